@@ -2,28 +2,100 @@
 #define ADDRESSING_MODES_HPP
 
 #include <cstdint>
+#include "../include/cpu.hpp"
+#include "../include/memory.hpp"
 
-class CPU;
-class Memory;
-
+// Addressing-mode policies for the instruction templates in instructions.cpp.
+// Each one resolves the effective address from the decoded operand; the
+// indexed modes also report whether indexing crossed a page, which costs read
+// instructions an extra cycle. Everything is inline so a composed handler
+// compiles down to straight-line code.
 class AddressingModes
 {
 public:
-    static uint16_t absolute(CPU *cpu, Memory *memory);
-    static uint16_t absolute_x(CPU *cpu, Memory *memory, bool *page_crossed);
-    static uint16_t absolute_y(CPU *cpu, Memory *memory, bool *page_crossed);
-    static uint8_t immediate(CPU *cpu, Memory *memory);
-    static uint16_t indirect(CPU *cpu, Memory *memory);
-    static uint16_t indirect_x(CPU *cpu, Memory *memory);
-    static uint16_t indirect_y(CPU *cpu, Memory *memory, bool *page_crossed);
-    static int8_t relative(CPU *cpu, Memory *memory);
-    static uint8_t zero_page(CPU *cpu, Memory *memory);
-    static uint8_t zero_page_x(CPU *cpu, Memory *memory);
-    static uint8_t zero_page_y(CPU *cpu, Memory *memory);
-    static uint8_t accumulator(CPU *cpu, Memory *memory);
-    static uint8_t implied(CPU *cpu, Memory *memory);
-
-private:
+    struct EffectiveAddress
+    {
+        uint16_t address;
+        bool page_crossed;
+    };
+
+    static EffectiveAddress indexed(uint16_t base, uint8_t index)
+    {
+        uint16_t addr = base + index;
+        return EffectiveAddress{ addr, ((base ^ addr) & 0xFF00) != 0 };
+    }
+
+    static uint16_t read_zero_page16(Memory *memory, uint8_t addr)
+    {
+        // Pointer high byte wraps within the zero page
+        return memory->read(addr) | (memory->read((uint8_t)(addr + 1)) << 8);
+    }
+
+    struct ZeroPage
+    {
+        static EffectiveAddress resolve(CPU *cpu, Memory *memory)
+        {
+            return EffectiveAddress{ (uint8_t)cpu->get_operand(), false };
+        }
+    };
+
+    struct ZeroPageX
+    {
+        static EffectiveAddress resolve(CPU *cpu, Memory *memory)
+        {
+            return EffectiveAddress{ (uint8_t)(cpu->get_operand() + cpu->get_X()), false };
+        }
+    };
+
+    struct ZeroPageY
+    {
+        static EffectiveAddress resolve(CPU *cpu, Memory *memory)
+        {
+            return EffectiveAddress{ (uint8_t)(cpu->get_operand() + cpu->get_Y()), false };
+        }
+    };
+
+    struct Absolute
+    {
+        static EffectiveAddress resolve(CPU *cpu, Memory *memory)
+        {
+            return EffectiveAddress{ cpu->get_operand(), false };
+        }
+    };
+
+    struct AbsoluteX
+    {
+        static EffectiveAddress resolve(CPU *cpu, Memory *memory)
+        {
+            return indexed(cpu->get_operand(), cpu->get_X());
+        }
+    };
+
+    struct AbsoluteY
+    {
+        static EffectiveAddress resolve(CPU *cpu, Memory *memory)
+        {
+            return indexed(cpu->get_operand(), cpu->get_Y());
+        }
+    };
+
+    struct IndirectX
+    {
+        static EffectiveAddress resolve(CPU *cpu, Memory *memory)
+        {
+            uint8_t ptr = cpu->get_operand() + cpu->get_X();
+            return EffectiveAddress{ read_zero_page16(memory, ptr), false };
+        }
+    };
+
+    struct IndirectY
+    {
+        static EffectiveAddress resolve(CPU *cpu, Memory *memory)
+        {
+            uint8_t ptr = cpu->get_operand();
+            return indexed(read_zero_page16(memory, ptr), cpu->get_Y());
+        }
+    };
 };
 
 #endif
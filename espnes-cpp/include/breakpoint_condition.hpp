@@ -0,0 +1,107 @@
+#ifndef BREAKPOINT_CONDITION_HPP
+#define BREAKPOINT_CONDITION_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Machine state a condition can refer to, filled in by whoever evaluates it
+enum ConditionVariable
+{
+    CONDITION_A,
+    CONDITION_X,
+    CONDITION_Y,
+    CONDITION_P,
+    CONDITION_SP,
+    CONDITION_PC,
+    CONDITION_CYCLES,
+    CONDITION_SCANLINE,
+    CONDITION_DOT,
+    CONDITION_FRAME,
+    CONDITION_ADDRESS,
+    CONDITION_VALUE,
+    CONDITION_VARIABLE_COUNT
+};
+
+// A breakpoint condition such as "A == $10 && scanline > 200", compiled once
+// to stack bytecode so checking it on a hit is a short loop with no parsing.
+// Supports the variables above by name (case-insensitive), $hex, 0xhex and
+// decimal numbers, ( ), ! and unary -, + -, == != < <= > >=, & |, && ||,
+// with C precedence.
+class BreakpointCondition
+{
+public:
+    BreakpointCondition();
+
+    bool compile(const std::string &source, std::string &error);
+    bool evaluate(const int64_t *variables) const;
+    bool is_empty() const;
+    const std::string &get_source() const;
+
+    static const int MAX_STACK = 16;
+
+private:
+    enum Op : uint8_t
+    {
+        OP_CONST,
+        OP_LOAD,
+        OP_NOT,
+        OP_NEGATE,
+        OP_ADD,
+        OP_SUBTRACT,
+        OP_BIT_AND,
+        OP_BIT_OR,
+        OP_EQUAL,
+        OP_NOT_EQUAL,
+        OP_LESS,
+        OP_LESS_EQUAL,
+        OP_GREATER,
+        OP_GREATER_EQUAL,
+        OP_AND,
+        OP_OR
+    };
+
+    // Recursive descent, one level per precedence
+    bool parse_or();
+    bool parse_and();
+    bool parse_bit_or();
+    bool parse_bit_and();
+    bool parse_equality();
+    bool parse_relational();
+    bool parse_additive();
+    bool parse_unary();
+    bool parse_primary();
+
+    bool nest();
+    bool match(const char *token);
+    void skip_spaces();
+    bool fail(const std::string &message);
+    void emit(Op op);
+    void emit(Op op, uint8_t operand);
+
+    std::string source;
+
+    // Ops, with a one-byte operand after OP_CONST (constant index) and
+    // OP_LOAD (variable)
+    std::vector<uint8_t> code;
+    std::vector<int64_t> constants;
+
+    // Compiler state
+    size_t position;
+    int depth;
+    int max_depth;
+    int nesting;
+    std::string error;
+};
+
+inline bool BreakpointCondition::is_empty() const
+{
+    return code.empty();
+}
+
+inline const std::string &BreakpointCondition::get_source() const
+{
+    return source;
+}
+
+#endif
\ No newline at end of file
@@ -1,7 +1,9 @@
 #ifndef BREAKPOINT_TYPES_H
 #define BREAKPOINT_TYPES_H
 
+#include <cstdint>
 #include <set>
+#include <string>
 
 // Breakpoint types
 typedef enum {
@@ -17,6 +19,9 @@ struct Breakpoint {
     breakpoint_type_t type;
     uint16_t address;
 
+    // Source of the condition that must also hold, empty for none
+    std::string condition;
+
     bool operator<(const Breakpoint& other) const {
         return address < other.address || (address == other.address && type < other.type);
     }
@@ -0,0 +1,76 @@
+#ifndef BREAKPOINTS_HPP
+#define BREAKPOINTS_HPP
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+#include "../include/breakpoint_types.hpp"
+#include "../include/breakpoint_condition.hpp"
+
+// The debugger's breakpoints, indexed for the emulation loop. Each type has
+// a bitmap over the 64K values it can match, so a check is one bit test no
+// matter how many are set, and conditions are only looked up on a hit.
+class Breakpoints
+{
+public:
+    Breakpoints();
+
+    bool add(breakpoint_type_t type, uint16_t value, const std::string &condition, std::string &error);
+    void remove(breakpoint_type_t type, uint16_t value);
+    void clear();
+    bool is_armed();
+    bool is_armed(breakpoint_type_t type);
+
+    // Whether any type checked between instructions is armed. Read and write
+    // breakpoints are caught by the bus and don't need stepping.
+    bool is_armed_per_instruction();
+    bool is_set(breakpoint_type_t type, int64_t value);
+    const BreakpointCondition *get_condition(breakpoint_type_t type, uint16_t value);
+    const std::set<Breakpoint> &get_all();
+
+    static const int TYPE_COUNT = BREAKPOINT_TYPE_EXECUTION + 1;
+
+private:
+    uint64_t bitmaps[TYPE_COUNT][0x10000 / 64];
+    int counts[TYPE_COUNT];
+
+    std::set<Breakpoint> breakpoints;
+
+    // Only breakpoints that have a condition
+    std::map<Breakpoint, BreakpointCondition> conditions;
+};
+
+inline bool Breakpoints::is_armed()
+{
+    return !breakpoints.empty();
+}
+
+inline bool Breakpoints::is_armed(breakpoint_type_t type)
+{
+    return counts[type] != 0;
+}
+
+inline bool Breakpoints::is_armed_per_instruction()
+{
+    return counts[BREAKPOINT_TYPE_ADDRESS] != 0 || counts[BREAKPOINT_TYPE_EXECUTION] != 0 ||
+        counts[BREAKPOINT_TYPE_CYCLE] != 0 || counts[BREAKPOINT_TYPE_SCANLINE] != 0;
+}
+
+inline bool Breakpoints::is_set(breakpoint_type_t type, int64_t value)
+{
+    // Values past 16 bits (late cycle counts) can't have a breakpoint
+    if (value < 0 || value > 0xFFFF)
+    {
+        return false;
+    }
+
+    return (bitmaps[type][value >> 6] >> (value & 63) & 1) != 0;
+}
+
+inline const std::set<Breakpoint> &Breakpoints::get_all()
+{
+    return breakpoints;
+}
+
+#endif
\ No newline at end of file
@@ -2,22 +2,77 @@
 #define CARTRIDGE_HPP
 
 #include <cstdint>
+#include <memory>
+#include <vector>
+#include "../include/machine_state.hpp"
+#include "../include/mapper.hpp"
+#include "../include/rom_image.hpp"
 
+// ROM and RAM on the cartridge, and the mapper that banks them in. ROM is
+// read in place from a shared RomImage and PRG RAM lives in the emulator's
+// MachineState, so only CHR-RAM belongs to the cartridge. Without a ROM loaded it is an empty NROM board with CHR-RAM.
 class Cartridge
 {
 public:
-    Cartridge();
+    Cartridge(MachineState *machine);
     ~Cartridge();
 
-    void load(uint8_t *rom, uint32_t size);
+    bool load(const std::shared_ptr<RomImage> &image);
     uint8_t read(uint16_t address);
-    void write(uint16_t address, uint8_t value);
-    void switchBank(uint16_t bank);
+    int write(uint16_t address, uint8_t value);
+    const uint8_t *get_page(uint16_t address);
+    uint8_t *get_ram_page(uint16_t address);
+    uint8_t read_chr(uint16_t address);
+    void write_chr(uint16_t address, uint8_t value);
+    const uint8_t *get_chr_window(int window);
+    MirroringType get_mirroring();
+    void clock_scanline();
+    bool get_irq();
+    int get_scanlines_to_irq();
+    int get_mapper_number();
+    uint32_t get_prg_crc();
+    uint32_t get_rom_hash();
+    void save_state(StateWriter &state);
+    void load_state(StateReader &state);
 
 private:
-    uint8_t *rom;
-    uint16_t currentBank;
-    static const uint16_t BANK_SIZE = 0x4000; // 16KB
+    std::shared_ptr<RomImage> image;
+    std::vector<uint8_t> chr_ram;
+
+    // In the emulator's MachineState
+    uint8_t *prg_ram;
+
+    Mapper *mapper;
 };
 
-#endif
+inline uint8_t *Cartridge::get_ram_page(uint16_t address)
+{
+    return &prg_ram[(address - 0x6000) & 0x1F00];
+}
+
+inline uint8_t Cartridge::read_chr(uint16_t address)
+{
+    return mapper->read_chr(address);
+}
+
+inline void Cartridge::write_chr(uint16_t address, uint8_t value)
+{
+    mapper->write_chr(address, value);
+}
+
+inline const uint8_t *Cartridge::get_chr_window(int window)
+{
+    return mapper->get_chr_window(window);
+}
+
+inline MirroringType Cartridge::get_mirroring()
+{
+    return mapper->get_mirroring();
+}
+
+inline bool Cartridge::get_irq()
+{
+    return mapper->get_irq();
+}
+
+#endif
\ No newline at end of file
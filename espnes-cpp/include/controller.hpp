@@ -2,13 +2,22 @@
 #define CONTROLLER_HPP
 
 #include <cstdint>
+#include "save_state.hpp"
 
 class Controller
 {
 public:
+	Controller();
+
+	// Buttons held on pad 0 or 1, bits 0-7 in the order they are read out:
+	// A, B, Select, Start, Up, Down, Left, Right
+	void set_buttons(int port, uint8_t buttons);
+
 	void write_controller_1(uint8_t value);
 	uint8_t read_controller_1();
 	uint8_t read_controller_2();
+	void save_state(StateWriter &state);
+	void load_state(StateReader &state);
 
 	private:
 		uint8_t controller_1;
@@ -5,26 +5,37 @@
 #include <cstdint>
 #include "../include/memory.hpp"
 #include "../include/instructions.hpp"
+#include "../include/decode_cache.hpp"
 #include "../include/interrupt_type.hpp"
 #include "../include/cpu_helpers.hpp"
 #include "../include/debug/disassembler.hpp"
+#include "../include/machine_state.hpp"
 
+// Define CPU_SWITCH_CORE to build the fused switch interpreter (src/cpu_core.cpp)
+// instead of dispatching through Instructions::ins_table
 class Interrupt;
+class RecompiledCode;
 
 class CPU
 {
 public:
-    CPU(Memory *memory);
+    CPU(MachineState *machine, Memory *memory);
     ~CPU();
 
     void add_cycles(int cycles);
-    int get_cycles();
-    long get_total_cycles();
+    int64_t get_total_cycles();
+    int64_t get_total_instructions();
+    int get_block_cycles();
     int run();
+    int run_block(int max_cycles);
     void set_interrupt(InterruptType type);
+    InterruptType get_interrupt();
+    void set_irq_line(bool asserted);
+    bool is_interrupt_pending();
     uint8_t fetch_opcode();
     void reset();
-    uint8_t fetch_next_opcode_cycles();
+    void flush_decode_cache();
+    void set_recompiled_code(RecompiledCode *recompiled_code);
 
     // Getters
     uint16_t get_PC();
@@ -34,6 +45,7 @@ public:
     uint8_t get_Y();
     uint8_t get_P();
     uint8_t get_current_opcode();
+    uint16_t get_operand();
 
     // Setters
     void set_PC(uint16_t value);
@@ -44,6 +56,7 @@ public:
     void set_P(uint8_t value);
     void set_Z(bool value);
     void set_N(bool value);
+    void set_NZ(uint8_t result);
     void set_C(bool value);
     void set_I(bool value);
     void set_D(bool value);
@@ -76,8 +89,13 @@ public:
     static const int IRQ_VECTOR = 0xFFFE;
 
 private:
-    long total_cycles;
-    Instructions::InstructionFunction ins_table[256];
+    uint8_t step_instruction();
+    uint8_t execute();
+    void materialize_NZ();
+
+    // Cycles run_block() has executed so far and not yet returned, so
+    // anything the CPU touches mid-block can tell how far in it is
+    int block_cycles;
     uint8_t opcode_cycles[256] = {
         6, 6, 2, 8, 3, 3, 5, 5, 3, 2, 2, 2, 4, 4, 6, 6, // 0x00
         2, 5, 2, 8, 4, 4, 6, 6, 2, 4, 2, 7, 4, 4, 7, 7, // 0x10
@@ -89,24 +107,23 @@ private:
         2, 5, 2, 8, 4, 4, 6, 6, 2, 4, 2, 7, 4, 4, 7, 7, // 0x70
         2, 6, 2, 6, 3, 3, 3, 3, 2, 2, 2, 2, 4, 4, 4, 4, // 0x80
         2, 6, 2, 6, 4, 4, 4, 4, 2, 5, 2, 5, 5, 5, 5, 5, // 0x90
-        2, 6, 2, 6, 3, 3, 5, 5, 2, 2, 2, 2, 4, 4, 6, 6, // 0xA0
+        2, 6, 2, 6, 3, 3, 3, 3, 2, 2, 2, 2, 4, 4, 4, 4, // 0xA0
         2, 5, 2, 5, 4, 4, 4, 4, 2, 4, 2, 4, 4, 4, 4, 4, // 0xB0
-        2, 6, 2, 8, 3, 3, 3, 3, 2, 2, 2, 2, 4, 4, 6, 6, // 0xC0
-        2, 5, 2, 8, 4, 4, 4, 4, 2, 4, 2, 7, 4, 4, 7, 7, // 0xD0
+        2, 6, 2, 8, 3, 3, 5, 5, 2, 2, 2, 2, 4, 4, 6, 6, // 0xC0
+        2, 5, 2, 8, 4, 4, 6, 6, 2, 4, 2, 7, 4, 4, 7, 7, // 0xD0
         2, 6, 2, 8, 3, 3, 5, 5, 2, 2, 2, 2, 4, 4, 6, 6, // 0xE0
         2, 5, 2, 8, 4, 4, 6, 6, 2, 4, 2, 7, 4, 4, 7, 7  // 0xF0
     };
 
-    // Registers
-    uint16_t PC; // Program Counter
-    uint8_t SP;  // Stack Pointer
-    uint8_t A;   // Accumulator
-    uint8_t X;   // Index Register X
-    uint8_t Y;   // Index Register Y
-    uint8_t P;   // Processor Status
+    // Registers, flags and interrupt lines, in the emulator's MachineState
+    CpuState *state;
+
+    // Operand of the instruction being executed, fetched with the opcode
+    uint16_t operand;
+    DecodeCache decode_cache;
 
-    // Interrupts
-    InterruptType interrupt;
+    // Ahead-of-time compiled PRG-ROM blocks, if the ROM has any
+    RecompiledCode *recompiled_code;
 
     // Memory
     Memory *memory;
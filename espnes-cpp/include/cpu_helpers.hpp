@@ -4,7 +4,6 @@
 #include <cstdint>
 #include "../include/cpu.hpp"
 #include "../include/memory.hpp"
-#include "../include/addressing_modes.hpp"
 #include <iomanip>
 #include <fstream>
 
@@ -18,6 +17,8 @@ public:
     static void check_for_illegal_opcode(uint8_t opcode);
     static void log_cpu_status(CPU *cpu, Memory *memory, uint8_t opcode);
     static uint16_t adc(uint8_t op1, uint8_t op2, uint8_t carry);
+    static void add_with_carry(CPU *cpu, uint8_t value);
+    static void subtract_with_carry(CPU *cpu, uint8_t value);
 };
 
 #endif
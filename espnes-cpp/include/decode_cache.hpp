@@ -0,0 +1,73 @@
+#ifndef DECODE_CACHE_HPP
+#define DECODE_CACHE_HPP
+
+#include <cstdint>
+#include "../include/memory.hpp"
+#include "../include/instructions.hpp"
+
+// Predecoded instructions for code running out of PRG-ROM. Entries are indexed
+// by PC and tagged with the host address of the opcode byte, which identifies
+// the (bank, PC) pair: a bank switch remaps the page to different storage and
+// the stale entry simply stops matching. Code in RAM or I/O space is decoded
+// through the bus on every fetch, so writes never have to invalidate anything.
+// Both interpreter cores fetch through it, and block dispatch uses it to find
+// idle loops.
+class DecodeCache
+{
+public:
+    struct Entry
+    {
+        const uint8_t *source;
+        uint16_t operand;
+        uint8_t opcode;
+        uint8_t length;
+        int8_t idle_loop; // -1 until is_idle_loop() has looked at it
+    };
+
+    DecodeCache();
+    ~DecodeCache();
+
+    const Entry &fetch(Memory *memory, uint16_t pc);
+    bool is_idle_loop(Memory *memory, uint16_t pc);
+    void flush();
+
+private:
+    void decode(Memory *memory, uint16_t pc, Entry &entry);
+    bool match_idle_loop(Memory *memory, uint16_t pc);
+
+    Entry *entries;
+    Entry uncached;
+
+    static const int ENTRY_COUNT = 0x8000; // One per PRG-ROM address
+};
+
+inline const DecodeCache::Entry &DecodeCache::fetch(Memory *memory, uint16_t pc)
+{
+    const uint8_t *page = memory->get_read_page(pc >> 8);
+
+    if (pc >= 0x8000 && page != nullptr)
+    {
+        Entry &entry = entries[pc & 0x7FFF];
+        if (entry.source == page + (pc & 0xFF))
+        {
+            return entry;
+        }
+
+        // Instructions that run into the next 8KB window could straddle two
+        // banks, so those are never cached
+        decode(memory, pc, entry);
+        if (((pc ^ (pc + entry.length - 1)) & 0xE000) == 0)
+        {
+            entry.source = page + (pc & 0xFF);
+            return entry;
+        }
+
+        entry.source = nullptr;
+        return entry;
+    }
+
+    decode(memory, pc, uncached);
+    return uncached;
+}
+
+#endif
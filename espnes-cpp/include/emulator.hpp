@@ -2,69 +2,143 @@
 #define EMULATOR_HPP
 
 #include <string>
-#include "window.hpp"
+#include "machine_state.hpp"
 #include "cpu.hpp"
 #include "memory.hpp"
+#include "recompiled_code.hpp"
 #include "cartridge.hpp"
 #include "debug/debug.hpp"
 #include "debug/disassembler.hpp"
 #include "controller.hpp"
 #include "apu.hpp"
 #include "ppu.hpp"
+#include "scheduler.hpp"
+#include "run_stats.hpp"
+#include "tracer.hpp"
 #include <functional>
 #include <chrono>
 #include <iostream>
 #include <vector>
 #include "../include/breakpoint_types.hpp"
+#include "../include/breakpoints.hpp"
+#include "../include/rewind_buffer.hpp"
+
+class Window;
 
 class Emulator
 {
 public:
-    Emulator();
+    // A headless emulator has no window or debug UI and runs unthrottled.
+    // Builds defining ESPNES_HEADLESS leave out SDL and ImGui entirely and
+    // are always headless.
+    Emulator(bool headless = false);
     ~Emulator();
 
-    void set_dma_triggered(bool dma_triggered);
+    // Keeps MachineState's alignment on the heap, which plain new doesn't
+    // guarantee before C++17
+    static void *operator new(size_t size);
+    static void operator delete(void *pointer);
+
+    void schedule_dma();
     void set_PC_to_reset_vector();
     void load_rom(const std::string &romPath);
+    void load_rom(const std::shared_ptr<RomImage> &image);
+
+    // Snapshots of the whole machine for the loaded ROM, into and out of a
+    // caller's buffer. Saving returns the bytes written, or 0 if the buffer
+    // is smaller than get_state_size(). Loading refuses states from another
+    // ROM or format version and leaves the machine untouched.
+    size_t get_state_size();
+    size_t save_state(uint8_t *buffer, size_t size);
+    bool load_state(const uint8_t *buffer, size_t size);
+
+    // Rewind history: a state every interval frames, in capacity bytes of
+    // deltas. rewind() goes back that many captures and drops the history
+    // after them.
+    void enable_rewind(size_t capacity, int interval);
+    void disable_rewind();
+    bool rewind(int steps);
+    int get_rewind_interval();
+    RewindBuffer *get_rewind_buffer();
+
     void run();
+    void run_cycles(long cycles);
+    RunStats run_frames(int frames);
+    RunStats run_until_vblank();
+    void stop();
     void step();
     void pause();
     void reset();
     bool is_paused();
-    void log_cpu();
+    bool is_headless();
     void clear_breakpoint(breakpoint_type_t type, uint16_t value);
     void clear_all_breakpoints();
-    bool is_breakpoint(breakpoint_type_t type, long value);
+    bool is_breakpoint(breakpoint_type_t type, int64_t value);
     void check_for_breakpoints();
-    void open_log_file();
-    void close_log_file();
+    void check_memory_breakpoint(breakpoint_type_t type, uint16_t address, uint8_t value);
+    bool start_trace(const std::string &path);
+    void stop_trace();
+    bool is_tracing();
     std::set<Breakpoint> get_breakpoints();
     std::set<Breakpoint> get_breakpoints_of_type(breakpoint_type_t type);
 
     void add_breakpoint(breakpoint_type_t type, uint16_t value);
+    bool add_breakpoint(breakpoint_type_t type, uint16_t value, const std::string &condition, std::string &error);
 
     uint16_t get_PC();
     CPU *get_CPU();
     PPU *get_PPU();
+    Cartridge *get_cartridge();
     Memory *get_memory();
+    RecompiledCode *get_recompiled_code();
+    uint8_t *get_frame_buffer();
+    const uint8_t *get_frame_indices();
+    const uint8_t *get_frame_emphasis();
+    uint8_t *get_ram();
+    void set_buttons(int port, uint8_t buttons);
     Disassembler get_disassembler();
 
 private:
-    std::ofstream log_file;
-    std::set<Breakpoint> breakpoints;
-    Window window;
+    void update_memory_watches();
+    void break_execution();
+    bool hit_breakpoint(breakpoint_type_t type, int64_t value, uint16_t address, uint8_t data);
+    void run_dma();
+    void run_events();
+    int run_block(int max_cycles);
+    int run_slice(int max_cycles);
+    void trace_instruction();
+    void write_state(StateWriter &state);
+    void capture_rewind();
+
+    // All of the console's mutable state, which the components below point
+    // into, so it has to be constructed first
+    MachineState machine;
+
+    Tracer tracer;
+    Breakpoints breakpoints;
+    // nullptr when headless
+    Window *window;
+    Scheduler scheduler;
     CPU cpu;
     Cartridge cartridge;
     Memory memory;
+    RecompiledCode recompiled_code;
     PPU ppu;
     APU apu;
     Controller controller;
     Disassembler disassembler;
 
-    bool dma_triggered;
     bool quit;
     bool paused;
+
+    // Set when vblank starts, frames are counted from one to the next
+    bool frame_ended;
     uint16_t reset_vector;
+
+    RewindBuffer rewind_buffer;
+    std::vector<uint8_t> rewind_state;
+    int rewind_interval;
+    int frames_to_capture;
 };
 
 #endif
\ No newline at end of file
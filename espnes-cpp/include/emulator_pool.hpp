@@ -0,0 +1,133 @@
+#ifndef EMULATOR_POOL_HPP
+#define EMULATOR_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../include/emulator.hpp"
+
+// What step() copies out of each instance
+enum PoolObservation
+{
+    POOL_OBSERVE_FRAME = 1,
+    POOL_OBSERVE_RAM = 2,
+
+    // Palette indices, a byte per pixel, without converting to colours
+    POOL_OBSERVE_INDICES = 4
+};
+
+// A batch of headless emulators running one ROM, for search and training
+// workloads that want many copies of a game stepped in lockstep. The ROM is
+// mapped once and shared by every instance.
+//
+// step() takes one input byte per pad per instance and runs every instance
+// the same number of frames on a pool of threads, then leaves frame buffers,
+// palette index frames and RAM for the whole batch in contiguous arrays,
+// instance after instance. Each thread starts on its own slice of the batch and steals from
+// the others' once it runs out, so a few slow instances don't hold up the
+// rest.
+class EmulatorPool
+{
+public:
+    // threads 0 uses one per hardware thread. The calling thread works too.
+    EmulatorPool(int size, int threads = 0, int observations = POOL_OBSERVE_FRAME | POOL_OBSERVE_RAM);
+    ~EmulatorPool();
+
+    // Loads into every instance and resets them, throws like
+    // Emulator::load_rom()
+    void load_rom(const std::string &path);
+    void load_rom(const std::shared_ptr<RomImage> &image);
+
+    // Puts every instance back to the state it was in right after
+    // load_rom(): registers, RAM, mapper banks and all
+    void reset();
+
+    // inputs holds 2 * size bytes, pad 0 and pad 1 of each instance (see
+    // Controller::set_buttons), or nullptr to leave them as they were
+    void step(const uint8_t *inputs, int frames = 1);
+
+    int get_size();
+    Emulator *get_emulator(int index);
+
+    // FRAME_SIZE, INDEX_FRAME_SIZE or RAM_SIZE bytes per instance, from the
+    // last step()
+    const uint8_t *get_frames();
+    const uint8_t *get_frame_indices();
+    const uint8_t *get_ram();
+
+    static const int FRAME_SIZE = 256 * 240 * 4;
+    static const int INDEX_FRAME_SIZE = 256 * 240;
+    static const int RAM_SIZE = 0x800;
+
+private:
+    // A contiguous run of instances claimed one at a time, by its owner and
+    // by threads stealing from it
+    struct Slice
+    {
+        std::atomic<int> next;
+        int end;
+    };
+
+    void save_power_on_state();
+    void work(int worker);
+    void run_worker(int worker);
+    void step_instance(int index);
+
+    std::vector<std::unique_ptr<Emulator>> emulators;
+    int observations;
+
+    // Saved from the first instance once the ROM is loaded, what reset()
+    // loads back into all of them
+    std::vector<uint8_t> power_on_state;
+    std::vector<uint8_t> frames;
+    std::vector<uint8_t> indices;
+    std::vector<uint8_t> ram;
+
+    // The current step's arguments
+    const uint8_t *inputs;
+    int frames_per_step;
+
+    std::vector<Slice> slices;
+    std::vector<std::thread> threads;
+
+    // Threads sleep until generation moves on, the last one to finish wakes
+    // the caller
+    std::mutex mutex;
+    std::condition_variable start;
+    std::condition_variable done;
+    uint64_t generation;
+    int busy;
+    bool quit;
+};
+
+inline int EmulatorPool::get_size()
+{
+    return (int)emulators.size();
+}
+
+inline Emulator *EmulatorPool::get_emulator(int index)
+{
+    return emulators[index].get();
+}
+
+inline const uint8_t *EmulatorPool::get_frames()
+{
+    return frames.data();
+}
+
+inline const uint8_t *EmulatorPool::get_frame_indices()
+{
+    return indices.data();
+}
+
+inline const uint8_t *EmulatorPool::get_ram()
+{
+    return ram.data();
+}
+
+#endif
\ No newline at end of file
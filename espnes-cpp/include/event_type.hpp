@@ -0,0 +1,17 @@
+#ifndef EVENT_TYPE_HPP
+#define EVENT_TYPE_HPP
+
+// Things that happen at a fixed point on the master clock. When two events
+// fall on the same dot they fire in this order.
+enum EventType
+{
+    EVENT_FRAME_END,
+    EVENT_VBLANK,
+    EVENT_NMI,
+    EVENT_MAPPER_IRQ,
+    EVENT_SPRITE0_HIT,
+    EVENT_DMA,
+    EVENT_TYPE_COUNT
+};
+
+#endif
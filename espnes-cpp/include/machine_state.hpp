@@ -0,0 +1,82 @@
+#ifndef MACHINE_STATE_HPP
+#define MACHINE_STATE_HPP
+
+#include <cstdint>
+#include "../include/interrupt_type.hpp"
+
+// Everything in the console that changes as it runs, in one block the
+// emulator owns and the CPU, memory, PPU and cartridge point into. It holds
+// no pointers, so copying it copies the machine.
+//
+// Fields are ordered by how hot they are: CPU registers, which every
+// instruction touches, then the PPU's, then the RAMs.
+
+struct CpuState
+{
+    uint16_t PC; // Program Counter
+    uint8_t SP;  // Stack Pointer
+    uint8_t A;   // Accumulator
+    uint8_t X;   // Index Register X
+    uint8_t Y;   // Index Register Y
+    uint8_t P;   // Processor Status
+
+    // N and Z are evaluated lazily: while nz_pending is set, the N/Z bits in
+    // P are stale and come from the last result byte instead. get_P() and the
+    // flag getters/setters fold it back in, so callers never see the difference.
+    uint8_t nz_result;
+    bool nz_pending;
+
+    // Level-triggered IRQ input from the cartridge, taken while I is clear
+    bool irq_line;
+    InterruptType interrupt;
+    int64_t total_cycles;
+    int64_t total_instructions;
+};
+
+struct PpuState
+{
+    uint8_t control;
+    uint8_t mask;
+    uint8_t status;
+    uint8_t prev_read;
+    uint8_t oam_address;
+    uint8_t oam_data;
+    uint8_t data;
+    uint8_t oam_dma;
+    uint8_t NMI_occurred;
+    uint8_t frame;
+
+    // Scroll and address registers, v/t/x/w in loopy's naming. Both
+    // addresses are laid out yyy NN YYYYY XXXXX: fine Y, nametable, coarse
+    // Y, coarse X. While rendering, vram_address is where the next line's
+    // first tile is fetched from.
+    uint16_t vram_address;
+    uint16_t temp_address;
+    uint8_t fine_x;
+    uint8_t write_toggle;
+    int cycles;
+    int scanline;
+    int64_t total_cycles;
+
+    // Master clock time the PPU has been stepped up to
+    int64_t synced_time;
+};
+
+struct alignas(64) MachineState
+{
+    CpuState cpu;
+    PpuState ppu;
+
+    // Work RAM, the stack in page 1 included
+    alignas(64) uint8_t ram[0x800];
+
+    // Nametable RAM, 2KB on the board and 4KB with four-screen cartridges
+    uint8_t vram[0x1000];
+    uint8_t oam[0x100];
+    uint8_t palette[0x40];
+
+    // PRG RAM at $6000-$7FFF
+    uint8_t prg_ram[0x2000];
+};
+
+#endif
\ No newline at end of file
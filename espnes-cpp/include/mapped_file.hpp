@@ -0,0 +1,41 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// A whole file mapped read-only into memory. The OS pages it in as it is
+// read, so large files cost no up-front copy.
+class MappedFile
+{
+public:
+    MappedFile();
+    ~MappedFile();
+
+    bool open(const std::string &path);
+    void close();
+    const uint8_t *get_data();
+    size_t get_size();
+
+private:
+    const uint8_t *data;
+    size_t size;
+
+#ifdef _WIN32
+    void *file;
+    void *mapping;
+#endif
+};
+
+inline const uint8_t *MappedFile::get_data()
+{
+    return data;
+}
+
+inline size_t MappedFile::get_size()
+{
+    return size;
+}
+
+#endif
\ No newline at end of file
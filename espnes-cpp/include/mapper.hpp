@@ -0,0 +1,107 @@
+#ifndef MAPPER_HPP
+#define MAPPER_HPP
+
+#include <cstdint>
+#include "../include/mirroring_type.hpp"
+#include "../include/save_state.hpp"
+
+// What a register write changed, for whoever caches the mapper's state
+static const int MAPPER_PRG_CHANGED = 0x01;
+static const int MAPPER_MIRRORING_CHANGED = 0x02;
+static const int MAPPER_IRQ_CHANGED = 0x04;
+static const int MAPPER_CHR_CHANGED = 0x08;
+
+// Cartridge bank switching. PRG-ROM is seen through four 8KB windows at
+// $8000-$FFFF and CHR through eight 1KB windows at $0000-$1FFF, each a host
+// pointer into the ROM data. Switching a bank only repoints a window, so
+// reads never do bank arithmetic. Subclasses decode their registers and call
+// the map_* helpers.
+class Mapper
+{
+public:
+    Mapper(const uint8_t *prg, uint32_t prg_size, const uint8_t *chr, uint32_t chr_size, bool chr_ram, MirroringType mirroring);
+    virtual ~Mapper();
+
+    static Mapper *create(int number, const uint8_t *prg, uint32_t prg_size, const uint8_t *chr, uint32_t chr_size, bool chr_ram, MirroringType mirroring);
+
+    virtual void reset();
+    virtual int write(uint16_t address, uint8_t value);
+
+    // PPU A12 rising edges, once per rendered scanline. Mappers that count
+    // them say how many more it takes to raise an IRQ, or -1 for never.
+    virtual void clock_scanline();
+    virtual int get_scanlines_to_irq();
+
+    // The base class saves the windows and mirroring; subclasses add the
+    // registers that decide future switches
+    virtual void save_state(StateWriter &state);
+    virtual void load_state(StateReader &state);
+
+    const uint8_t *get_prg_page(uint16_t address);
+    uint8_t read_chr(uint16_t address);
+    void write_chr(uint16_t address, uint8_t value);
+    const uint8_t *get_chr_window(int window);
+    MirroringType get_mirroring();
+    bool get_irq();
+
+protected:
+    // Negative banks count from the end, -1 is the last one
+    void map_prg_8k(int window, int bank);
+    void map_prg_16k(int window, int bank);
+    void map_prg_32k(int bank);
+    void map_chr_1k(int window, int bank);
+    void map_chr_2k(int window, int bank);
+    void map_chr_4k(int window, int bank);
+    void map_chr_8k(int bank);
+
+    const uint8_t *prg;
+    uint32_t prg_size;
+    const uint8_t *chr;
+    uint32_t chr_size;
+    bool chr_ram;
+    MirroringType mirroring;
+    bool irq;
+
+private:
+    static const uint32_t NO_WINDOW = 0xFFFFFFFF;
+
+    const uint8_t *prg_windows[4];
+    const uint8_t *chr_windows[8];
+};
+
+inline const uint8_t *Mapper::get_prg_page(uint16_t address)
+{
+    const uint8_t *window = prg_windows[(address >> 13) & 3];
+    return window != nullptr ? window + (address & 0x1F00) : nullptr;
+}
+
+inline uint8_t Mapper::read_chr(uint16_t address)
+{
+    return chr_windows[(address >> 10) & 7][address & 0x3FF];
+}
+
+inline void Mapper::write_chr(uint16_t address, uint8_t value)
+{
+    // CHR-RAM is the cartridge's own buffer, only CHR-ROM is really read-only
+    if (chr_ram)
+    {
+        const_cast<uint8_t *>(chr_windows[(address >> 10) & 7])[address & 0x3FF] = value;
+    }
+}
+
+inline const uint8_t *Mapper::get_chr_window(int window)
+{
+    return chr_windows[window];
+}
+
+inline MirroringType Mapper::get_mirroring()
+{
+    return mirroring;
+}
+
+inline bool Mapper::get_irq()
+{
+    return irq;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,15 @@
+#ifndef CNROM_HPP
+#define CNROM_HPP
+
+#include "../mapper.hpp"
+
+// Mapper 3: fixed PRG and a switchable 8KB CHR bank
+class CNROM : public Mapper
+{
+public:
+    CNROM(const uint8_t *prg, uint32_t prg_size, const uint8_t *chr, uint32_t chr_size, bool chr_ram, MirroringType mirroring);
+
+    int write(uint16_t address, uint8_t value) override;
+};
+
+#endif
\ No newline at end of file
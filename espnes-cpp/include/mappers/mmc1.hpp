@@ -0,0 +1,28 @@
+#ifndef MMC1_HPP
+#define MMC1_HPP
+
+#include "../mapper.hpp"
+
+// Mapper 1: registers loaded one bit per write through a 5-bit shift
+// register. Switches 16KB or 32KB of PRG, 4KB or 8KB of CHR and mirroring.
+class MMC1 : public Mapper
+{
+public:
+    MMC1(const uint8_t *prg, uint32_t prg_size, const uint8_t *chr, uint32_t chr_size, bool chr_ram, MirroringType mirroring);
+
+    void reset() override;
+    int write(uint16_t address, uint8_t value) override;
+    void save_state(StateWriter &state) override;
+    void load_state(StateReader &state) override;
+
+private:
+    int update_banks();
+
+    uint8_t shift;
+    uint8_t control;
+    uint8_t chr_bank_0;
+    uint8_t chr_bank_1;
+    uint8_t prg_bank;
+};
+
+#endif
\ No newline at end of file
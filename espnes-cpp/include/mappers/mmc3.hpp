@@ -0,0 +1,32 @@
+#ifndef MMC3_HPP
+#define MMC3_HPP
+
+#include "../mapper.hpp"
+
+// Mapper 4: 8KB PRG and 1KB/2KB CHR banking through eight bank registers,
+// and a scanline counter clocked by PPU A12 that raises an IRQ at zero.
+class MMC3 : public Mapper
+{
+public:
+    MMC3(const uint8_t *prg, uint32_t prg_size, const uint8_t *chr, uint32_t chr_size, bool chr_ram, MirroringType mirroring);
+
+    void reset() override;
+    int write(uint16_t address, uint8_t value) override;
+    void clock_scanline() override;
+    int get_scanlines_to_irq() override;
+    void save_state(StateWriter &state) override;
+    void load_state(StateReader &state) override;
+
+private:
+    void update_banks();
+
+    uint8_t bank_select;
+    uint8_t banks[8];
+    uint8_t irq_latch;
+    uint8_t irq_counter;
+    bool irq_reload;
+    bool irq_enabled;
+    bool four_screen;
+};
+
+#endif
\ No newline at end of file
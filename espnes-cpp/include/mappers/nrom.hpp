@@ -0,0 +1,13 @@
+#ifndef NROM_HPP
+#define NROM_HPP
+
+#include "../mapper.hpp"
+
+// Mapper 0: 16KB or 32KB of PRG and 8KB of CHR, no registers
+class NROM : public Mapper
+{
+public:
+    NROM(const uint8_t *prg, uint32_t prg_size, const uint8_t *chr, uint32_t chr_size, bool chr_ram, MirroringType mirroring);
+};
+
+#endif
\ No newline at end of file
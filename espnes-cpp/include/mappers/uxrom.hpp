@@ -0,0 +1,16 @@
+#ifndef UXROM_HPP
+#define UXROM_HPP
+
+#include "../mapper.hpp"
+
+// Mapper 2: a switchable 16KB PRG bank at $8000 and the last bank fixed at
+// $C000. CHR is normally 8KB of RAM.
+class UxROM : public Mapper
+{
+public:
+    UxROM(const uint8_t *prg, uint32_t prg_size, const uint8_t *chr, uint32_t chr_size, bool chr_ram, MirroringType mirroring);
+
+    int write(uint16_t address, uint8_t value) override;
+};
+
+#endif
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include "controller.hpp"
 #include "cartridge.hpp"
 #include "debug/debug.hpp"
+#include "machine_state.hpp"
 #include <string>
 
 class Emulator;
@@ -15,18 +16,40 @@ class Emulator;
 class Memory
 {
 public:
-    Memory(PPU *ppu, APU *apu, Cartridge *cartridge, Controller *controller);
+    Memory(MachineState *machine, PPU *ppu, APU *apu, Cartridge *cartridge, Controller *controller);
     ~Memory();
 
     uint8_t read(uint16_t address, bool resetStatus = true);
     void write(uint16_t address, uint8_t value);
-    void load(uint8_t *rom, uint32_t size);
     void set_emulator(Emulator *emulator);
+    void map_pages();
+    void unmap_read_page(uint8_t page);
+    void unmap_write_page(uint8_t page);
+    const uint8_t *get_read_page(uint8_t page);
+    const uint8_t *const *get_read_pages();
+    uint8_t *const *get_write_pages();
+    uint8_t *get_ram();
+    bool get_io_access();
+    void reset_io_access();
 
 private:
-    uint8_t *memory;
+    uint8_t read_io(uint16_t address, bool resetStatus);
+    uint8_t read_device(uint16_t address, bool resetStatus);
+    void map_prg_pages();
+    void write_io(uint16_t address, uint8_t value);
+
+    // In the emulator's MachineState
     uint8_t *ram;
-    uint8_t *stack;
+
+    // One host pointer per 256-byte page; nullptr sends the access through read_io/write_io
+    const uint8_t *read_pages[256];
+    uint8_t *write_pages[256];
+
+    // PRG pages kept unmapped through bank switches for read breakpoints
+    bool read_watched[256];
+
+    // Set whenever an access falls through to read_io/write_io
+    bool io_access;
 
     PPU *ppu;
     APU *apu;
@@ -35,4 +58,57 @@ private:
     Emulator *emulator;
 };
 
+inline uint8_t Memory::read(uint16_t address, bool resetStatus)
+{
+    const uint8_t *page = read_pages[address >> 8];
+    if (page != nullptr)
+    {
+        return page[address & 0xFF];
+    }
+
+    return read_io(address, resetStatus);
+}
+
+inline const uint8_t *Memory::get_read_page(uint8_t page)
+{
+    return read_pages[page];
+}
+
+inline const uint8_t *const *Memory::get_read_pages()
+{
+    return read_pages;
+}
+
+inline uint8_t *const *Memory::get_write_pages()
+{
+    return write_pages;
+}
+
+inline uint8_t *Memory::get_ram()
+{
+    return ram;
+}
+
+inline bool Memory::get_io_access()
+{
+    return io_access;
+}
+
+inline void Memory::reset_io_access()
+{
+    io_access = false;
+}
+
+inline void Memory::write(uint16_t address, uint8_t value)
+{
+    uint8_t *page = write_pages[address >> 8];
+    if (page != nullptr)
+    {
+        page[address & 0xFF] = value;
+        return;
+    }
+
+    write_io(address, value);
+}
+
 #endif
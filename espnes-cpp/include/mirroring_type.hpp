@@ -0,0 +1,14 @@
+#ifndef MIRRORING_TYPE_HPP
+#define MIRRORING_TYPE_HPP
+
+// How the four 1KB nametables at $2000-$2FFF map onto nametable RAM
+enum MirroringType
+{
+    MIRRORING_HORIZONTAL,
+    MIRRORING_VERTICAL,
+    MIRRORING_SINGLE_LOWER,
+    MIRRORING_SINGLE_UPPER,
+    MIRRORING_FOUR_SCREEN
+};
+
+#endif
\ No newline at end of file
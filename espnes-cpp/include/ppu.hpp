@@ -6,72 +6,86 @@
 #include "../include/debug/debug.hpp"
 #include <string>
 #include "../include/interrupt_type.hpp"
+#include "../include/scheduler.hpp"
+#include "../include/machine_state.hpp"
 #include <vector>
 
 class CPU;
+class Cartridge;
 
 class PPU
 {
 public:
-    PPU();
+    PPU(MachineState *machine);
     ~PPU();
 
     typedef void (*InterruptCallback)();
 
     uint8_t read(uint16_t address, bool resetStatus = true);
     void write(uint16_t address, uint8_t value);
-    void load(uint8_t *rom, uint32_t size);
     void step(int cycles);
     uint8_t *get_vram();
     uint8_t *get_frame_buffer();
+    const uint8_t *get_frame_indices();
+    const uint8_t *get_frame_emphasis();
     uint8_t *get_palette();
     void set_cpu(CPU &cpu);
+    void set_scheduler(Scheduler &scheduler);
+    void set_cartridge(Cartridge &cartridge);
+    void update_cartridge(int changes);
+    void flush_tile_cache();
+    void flush_sprite_lines();
+    void schedule_events();
+    void handle_event(EventType type);
+    void catch_up();
     void reset();
-    void render_background_scanline(int scanline);
+    void render_scanline(int scanline);
     int get_cycle();
     int get_scanline();
     int get_frame();
     void draw_palette();
     void set_vblank_flag();
-    long get_total_cycles();
+    int64_t get_total_cycles();
     void write_oam_data(uint16_t address, uint8_t value);
     void add_cycles(int cycles);
 
 private:
     InterruptCallback interruptCallback;
+
+    // Registers, counters and RAMs, in the emulator's MachineState
+    PpuState *state;
     uint8_t *vram;
     uint8_t *oam;
     uint8_t *palette;
-    uint8_t chr_rom[0x2000];
-
-    uint8_t control;
-    uint8_t mask;
-    uint8_t status;
-    uint8_t prev_read;
-    uint8_t oam_address;
-    uint8_t oam_data;
-    uint8_t scroll_x;
-    uint8_t scroll_y;
-    uint8_t address;
-    uint8_t data;
-    uint8_t oam_dma;
-    int cycles;
-    long total_cycles;
-    int scanline;
-    bool nmi_triggered;
-    uint8_t old_frame;
-    uint8_t NMI_occurred;
-    uint8_t frame;
-    uint8_t write_toggle;
-    uint16_t vram_address;
+
+    // Where each 1KB nametable at $2000-$2FFF lives in vram, set by mirroring
+    uint8_t *nametables[4];
+
+    // The CHR banked in at $0000-$1FFF, decoded to a byte per pixel so
+    // drawing a tile row is a copy and a palette OR. Rows are 8 pixels in a
+    // uint64_t, leftmost in the low byte, with a second copy mirrored for
+    // horizontally flipped sprites. A window is decoded again when the
+    // mapper points it somewhere else, a row when CHR-RAM is written.
+    uint64_t tile_cache[2][0x1000];
+    const uint8_t *cached_chr_windows[8];
 
     static const int XRES = 256;
     static const int YRES = 240;
     static const int COLOR_DEPTH = 4;
+
+    // The frame as drawn, a 6-bit palette index per pixel and PPUMASK's
+    // emphasis bits (5-7, shifted down) per line. The 32-bit frame buffer
+    // is converted from them only when asked for, once per frame drawn.
+    uint8_t frame_indices[XRES * YRES];
+    uint8_t frame_emphasis[YRES];
     uint8_t frame_buffer[XRES * YRES * COLOR_DEPTH];
+    bool frame_buffer_dirty;
     static const int SCANLINE_CYCLES = 341;
+    static const int FETCH_END_CYCLE = 257;
     static const int SCANLINES = 261;
     static const int VBLANK_SCANLINE = 241;
+    static const int FRAME_CYCLES = (SCANLINES + 1) * SCANLINE_CYCLES;
+    static const int NAMETABLE_RAM_SIZE = 0x1000; // 2KB on the board, 4KB with four-screen cartridges
     const uint32_t PaletteLUT_2C04_0001[64] = {
         0xFF585858, 0xFF00237C, 0xFF0D1099, 0xFF300092, 0xFF4F006C, 0xFF600035, 0xFF5C0500, 0xFF461800,
         0xFF271400, 0xFF0B2400, 0xFF003200, 0xFF003D00, 0xFF003840, 0xFF002F66, 0xFF000000, 0xFF000000,
@@ -82,11 +96,64 @@ private:
         0xFFFFFFFF, 0xFFC4E4F0, 0xFFD8D8F8, 0xFFE8D8F8, 0xFFF8D8F8, 0xFFF8CCE8, 0xFFF4E4D8, 0xFFFCE4D0,
         0xFFF8F0C0, 0xFFF0F8C8, 0xFFD8F8D8, 0xFFD8F8E8, 0xFF00FCFC, 0xFFF8F8F8, 0xFF000000, 0xFF000000};
 
+    // The palette above under each combination of emphasis bits
+    uint32_t emphasis_colors[8][64];
+
+    // Sprites on each visible line, the first 8 in OAM order and whether
+    // there were more. Built for the whole frame at once, again only if OAM
+    // or the sprite size changes during it.
+    struct SpriteLine
+    {
+        uint8_t count;
+        bool overflow;
+        uint8_t sprites[8];
+    };
+    SpriteLine sprite_lines[YRES];
+    bool sprite_lines_dirty;
+
+    // Sprite pixels are drawn as palette indices 16-31, with this flag on
+    // top for those behind the background
+    static const uint8_t SPRITE_BEHIND = 0x20;
+
     void draw_pattern_table(int startX, int startY, int table, uint8_t *palette);
     void draw_name_table(int nameTableIndex);
-    void draw_pixel(int x, int y, uint32_t color);
+    void draw_pixel(int x, int y, uint8_t index);
+    void draw_scanline();
+    void build_emphasis_colors();
+    void convert_frame();
+    uint8_t *render_background(uint8_t *line);
+    bool render_sprites(int scanline, uint8_t *line);
+    uint64_t get_sprite_row(const uint8_t *sprite, int row);
+    void build_sprite_lines();
+    int get_sprite_height();
+    void schedule_sprite0_hit();
+    void schedule_sprite0_line(int line);
+    void update_sprite0_hit();
+    int find_sprite0_hit(int scanline);
+    void end_scanline();
+    uint8_t read_bus(uint16_t address);
+    void write_bus(uint16_t address, uint8_t value);
+    void update_mirroring();
+    void update_tile_cache();
+    void decode_tile_row(uint16_t address);
+    static int get_tile_row_index(uint16_t address);
+    void schedule_irq();
+    bool is_rendering();
 
     CPU *cpu;
+    Cartridge *cartridge;
+    Scheduler *scheduler;
 };
 
+inline int PPU::get_sprite_height()
+{
+    return (state->control & 0x20) != 0 ? 16 : 8;
+}
+
+inline int PPU::get_tile_row_index(uint16_t address)
+{
+    // CHR address without bit 3, which picks the bitplane
+    return ((address >> 1) & 0x0FF8) | (address & 0x07);
+}
+
 #endif
@@ -0,0 +1,160 @@
+#ifndef RECOMPILED_ABI_HPP
+#define RECOMPILED_ABI_HPP
+
+#include <stdint.h>
+
+// Interface between the emulator and a ROM recompiled by espnes_recompiler.
+// It is plain C so the shared object does not depend on the emulator's C++
+// ABI or on any of its classes.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ESPNES_RECOMPILED_VERSION 3
+
+// Registers and memory as seen by a recompiled block. P is always fully
+// materialized here.
+typedef struct espnes_context
+{
+    uint16_t pc;
+    uint8_t a;
+    uint8_t x;
+    uint8_t y;
+    uint8_t sp;
+    uint8_t p;
+
+    // Set when an access went through read/write instead of the page tables
+    uint8_t io;
+
+    // Cycles the running block had taken before the instruction doing that
+    // access, so the host can tell where the CPU is
+    int32_t elapsed;
+
+    // Instructions run, every block adds its own on exit
+    uint32_t instructions;
+
+    // Memory's page tables, nullptr pages go through read/write
+    const uint8_t *const *read_pages;
+    uint8_t *const *write_pages;
+
+    void *host;
+    uint8_t (*read)(void *host, uint16_t address);
+    void (*write)(void *host, uint16_t address, uint8_t value);
+} espnes_context;
+
+// Runs one basic block and returns the cycles it took, ctx->pc is left on the
+// next instruction
+typedef int (*espnes_block)(espnes_context *ctx);
+
+typedef struct espnes_block_entry
+{
+    uint16_t pc;
+    espnes_block block;
+} espnes_block_entry;
+
+// Exported by the shared object as espnes_module_info
+typedef struct espnes_module
+{
+    uint32_t version;
+    uint32_t prg_crc;
+    uint32_t block_count;
+    const espnes_block_entry *blocks;
+} espnes_module;
+
+#define ESPNES_MODULE_SYMBOL "espnes_module_info"
+
+#ifdef _WIN32
+#define ESPNES_EXPORT __declspec(dllexport)
+#else
+#define ESPNES_EXPORT __attribute__((visibility("default")))
+#endif
+
+#ifdef ESPNES_RECOMPILED_MODULE
+
+// Helpers for the generated code. Blocks keep the registers in locals and
+// write them back on every exit.
+
+static inline uint8_t espnes_read(espnes_context *ctx, uint16_t address, int elapsed)
+{
+    const uint8_t *page = ctx->read_pages[address >> 8];
+    if (page)
+    {
+        return page[address & 0xFF];
+    }
+
+    ctx->io = 1;
+    ctx->elapsed = elapsed;
+    return ctx->read(ctx->host, address);
+}
+
+static inline void espnes_write(espnes_context *ctx, uint16_t address, uint8_t value, int elapsed)
+{
+    uint8_t *page = ctx->write_pages[address >> 8];
+    if (page)
+    {
+        page[address & 0xFF] = value;
+        return;
+    }
+
+    ctx->io = 1;
+    ctx->elapsed = elapsed;
+    ctx->write(ctx->host, address, value);
+}
+
+#define F_C 0x01
+#define F_Z 0x02
+#define F_I 0x04
+#define F_D 0x08
+#define F_B 0x10
+#define F_U 0x20
+#define F_V 0x40
+#define F_N 0x80
+
+#define BEGIN \
+    uint8_t a = ctx->a, x = ctx->x, y = ctx->y, sp = ctx->sp, p = ctx->p; \
+    uint16_t ea = 0, base = 0; \
+    uint8_t t = 0; \
+    unsigned r = 0; \
+    int cycles = 0, start = 0, executed = 0; \
+    (void)ea; (void)base; (void)t; (void)r; (void)start
+
+#define EXIT(target) \
+    do { \
+        ctx->pc = (uint16_t)(target); \
+        ctx->a = a; ctx->x = x; ctx->y = y; ctx->sp = sp; ctx->p = p; \
+        ctx->instructions += executed; \
+        return cycles; \
+    } while (0)
+
+// Leave after I/O so events it raised are seen on time
+#define IO_EXIT(target) if (ctx->io) EXIT(target)
+
+#define RD(address) espnes_read(ctx, (uint16_t)(address), start)
+#define WR(address, value) espnes_write(ctx, (uint16_t)(address), (uint8_t)(value), start)
+#define RD16_ZP(address) (uint16_t)(RD((uint8_t)(address)) | (RD((uint8_t)((address) + 1)) << 8))
+#define PAGE_CROSSED(from, to) ((((from) ^ (to)) & 0xFF00) != 0)
+
+#define SETF(flag, cond) (p = (uint8_t)((cond) ? (p | (flag)) : (p & ~(flag))))
+#define NZ(v) (p = (uint8_t)((p & ~(F_N | F_Z)) | ((v) & F_N) | ((v) == 0 ? F_Z : 0)))
+
+#define ADC(v) (t = (uint8_t)(v), r = a + t + (p & F_C), SETF(F_C, r > 0xFF), \
+    SETF(F_V, ~(a ^ t) & (a ^ r) & 0x80), a = (uint8_t)r, NZ(a))
+#define SBC(v) ADC(~(v))
+#define CMP(reg, v) (t = (uint8_t)(v), SETF(F_C, (reg) >= t), t = (uint8_t)((reg) - t), NZ(t))
+#define BIT(v) (t = (uint8_t)(v), SETF(F_Z, (a & t) == 0), p = (uint8_t)((p & 0x3F) | (t & 0xC0)))
+#define ASL(v) (SETF(F_C, (v) & 0x80), v = (uint8_t)((v) << 1), NZ(v))
+#define LSR(v) (SETF(F_C, (v) & 0x01), v = (uint8_t)((v) >> 1), NZ(v))
+#define ROL(v) (r = ((v) << 1) | (p & F_C), SETF(F_C, r > 0xFF), v = (uint8_t)r, NZ(v))
+#define ROR(v) (r = (v) | ((p & F_C) << 8), SETF(F_C, (v) & 0x01), v = (uint8_t)(r >> 1), NZ(v))
+
+#define PUSH(v) (WR(0x0100 | sp, v), sp--)
+#define PULL() (sp++, RD(0x0100 | sp))
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,62 @@
+#ifndef RECOMPILED_CODE_HPP
+#define RECOMPILED_CODE_HPP
+
+#include <cstdint>
+#include <string>
+#include "../include/memory.hpp"
+#include "../include/recompiled_abi.hpp"
+
+class CPU;
+
+// PRG-ROM blocks compiled ahead of time by espnes_recompiler, loaded from a
+// shared object next to the ROM. The CPU runs them in place of the
+// interpreter wherever a block starts; everything else is interpreted.
+class RecompiledCode
+{
+public:
+    RecompiledCode(Memory *memory);
+    ~RecompiledCode();
+
+    bool load(const std::string &path, uint32_t prg_crc);
+
+    // Blocks linked into the executable instead of a shared object, as the
+    // tests do
+    bool load(const espnes_module *module, uint32_t prg_crc);
+    void unload();
+    bool has_block(uint16_t address);
+    int run(CPU *cpu, int max_cycles, int &cycles);
+
+    static std::string module_path(const std::string &rom_path);
+
+private:
+    static uint8_t read(void *host, uint16_t address);
+    static void write(void *host, uint16_t address, uint8_t value);
+
+    espnes_block lookup(uint16_t address);
+
+    void *library;
+
+    // One slot per $8000-$FFFF address, nullptr where no block starts.
+    // Allocated when a module loads.
+    espnes_block *blocks;
+
+    espnes_context context;
+    Memory *memory;
+
+    // The CPU's cycle count for the current run and its value when the
+    // running block was entered
+    int *progress;
+    int block_start;
+};
+
+inline espnes_block RecompiledCode::lookup(uint16_t address)
+{
+    return address >= 0x8000 ? blocks[address - 0x8000] : nullptr;
+}
+
+inline bool RecompiledCode::has_block(uint16_t address)
+{
+    return blocks != nullptr && lookup(address) != nullptr;
+}
+
+#endif
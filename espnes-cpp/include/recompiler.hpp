@@ -0,0 +1,46 @@
+#ifndef RECOMPILER_HPP
+#define RECOMPILER_HPP
+
+#include <cstdint>
+#include <set>
+#include <vector>
+#include <string>
+#include <ostream>
+#include "../include/memory.hpp"
+#include "../include/debug/disassembler.hpp"
+
+// Translates the PRG-ROM of a mapper 0 cartridge into C++, one function per
+// basic block. Code is found by tracing from the interrupt vectors, so only
+// what is reachable through direct jumps, calls and branches gets compiled;
+// everything else (RAM code, jump tables, unofficial opcodes) is left to the
+// interpreter. The output builds into a shared object that RecompiledCode
+// loads, see recompiled_abi.hpp.
+class Recompiler
+{
+public:
+    Recompiler(Memory *memory, Disassembler *disassembler);
+    ~Recompiler();
+
+    void trace(uint16_t entry);
+    void trace_vectors();
+    bool write_source(const std::string &path, uint32_t prg_crc);
+    size_t get_block_count();
+
+    static bool is_supported(const Disassembler::Instruction &ins);
+
+private:
+    static const int MAX_BLOCK_INSTRUCTIONS = 64;
+
+    void add_leader(uint16_t address, std::vector<uint16_t> &pending);
+    void emit_block(std::ostream &out, uint16_t start);
+    bool emit_instruction(std::ostream &out, const Disassembler::Instruction &ins);
+
+    // Block entry points: vectors, jump/branch targets and return addresses
+    std::set<uint16_t> leaders;
+    std::set<uint16_t> visited;
+
+    Memory *memory;
+    Disassembler *disassembler;
+};
+
+#endif
@@ -0,0 +1,78 @@
+#ifndef REWIND_BUFFER_HPP
+#define REWIND_BUFFER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// History of save states for rewinding. Only the newest state is kept
+// whole; each older one is stored as the XOR of it and its successor,
+// run-length coded so unchanged bytes cost almost nothing. Deltas go into
+// a fixed-size byte ring, and the oldest are dropped to make room, so
+// nothing is allocated once the buffer is set up.
+//
+// Going back n steps XORs the n newest deltas into the newest state, newest
+// first, and forgets them.
+class RewindBuffer
+{
+public:
+    RewindBuffer();
+
+    void allocate(size_t capacity, size_t state_size);
+    void release();
+    void clear();
+    bool is_allocated();
+    void push(const uint8_t *state);
+    const uint8_t *rewind(int steps);
+    int get_count();
+    size_t get_used();
+    size_t get_capacity();
+
+private:
+    struct Snapshot
+    {
+        uint32_t offset;
+        uint32_t size;
+    };
+
+    size_t encode(const uint8_t *older, const uint8_t *newer, uint8_t *out);
+    void apply(const uint8_t *delta, size_t size, uint8_t *state);
+    void store(const uint8_t *delta, uint32_t size);
+    void drop_oldest();
+
+    // Delta bytes, and where each snapshot's delta sits in them (a ring of
+    // its own, oldest at first)
+    std::vector<uint8_t> ring;
+    std::vector<Snapshot> snapshots;
+    int first;
+    int count;
+    uint32_t write;
+    size_t used;
+
+    // Newest state, and scratch space for encoding the next delta
+    std::vector<uint8_t> newest;
+    std::vector<uint8_t> scratch;
+    bool has_newest;
+};
+
+inline bool RewindBuffer::is_allocated()
+{
+    return !ring.empty();
+}
+
+inline int RewindBuffer::get_count()
+{
+    return count;
+}
+
+inline size_t RewindBuffer::get_used()
+{
+    return used;
+}
+
+inline size_t RewindBuffer::get_capacity()
+{
+    return ring.size();
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,143 @@
+#ifndef ROM_IMAGE_HPP
+#define ROM_IMAGE_HPP
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../include/mapped_file.hpp"
+#include "../include/mirroring_type.hpp"
+
+// An iNES or NES 2.0 ROM, mapped read-only. The header is parsed where it
+// lies and PRG/CHR point into the mapping, so loading copies nothing.
+//
+// Images are shared across the process: opening a file whose PRG and CHR
+// match an image that is still in use returns that image, so any number of
+// emulators running one ROM hold a single mapping between them.
+class RomImage
+{
+public:
+    ~RomImage();
+
+    static std::shared_ptr<RomImage> open(const std::string &path, std::string &error);
+
+    // A ROM built in memory, by tests and tools. The bytes are copied and the
+    // image is never shared.
+    static std::shared_ptr<RomImage> create(const uint8_t *data, size_t size, std::string &error);
+
+    const uint8_t *get_prg();
+    uint32_t get_prg_size();
+    const uint8_t *get_chr();
+    uint32_t get_chr_size();
+    const uint8_t *get_trainer();
+    int get_mapper_number();
+    int get_submapper();
+    MirroringType get_mirroring();
+    bool is_nes2();
+    bool has_battery();
+    uint32_t get_prg_ram_size();
+    uint32_t get_chr_ram_size();
+    uint32_t get_prg_crc();
+    uint32_t get_hash();
+
+    static const int TRAINER_SIZE = 512;
+
+private:
+    RomImage();
+
+    bool parse(const uint8_t *data, size_t size, std::string &error);
+    bool same_contents(RomImage &other);
+
+    MappedFile file;
+    std::vector<uint8_t> contents;
+    const uint8_t *header;
+    const uint8_t *trainer;
+    const uint8_t *prg;
+    uint32_t prg_size;
+    const uint8_t *chr;
+    uint32_t chr_size;
+    int mapper_number;
+    int submapper;
+    MirroringType mirroring;
+    bool nes2;
+    bool battery;
+    uint32_t prg_ram_size;
+    uint32_t chr_ram_size;
+
+    // CRC-32 of PRG alone (what recompiled code is built against), and of
+    // PRG followed by CHR (what images are shared by)
+    uint32_t prg_crc;
+    uint32_t hash;
+};
+
+inline const uint8_t *RomImage::get_prg()
+{
+    return prg;
+}
+
+inline uint32_t RomImage::get_prg_size()
+{
+    return prg_size;
+}
+
+inline const uint8_t *RomImage::get_chr()
+{
+    return chr;
+}
+
+inline uint32_t RomImage::get_chr_size()
+{
+    return chr_size;
+}
+
+inline const uint8_t *RomImage::get_trainer()
+{
+    return trainer;
+}
+
+inline int RomImage::get_mapper_number()
+{
+    return mapper_number;
+}
+
+inline int RomImage::get_submapper()
+{
+    return submapper;
+}
+
+inline MirroringType RomImage::get_mirroring()
+{
+    return mirroring;
+}
+
+inline bool RomImage::is_nes2()
+{
+    return nes2;
+}
+
+inline bool RomImage::has_battery()
+{
+    return battery;
+}
+
+inline uint32_t RomImage::get_prg_ram_size()
+{
+    return prg_ram_size;
+}
+
+inline uint32_t RomImage::get_chr_ram_size()
+{
+    return chr_ram_size;
+}
+
+inline uint32_t RomImage::get_prg_crc()
+{
+    return prg_crc;
+}
+
+inline uint32_t RomImage::get_hash()
+{
+    return hash;
+}
+
+#endif
\ No newline at end of file
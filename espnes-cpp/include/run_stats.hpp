@@ -0,0 +1,15 @@
+#ifndef RUN_STATS_HPP
+#define RUN_STATS_HPP
+
+#include <cstdint>
+
+// What a call to Emulator::run_frames() did
+struct RunStats
+{
+    int frames;
+    int64_t cycles;
+    int64_t instructions;
+    double wall_time_ms;
+};
+
+#endif
\ No newline at end of file
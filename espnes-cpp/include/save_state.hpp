@@ -0,0 +1,121 @@
+#ifndef SAVE_STATE_HPP
+#define SAVE_STATE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Binary save-state format: a SaveStateHeader, the MachineState as it is in
+// memory, then the state kept outside it in a fixed order (cartridge,
+// controller, scheduler, emulator), packed and in host byte order. Only
+// state that can't be rebuilt is stored; ROM comes from the loaded image and
+// host pointers are recomputed on load.
+
+#define SAVE_STATE_MAGIC "ESPNESST"
+#define SAVE_STATE_VERSION 6
+
+struct SaveStateHeader
+{
+    char magic[8];
+    uint32_t version;
+
+    // Whole state, header included
+    uint32_t size;
+
+    // RomImage hash of the ROM the state was saved from
+    uint32_t rom_hash;
+    uint32_t reserved;
+};
+
+// Appends fields to a caller's buffer. Writing past the end is counted but
+// not stored, so a writer without a buffer measures the state's size.
+class StateWriter
+{
+public:
+    StateWriter(uint8_t *buffer, size_t capacity);
+
+    void write(const void *data, size_t size);
+    template <typename T> void write_value(T value);
+    size_t get_size();
+    bool is_overflowed();
+
+private:
+    uint8_t *buffer;
+    size_t capacity;
+    size_t position;
+};
+
+// Reads fields back in the order they were written. Reading past the end
+// yields zeros and marks the reader failed.
+class StateReader
+{
+public:
+    StateReader(const uint8_t *buffer, size_t size);
+
+    void read(void *data, size_t size);
+    template <typename T> void read_value(T &value);
+    bool is_failed();
+
+private:
+    const uint8_t *buffer;
+    size_t size;
+    size_t position;
+    bool failed;
+};
+
+inline StateWriter::StateWriter(uint8_t *buffer, size_t capacity) : buffer(buffer), capacity(capacity), position(0)
+{
+}
+
+inline void StateWriter::write(const void *data, size_t size)
+{
+    if (buffer != nullptr && position + size <= capacity)
+    {
+        memcpy(buffer + position, data, size);
+    }
+    position += size;
+}
+
+template <typename T> inline void StateWriter::write_value(T value)
+{
+    write(&value, sizeof(value));
+}
+
+inline size_t StateWriter::get_size()
+{
+    return position;
+}
+
+inline bool StateWriter::is_overflowed()
+{
+    return position > capacity;
+}
+
+inline StateReader::StateReader(const uint8_t *buffer, size_t size) : buffer(buffer), size(size), position(0), failed(false)
+{
+}
+
+inline void StateReader::read(void *data, size_t size)
+{
+    if (position + size > this->size)
+    {
+        memset(data, 0, size);
+        failed = true;
+        return;
+    }
+
+    memcpy(data, buffer + position, size);
+    position += size;
+}
+
+template <typename T> inline void StateReader::read_value(T &value)
+{
+    read(&value, sizeof(value));
+}
+
+inline bool StateReader::is_failed()
+{
+    return failed;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,66 @@
+#ifndef SCHEDULER_HPP
+#define SCHEDULER_HPP
+
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <vector>
+#include "../include/event_type.hpp"
+#include "../include/save_state.hpp"
+
+// Master clock, counted in PPU dots (3 per CPU cycle), and the timestamped
+// events on it. The CPU runs freely up to the next event; whoever owns an
+// event handles it when it comes due and schedules the next one.
+class Scheduler
+{
+public:
+    Scheduler();
+    ~Scheduler();
+
+    void reset();
+    void schedule(EventType type, int64_t time);
+    void cancel(EventType type);
+    bool pop_due_event(EventType &type);
+    void advance(int dots);
+    int64_t get_time();
+    int64_t get_event_time(EventType type);
+    int get_cycles_to_next_event();
+    void save_state(StateWriter &state);
+    void load_state(StateReader &state);
+
+    static const int NOT_SCHEDULED = -1;
+
+private:
+    struct Event
+    {
+        int64_t time;
+        EventType type;
+
+        bool operator>(const Event &other) const
+        {
+            return time != other.time ? time > other.time : type > other.type;
+        }
+    };
+
+    void drop_stale_events();
+
+    std::priority_queue<Event, std::vector<Event>, std::greater<Event>> events;
+
+    // Each type is pending at most once; queue entries that no longer match
+    // are stale (rescheduled or cancelled) and get skipped
+    int64_t scheduled[EVENT_TYPE_COUNT];
+
+    int64_t time;
+};
+
+inline int64_t Scheduler::get_time()
+{
+    return time;
+}
+
+inline void Scheduler::advance(int dots)
+{
+    time += dots;
+}
+
+#endif
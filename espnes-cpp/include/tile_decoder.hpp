@@ -0,0 +1,55 @@
+#ifndef TILE_DECODER_HPP
+#define TILE_DECODER_HPP
+
+#include <cstdint>
+
+enum TileKernel
+{
+    TILE_KERNEL_SCALAR,
+    TILE_KERNEL_AVX2
+};
+
+// Turns palette indices, a byte per pixel, into 32-bit pixels, and maps
+// indices through byte tables. AVX2 is picked at startup when the host
+// has it, looking colours up as byte shuffles over 64-byte tables and
+// indices as two shuffles over the 32-byte table; scalar loops are the
+// fallback for everything else.
+class TileDecoder
+{
+public:
+    // Indices 0-63 into 64 colours, count a multiple of 8
+    static void lookup_colors(const uint8_t *indices, int count, const uint32_t *colors, uint32_t *out);
+
+    // Indices 0-31 into a 32-byte table, count a multiple of 32
+    static void lookup_indices(const uint8_t *indices, int count, const uint8_t *table, uint8_t *out);
+
+    static TileKernel get_kernel();
+
+    // Returns false, keeping the current kernel, if the host can't run it
+    static bool set_kernel(TileKernel kernel);
+
+private:
+    typedef void (*LookupKernel)(const uint8_t *indices, int count, const uint32_t *colors, uint32_t *out);
+    typedef void (*IndexKernel)(const uint8_t *indices, int count, const uint8_t *table, uint8_t *out);
+
+    static LookupKernel lookup_kernel;
+    static IndexKernel index_kernel;
+    static TileKernel kernel_type;
+};
+
+inline void TileDecoder::lookup_colors(const uint8_t *indices, int count, const uint32_t *colors, uint32_t *out)
+{
+    lookup_kernel(indices, count, colors, out);
+}
+
+inline void TileDecoder::lookup_indices(const uint8_t *indices, int count, const uint8_t *table, uint8_t *out)
+{
+    index_kernel(indices, count, table, out);
+}
+
+inline TileKernel TileDecoder::get_kernel()
+{
+    return kernel_type;
+}
+
+#endif
\ No newline at end of file
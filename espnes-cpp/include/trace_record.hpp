@@ -0,0 +1,52 @@
+#ifndef TRACE_RECORD_HPP
+#define TRACE_RECORD_HPP
+
+#include <cstdint>
+
+// Binary CPU trace format written by Tracer: a TraceFileHeader followed by
+// one fixed-size TraceRecord per instruction, in host byte order.
+
+#define TRACE_MAGIC "ESPNESTR"
+#define TRACE_VERSION 1
+
+struct TraceFileHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t record_size;
+};
+
+enum TraceFlags
+{
+    // value holds the byte at address (not set for I/O, which can't be
+    // read without side effects)
+    TRACE_HAS_VALUE = 0x01
+};
+
+// CPU and PPU state just before an instruction runs
+struct TraceRecord
+{
+    uint64_t cpu_cycles;
+    uint32_t frame;
+    uint16_t pc;
+
+    // Effective address, branch target or indirect jump target
+    uint16_t address;
+    uint16_t scanline;
+    uint16_t dot;
+    uint8_t opcode;
+    uint8_t operand1;
+    uint8_t operand2;
+    uint8_t value;
+    uint8_t a;
+    uint8_t x;
+    uint8_t y;
+    uint8_t p;
+    uint8_t sp;
+    uint8_t flags;
+    uint8_t reserved[2];
+};
+
+static_assert(sizeof(TraceRecord) == 32, "TraceRecord is part of the file format");
+
+#endif
\ No newline at end of file
@@ -0,0 +1,68 @@
+#ifndef TRACER_HPP
+#define TRACER_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <thread>
+#include "../include/trace_record.hpp"
+#include "../include/debug/disassembler.hpp"
+
+// Writes a binary CPU trace. The emulator thread only copies each record
+// into a single-producer, single-consumer ring; a writer thread drains it to
+// disk. Nothing is recorded, and nothing costs more than a flag test, while
+// the tracer is stopped.
+class Tracer
+{
+public:
+    Tracer();
+    ~Tracer();
+
+    bool start(const std::string &path);
+    void stop();
+    bool is_enabled();
+    void record(const TraceRecord &record);
+
+    // One line in the format of the nestest.log reference trace
+    static void format(const TraceRecord &record, const Disassembler::OpcodeInfo &info, char *buffer, size_t size);
+
+private:
+    static const uint32_t CAPACITY = 1 << 16;
+
+    void write_loop();
+
+    // Allocated while tracing
+    TraceRecord *ring;
+
+    // Free-running counters, the slot is the counter modulo CAPACITY. Only
+    // the emulator moves head and only the writer moves tail.
+    std::atomic<uint32_t> head;
+    std::atomic<uint32_t> tail;
+    std::atomic<bool> running;
+
+    std::thread writer;
+    std::ofstream file;
+    bool enabled;
+};
+
+inline bool Tracer::is_enabled()
+{
+    return enabled;
+}
+
+inline void Tracer::record(const TraceRecord &record)
+{
+    uint32_t slot = head.load(std::memory_order_relaxed);
+
+    // Wait for the writer rather than drop records
+    while (slot - tail.load(std::memory_order_acquire) == CAPACITY)
+    {
+        std::this_thread::yield();
+    }
+
+    ring[slot & (CAPACITY - 1)] = record;
+    head.store(slot + 1, std::memory_order_release);
+}
+
+#endif
\ No newline at end of file
@@ -29,12 +29,16 @@ public:
     void render_PPU(Emulator *emulator);
     void render_CPU(Emulator *emulator);
     void render_breakpoints(Emulator* emulator);
+    void render_rewind(Emulator *emulator);
 
 private:
     SDL_Window *window;
     SDL_Renderer *renderer;
     SDL_Texture *texture;
     bool show_disassembly;
+
+    // How far back the rewind slider points, in seconds
+    float rewind_seconds;
 };
 
 #endif
\ No newline at end of file
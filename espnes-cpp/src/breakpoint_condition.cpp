@@ -0,0 +1,512 @@
+#include <cctype>
+#include <cstring>
+#include "../include/breakpoint_condition.hpp"
+
+static const char *variable_names[CONDITION_VARIABLE_COUNT] =
+{
+    "a", "x", "y", "p", "sp", "pc", "cycles", "scanline", "dot", "frame", "address", "value"
+};
+
+BreakpointCondition::BreakpointCondition() : position(0), depth(0), max_depth(0), nesting(0)
+{
+}
+
+bool BreakpointCondition::compile(const std::string &source, std::string &error)
+{
+    this->source = source;
+    code.clear();
+    constants.clear();
+    position = 0;
+    depth = 0;
+    max_depth = 0;
+    nesting = 0;
+    this->error.clear();
+
+    // An empty condition always holds
+    skip_spaces();
+    if (position == source.size())
+    {
+        return true;
+    }
+
+    bool compiled = parse_or();
+    skip_spaces();
+    if (compiled && position != source.size())
+    {
+        compiled = fail("unexpected '" + source.substr(position, 1) + "'");
+    }
+    if (compiled && max_depth > MAX_STACK)
+    {
+        compiled = fail("expression is nested too deeply");
+    }
+
+    if (!compiled)
+    {
+        code.clear();
+        constants.clear();
+        error = this->error;
+    }
+
+    return compiled;
+}
+
+bool BreakpointCondition::evaluate(const int64_t *variables) const
+{
+    if (code.empty())
+    {
+        return true;
+    }
+
+    int64_t stack[MAX_STACK];
+    int top = -1;
+    const uint8_t *op = code.data();
+    const uint8_t *end = op + code.size();
+
+    while (op < end)
+    {
+        switch (*op++)
+        {
+        case OP_CONST:
+            stack[++top] = constants[*op++];
+            break;
+        case OP_LOAD:
+            stack[++top] = variables[*op++];
+            break;
+        case OP_NOT:
+            stack[top] = stack[top] == 0;
+            break;
+        case OP_NEGATE:
+            stack[top] = -stack[top];
+            break;
+        case OP_ADD:
+            top--;
+            stack[top] = stack[top] + stack[top + 1];
+            break;
+        case OP_SUBTRACT:
+            top--;
+            stack[top] = stack[top] - stack[top + 1];
+            break;
+        case OP_BIT_AND:
+            top--;
+            stack[top] = stack[top] & stack[top + 1];
+            break;
+        case OP_BIT_OR:
+            top--;
+            stack[top] = stack[top] | stack[top + 1];
+            break;
+        case OP_EQUAL:
+            top--;
+            stack[top] = stack[top] == stack[top + 1];
+            break;
+        case OP_NOT_EQUAL:
+            top--;
+            stack[top] = stack[top] != stack[top + 1];
+            break;
+        case OP_LESS:
+            top--;
+            stack[top] = stack[top] < stack[top + 1];
+            break;
+        case OP_LESS_EQUAL:
+            top--;
+            stack[top] = stack[top] <= stack[top + 1];
+            break;
+        case OP_GREATER:
+            top--;
+            stack[top] = stack[top] > stack[top + 1];
+            break;
+        case OP_GREATER_EQUAL:
+            top--;
+            stack[top] = stack[top] >= stack[top + 1];
+            break;
+        // Both sides are always evaluated, there are no side effects to skip
+        case OP_AND:
+            top--;
+            stack[top] = stack[top] != 0 && stack[top + 1] != 0;
+            break;
+        case OP_OR:
+            top--;
+            stack[top] = stack[top] != 0 || stack[top + 1] != 0;
+            break;
+        }
+    }
+
+    return stack[0] != 0;
+}
+
+bool BreakpointCondition::parse_or()
+{
+    if (!parse_and())
+    {
+        return false;
+    }
+
+    while (match("||"))
+    {
+        if (!parse_and())
+        {
+            return false;
+        }
+        emit(OP_OR);
+    }
+
+    return true;
+}
+
+bool BreakpointCondition::parse_and()
+{
+    if (!parse_bit_or())
+    {
+        return false;
+    }
+
+    while (match("&&"))
+    {
+        if (!parse_bit_or())
+        {
+            return false;
+        }
+        emit(OP_AND);
+    }
+
+    return true;
+}
+
+bool BreakpointCondition::parse_bit_or()
+{
+    if (!parse_bit_and())
+    {
+        return false;
+    }
+
+    // "|" but not the start of "||"
+    for (;;)
+    {
+        skip_spaces();
+        if (position >= source.size() || source[position] != '|' || (position + 1 < source.size() && source[position + 1] == '|'))
+        {
+            return true;
+        }
+
+        position++;
+        if (!parse_bit_and())
+        {
+            return false;
+        }
+        emit(OP_BIT_OR);
+    }
+}
+
+bool BreakpointCondition::parse_bit_and()
+{
+    if (!parse_equality())
+    {
+        return false;
+    }
+
+    // "&" but not the start of "&&"
+    for (;;)
+    {
+        skip_spaces();
+        if (position >= source.size() || source[position] != '&' || (position + 1 < source.size() && source[position + 1] == '&'))
+        {
+            return true;
+        }
+
+        position++;
+        if (!parse_equality())
+        {
+            return false;
+        }
+        emit(OP_BIT_AND);
+    }
+}
+
+bool BreakpointCondition::parse_equality()
+{
+    if (!parse_relational())
+    {
+        return false;
+    }
+
+    for (;;)
+    {
+        Op op;
+        if (match("=="))
+        {
+            op = OP_EQUAL;
+        }
+        else if (match("!="))
+        {
+            op = OP_NOT_EQUAL;
+        }
+        else
+        {
+            return true;
+        }
+
+        if (!parse_relational())
+        {
+            return false;
+        }
+        emit(op);
+    }
+}
+
+bool BreakpointCondition::parse_relational()
+{
+    if (!parse_additive())
+    {
+        return false;
+    }
+
+    for (;;)
+    {
+        // Two-character operators first
+        Op op;
+        if (match("<="))
+        {
+            op = OP_LESS_EQUAL;
+        }
+        else if (match(">="))
+        {
+            op = OP_GREATER_EQUAL;
+        }
+        else if (match("<"))
+        {
+            op = OP_LESS;
+        }
+        else if (match(">"))
+        {
+            op = OP_GREATER;
+        }
+        else
+        {
+            return true;
+        }
+
+        if (!parse_additive())
+        {
+            return false;
+        }
+        emit(op);
+    }
+}
+
+bool BreakpointCondition::parse_additive()
+{
+    if (!parse_unary())
+    {
+        return false;
+    }
+
+    for (;;)
+    {
+        Op op;
+        if (match("+"))
+        {
+            op = OP_ADD;
+        }
+        else if (match("-"))
+        {
+            op = OP_SUBTRACT;
+        }
+        else
+        {
+            return true;
+        }
+
+        if (!parse_unary())
+        {
+            return false;
+        }
+        emit(op);
+    }
+}
+
+bool BreakpointCondition::parse_unary()
+{
+    // "!" but not "!="
+    skip_spaces();
+    if (position < source.size() && source[position] == '!' && (position + 1 >= source.size() || source[position + 1] != '='))
+    {
+        position++;
+        if (!nest() || !parse_unary())
+        {
+            return false;
+        }
+        nesting--;
+        emit(OP_NOT);
+        return true;
+    }
+
+    if (match("-"))
+    {
+        if (!nest() || !parse_unary())
+        {
+            return false;
+        }
+        nesting--;
+        emit(OP_NEGATE);
+        return true;
+    }
+
+    return parse_primary();
+}
+
+bool BreakpointCondition::parse_primary()
+{
+    skip_spaces();
+    if (position >= source.size())
+    {
+        return fail("unexpected end of condition");
+    }
+
+    if (match("("))
+    {
+        if (!nest() || !parse_or())
+        {
+            return false;
+        }
+        if (!match(")"))
+        {
+            return fail("missing ')'");
+        }
+        nesting--;
+        return true;
+    }
+
+    // Numbers: $hex, 0xhex or decimal
+    char c = source[position];
+    if (c == '$' || isdigit(static_cast<unsigned char>(c)))
+    {
+        int base = 10;
+        if (c == '$')
+        {
+            base = 16;
+            position++;
+        }
+        else if (c == '0' && position + 1 < source.size() && tolower(static_cast<unsigned char>(source[position + 1])) == 'x')
+        {
+            base = 16;
+            position += 2;
+        }
+
+        size_t start = position;
+        int64_t value = 0;
+        while (position < source.size() && isxdigit(static_cast<unsigned char>(source[position])))
+        {
+            c = static_cast<char>(tolower(static_cast<unsigned char>(source[position])));
+            int digit = isdigit(static_cast<unsigned char>(c)) ? c - '0' : c - 'a' + 10;
+            if (digit >= base)
+            {
+                break;
+            }
+            value = value * base + digit;
+            position++;
+        }
+
+        if (position == start)
+        {
+            return fail("expected a number");
+        }
+        if (constants.size() > 0xFF)
+        {
+            return fail("too many constants");
+        }
+
+        constants.push_back(value);
+        emit(OP_CONST, static_cast<uint8_t>(constants.size() - 1));
+        return true;
+    }
+
+    if (isalpha(static_cast<unsigned char>(c)))
+    {
+        size_t start = position;
+        while (position < source.size() && isalnum(static_cast<unsigned char>(source[position])))
+        {
+            position++;
+        }
+
+        std::string name = source.substr(start, position - start);
+        for (size_t i = 0; i < name.size(); i++)
+        {
+            name[i] = static_cast<char>(tolower(static_cast<unsigned char>(name[i])));
+        }
+
+        for (int i = 0; i < CONDITION_VARIABLE_COUNT; i++)
+        {
+            if (name == variable_names[i])
+            {
+                emit(OP_LOAD, static_cast<uint8_t>(i));
+                return true;
+            }
+        }
+
+        return fail("unknown variable '" + name + "'");
+    }
+
+    return fail("unexpected '" + source.substr(position, 1) + "'");
+}
+
+bool BreakpointCondition::nest()
+{
+    // Each ( ! and - recurses, so give up before a long run of them can
+    // exhaust the native stack rather than once the whole thing is parsed
+    if (++nesting > MAX_STACK)
+    {
+        return fail("expression is nested too deeply");
+    }
+    return true;
+}
+
+bool BreakpointCondition::match(const char *token)
+{
+    skip_spaces();
+    size_t length = strlen(token);
+    if (source.compare(position, length, token) != 0)
+    {
+        return false;
+    }
+
+    position += length;
+    return true;
+}
+
+void BreakpointCondition::skip_spaces()
+{
+    while (position < source.size() && isspace(static_cast<unsigned char>(source[position])))
+    {
+        position++;
+    }
+}
+
+bool BreakpointCondition::fail(const std::string &message)
+{
+    if (error.empty())
+    {
+        error = message + " at column " + std::to_string(position + 1);
+    }
+    return false;
+}
+
+void BreakpointCondition::emit(Op op)
+{
+    // Binary ops take two values and leave one, unary ops leave the depth alone
+    if (op != OP_NOT && op != OP_NEGATE)
+    {
+        depth--;
+    }
+    code.push_back(op);
+}
+
+void BreakpointCondition::emit(Op op, uint8_t operand)
+{
+    // Constants and loads push a value
+    depth++;
+    if (depth > max_depth)
+    {
+        max_depth = depth;
+    }
+    code.push_back(op);
+    code.push_back(operand);
+}
\ No newline at end of file
@@ -0,0 +1,62 @@
+#include <cstring>
+#include "../include/breakpoints.hpp"
+
+Breakpoints::Breakpoints()
+{
+    clear();
+}
+
+bool Breakpoints::add(breakpoint_type_t type, uint16_t value, const std::string &condition, std::string &error)
+{
+    BreakpointCondition compiled;
+    if (!compiled.compile(condition, error))
+    {
+        return false;
+    }
+
+    // Adding an existing breakpoint replaces its condition
+    remove(type, value);
+
+    Breakpoint breakpoint = { type, value, condition };
+    breakpoints.insert(breakpoint);
+    if (!compiled.is_empty())
+    {
+        conditions[breakpoint] = compiled;
+    }
+
+    bitmaps[type][value >> 6] |= 1ull << (value & 63);
+    counts[type]++;
+    return true;
+}
+
+void Breakpoints::remove(breakpoint_type_t type, uint16_t value)
+{
+    Breakpoint breakpoint = { type, value };
+    if (breakpoints.erase(breakpoint) == 0)
+    {
+        return;
+    }
+    conditions.erase(breakpoint);
+
+    bitmaps[type][value >> 6] &= ~(1ull << (value & 63));
+    counts[type]--;
+}
+
+void Breakpoints::clear()
+{
+    breakpoints.clear();
+    conditions.clear();
+    memset(bitmaps, 0, sizeof(bitmaps));
+    memset(counts, 0, sizeof(counts));
+}
+
+const BreakpointCondition *Breakpoints::get_condition(breakpoint_type_t type, uint16_t value)
+{
+    if (conditions.empty())
+    {
+        return nullptr;
+    }
+
+    auto it = conditions.find(Breakpoint{ type, value });
+    return it != conditions.end() ? &it->second : nullptr;
+}
\ No newline at end of file
@@ -1,36 +1,133 @@
 #include "../include/cartridge.hpp"
 
-Cartridge::Cartridge()
+Cartridge::Cartridge(MachineState *machine) : chr_ram(0x2000, 0), prg_ram(machine->prg_ram), mapper(nullptr)
 {
-    rom = new uint8_t[0x10000];
+    for (int i = 0; i < 0x2000; i++)
+    {
+        prg_ram[i] = 0;
+    }
+
+    mapper = Mapper::create(0, nullptr, 0, chr_ram.data(), (uint32_t)chr_ram.size(), true, MIRRORING_HORIZONTAL);
 }
 
 Cartridge::~Cartridge()
 {
-    delete[] rom;
+    delete mapper;
 }
 
-uint8_t Cartridge::read(uint16_t address)
+bool Cartridge::load(const std::shared_ptr<RomImage> &image)
 {
-    uint16_t relativeAddress = address - 0x8000; // ROM starts at 0x8000
-    uint16_t bankAddress = (currentBank * BANK_SIZE) + (relativeAddress % BANK_SIZE);
-    return rom[bankAddress];
+    // Boards without CHR-ROM get CHR-RAM, at least 8KB of it
+    std::vector<uint8_t> new_chr_ram;
+    const uint8_t *chr = image->get_chr();
+    uint32_t chr_size = image->get_chr_size();
+    if (chr_size == 0)
+    {
+        new_chr_ram.assign(image->get_chr_ram_size() > 0x2000 ? image->get_chr_ram_size() : 0x2000, 0);
+        chr = new_chr_ram.data();
+        chr_size = (uint32_t)new_chr_ram.size();
+    }
+
+    Mapper *new_mapper = Mapper::create(image->get_mapper_number(), image->get_prg(), image->get_prg_size(), chr, chr_size, !new_chr_ram.empty(),
+        image->get_mirroring());
+    if (new_mapper == nullptr)
+    {
+        return false;
+    }
+
+    // Swapping keeps the buffer the new mapper points into
+    delete mapper;
+    mapper = new_mapper;
+    chr_ram.swap(new_chr_ram);
+    this->image = image;
+
+    for (int i = 0; i < 0x2000; i++)
+    {
+        prg_ram[i] = 0;
+    }
+
+    // A trainer is loaded at $7000
+    if (image->get_trainer() != nullptr)
+    {
+        for (int i = 0; i < RomImage::TRAINER_SIZE; i++)
+        {
+            prg_ram[0x1000 + i] = image->get_trainer()[i];
+        }
+    }
+
+    return true;
 }
 
-void Cartridge::switchBank(uint16_t bank)
+uint8_t Cartridge::read(uint16_t address)
 {
-    currentBank = bank;
+    // Open bus below $6000 isn't emulated
+    const uint8_t *page = get_page(address);
+    return page != nullptr ? page[address & 0xFF] : 0;
 }
 
-void Cartridge::write(uint16_t address, uint8_t value)
+const uint8_t* Cartridge::get_page(uint16_t address)
 {
-    return;
+    if (address >= 0x8000)
+    {
+        return mapper->get_prg_page(address);
+    }
+    if (address >= 0x6000)
+    {
+        return get_ram_page(address);
+    }
+
+    return nullptr;
 }
 
-void Cartridge::load(uint8_t* rom, uint32_t size)
+int Cartridge::write(uint16_t address, uint8_t value)
 {
-    for (uint32_t i = 0; i < size; i++)
+    if (address >= 0x8000)
     {
-        this->rom[i] = rom[i];
+        return mapper->write(address, value);
     }
+    if (address >= 0x6000)
+    {
+        prg_ram[address - 0x6000] = value;
+    }
+
+    return 0;
+}
+
+void Cartridge::clock_scanline()
+{
+    mapper->clock_scanline();
+}
+
+int Cartridge::get_scanlines_to_irq()
+{
+    return mapper->get_scanlines_to_irq();
+}
+
+int Cartridge::get_mapper_number()
+{
+    return image != nullptr ? image->get_mapper_number() : 0;
+}
+
+uint32_t Cartridge::get_prg_crc()
+{
+    return image != nullptr ? image->get_prg_crc() : 0;
+}
+
+uint32_t Cartridge::get_rom_hash()
+{
+    return image != nullptr ? image->get_hash() : 0;
+}
+
+void Cartridge::save_state(StateWriter &state)
+{
+    // PRG RAM is in the MachineState. CHR-RAM is sized by the ROM, so the
+    // state's layout is fixed per ROM.
+    state.write(chr_ram.data(), chr_ram.size());
+    mapper->save_state(state);
+}
+
+void Cartridge::load_state(StateReader &state)
+{
+    state.read(chr_ram.data(), chr_ram.size());
+    mapper->load_state(state);
 }
\ No newline at end of file
@@ -1,11 +1,29 @@
 #include "../include/controller.hpp"
 
+Controller::Controller() : controller_1(0), controller_2(0), controller_1_state(0), controller_2_state(0), controller_1_state_index(0),
+	controller_2_state_index(0), last_bus_value(0)
+{
+}
+
 void Controller::write_controller_1(uint8_t value)
 {
-	// $4016
+	// $4016, strobing reloads both pads
 	if (value & 0x01)
 	{
 		controller_1_state_index = 0;
+		controller_2_state_index = 0;
+	}
+}
+
+void Controller::set_buttons(int port, uint8_t buttons)
+{
+	if (port == 0)
+	{
+		controller_1 = buttons;
+	}
+	else
+	{
+		controller_2 = buttons;
 	}
 }
 
@@ -28,8 +46,8 @@ uint8_t Controller::read_controller_1()
 	// Update the last bus value
 	last_bus_value = button_state;
 
-	// TODO implement more complex controller logic
-	return 0x40;
+	// Serial data on bit 0, the rest is open bus from the high address byte
+	return 0x40 | (button_state & 0x01);
 }
 
 uint8_t Controller::read_controller_2()
@@ -50,8 +68,8 @@ uint8_t Controller::read_controller_2()
 	// Update the last bus value
 	last_bus_value = button_state;
 
-	// TODO implement more complex controller logic
-	return 0x40;
+	// Serial data on bit 0, the rest is open bus from the high address byte
+	return 0x40 | (button_state & 0x01);
 }
 
 uint8_t Controller::get_controller_1_state(uint8_t index)
@@ -122,4 +140,26 @@ uint8_t Controller::get_controller_2_state(uint8_t index)
 	}
 
 	return state;
+}
+
+void Controller::save_state(StateWriter &state)
+{
+	state.write_value(controller_1);
+	state.write_value(controller_2);
+	state.write_value(controller_1_state);
+	state.write_value(controller_2_state);
+	state.write_value(controller_1_state_index);
+	state.write_value(controller_2_state_index);
+	state.write_value(last_bus_value);
+}
+
+void Controller::load_state(StateReader &state)
+{
+	state.read_value(controller_1);
+	state.read_value(controller_2);
+	state.read_value(controller_1_state);
+	state.read_value(controller_2_state);
+	state.read_value(controller_1_state_index);
+	state.read_value(controller_2_state_index);
+	state.read_value(last_bus_value);
 }
\ No newline at end of file
@@ -0,0 +1,351 @@
+#include "../include/cpu.hpp"
+#include "../include/cpu_helpers.hpp"
+
+// Fused interpreter core: every opcode is handled inline in one switch with the
+// registers held in locals, so the common path has no indirect call and no
+// getter/setter round trips. Built instead of the ins_table dispatch when
+// CPU_SWITCH_CORE is defined.
+
+// Operand bytes come predecoded in argument. IMM() and the addressing modes
+// step pc past them, each mode leaves the effective address in addr.
+#define IMM() (pc++, (uint8_t)argument)
+#define ZPG() addr = (uint8_t)argument; pc++
+#define ZPX() addr = (uint8_t)(argument + x); pc++
+#define ZPY() addr = (uint8_t)(argument + y); pc++
+#define ABS() addr = argument; pc += 2
+#define IZX() ptr = (uint8_t)(argument + x); pc++; addr = memory->read(ptr) | (memory->read((ptr + 1) & 0xFF) << 8)
+
+// Indexed modes take an extra cycle on page crossing for reads only
+#define ABX(penalty) base = argument; pc += 2; addr = base + x; \
+    if (penalty && ((base ^ addr) & 0xFF00)) cycles++
+#define ABY(penalty) base = argument; pc += 2; addr = base + y; \
+    if (penalty && ((base ^ addr) & 0xFF00)) cycles++
+#define IZY(penalty) ptr = (uint8_t)argument; pc++; base = memory->read(ptr) | (memory->read((ptr + 1) & 0xFF) << 8); addr = base + y; \
+    if (penalty && ((base ^ addr) & 0xFF00)) cycles++
+
+// Flags. N/Z are lazy: SET_ZN only records the result byte, and the bits in
+// p are refreshed by SYNC_NZ when P itself is observed
+#define SET_ZN(v) (nz = (v), lazy = true)
+#define SYNC_NZ() if (lazy) { p = (p & ~(FLAG_ZERO | FLAG_NEGATIVE)) | (nz == 0 ? FLAG_ZERO : 0) | (nz & FLAG_NEGATIVE); lazy = false; }
+#define IS_ZERO() (lazy ? nz == 0 : (p & FLAG_ZERO) != 0)
+#define IS_NEGATIVE() (lazy ? (nz & FLAG_NEGATIVE) != 0 : (p & FLAG_NEGATIVE) != 0)
+#define SET_FLAG(flag, cond) p = (cond) ? (p | (flag)) : (p & ~(flag))
+
+// Operations
+#define ADC(v) { uint8_t operand = (v); uint16_t sum = a + operand + (p & FLAG_CARRY); \
+    SET_FLAG(FLAG_OVERFLOW, (~(a ^ operand) & (a ^ sum) & 0x80) != 0); SET_FLAG(FLAG_CARRY, sum > 0xFF); a = (uint8_t)sum; SET_ZN(a); }
+#define SBC(v) ADC(~(v))
+#define CMP(reg, v) { uint8_t operand = (v); uint8_t diff = reg - operand; SET_FLAG(FLAG_CARRY, reg >= operand); SET_ZN(diff); }
+#define BIT(v) { uint8_t operand = (v); SET_FLAG(FLAG_ZERO, (a & operand) == 0); \
+    p = (p & ~(FLAG_NEGATIVE | FLAG_OVERFLOW)) | (operand & (FLAG_NEGATIVE | FLAG_OVERFLOW)); lazy = false; }
+#define ASL(v) SET_FLAG(FLAG_CARRY, v & 0x80); v <<= 1; SET_ZN(v)
+#define LSR(v) SET_FLAG(FLAG_CARRY, v & 0x01); v >>= 1; SET_ZN(v)
+#define ROL(v) { uint8_t carry = p & FLAG_CARRY; SET_FLAG(FLAG_CARRY, v & 0x80); v = (v << 1) | carry; SET_ZN(v); }
+#define ROR(v) { uint8_t carry = (p & FLAG_CARRY) << 7; SET_FLAG(FLAG_CARRY, v & 0x01); v = (v >> 1) | carry; SET_ZN(v); }
+#define RMW(op) value = memory->read(addr); op(value); memory->write(addr, value)
+#define BRANCH(cond) { int8_t offset = (int8_t)argument; pc++; \
+    if (cond) { uint16_t target = pc + offset; cycles += ((pc ^ target) & 0xFF00) ? 2 : 1; pc = target; } }
+#define PUSH(v) memory->write(0x0100 + sp--, v)
+#define PULL() memory->read(0x0100 + ++sp)
+
+uint8_t CPU::execute()
+{
+    uint16_t pc = state->PC;
+    uint8_t sp = state->SP;
+    uint8_t a = state->A;
+    uint8_t x = state->X;
+    uint8_t y = state->Y;
+    uint8_t p = state->P;
+    uint8_t nz = state->nz_result;
+    bool lazy = state->nz_pending;
+
+    uint16_t addr;
+    uint16_t base;
+    uint8_t ptr;
+    uint8_t value;
+
+    // PRG-ROM code comes predecoded from the cache, like the table path
+    const DecodeCache::Entry& ins = decode_cache.fetch(memory, pc);
+    uint8_t opcode = ins.opcode;
+    uint16_t argument = ins.operand;
+    uint8_t cycles = opcode_cycles[opcode];
+    pc++;
+
+    switch (opcode)
+    {
+    // Loads
+    case 0xA9: a = IMM(); SET_ZN(a); break;
+    case 0xA5: ZPG(); a = memory->read(addr); SET_ZN(a); break;
+    case 0xB5: ZPX(); a = memory->read(addr); SET_ZN(a); break;
+    case 0xAD: ABS(); a = memory->read(addr); SET_ZN(a); break;
+    case 0xBD: ABX(true); a = memory->read(addr); SET_ZN(a); break;
+    case 0xB9: ABY(true); a = memory->read(addr); SET_ZN(a); break;
+    case 0xA1: IZX(); a = memory->read(addr); SET_ZN(a); break;
+    case 0xB1: IZY(true); a = memory->read(addr); SET_ZN(a); break;
+
+    case 0xA2: x = IMM(); SET_ZN(x); break;
+    case 0xA6: ZPG(); x = memory->read(addr); SET_ZN(x); break;
+    case 0xB6: ZPY(); x = memory->read(addr); SET_ZN(x); break;
+    case 0xAE: ABS(); x = memory->read(addr); SET_ZN(x); break;
+    case 0xBE: ABY(true); x = memory->read(addr); SET_ZN(x); break;
+
+    case 0xA0: y = IMM(); SET_ZN(y); break;
+    case 0xA4: ZPG(); y = memory->read(addr); SET_ZN(y); break;
+    case 0xB4: ZPX(); y = memory->read(addr); SET_ZN(y); break;
+    case 0xAC: ABS(); y = memory->read(addr); SET_ZN(y); break;
+    case 0xBC: ABX(true); y = memory->read(addr); SET_ZN(y); break;
+
+    // Stores
+    case 0x85: ZPG(); memory->write(addr, a); break;
+    case 0x95: ZPX(); memory->write(addr, a); break;
+    case 0x8D: ABS(); memory->write(addr, a); break;
+    case 0x9D: ABX(false); memory->write(addr, a); break;
+    case 0x99: ABY(false); memory->write(addr, a); break;
+    case 0x81: IZX(); memory->write(addr, a); break;
+    case 0x91: IZY(false); memory->write(addr, a); break;
+
+    case 0x86: ZPG(); memory->write(addr, x); break;
+    case 0x96: ZPY(); memory->write(addr, x); break;
+    case 0x8E: ABS(); memory->write(addr, x); break;
+
+    case 0x84: ZPG(); memory->write(addr, y); break;
+    case 0x94: ZPX(); memory->write(addr, y); break;
+    case 0x8C: ABS(); memory->write(addr, y); break;
+
+    // Transfers
+    case 0xAA: x = a; SET_ZN(x); break;
+    case 0xA8: y = a; SET_ZN(y); break;
+    case 0x8A: a = x; SET_ZN(a); break;
+    case 0x98: a = y; SET_ZN(a); break;
+    case 0xBA: x = sp; SET_ZN(x); break;
+    case 0x9A: sp = x; break;
+
+    // Stack
+    case 0x48: PUSH(a); break;
+    case 0x08: SYNC_NZ(); PUSH(p | FLAG_BREAK | FLAG_UNUSED); break;
+    case 0x68: a = PULL(); SET_ZN(a); break;
+    case 0x28: p = (PULL() & ~FLAG_BREAK) | FLAG_UNUSED; lazy = false; break;
+
+    // Logic
+    case 0x29: a &= IMM(); SET_ZN(a); break;
+    case 0x25: ZPG(); a &= memory->read(addr); SET_ZN(a); break;
+    case 0x35: ZPX(); a &= memory->read(addr); SET_ZN(a); break;
+    case 0x2D: ABS(); a &= memory->read(addr); SET_ZN(a); break;
+    case 0x3D: ABX(true); a &= memory->read(addr); SET_ZN(a); break;
+    case 0x39: ABY(true); a &= memory->read(addr); SET_ZN(a); break;
+    case 0x21: IZX(); a &= memory->read(addr); SET_ZN(a); break;
+    case 0x31: IZY(true); a &= memory->read(addr); SET_ZN(a); break;
+
+    case 0x09: a |= IMM(); SET_ZN(a); break;
+    case 0x05: ZPG(); a |= memory->read(addr); SET_ZN(a); break;
+    case 0x15: ZPX(); a |= memory->read(addr); SET_ZN(a); break;
+    case 0x0D: ABS(); a |= memory->read(addr); SET_ZN(a); break;
+    case 0x1D: ABX(true); a |= memory->read(addr); SET_ZN(a); break;
+    case 0x19: ABY(true); a |= memory->read(addr); SET_ZN(a); break;
+    case 0x01: IZX(); a |= memory->read(addr); SET_ZN(a); break;
+    case 0x11: IZY(true); a |= memory->read(addr); SET_ZN(a); break;
+
+    case 0x49: a ^= IMM(); SET_ZN(a); break;
+    case 0x45: ZPG(); a ^= memory->read(addr); SET_ZN(a); break;
+    case 0x55: ZPX(); a ^= memory->read(addr); SET_ZN(a); break;
+    case 0x4D: ABS(); a ^= memory->read(addr); SET_ZN(a); break;
+    case 0x5D: ABX(true); a ^= memory->read(addr); SET_ZN(a); break;
+    case 0x59: ABY(true); a ^= memory->read(addr); SET_ZN(a); break;
+    case 0x41: IZX(); a ^= memory->read(addr); SET_ZN(a); break;
+    case 0x51: IZY(true); a ^= memory->read(addr); SET_ZN(a); break;
+
+    case 0x24: ZPG(); BIT(memory->read(addr)); break;
+    case 0x2C: ABS(); BIT(memory->read(addr)); break;
+
+    // Arithmetic
+    case 0x69: ADC(IMM()); break;
+    case 0x65: ZPG(); ADC(memory->read(addr)); break;
+    case 0x75: ZPX(); ADC(memory->read(addr)); break;
+    case 0x6D: ABS(); ADC(memory->read(addr)); break;
+    case 0x7D: ABX(true); ADC(memory->read(addr)); break;
+    case 0x79: ABY(true); ADC(memory->read(addr)); break;
+    case 0x61: IZX(); ADC(memory->read(addr)); break;
+    case 0x71: IZY(true); ADC(memory->read(addr)); break;
+
+    case 0xE9: SBC(IMM()); break;
+    case 0xE5: ZPG(); SBC(memory->read(addr)); break;
+    case 0xF5: ZPX(); SBC(memory->read(addr)); break;
+    case 0xED: ABS(); SBC(memory->read(addr)); break;
+    case 0xFD: ABX(true); SBC(memory->read(addr)); break;
+    case 0xF9: ABY(true); SBC(memory->read(addr)); break;
+    case 0xE1: IZX(); SBC(memory->read(addr)); break;
+    case 0xF1: IZY(true); SBC(memory->read(addr)); break;
+
+    case 0xC9: CMP(a, IMM()); break;
+    case 0xC5: ZPG(); CMP(a, memory->read(addr)); break;
+    case 0xD5: ZPX(); CMP(a, memory->read(addr)); break;
+    case 0xCD: ABS(); CMP(a, memory->read(addr)); break;
+    case 0xDD: ABX(true); CMP(a, memory->read(addr)); break;
+    case 0xD9: ABY(true); CMP(a, memory->read(addr)); break;
+    case 0xC1: IZX(); CMP(a, memory->read(addr)); break;
+    case 0xD1: IZY(true); CMP(a, memory->read(addr)); break;
+
+    case 0xE0: CMP(x, IMM()); break;
+    case 0xE4: ZPG(); CMP(x, memory->read(addr)); break;
+    case 0xEC: ABS(); CMP(x, memory->read(addr)); break;
+
+    case 0xC0: CMP(y, IMM()); break;
+    case 0xC4: ZPG(); CMP(y, memory->read(addr)); break;
+    case 0xCC: ABS(); CMP(y, memory->read(addr)); break;
+
+    // Increments and decrements
+    case 0xE6: ZPG(); value = memory->read(addr) + 1; memory->write(addr, value); SET_ZN(value); break;
+    case 0xF6: ZPX(); value = memory->read(addr) + 1; memory->write(addr, value); SET_ZN(value); break;
+    case 0xEE: ABS(); value = memory->read(addr) + 1; memory->write(addr, value); SET_ZN(value); break;
+    case 0xFE: ABX(false); value = memory->read(addr) + 1; memory->write(addr, value); SET_ZN(value); break;
+
+    case 0xC6: ZPG(); value = memory->read(addr) - 1; memory->write(addr, value); SET_ZN(value); break;
+    case 0xD6: ZPX(); value = memory->read(addr) - 1; memory->write(addr, value); SET_ZN(value); break;
+    case 0xCE: ABS(); value = memory->read(addr) - 1; memory->write(addr, value); SET_ZN(value); break;
+    case 0xDE: ABX(false); value = memory->read(addr) - 1; memory->write(addr, value); SET_ZN(value); break;
+
+    case 0xE8: x++; SET_ZN(x); break;
+    case 0xCA: x--; SET_ZN(x); break;
+    case 0xC8: y++; SET_ZN(y); break;
+    case 0x88: y--; SET_ZN(y); break;
+
+    // Shifts
+    case 0x0A: ASL(a); break;
+    case 0x06: ZPG(); RMW(ASL); break;
+    case 0x16: ZPX(); RMW(ASL); break;
+    case 0x0E: ABS(); RMW(ASL); break;
+    case 0x1E: ABX(false); RMW(ASL); break;
+
+    case 0x4A: LSR(a); break;
+    case 0x46: ZPG(); RMW(LSR); break;
+    case 0x56: ZPX(); RMW(LSR); break;
+    case 0x4E: ABS(); RMW(LSR); break;
+    case 0x5E: ABX(false); RMW(LSR); break;
+
+    case 0x2A: ROL(a); break;
+    case 0x26: ZPG(); RMW(ROL); break;
+    case 0x36: ZPX(); RMW(ROL); break;
+    case 0x2E: ABS(); RMW(ROL); break;
+    case 0x3E: ABX(false); RMW(ROL); break;
+
+    case 0x6A: ROR(a); break;
+    case 0x66: ZPG(); RMW(ROR); break;
+    case 0x76: ZPX(); RMW(ROR); break;
+    case 0x6E: ABS(); RMW(ROR); break;
+    case 0x7E: ABX(false); RMW(ROR); break;
+
+    // Jumps and calls
+    case 0x4C: ABS(); pc = addr; break;
+    case 0x6C:
+        ABS();
+        pc = memory->read(addr) | (memory->read(addr + 1) << 8);
+        break;
+    case 0x20:
+        ABS();
+        PUSH((pc - 1) >> 8);
+        PUSH((pc - 1) & 0xFF);
+        pc = addr;
+        break;
+    case 0x60:
+        pc = PULL();
+        pc |= PULL() << 8;
+        pc++;
+        break;
+    case 0x40:
+        p = PULL();
+        lazy = false;
+        pc = PULL();
+        pc |= PULL() << 8;
+        break;
+
+    // Branches
+    case 0x10: BRANCH(!IS_NEGATIVE()); break;
+    case 0x30: BRANCH(IS_NEGATIVE()); break;
+    case 0x50: BRANCH(!(p & FLAG_OVERFLOW)); break;
+    case 0x70: BRANCH(p & FLAG_OVERFLOW); break;
+    case 0x90: BRANCH(!(p & FLAG_CARRY)); break;
+    case 0xB0: BRANCH(p & FLAG_CARRY); break;
+    case 0xD0: BRANCH(!IS_ZERO()); break;
+    case 0xF0: BRANCH(IS_ZERO()); break;
+
+    // Flag operations
+    case 0x18: p &= ~FLAG_CARRY; break;
+    case 0x38: p |= FLAG_CARRY; break;
+    case 0x58: p &= ~FLAG_INTERRUPT_DISABLE; break;
+    case 0x78: p |= FLAG_INTERRUPT_DISABLE; break;
+    case 0xB8: p &= ~FLAG_OVERFLOW; break;
+    case 0xD8: p &= ~FLAG_DECIMAL; break;
+    case 0xF8: p |= FLAG_DECIMAL; break;
+
+    case 0xEA: break;
+
+    case 0x00:
+        // Skip the padding byte, the interrupt handler does the rest
+        pc++;
+        state->interrupt = InterruptType::BRK;
+        cycles = 0;
+        break;
+
+    default:
+        // Unofficial opcodes are rare enough to take the table path; sync the
+        // registers out and back around the handler
+        CPUHelpers::check_for_illegal_opcode(opcode);
+        state->SP = sp;
+        state->A = a;
+        state->X = x;
+        state->Y = y;
+        state->P = p;
+        state->nz_result = nz;
+        state->nz_pending = lazy;
+        state->PC = pc - 1 + ins.length;
+        operand = argument;
+        cycles = Instructions::ins_table[opcode](this, memory);
+        pc = state->PC;
+        sp = state->SP;
+        a = state->A;
+        x = state->X;
+        y = state->Y;
+        p = state->P;
+        nz = state->nz_result;
+        lazy = state->nz_pending;
+        break;
+    }
+
+    state->PC = pc;
+    state->SP = sp;
+    state->A = a;
+    state->X = x;
+    state->Y = y;
+    state->P = p;
+    state->nz_result = nz;
+    state->nz_pending = lazy;
+
+    return cycles;
+}
+
+#undef IMM
+#undef ZPG
+#undef ZPX
+#undef ZPY
+#undef ABS
+#undef IZX
+#undef ABX
+#undef ABY
+#undef IZY
+#undef SET_ZN
+#undef SYNC_NZ
+#undef IS_ZERO
+#undef IS_NEGATIVE
+#undef SET_FLAG
+#undef ADC
+#undef SBC
+#undef CMP
+#undef BIT
+#undef ASL
+#undef LSR
+#undef ROL
+#undef ROR
+#undef RMW
+#undef BRANCH
+#undef PUSH
+#undef PULL
@@ -50,6 +50,24 @@ uint16_t CPUHelpers::adc(uint8_t op1, uint8_t op2, uint8_t carry)
     return result;
 }
 
+void CPUHelpers::add_with_carry(CPU* cpu, uint8_t value)
+{
+    uint8_t a = cpu->get_A();
+    uint16_t result = adc(a, value, cpu->get_C());
+
+    // Overflow when both operands share a sign that the result does not
+    cpu->set_C(result > 0xFF);
+    cpu->set_V((~(a ^ value) & (a ^ result) & 0x80) != 0);
+    cpu->set_A(result & 0xFF);
+    cpu->set_NZ(result & 0xFF);
+}
+
+void CPUHelpers::subtract_with_carry(CPU* cpu, uint8_t value)
+{
+    // A - M - (1 - C) == A + ~M + C
+    add_with_carry(cpu, ~value);
+}
+
 void CPUHelpers::log_cpu_status(CPU* cpu, Memory* memory, uint8_t opcode)
 {
     // Write to file in the format uppercased hex values with leading zeroes
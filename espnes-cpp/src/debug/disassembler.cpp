@@ -104,4 +104,46 @@ Disassembler::Instruction Disassembler::disassemble(uint16_t address)
     }
 
     return result;
+}
+
+uint16_t Disassembler::get_effective_address(const Instruction &ins)
+{
+    // Where the instruction would access memory or jump to with the current
+    // registers, 0 if it has no address
+    uint16_t operand16 = ins.operand1 | (ins.operand2 << 8);
+    switch (ins.addressingMode)
+    {
+    case AddressingMode::ZERO_PAGE:
+        return ins.operand1;
+    case AddressingMode::ZERO_PAGE_X:
+        return (ins.operand1 + cpu->get_X()) & 0xFF;
+    case AddressingMode::ZERO_PAGE_Y:
+        return (ins.operand1 + cpu->get_Y()) & 0xFF;
+    case AddressingMode::ABSOLUTE:
+        return operand16;
+    case AddressingMode::ABSOLUTE_X:
+        return (operand16 + cpu->get_X()) & 0xFFFF;
+    case AddressingMode::ABSOLUTE_Y:
+        return (operand16 + cpu->get_Y()) & 0xFFFF;
+    case AddressingMode::INDIRECT:
+    {
+        // The high byte does not carry into the next page
+        uint16_t high = (operand16 & 0xFF00) | ((operand16 + 1) & 0xFF);
+        return memory->read(operand16, false) | (memory->read(high, false) << 8);
+    }
+    case AddressingMode::INDIRECT_X:
+    {
+        uint8_t pointer = ins.operand1 + cpu->get_X();
+        return memory->read(pointer, false) | (memory->read((uint8_t)(pointer + 1), false) << 8);
+    }
+    case AddressingMode::INDIRECT_Y:
+    {
+        uint16_t base = memory->read(ins.operand1, false) | (memory->read((uint8_t)(ins.operand1 + 1), false) << 8);
+        return (base + cpu->get_Y()) & 0xFFFF;
+    }
+    case AddressingMode::RELATIVE:
+        return (ins.address + 2 + (int8_t)ins.operand1) & 0xFFFF;
+    default:
+        return 0;
+    }
 }
\ No newline at end of file
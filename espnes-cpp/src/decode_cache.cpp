@@ -0,0 +1,124 @@
+#include "../include/decode_cache.hpp"
+
+DecodeCache::DecodeCache()
+{
+    entries = new Entry[ENTRY_COUNT];
+    flush();
+}
+
+DecodeCache::~DecodeCache()
+{
+    delete[] entries;
+}
+
+void DecodeCache::flush()
+{
+    for (int i = 0; i < ENTRY_COUNT; i++)
+    {
+        entries[i].source = nullptr;
+    }
+}
+
+void DecodeCache::decode(Memory* memory, uint16_t pc, Entry& entry)
+{
+    // Read the opcode and its operand bytes through the bus
+    entry.opcode = memory->read(pc);
+    entry.length = Instructions::ins_length[entry.opcode];
+    entry.operand = 0;
+    entry.idle_loop = -1;
+
+    if (entry.length > 1)
+    {
+        entry.operand = memory->read(pc + 1);
+    }
+
+    if (entry.length > 2)
+    {
+        entry.operand |= memory->read(pc + 2) << 8;
+    }
+}
+
+bool DecodeCache::is_idle_loop(Memory* memory, uint16_t pc)
+{
+    // Only cached PRG-ROM code; loops in RAM could be rewritten under us
+    const Entry& first = fetch(memory, pc);
+    if (first.source == nullptr || &first != &entries[pc & 0x7FFF])
+    {
+        return false;
+    }
+
+    Entry& entry = entries[pc & 0x7FFF];
+    if (entry.idle_loop < 0)
+    {
+        entry.idle_loop = match_idle_loop(memory, pc) ? 1 : 0;
+    }
+
+    return entry.idle_loop == 1;
+}
+
+bool DecodeCache::match_idle_loop(Memory* memory, uint16_t pc)
+{
+    // Recognizes polling loops such as
+    //     loop: LDA $2002      (or LDX/LDY/BIT, zero page or absolute)
+    //           AND #$80       (optional AND/CMP immediate)
+    //           BPL loop
+    // reading RAM or PPUSTATUS. Each pass has no side effects beyond the
+    // idempotent status read, so the result can only change on a PPU event.
+    // Only vblank (bit 7) and sprite 0 hit (bit 6) are raised by scheduled
+    // events; sprite overflow is set while a line is drawn, so a PPUSTATUS
+    // poll that could see bit 5 or below isn't idle.
+    uint16_t addr = pc;
+    const Entry* ins = &fetch(memory, addr);
+
+    switch (ins->opcode)
+    {
+    case 0xA5: case 0xA6: case 0xA4: case 0x24: // zero page
+    case 0xAD: case 0xAE: case 0xAC: case 0x2C: // absolute
+        break;
+    default:
+        return false;
+    }
+
+    uint16_t target = ins->operand;
+    bool ram = target < 0x2000;
+    bool ppu_status = target >= 0x2000 && target < 0x4000 && (target & 7) == 2;
+    if (!ram && !ppu_status)
+    {
+        return false;
+    }
+
+    addr += ins->length;
+    ins = &fetch(memory, addr);
+
+    // AND #imm or CMP #imm, narrowing or widening the bits the branch sees
+    uint8_t tested = 0xFF;
+    bool compared = false;
+    if (ins->opcode == 0x29 || ins->opcode == 0xC9)
+    {
+        tested = ins->opcode == 0x29 ? (uint8_t)ins->operand : 0xFF;
+        compared = ins->opcode == 0xC9;
+        addr += ins->length;
+        ins = &fetch(memory, addr);
+    }
+
+    // Branch back to the load
+    if ((ins->opcode & 0x1F) != 0x10)
+    {
+        return false;
+    }
+
+    if (ppu_status)
+    {
+        // BPL/BMI and BVC/BVS see bit 7 or 6 only, unless a CMP set N
+        if (!compared && ins->opcode <= 0x70)
+        {
+            tested &= 0xC0;
+        }
+        if ((tested & ~0xC0) != 0)
+        {
+            return false;
+        }
+    }
+
+    return (uint16_t)(addr + 2 + (int8_t)ins->operand) == pc;
+}
@@ -1,20 +1,69 @@
+#include <cstdlib>
+#include <new>
 #include <string>
 #include "../include/emulator.hpp"
+#ifndef ESPNES_HEADLESS
+#include "../include/window.hpp"
+#endif
 
-Emulator::Emulator() : cpu(&memory), ppu(), apu(), window(), cartridge(), memory(& ppu, & apu, & cartridge, & controller), disassembler(&cpu, &memory), quit(false), paused(false)
+Emulator::Emulator(bool headless) : machine(), cpu(&machine, &memory), ppu(&machine), apu(), window(nullptr), cartridge(&machine), memory(&machine, & ppu, & apu, & cartridge, & controller), recompiled_code(&memory), disassembler(&cpu, &memory), quit(false), paused(false), frame_ended(false),
+    rewind_interval(1), frames_to_capture(1)
 {
     ppu.set_cpu(cpu);
+    ppu.set_cartridge(cartridge);
+    ppu.set_scheduler(scheduler);
+    ppu.schedule_events();
+    cpu.set_recompiled_code(&recompiled_code);
 
     memory.set_emulator(this);
+
+#ifndef ESPNES_HEADLESS
+    if (!headless)
+    {
+        window = new Window();
+    }
+#endif
 }
 
 Emulator::~Emulator()
 {
+#ifndef ESPNES_HEADLESS
+    delete window;
+#endif
+}
+
+void *Emulator::operator new(size_t size)
+{
+#ifdef _WIN32
+    void *pointer = _aligned_malloc(size, alignof(Emulator));
+#else
+    void *pointer = nullptr;
+    if (posix_memalign(&pointer, alignof(Emulator), size) != 0)
+    {
+        pointer = nullptr;
+    }
+#endif
+    if (pointer == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    return pointer;
+}
+
+void Emulator::operator delete(void *pointer)
+{
+#ifdef _WIN32
+    _aligned_free(pointer);
+#else
+    free(pointer);
+#endif
 }
 
-void Emulator::set_dma_triggered(bool dma_triggered)
+void Emulator::schedule_dma()
 {
-	this->dma_triggered = dma_triggered;
+    // The CPU is halted for the copy as soon as the write completes
+    scheduler.schedule(EVENT_DMA, scheduler.get_time());
 }
 
 uint16_t Emulator::get_PC()
@@ -22,6 +71,11 @@ uint16_t Emulator::get_PC()
     return cpu.get_PC();
 }
 
+RecompiledCode* Emulator::get_recompiled_code()
+{
+    return &recompiled_code;
+}
+
 Memory* Emulator::get_memory()
 {
 	return &memory;
@@ -37,26 +91,77 @@ PPU* Emulator::get_PPU()
     return &ppu;
 }
 
+Cartridge* Emulator::get_cartridge()
+{
+    return &cartridge;
+}
+
 bool Emulator::is_paused()
 {
     return paused;
 }
 
+bool Emulator::is_headless()
+{
+    return window == nullptr;
+}
+
+uint8_t* Emulator::get_frame_buffer()
+{
+    // Finish the lines the PPU has not caught up on yet
+    ppu.catch_up();
+    return ppu.get_frame_buffer();
+}
+
+const uint8_t* Emulator::get_frame_indices()
+{
+    // The frame before conversion, for callers that don't need colours
+    ppu.catch_up();
+    return ppu.get_frame_indices();
+}
+
+const uint8_t* Emulator::get_frame_emphasis()
+{
+    ppu.catch_up();
+    return ppu.get_frame_emphasis();
+}
+
+uint8_t* Emulator::get_ram()
+{
+    return memory.get_ram();
+}
+
+void Emulator::set_buttons(int port, uint8_t buttons)
+{
+    controller.set_buttons(port, buttons);
+}
+
 void Emulator::pause()
 {
     paused = !paused;
 }
 
+void Emulator::break_execution()
+{
+    // Several hits in one step all stop, unlike pause() which toggles
+    paused = true;
+}
+
 void Emulator::step()
 {
-    uint8_t cycles = cpu.run();
-    ppu.step(cycles * 3);
+    int cycles = cpu.run();
+    scheduler.advance(cycles * 3);
+    run_events();
 }
 
 void Emulator::reset()
 {
     cpu.reset();
     ppu.reset();
+
+    scheduler.reset();
+    ppu.set_scheduler(scheduler);
+    ppu.schedule_events();
 }
 
 Disassembler Emulator::get_disassembler()
@@ -66,40 +171,106 @@ Disassembler Emulator::get_disassembler()
 
 void Emulator::add_breakpoint(breakpoint_type_t type, uint16_t value)
 {
-    breakpoints.insert({ type, value });
+    std::string error;
+    add_breakpoint(type, value, "", error);
+}
+
+bool Emulator::add_breakpoint(breakpoint_type_t type, uint16_t value, const std::string &condition, std::string &error)
+{
+    if (!breakpoints.add(type, value, condition, error))
+    {
+        return false;
+    }
+
+    update_memory_watches();
+    return true;
 }
 
 void Emulator::clear_breakpoint(breakpoint_type_t type, uint16_t value)
 {
-	breakpoints.erase({ type, value });
+	breakpoints.remove(type, value);
+    update_memory_watches();
 }
 
 void Emulator::clear_all_breakpoints()
 {
     breakpoints.clear();
+    update_memory_watches();
 }
 
-bool Emulator::is_breakpoint(breakpoint_type_t type, long value)
+void Emulator::update_memory_watches()
 {
-    for (auto breakpoint : breakpoints)
+    // Pages holding a read or write breakpoint go through the slow path so Memory can check them
+    memory.map_pages();
+
+    for (auto breakpoint : breakpoints.get_all())
     {
-        if (breakpoint.type == type && breakpoint.address == value)
+        if (breakpoint.type == BREAKPOINT_TYPE_READ)
         {
-			return true;
-		}
-	}
-	return false;
+            memory.unmap_read_page(breakpoint.address >> 8);
+        }
+        else if (breakpoint.type == BREAKPOINT_TYPE_WRITE)
+        {
+            memory.unmap_write_page(breakpoint.address >> 8);
+        }
+    }
+}
+
+bool Emulator::is_breakpoint(breakpoint_type_t type, int64_t value)
+{
+    return breakpoints.is_set(type, value);
+}
+
+bool Emulator::hit_breakpoint(breakpoint_type_t type, int64_t value, uint16_t address, uint8_t data)
+{
+    if (!breakpoints.is_set(type, value))
+    {
+        return false;
+    }
+
+    const BreakpointCondition *condition = breakpoints.get_condition(type, (uint16_t)value);
+    if (condition == nullptr)
+    {
+        return true;
+    }
+
+    // Only gathered on a hit, so the PPU is caught up only when it matters
+    ppu.catch_up();
+
+    int64_t variables[CONDITION_VARIABLE_COUNT];
+    variables[CONDITION_A] = cpu.get_A();
+    variables[CONDITION_X] = cpu.get_X();
+    variables[CONDITION_Y] = cpu.get_Y();
+    variables[CONDITION_P] = cpu.get_P();
+    variables[CONDITION_SP] = cpu.get_SP();
+    variables[CONDITION_PC] = cpu.get_PC();
+    variables[CONDITION_CYCLES] = cpu.get_total_cycles();
+    variables[CONDITION_SCANLINE] = ppu.get_scanline();
+    variables[CONDITION_DOT] = ppu.get_cycle();
+    variables[CONDITION_FRAME] = ppu.get_frame();
+    variables[CONDITION_ADDRESS] = address;
+    variables[CONDITION_VALUE] = data;
+
+    return condition->evaluate(variables);
+}
+
+void Emulator::check_memory_breakpoint(breakpoint_type_t type, uint16_t address, uint8_t value)
+{
+    if (hit_breakpoint(type, address, address, value))
+    {
+        break_execution();
+    }
 }
 
 std::set<Breakpoint> Emulator::get_breakpoints()
 {
-    return breakpoints;
+    return breakpoints.get_all();
 }
 
 std::set<Breakpoint> Emulator::get_breakpoints_of_type(breakpoint_type_t type)
 {
 	std::set<Breakpoint> breakpoints_of_type;
-    for (auto breakpoint : breakpoints)
+    for (auto breakpoint : breakpoints.get_all())
     {
         if (breakpoint.type == type)
         {
@@ -111,59 +282,185 @@ std::set<Breakpoint> Emulator::get_breakpoints_of_type(breakpoint_type_t type)
 
 void Emulator::load_rom(const std::string& romPath)
 {
-    // Open the file
-    std::ifstream rom(romPath, std::ios::binary);
-    if (!rom)
+    // Map the file, or share the mapping of an instance already running it
+    std::string error;
+    std::shared_ptr<RomImage> image = RomImage::open(romPath, error);
+    if (image == nullptr)
     {
-        throw std::runtime_error("Failed to open ROM file");
+        throw std::runtime_error(error);
     }
 
-    // Read the header
-    std::vector<uint8_t> header(16);
-    rom.read(reinterpret_cast<char*>(header.data()), header.size());
+    load_rom(image);
 
-    // Check if ROM is valid (NES<EOF>)
-    if (header[0] != 0x4E || header[1] != 0x45 || header[2] != 0x53 || header[3] != 0x1A)
+    // Run the ROM's recompiled blocks if they have been built. Only NROM is
+    // compiled, the blocks assume PRG never moves.
+    if (image->get_mapper_number() == 0)
     {
-        throw std::runtime_error("Invalid ROM");
+        recompiled_code.load(RecompiledCode::module_path(romPath), cartridge.get_prg_crc());
     }
+}
 
-    // Get ROM info
-    int prg_rom_size = header[4] * 16384;
-    int chr_rom_size = header[5] * 8192;
-    int mapper = ((header[6] >> 4) | (header[7] & 0xF0));
-
-    // Check if ROM is supported
-    if (mapper != 0)
+void Emulator::load_rom(const std::shared_ptr<RomImage>& image)
+{
+    // Put PRG and CHR behind the cartridge's mapper, in place
+    if (!cartridge.load(image))
     {
         throw std::runtime_error("Unsupported mapper");
     }
+    update_memory_watches();
+    ppu.flush_tile_cache();
+    ppu.update_cartridge(MAPPER_MIRRORING_CHANGED | MAPPER_IRQ_CHANGED | MAPPER_CHR_CHANGED);
+    cpu.flush_decode_cache();
 
-    // Read PRG ROM
-    std::vector<uint8_t> prg_rom(prg_rom_size);
-    rom.read(reinterpret_cast<char*>(prg_rom.data()), prg_rom.size());
+    // History from another ROM is useless, and the state size may differ
+    if (rewind_buffer.is_allocated())
+    {
+        enable_rewind(rewind_buffer.get_capacity(), rewind_interval);
+    }
 
-    // Get the reset vector
-    uint16_t reset_vector = prg_rom[prg_rom_size - 4] | (prg_rom[prg_rom_size - 3] << 8);
+    // Get the reset vector from wherever the mapper put the last bank
+    uint16_t reset_vector = memory.read(CPU::RESET_VECTOR, false) | (memory.read(CPU::RESET_VECTOR + 1, false) << 8);
 
     // Load reset vector into memory
     Debug::debug_print("Reset vector: 0x%04X", reset_vector);
     this->reset_vector = reset_vector;
 
-    // Read CHR ROM
-    std::vector<uint8_t> chr_rom(chr_rom_size);
-    rom.read(reinterpret_cast<char*>(chr_rom.data()), chr_rom.size());
+    // Blocks compiled for the last ROM
+    recompiled_code.unload();
+}
+
+size_t Emulator::get_state_size()
+{
+    // A writer without a buffer only counts
+    StateWriter state(nullptr, 0);
+    write_state(state);
+    return sizeof(SaveStateHeader) + state.get_size();
+}
+
+size_t Emulator::save_state(uint8_t *buffer, size_t size)
+{
+    if (size < sizeof(SaveStateHeader))
+    {
+        return 0;
+    }
+
+    // Bring the PPU up to the master clock so the state carries no lag
+    ppu.catch_up();
+
+    // Components go first, the header is filled in once the size is known
+    StateWriter state(buffer + sizeof(SaveStateHeader), size - sizeof(SaveStateHeader));
+    write_state(state);
+    if (state.is_overflowed())
+    {
+        return 0;
+    }
+
+    SaveStateHeader header;
+    memcpy(header.magic, SAVE_STATE_MAGIC, sizeof(header.magic));
+    header.version = SAVE_STATE_VERSION;
+    header.size = (uint32_t)(sizeof(SaveStateHeader) + state.get_size());
+    header.rom_hash = cartridge.get_rom_hash();
+    header.reserved = 0;
+    memcpy(buffer, &header, sizeof(header));
+
+    return header.size;
+}
+
+bool Emulator::load_state(const uint8_t *buffer, size_t size)
+{
+    // Check everything up front, so a bad state can't half-load
+    SaveStateHeader header;
+    if (size < sizeof(header))
+    {
+        return false;
+    }
+    memcpy(&header, buffer, sizeof(header));
+
+    if (memcmp(header.magic, SAVE_STATE_MAGIC, sizeof(header.magic)) != 0 || header.version != SAVE_STATE_VERSION || header.size != size ||
+        header.rom_hash != cartridge.get_rom_hash() || size != get_state_size())
+    {
+        return false;
+    }
+
+    StateReader state(buffer + sizeof(header), size - sizeof(header));
+    state.read(&machine, sizeof(machine));
+    cartridge.load_state(state);
+    controller.load_state(state);
+    scheduler.load_state(state);
+    state.read_value(frame_ended);
+    state.read_value(reset_vector);
+
+    // Host pointers and what depends on them: PRG pages, nametable
+    // mirroring, the IRQ line and the decoded CHR, whose RAM was replaced.
+    // Sprite lines come from the OAM just loaded.
+    update_memory_watches();
+    ppu.flush_tile_cache();
+    ppu.flush_sprite_lines();
+    ppu.update_cartridge(MAPPER_MIRRORING_CHANGED | MAPPER_IRQ_CHANGED | MAPPER_CHR_CHANGED);
+
+    return !state.is_failed();
+}
+
+void Emulator::write_state(StateWriter &state)
+{
+    // Same order as load_state()
+    state.write(&machine, sizeof(machine));
+    cartridge.save_state(state);
+    controller.save_state(state);
+    scheduler.save_state(state);
+    state.write_value(frame_ended);
+    state.write_value(reset_vector);
+}
+
+void Emulator::enable_rewind(size_t capacity, int interval)
+{
+    // The state size is fixed per ROM, so this is the last allocation
+    rewind_state.assign(get_state_size(), 0);
+    rewind_buffer.allocate(capacity, rewind_state.size());
+    rewind_interval = interval > 0 ? interval : 1;
+    frames_to_capture = 1;
+}
+
+void Emulator::disable_rewind()
+{
+    rewind_buffer.release();
+    std::vector<uint8_t>().swap(rewind_state);
+}
+
+bool Emulator::rewind(int steps)
+{
+    const uint8_t *state = rewind_buffer.rewind(steps);
+    if (state == nullptr || !load_state(state, rewind_state.size()))
+    {
+        return false;
+    }
 
-    // Load PRG ROM into cartridge memory
-    cartridge.load(prg_rom.data(), prg_rom.size());
+    // Count the interval again from the restored frame
+    frames_to_capture = rewind_interval;
+    return true;
+}
+
+int Emulator::get_rewind_interval()
+{
+    return rewind_interval;
+}
+
+RewindBuffer *Emulator::get_rewind_buffer()
+{
+    return &rewind_buffer;
+}
 
-    // print out cartridge
-    // std::string cartridge_data;
-    // Debug::hex_to_string(prg_rom.data(), prg_rom.size(), cartridge_data);
-    // Debug::debug_print("PRG ROM: %s", cartridge_data.c_str());
+void Emulator::capture_rewind()
+{
+    // At vblank, so every capture is at the same point in a frame
+    if (!rewind_buffer.is_allocated() || --frames_to_capture > 0)
+    {
+        return;
+    }
+    frames_to_capture = rewind_interval;
 
-    // Load CHR ROM into PPU memory
-    ppu.load(chr_rom.data(), chr_rom.size());
+    save_state(rewind_state.data(), rewind_state.size());
+    rewind_buffer.push(rewind_state.data());
 }
 
 void Emulator::set_PC_to_reset_vector()
@@ -171,8 +468,70 @@ void Emulator::set_PC_to_reset_vector()
     cpu.set_PC(reset_vector);
 }
 
+void Emulator::run_dma()
+{
+    // DMA takes 513 or 514 cycles
+    ppu.catch_up();
+    int cycles = ppu.get_cycle() % 2 == 1 ? 514 : 513;
+
+    cpu.add_cycles(cycles);
+    scheduler.advance(cycles * 3);
+}
+
+void Emulator::run_events()
+{
+    EventType type;
+    while (scheduler.pop_due_event(type))
+    {
+        switch (type)
+        {
+        case EVENT_NMI:
+            cpu.set_interrupt(InterruptType::NMI);
+            break;
+        case EVENT_DMA:
+            run_dma();
+            break;
+        case EVENT_VBLANK:
+            ppu.handle_event(type);
+            frame_ended = true;
+            capture_rewind();
+            break;
+        default:
+            ppu.handle_event(type);
+            break;
+        }
+    }
+}
+
+int Emulator::run_block(int max_cycles)
+{
+    // Never run past the next event, so idle loops wake up on time
+    int budget = scheduler.get_cycles_to_next_event();
+    if (max_cycles < budget)
+    {
+        budget = max_cycles;
+    }
+
+    int cycles = cpu.run_block(budget);
+    scheduler.advance(cycles * 3);
+    run_events();
+
+    return cycles;
+}
+
 void Emulator::run()
 {
+    // Nothing to pace or draw, run as fast as the host allows
+    if (window == nullptr)
+    {
+        while (!quit)
+        {
+            run_cycles(CPU::CLOCK_SPEED / 60);
+        }
+        return;
+    }
+
+#ifndef ESPNES_HEADLESS
     auto start_time = std::chrono::high_resolution_clock::now();
     int cycles_to_run = 0;
 
@@ -188,99 +547,176 @@ void Emulator::run()
             elapsed = max_elapsed;
         }
         cycles_to_run = (elapsed * CPU::CLOCK_SPEED / 1000);
-        quit = window.poll_events();
+        quit = window->poll_events();
+
+        window->render(this);
+
+        run_cycles(cycles_to_run);
+
+        // render graphics, finishing any lines the PPU has not caught up on
+        ppu.catch_up();
+        window->post_render(ppu.get_frame_buffer());
+    }
+#endif
+}
+
+void Emulator::run_cycles(long cycles_to_run)
+{
+    while (cycles_to_run > 0 && !paused && !quit)
+    {
+        cycles_to_run -= run_slice(cycles_to_run > 0x10000 ? 0x10000 : (int)cycles_to_run);
+    }
+}
+
+RunStats Emulator::run_frames(int frames)
+{
+    RunStats stats = { 0, 0, 0, 0.0 };
+    int64_t start_cycles = cpu.get_total_cycles();
+    int64_t start_instructions = cpu.get_total_instructions();
+    auto start_time = std::chrono::high_resolution_clock::now();
 
-        window.render(this);
+    // Stops right after the vblank event, before any NMI it raised is taken
+    while (stats.frames < frames && !paused && !quit)
+    {
+        frame_ended = false;
+        while (!frame_ended && !paused && !quit)
+        {
+            run_slice(0x10000);
+        }
 
-        uint8_t cycles = 7;
-        while (cycles_to_run > 0)
+        if (frame_ended)
         {
-            if (paused)
-            {
-                break;
-            }
-
-            //log cpu
-            log_cpu();
-
-            uint8_t tmp_cycles = cpu.fetch_next_opcode_cycles();
-            // if adding cycles would cause scanline 241 cycle 1 to be executed, set vblank flag
-            if (ppu.get_scanline() == 240 && ppu.get_cycle() + tmp_cycles >= 330)
-            {
-                ppu.set_vblank_flag();
-            }
-
-            // check for oam dma
-            if (this->dma_triggered)
-            {
-				this->dma_triggered = false;
-
-                // DMA takes 513 or 514 cycles
-                if (ppu.get_cycle() % 2 == 1)
-                {
-					cpu.add_cycles(514);
-					ppu.add_cycles(514 * 3);
-				}
-                else
-                {
-					cpu.add_cycles(513);
-					ppu.add_cycles(513 * 3);
-				}
-			}
-
-            cycles = cpu.run();
-
-            cycles_to_run -= cycles;
-
-            ppu.step(cycles * 3);
-
-            check_for_breakpoints();
+            stats.frames++;
         }
+    }
+
+    auto end_time = std::chrono::high_resolution_clock::now();
+    stats.cycles = cpu.get_total_cycles() - start_cycles;
+    stats.instructions = cpu.get_total_instructions() - start_instructions;
+    stats.wall_time_ms = std::chrono::duration<double, std::milli>(end_time - start_time).count();
+    return stats;
+}
+
+RunStats Emulator::run_until_vblank()
+{
+    return run_frames(1);
+}
+
+int Emulator::run_slice(int max_cycles)
+{
+    // Without a trace or breakpoints to service per instruction, run whole
+    // blocks up to the next event
+    if (!tracer.is_enabled() && !breakpoints.is_armed_per_instruction())
+    {
+        return run_block(max_cycles);
+    }
 
-        // render graphics
-        window.post_render(ppu.get_frame_buffer());
+    // A pending interrupt is taken instead of the next instruction
+    if (tracer.is_enabled() && !cpu.is_interrupt_pending())
+    {
+        trace_instruction();
     }
+
+    int cycles = cpu.run();
+
+    scheduler.advance(cycles * 3);
+    run_events();
+
+    check_for_breakpoints();
+    return cycles;
+}
+
+void Emulator::stop()
+{
+    quit = true;
 }
 
-void Emulator::open_log_file()
+bool Emulator::start_trace(const std::string &path)
 {
-	log_file.open("log.txt", std::ios_base::app);
+    return tracer.start(path);
 }
 
-void Emulator::close_log_file()
+void Emulator::stop_trace()
 {
-	log_file.close();
+    tracer.stop();
 }
 
-void Emulator::log_cpu()
+bool Emulator::is_tracing()
 {
-    char buffer[256];
-    disassembler.get_opcode_info_str(buffer, sizeof(buffer));
+    return tracer.is_enabled();
+}
+
+void Emulator::trace_instruction()
+{
+    // The record shows where the PPU is at this instruction
+    ppu.catch_up();
+
+    Disassembler::Instruction ins = disassembler.disassemble(cpu.get_PC());
+
+    TraceRecord record;
+    record.cpu_cycles = cpu.get_total_cycles();
+    record.frame = ppu.get_frame();
+    record.pc = ins.address;
+    record.address = disassembler.get_effective_address(ins);
+    record.scanline = ppu.get_scanline();
+    record.dot = ppu.get_cycle();
+    record.opcode = ins.opcode;
+    record.operand1 = ins.length > 1 ? ins.operand1 : 0;
+    record.operand2 = ins.length > 2 ? ins.operand2 : 0;
+    record.a = cpu.get_A();
+    record.x = cpu.get_X();
+    record.y = cpu.get_Y();
+    record.p = cpu.get_P();
+    record.sp = cpu.get_SP();
+    record.reserved[0] = 0;
+    record.reserved[1] = 0;
+
+    // Only read what can be read without side effects
+    record.value = 0;
+    record.flags = 0;
+    switch (ins.addressingMode)
+    {
+    case Disassembler::IMPLIED:
+    case Disassembler::ACCUMULATOR:
+    case Disassembler::IMMEDIATE:
+    case Disassembler::RELATIVE:
+    case Disassembler::INDIRECT:
+        break;
+    default:
+        if (memory.get_read_page(record.address >> 8) != nullptr)
+        {
+            record.value = memory.read(record.address, false);
+            record.flags |= TRACE_HAS_VALUE;
+        }
+        break;
+    }
 
-     /*log in format C009  AD 02 20  LDA $2002 = 80                  A:00 X:FF Y:00 P:A4 SP:FF CYC:15*/
-    log_file << buffer;
-    log_file << "A:" << std::hex << std::uppercase << std::setfill('0') << std::setw(2) << (int)cpu.get_A() << " ";
-    log_file << "X:" << std::hex << std::uppercase << std::setfill('0') << std::setw(2) << (int)cpu.get_X() << " ";
-    log_file << "Y:" << std::hex << std::uppercase << std::setfill('0') << std::setw(2) << (int)cpu.get_Y() << " ";
-    log_file << "P:" << std::hex << std::uppercase << std::setfill('0') << std::setw(2) << (int)cpu.get_P() << " ";
-    log_file << "SP:" << std::hex << std::uppercase << std::setfill('0') << std::setw(2) << (int)cpu.get_SP() << " ";
-    log_file << "CYC:" << std::dec << std::uppercase << std::setfill('0') << std::setw(3) << ppu.get_total_cycles() << " ";
-    log_file << "PPU: " << std::dec << std::uppercase << std::setfill('0') << std::setw(3) << ppu.get_scanline() << ", " << std::dec << std::uppercase << std::setfill('0') << std::setw(3) << ppu.get_cycle() << "\n";
-    log_file.flush();
+    tracer.record(record);
 }
 
 void Emulator::check_for_breakpoints()
 {
-    if (is_breakpoint(BREAKPOINT_TYPE_ADDRESS, cpu.get_PC()))
+    uint16_t pc = cpu.get_PC();
+
+    if (breakpoints.is_armed(BREAKPOINT_TYPE_ADDRESS) && hit_breakpoint(BREAKPOINT_TYPE_ADDRESS, pc, pc, 0))
+    {
+		break_execution();
+    }
+    else if (breakpoints.is_armed(BREAKPOINT_TYPE_EXECUTION) && hit_breakpoint(BREAKPOINT_TYPE_EXECUTION, pc, pc, 0))
     {
-		pause();
+        break_execution();
     }
-    else if (is_breakpoint(BREAKPOINT_TYPE_CYCLE, cpu.get_total_cycles()))
+    else if (breakpoints.is_armed(BREAKPOINT_TYPE_CYCLE) && hit_breakpoint(BREAKPOINT_TYPE_CYCLE, cpu.get_total_cycles(), pc, 0))
     {
-		pause();
+		break_execution();
     }
-    else if (is_breakpoint(BREAKPOINT_TYPE_SCANLINE, ppu.get_scanline()))
+    else if (breakpoints.is_armed(BREAKPOINT_TYPE_SCANLINE))
     {
-		pause();
+        // Scanline breakpoints need the PPU's real position
+        ppu.catch_up();
+        if (hit_breakpoint(BREAKPOINT_TYPE_SCANLINE, ppu.get_scanline(), pc, 0))
+        {
+            break_execution();
+        }
 	}
 }
\ No newline at end of file
@@ -0,0 +1,212 @@
+#include <cstring>
+#include "../include/emulator_pool.hpp"
+
+EmulatorPool::EmulatorPool(int size, int threads, int observations) : observations(observations), inputs(nullptr), frames_per_step(0),
+    generation(0), busy(0), quit(false)
+{
+    for (int i = 0; i < size; i++)
+    {
+        emulators.push_back(std::unique_ptr<Emulator>(new Emulator(true)));
+    }
+
+    if ((observations & POOL_OBSERVE_FRAME) != 0)
+    {
+        frames.assign((size_t)size * FRAME_SIZE, 0);
+    }
+    if ((observations & POOL_OBSERVE_INDICES) != 0)
+    {
+        indices.assign((size_t)size * INDEX_FRAME_SIZE, 0);
+    }
+    if ((observations & POOL_OBSERVE_RAM) != 0)
+    {
+        ram.assign((size_t)size * RAM_SIZE, 0);
+    }
+
+    // No more workers than instances, and the caller is one of them
+    if (threads <= 0)
+    {
+        threads = (int)std::thread::hardware_concurrency();
+    }
+    if (threads > size)
+    {
+        threads = size;
+    }
+    if (threads < 1)
+    {
+        threads = 1;
+    }
+
+    std::vector<Slice>(threads).swap(slices);
+    for (int i = 0; i < threads; i++)
+    {
+        slices[i].next = 0;
+        slices[i].end = 0;
+    }
+    for (int i = 1; i < threads; i++)
+    {
+        this->threads.push_back(std::thread(&EmulatorPool::run_worker, this, i));
+    }
+}
+
+EmulatorPool::~EmulatorPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        quit = true;
+    }
+    start.notify_all();
+
+    for (size_t i = 0; i < threads.size(); i++)
+    {
+        threads[i].join();
+    }
+}
+
+void EmulatorPool::load_rom(const std::string &path)
+{
+    // The first instance maps the file, the rest share it
+    for (size_t i = 0; i < emulators.size(); i++)
+    {
+        emulators[i]->load_rom(path);
+    }
+
+    save_power_on_state();
+}
+
+void EmulatorPool::load_rom(const std::shared_ptr<RomImage> &image)
+{
+    for (size_t i = 0; i < emulators.size(); i++)
+    {
+        emulators[i]->load_rom(image);
+    }
+
+    save_power_on_state();
+}
+
+void EmulatorPool::save_power_on_state()
+{
+    power_on_state.clear();
+    if (!emulators.empty())
+    {
+        Emulator *first = emulators[0].get();
+        first->set_PC_to_reset_vector();
+        power_on_state.resize(first->get_state_size());
+        power_on_state.resize(first->save_state(power_on_state.data(), power_on_state.size()));
+    }
+
+    reset();
+}
+
+void EmulatorPool::reset()
+{
+    // Nothing to go back to before a ROM is loaded
+    if (power_on_state.empty())
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < emulators.size(); i++)
+    {
+        emulators[i]->load_state(power_on_state.data(), power_on_state.size());
+    }
+}
+
+void EmulatorPool::step(const uint8_t *inputs, int frames)
+{
+    this->inputs = inputs;
+    frames_per_step = frames;
+
+    // Even slices to start with, stealing evens out the rest
+    int size = (int)emulators.size();
+    int count = (int)slices.size();
+    for (int i = 0; i < count; i++)
+    {
+        slices[i].next = size * i / count;
+        slices[i].end = size * (i + 1) / count;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        busy = count;
+        generation++;
+    }
+    start.notify_all();
+
+    work(0);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    done.wait(lock, [this] { return busy == 0; });
+}
+
+void EmulatorPool::run_worker(int worker)
+{
+    uint64_t seen = 0;
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            start.wait(lock, [this, seen] { return quit || generation != seen; });
+            if (quit)
+            {
+                return;
+            }
+            seen = generation;
+        }
+
+        work(worker);
+    }
+}
+
+void EmulatorPool::work(int worker)
+{
+    // Own slice first, then the others' in turn until every one is empty
+    int count = (int)slices.size();
+    for (int i = 0; i < count; i++)
+    {
+        Slice &slice = slices[(worker + i) % count];
+        for (;;)
+        {
+            int index = slice.next.fetch_add(1);
+            if (index >= slice.end)
+            {
+                break;
+            }
+            step_instance(index);
+        }
+    }
+
+    bool last;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        last = --busy == 0;
+    }
+    if (last)
+    {
+        done.notify_one();
+    }
+}
+
+void EmulatorPool::step_instance(int index)
+{
+    Emulator *emulator = emulators[index].get();
+    if (inputs != nullptr)
+    {
+        emulator->set_buttons(0, inputs[index * 2]);
+        emulator->set_buttons(1, inputs[index * 2 + 1]);
+    }
+
+    emulator->run_frames(frames_per_step);
+
+    if ((observations & POOL_OBSERVE_FRAME) != 0)
+    {
+        memcpy(&frames[(size_t)index * FRAME_SIZE], emulator->get_frame_buffer(), FRAME_SIZE);
+    }
+    if ((observations & POOL_OBSERVE_INDICES) != 0)
+    {
+        memcpy(&indices[(size_t)index * INDEX_FRAME_SIZE], emulator->get_frame_indices(), INDEX_FRAME_SIZE);
+    }
+    if ((observations & POOL_OBSERVE_RAM) != 0)
+    {
+        memcpy(&ram[(size_t)index * RAM_SIZE], emulator->get_ram(), RAM_SIZE);
+    }
+}
\ No newline at end of file
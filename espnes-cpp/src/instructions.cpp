@@ -1,3097 +1,735 @@
 #include "../include/cpu.hpp"
 #include "../include/cpu_helpers.hpp"
 #include "../include/instructions.hpp"
+#include "../include/addressing_modes.hpp"
 
-// 0x00
-uint8_t Instructions::brk_impl(CPU* cpu, Memory* memory)
-{
-    // Fetch additional opcode for brk reason
-    cpu->fetch_opcode();
-
-    // set interrupt, rest of the work is done in interrupt handler
-    cpu->set_interrupt(InterruptType::BRK);
-
-    // returns 0 because the interrupt handler will return 7 cycles
-    return 0;
-}
+typedef AddressingModes::EffectiveAddress EffectiveAddress;
+typedef AddressingModes::ZeroPage ZeroPage;
+typedef AddressingModes::ZeroPageX ZeroPageX;
+typedef AddressingModes::ZeroPageY ZeroPageY;
+typedef AddressingModes::Absolute Absolute;
+typedef AddressingModes::AbsoluteX AbsoluteX;
+typedef AddressingModes::AbsoluteY AbsoluteY;
+typedef AddressingModes::IndirectX IndirectX;
+typedef AddressingModes::IndirectY IndirectY;
 
-// 0x01
-uint8_t Instructions::ora_x_ind(CPU* cpu, Memory* memory)
+static void compare(CPU* cpu, uint8_t reg, uint8_t value)
 {
-    // Get zero page address and add X register to it
-    uint8_t zpg_addr = AddressingModes::zero_page_x(cpu, memory);
-
-    // Get the 16-bit address stored at the zero page location
-    uint8_t lo = memory->read(zpg_addr & 0xFF);
-    uint8_t hi = memory->read((zpg_addr + 1) & 0xFF);
-    uint16_t addr = (hi << 8) | lo;
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // OR value with A
-    cpu->set_A(cpu->get_A() | val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_A() == 0);
-    cpu->set_N(cpu->get_A() & 0x80);
-
-    return 6;
+    cpu->set_C(reg >= value);
+    cpu->set_NZ(reg - value);
 }
 
-// 0x05
-uint8_t Instructions::ora_zpg(CPU* cpu, Memory* memory)
-{
-    // Get zero page address
-    uint8_t zpg_addr = AddressingModes::zero_page(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(zpg_addr);
-
-    // OR value with A
-    cpu->set_A(cpu->get_A() | val);
+// ---------------------------------------------------------------------------
+// Instruction shapes. Each template pairs an addressing mode with an operation
+// and the base cycle count from the opcode table.
+// ---------------------------------------------------------------------------
 
-    // Set flags
-    cpu->set_Z(cpu->get_A() == 0);
-    cpu->set_N(cpu->get_A() & 0x80);
-
-    return 3;
-}
-
-// 0x06
-uint8_t Instructions::asl_zpg(CPU* cpu, Memory* memory)
+// Read the operand and hand it to the operation; indexed modes take an extra
+// cycle when they cross a page
+template <class Mode, class Op, uint8_t Cycles>
+static uint8_t read_op(CPU* cpu, Memory* memory)
 {
-    // Get zero page address
-    uint8_t zpg_addr = AddressingModes::zero_page(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(zpg_addr);
-
-    // Shift value left
-    uint8_t result = val << 1;
-
-    // Write result to memory
-    memory->write(zpg_addr, result);
-
-    // Set flags
-    cpu->set_C(val & 0x80);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-
-    return 5;
+    EffectiveAddress ea = Mode::resolve(cpu, memory);
+    Op::execute(cpu, memory->read(ea.address));
+    return Cycles + ea.page_crossed;
 }
 
-// 0x08
-uint8_t Instructions::php_impl(CPU* cpu, Memory* memory)
+// Immediate operands come straight from the decoded instruction
+template <class Op, uint8_t Cycles>
+static uint8_t immediate_op(CPU* cpu, Memory* memory)
 {
-    // Push P onto stack with B and U flags set
-    CPUHelpers::push_to_stack8(cpu, memory, cpu->get_P() | CPU::FLAG_BREAK | CPU::FLAG_UNUSED);
-
-    return 3;
+    Op::execute(cpu, (uint8_t)cpu->get_operand());
+    return Cycles;
 }
 
-// 0x09
-uint8_t Instructions::ora_imm(CPU* cpu, Memory* memory)
+// Store a register value; stores always pay for the page cross up front
+template <class Mode, class Op, uint8_t Cycles>
+static uint8_t write_op(CPU* cpu, Memory* memory)
 {
-    // Get immediate value
-    uint8_t val = AddressingModes::immediate(cpu, memory);
-
-    // OR value with A
-    cpu->set_A(cpu->get_A() | val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_A() == 0);
-    cpu->set_N(cpu->get_A() & 0x80);
-
-    return 2;
+    EffectiveAddress ea = Mode::resolve(cpu, memory);
+    memory->write(ea.address, Op::value(cpu));
+    return Cycles;
 }
 
-// 0x0A
-uint8_t Instructions::asl_a(CPU* cpu, Memory* memory)
+// Read, modify and write back a memory operand
+template <class Mode, class Op, uint8_t Cycles>
+static uint8_t modify_op(CPU* cpu, Memory* memory)
 {
-    // Get A
-    uint8_t val = cpu->get_A();
-
-    // Shift value left
-    uint8_t result = val << 1;
-
-    // Write result to A
-    cpu->set_A(result);
-
-    // Set flags
-    cpu->set_C(val & 0x80);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-
-    return 2;
+    EffectiveAddress ea = Mode::resolve(cpu, memory);
+    uint8_t value = memory->read(ea.address);
+    memory->write(ea.address, Op::modify(cpu, value));
+    return Cycles;
 }
 
-// 0x0D
-uint8_t Instructions::ora_abs(CPU* cpu, Memory* memory)
+// Modify the accumulator in place
+template <class Op, uint8_t Cycles>
+static uint8_t accumulator_op(CPU* cpu, Memory* memory)
 {
-    // Get absolute address
-    uint16_t addr = AddressingModes::absolute(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // OR value with A
-    cpu->set_A(cpu->get_A() | val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_A() == 0);
-    cpu->set_N(cpu->get_A() & 0x80);
-
-    return 4;
+    cpu->set_A(Op::modify(cpu, cpu->get_A()));
+    return Cycles;
 }
 
-// 0x0E
-uint8_t Instructions::asl_abs(CPU* cpu, Memory* memory)
+// Unstable stores (SHX, SHY, AHX, TAS) AND the value with the high byte of the
+// base address + 1, and a page cross replaces the target high byte with it
+template <class Mode, class Op, uint8_t Cycles>
+static uint8_t store_high_op(CPU* cpu, Memory* memory)
 {
-    // Get absolute address
-    uint16_t addr = AddressingModes::absolute(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // Shift value left
-    uint8_t result = val << 1;
-
-    // Write result to memory
-    memory->write(addr, result);
-
-    // Set flags
-    cpu->set_C(val & 0x80);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-
-    return 6;
+    EffectiveAddress ea = Mode::resolve(cpu, memory);
+    uint8_t high = (ea.address >> 8) + (ea.page_crossed ? 0 : 1);
+    uint8_t value = Op::value(cpu) & high;
+    uint16_t addr = ea.page_crossed ? ((value << 8) | (ea.address & 0xFF)) : ea.address;
+    memory->write(addr, value);
+    return Cycles;
 }
 
-uint8_t Instructions::bpl_rel(CPU* cpu, Memory* memory)
+// Instructions without a memory operand, or that handle their own operands
+template <class Op, uint8_t Cycles>
+static uint8_t implied_op(CPU* cpu, Memory* memory)
 {
-    // Get relative address
-    int8_t offset = AddressingModes::relative(cpu, memory);
-    uint16_t originalPC = cpu->get_PC();
-    uint16_t addr = originalPC + offset;
-
-    // Check if negative flag is clear
-    if (!cpu->get_N())
-    {
-        // Branch
-        cpu->set_PC(addr);
-
-        // Add cycles if page boundary is crossed
-        if ((originalPC & 0xFF00) != (addr & 0xFF00))
-        {
-            return 4;
-        }
-        else
-        {
-            return 3;
-        }
-    }
-
-    return 2;
+    Op::execute(cpu, memory);
+    return Cycles;
 }
 
-
-// 0x11
-uint8_t Instructions::ora_ind_y(CPU* cpu, Memory* memory)
+// Branch when the flag matches; +1 cycle if taken, +2 if the target is on
+// another page
+template <bool (CPU::*Flag)(), bool Set>
+static uint8_t branch_op(CPU* cpu, Memory* memory)
 {
-    // Get zero page address
-    uint8_t zpg_addr = AddressingModes::zero_page(cpu, memory);
-
-    // Get the 16-bit address stored at the zero page location
-    uint8_t lo = memory->read(zpg_addr & 0xFF);
-    uint8_t hi = memory->read((zpg_addr + 1) & 0xFF);
-    uint16_t addr = (hi << 8) | lo;
-
-    // Add Y register to address
-    addr += cpu->get_Y();
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
+    int8_t offset = static_cast<int8_t>(cpu->get_operand());
 
-    // OR value with A
-    cpu->set_A(cpu->get_A() | val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_A() == 0);
-    cpu->set_N(cpu->get_A() & 0x80);
-
-    // Check if page boundary was crossed
-    if ((addr & 0xFF00) != (hi << 8))
+    // Test through the flag getter so a pending N/Z is not materialized
+    if ((cpu->*Flag)() != Set)
     {
-        return 6;
+        return 2;
     }
 
-    return 5;
-}
-
-// 0x15
-uint8_t Instructions::ora_zpg_x(CPU* cpu, Memory* memory)
-{
-    // Get zero page address and add X register to it
-    uint8_t zpg_addr = AddressingModes::zero_page_x(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(zpg_addr);
-
-    // OR value with A
-    cpu->set_A(cpu->get_A() | val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_A() == 0);
-    cpu->set_N(cpu->get_A() & 0x80);
-
-    return 4;
-}
-
-// 0x16
-uint8_t Instructions::asl_zpg_x(CPU* cpu, Memory* memory)
-{
-    // Get zero page address and add X register to it
-    uint8_t zpg_addr = AddressingModes::zero_page_x(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(zpg_addr);
-
-    // Shift value left
-    uint8_t result = val << 1;
-
-    // Write result to memory
-    memory->write(zpg_addr, result);
-
-    // Set flags
-    cpu->set_C(val & 0x80);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
+    uint16_t originalPC = cpu->get_PC();
+    uint16_t addr = originalPC + offset;
+    cpu->set_PC(addr);
 
-    return 6;
+    return ((originalPC & 0xFF00) != (addr & 0xFF00)) ? 4 : 3;
 }
 
-// 0x18
-uint8_t Instructions::clc_impl(CPU* cpu, Memory* memory)
-{
-    // Clear C flag
-    cpu->set_C(false);
+// ---------------------------------------------------------------------------
+// Read operations
+// ---------------------------------------------------------------------------
 
-    return 2;
-}
+struct Lda { static void execute(CPU* cpu, uint8_t value) { cpu->set_A(value); cpu->set_NZ(value); } };
+struct Ldx { static void execute(CPU* cpu, uint8_t value) { cpu->set_X(value); cpu->set_NZ(value); } };
+struct Ldy { static void execute(CPU* cpu, uint8_t value) { cpu->set_Y(value); cpu->set_NZ(value); } };
+struct And { static void execute(CPU* cpu, uint8_t value) { cpu->set_A(cpu->get_A() & value); cpu->set_NZ(cpu->get_A()); } };
+struct Ora { static void execute(CPU* cpu, uint8_t value) { cpu->set_A(cpu->get_A() | value); cpu->set_NZ(cpu->get_A()); } };
+struct Eor { static void execute(CPU* cpu, uint8_t value) { cpu->set_A(cpu->get_A() ^ value); cpu->set_NZ(cpu->get_A()); } };
+struct Adc { static void execute(CPU* cpu, uint8_t value) { CPUHelpers::add_with_carry(cpu, value); } };
+struct Sbc { static void execute(CPU* cpu, uint8_t value) { CPUHelpers::subtract_with_carry(cpu, value); } };
+struct Cmp { static void execute(CPU* cpu, uint8_t value) { compare(cpu, cpu->get_A(), value); } };
+struct Cpx { static void execute(CPU* cpu, uint8_t value) { compare(cpu, cpu->get_X(), value); } };
+struct Cpy { static void execute(CPU* cpu, uint8_t value) { compare(cpu, cpu->get_Y(), value); } };
 
-// 0x19
-uint8_t Instructions::ora_abs_y(CPU* cpu, Memory* memory)
+struct Bit
 {
-    bool page_crossed = false;
-
-    // Get absolute address and add Y register to it
-    uint16_t addr = AddressingModes::absolute_y(cpu, memory, &page_crossed);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // OR value with A
-    cpu->set_A(cpu->get_A() | val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_A() == 0);
-    cpu->set_N(cpu->get_A() & 0x80);
-
-    // Check if page boundary was crossed
-    if (page_crossed)
+    static void execute(CPU* cpu, uint8_t value)
     {
-        return 5;
+        // Z from A & M, N and V straight from the operand
+        cpu->set_Z((cpu->get_A() & value) == 0);
+        cpu->set_N(value & 0x80);
+        cpu->set_V(value & 0x40);
     }
+};
 
-    return 4;
-}
-
-// 0x1D
-uint8_t Instructions::ora_abs_x(CPU* cpu, Memory* memory)
-{
-    bool page_crossed = false;
-
-    // Get absolute address and add X register to it
-    uint16_t addr = AddressingModes::absolute_x(cpu, memory, &page_crossed);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // OR value with A
-    cpu->set_A(cpu->get_A() | val);
+// Unofficial reads
 
-    // Set flags
-    cpu->set_Z(cpu->get_A() == 0);
-    cpu->set_N(cpu->get_A() & 0x80);
+struct Lax { static void execute(CPU* cpu, uint8_t value) { cpu->set_A(value); cpu->set_X(value); cpu->set_NZ(value); } };
 
-    // Check if page boundary was crossed
-    if (page_crossed)
+struct Lxa
+{
+    static void execute(CPU* cpu, uint8_t value)
     {
-        return 5;
+        // Immediate LAX goes through the same unstable bus as XAA
+        uint8_t result = (cpu->get_A() | 0xEE) & value;
+        cpu->set_A(result);
+        cpu->set_X(result);
+        cpu->set_NZ(result);
     }
+};
 
-    return 4;
-}
-
-// 0x1E
-uint8_t Instructions::asl_abs_x(CPU* cpu, Memory* memory)
+struct Anc
 {
-    bool page_crossed = false;
-
-    // Get absolute address and add X register to it
-    uint16_t addr = AddressingModes::absolute_x(cpu, memory, &page_crossed);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // Shift value left
-    uint8_t result = val << 1;
-
-    // Write result to memory
-    memory->write(addr, result);
-
-    // Set flags
-    cpu->set_C(val & 0x80);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-
-    // Check if page boundary was crossed
-    if (page_crossed)
+    static void execute(CPU* cpu, uint8_t value)
     {
-        return 7;
+        And::execute(cpu, value);
+        cpu->set_C(cpu->get_A() & 0x80);
     }
+};
 
-    return 6;
-}
-
-// 0x20
-uint8_t Instructions::jsr_abs(CPU* cpu, Memory* memory)
-{
-    // Get absolute address
-    uint16_t addr = AddressingModes::absolute(cpu, memory);
-
-    // Push address of next instruction onto stack
-    CPUHelpers::push_to_stack16(cpu, memory, cpu->get_PC() - 1);
-
-    // Set PC to address
-    cpu->set_PC(addr);
-
-    return 6;
-}
-
-// 0x21
-uint8_t Instructions::and_x_ind(CPU* cpu, Memory* memory)
-{
-    // Get zero page address and add X register to it
-    uint8_t zpg_addr = AddressingModes::zero_page_x(cpu, memory);
-
-    // Get the 16-bit address stored at the zero page location
-    uint8_t lo = memory->read(zpg_addr & 0xFF);
-    uint8_t hi = memory->read((zpg_addr + 1) & 0xFF);
-    uint16_t addr = (hi << 8) | lo;
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // AND value with A
-    cpu->set_A(cpu->get_A() & val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_A() == 0);
-    cpu->set_N(cpu->get_A() & 0x80);
-
-    return 6;
-}
-
-// 0x24
-uint8_t Instructions::bit_zpg(CPU* cpu, Memory* memory)
-{
-    // Get zero page address
-    uint8_t zpg_addr = AddressingModes::zero_page(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(zpg_addr);
-
-    // AND value with A
-    uint8_t result = cpu->get_A() & val;
-
-    // Set flags
-    cpu->set_Z(result == 0);
-    cpu->set_N(val & 0x80);
-    cpu->set_V(val & 0x40);
-
-    return 3;
-}
-
-// 0x25
-uint8_t Instructions::and_zpg(CPU* cpu, Memory* memory)
+struct Alr
 {
-    // Get zero page address
-    uint8_t zpg_addr = AddressingModes::zero_page(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(zpg_addr);
-
-    // AND value with A
-    cpu->set_A(cpu->get_A() & val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_A() == 0);
-    cpu->set_N(cpu->get_A() & 0x80);
-
-    return 3;
-}
+    static void execute(CPU* cpu, uint8_t value)
+    {
+        uint8_t result = cpu->get_A() & value;
+        cpu->set_C(result & 0x01);
+        result >>= 1;
+        cpu->set_A(result);
+        cpu->set_NZ(result);
+    }
+};
 
-// 0x26
-uint8_t Instructions::rol_zpg(CPU* cpu, Memory* memory)
+struct Arr
 {
-    // Get zero page address
-    uint8_t zpg_addr = AddressingModes::zero_page(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(zpg_addr);
-
-    // Shift value left
-    uint8_t result = (val << 1) | cpu->get_C();
-
-    // Write result to memory
-    memory->write(zpg_addr, result);
-
-    // Set flags
-    cpu->set_C(val & 0x80);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-
-    return 5;
-}
+    static void execute(CPU* cpu, uint8_t value)
+    {
+        // AND then ROR, with C and V taken from bits 6 and 5 of the result
+        uint8_t result = ((cpu->get_A() & value) >> 1) | (cpu->get_C() ? 0x80 : 0);
+        cpu->set_A(result);
+        cpu->set_NZ(result);
+        cpu->set_C(result & 0x40);
+        cpu->set_V(((result >> 6) ^ (result >> 5)) & 0x01);
+    }
+};
 
-// 0x28
-uint8_t Instructions::plp_impl(CPU* cpu, Memory* memory)
+struct Xaa
 {
-    // Pull P from stack
-    cpu->set_P(CPUHelpers::pop_from_stack8(cpu, memory));
-
-    // Clear B and set U flag
-    cpu->set_B(false);
-    cpu->set_U(true);
-
-    return 4;
-}
+    static void execute(CPU* cpu, uint8_t value)
+    {
+        uint8_t result = (cpu->get_A() | 0xEE) & cpu->get_X() & value;
+        cpu->set_A(result);
+        cpu->set_NZ(result);
+    }
+};
 
-// 0x29
-uint8_t Instructions::and_imm(CPU* cpu, Memory* memory)
+struct Axs
 {
-    // Get immediate value
-    uint8_t val = AddressingModes::immediate(cpu, memory);
-
-    // AND value with A
-    cpu->set_A(cpu->get_A() & val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_A() == 0);
-    cpu->set_N(cpu->get_A() & 0x80);
-
-    return 2;
-}
+    static void execute(CPU* cpu, uint8_t value)
+    {
+        // X = (A & X) - M, flags as CMP
+        uint8_t ax = cpu->get_A() & cpu->get_X();
+        cpu->set_X(ax - value);
+        cpu->set_C(ax >= value);
+        cpu->set_NZ(cpu->get_X());
+    }
+};
 
-// 0x2A
-uint8_t Instructions::rol_a(CPU* cpu, Memory* memory)
+struct Las
 {
-    // Get A
-    uint8_t val = cpu->get_A();
-
-    // Shift value left
-    uint8_t result = (val << 1) | cpu->get_C();
-
-    // Write result to A
-    cpu->set_A(result);
+    static void execute(CPU* cpu, uint8_t value)
+    {
+        uint8_t result = value & cpu->get_SP();
+        cpu->set_A(result);
+        cpu->set_X(result);
+        cpu->set_SP(result);
+        cpu->set_NZ(result);
+    }
+};
 
-    // Set flags
-    cpu->set_C(val & 0x80);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
+// ---------------------------------------------------------------------------
+// Store operations
+// ---------------------------------------------------------------------------
 
-    return 2;
-}
+struct Sta { static uint8_t value(CPU* cpu) { return cpu->get_A(); } };
+struct Stx { static uint8_t value(CPU* cpu) { return cpu->get_X(); } };
+struct Sty { static uint8_t value(CPU* cpu) { return cpu->get_Y(); } };
+struct Sax { static uint8_t value(CPU* cpu) { return cpu->get_A() & cpu->get_X(); } };
+struct Ahx { static uint8_t value(CPU* cpu) { return cpu->get_A() & cpu->get_X(); } };
+struct Shx { static uint8_t value(CPU* cpu) { return cpu->get_X(); } };
+struct Shy { static uint8_t value(CPU* cpu) { return cpu->get_Y(); } };
 
-// 0x2C
-uint8_t Instructions::bit_abs(CPU* cpu, Memory* memory)
+struct Tas
 {
-    // Get absolute address
-    uint16_t addr = AddressingModes::absolute(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // AND value with A
-    uint8_t result = cpu->get_A() & val;
-
-    // Set flags
-    cpu->set_Z(result == 0);
-    cpu->set_N(val & 0x80);
-    cpu->set_V(val & 0x40);
+    static uint8_t value(CPU* cpu)
+    {
+        cpu->set_SP(cpu->get_A() & cpu->get_X());
+        return cpu->get_SP();
+    }
+};
 
-    return 4;
-}
+// ---------------------------------------------------------------------------
+// Read-modify-write operations
+// ---------------------------------------------------------------------------
 
-// 0x2D
-uint8_t Instructions::and_abs(CPU* cpu, Memory* memory)
+struct Asl
 {
-    // Get absolute address
-    uint16_t addr = AddressingModes::absolute(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // AND value with A
-    cpu->set_A(cpu->get_A() & val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_A() == 0);
-    cpu->set_N(cpu->get_A() & 0x80);
-
-    return 4;
-}
+    static uint8_t modify(CPU* cpu, uint8_t value)
+    {
+        uint8_t result = value << 1;
+        cpu->set_C(value & 0x80);
+        cpu->set_NZ(result);
+        return result;
+    }
+};
 
-// 0x2E
-uint8_t Instructions::rol_abs(CPU* cpu, Memory* memory)
+struct Lsr
 {
-    // Get absolute address
-    uint16_t addr = AddressingModes::absolute(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // Shift value left
-    uint8_t result = (val << 1) | cpu->get_C();
-
-    // Write result to memory
-    memory->write(addr, result);
-
-    // Set flags
-    cpu->set_C(val & 0x80);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-
-    return 6;
-}
+    static uint8_t modify(CPU* cpu, uint8_t value)
+    {
+        uint8_t result = value >> 1;
+        cpu->set_C(value & 0x01);
+        cpu->set_NZ(result);
+        return result;
+    }
+};
 
-// 0x30
-uint8_t Instructions::bmi_rel(CPU* cpu, Memory* memory)
+struct Rol
 {
-    // Get relative address
-    int8_t offset = AddressingModes::relative(cpu, memory);
-    uint16_t addr = cpu->get_PC() + offset;
-
-    // Check if negative flag is set
-    if (cpu->get_N())
+    static uint8_t modify(CPU* cpu, uint8_t value)
     {
-        // Branch
-        cpu->set_PC(addr);
-
-        // Add cycles if page boundary is crossed
-        if ((cpu->get_PC() & 0xFF00) != (addr & 0xFF00))
-        {
-            return 4;
-        }
-        else
-        {
-            return 3;
-        }
+        uint8_t result = (value << 1) | (cpu->get_C() ? 0x01 : 0);
+        cpu->set_C(value & 0x80);
+        cpu->set_NZ(result);
+        return result;
     }
+};
 
-    return 2;
-}
-
-// 0x31
-uint8_t Instructions::and_ind_y(CPU* cpu, Memory* memory)
+struct Ror
 {
-    // Get zero page address
-    uint8_t zpg_addr = AddressingModes::zero_page(cpu, memory);
-
-    // Get the 16-bit address stored at the zero page location
-    uint8_t lo = memory->read(zpg_addr & 0xFF);
-    uint8_t hi = memory->read((zpg_addr + 1) & 0xFF);
-    uint16_t addr = (hi << 8) | lo;
-
-    // Add Y register to address
-    addr += cpu->get_Y();
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // AND value with A
-    cpu->set_A(cpu->get_A() & val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_A() == 0);
-    cpu->set_N(cpu->get_A() & 0x80);
-
-    // Check if page boundary was crossed
-    if ((addr & 0xFF00) != (hi << 8))
+    static uint8_t modify(CPU* cpu, uint8_t value)
     {
-        return 6;
+        uint8_t result = (value >> 1) | (cpu->get_C() ? 0x80 : 0);
+        cpu->set_C(value & 0x01);
+        cpu->set_NZ(result);
+        return result;
     }
+};
 
-    return 5;
-}
-
-// 0x35
-uint8_t Instructions::and_zpg_x(CPU* cpu, Memory* memory)
-{
-    // Get zero page address and add X register to it
-    uint8_t zpg_addr = AddressingModes::zero_page_x(cpu, memory);
+struct Inc { static uint8_t modify(CPU* cpu, uint8_t value) { value++; cpu->set_NZ(value); return value; } };
+struct Dec { static uint8_t modify(CPU* cpu, uint8_t value) { value--; cpu->set_NZ(value); return value; } };
 
-    // Get value at the address
-    uint8_t val = memory->read(zpg_addr);
+// Unofficial combined operations: modify memory, then feed the result to A
 
-    // AND value with A
-    cpu->set_A(cpu->get_A() & val);
+struct Slo { static uint8_t modify(CPU* cpu, uint8_t value) { value = Asl::modify(cpu, value); Ora::execute(cpu, value); return value; } };
+struct Rla { static uint8_t modify(CPU* cpu, uint8_t value) { value = Rol::modify(cpu, value); And::execute(cpu, value); return value; } };
+struct Sre { static uint8_t modify(CPU* cpu, uint8_t value) { value = Lsr::modify(cpu, value); Eor::execute(cpu, value); return value; } };
+struct Rra { static uint8_t modify(CPU* cpu, uint8_t value) { value = Ror::modify(cpu, value); Adc::execute(cpu, value); return value; } };
+struct Dcp { static uint8_t modify(CPU* cpu, uint8_t value) { value--; Cmp::execute(cpu, value); return value; } };
+struct Isc { static uint8_t modify(CPU* cpu, uint8_t value) { value++; Sbc::execute(cpu, value); return value; } };
 
-    // Set flags
-    cpu->set_Z(cpu->get_A() == 0);
-    cpu->set_N(cpu->get_A() & 0x80);
+// ---------------------------------------------------------------------------
+// Implied operations
+// ---------------------------------------------------------------------------
 
-    return 4;
-}
+struct Tax { static void execute(CPU* cpu, Memory* memory) { cpu->set_X(cpu->get_A()); cpu->set_NZ(cpu->get_X()); } };
+struct Tay { static void execute(CPU* cpu, Memory* memory) { cpu->set_Y(cpu->get_A()); cpu->set_NZ(cpu->get_Y()); } };
+struct Txa { static void execute(CPU* cpu, Memory* memory) { cpu->set_A(cpu->get_X()); cpu->set_NZ(cpu->get_A()); } };
+struct Tya { static void execute(CPU* cpu, Memory* memory) { cpu->set_A(cpu->get_Y()); cpu->set_NZ(cpu->get_A()); } };
+struct Tsx { static void execute(CPU* cpu, Memory* memory) { cpu->set_X(cpu->get_SP()); cpu->set_NZ(cpu->get_X()); } };
+struct Txs { static void execute(CPU* cpu, Memory* memory) { cpu->set_SP(cpu->get_X()); } };
+struct Inx { static void execute(CPU* cpu, Memory* memory) { cpu->set_X(cpu->get_X() + 1); cpu->set_NZ(cpu->get_X()); } };
+struct Iny { static void execute(CPU* cpu, Memory* memory) { cpu->set_Y(cpu->get_Y() + 1); cpu->set_NZ(cpu->get_Y()); } };
+struct Dex { static void execute(CPU* cpu, Memory* memory) { cpu->set_X(cpu->get_X() - 1); cpu->set_NZ(cpu->get_X()); } };
+struct Dey { static void execute(CPU* cpu, Memory* memory) { cpu->set_Y(cpu->get_Y() - 1); cpu->set_NZ(cpu->get_Y()); } };
+struct Clc { static void execute(CPU* cpu, Memory* memory) { cpu->set_C(false); } };
+struct Sec { static void execute(CPU* cpu, Memory* memory) { cpu->set_C(true); } };
+struct Cli { static void execute(CPU* cpu, Memory* memory) { cpu->set_I(false); } };
+struct Sei { static void execute(CPU* cpu, Memory* memory) { cpu->set_I(true); } };
+struct Clv { static void execute(CPU* cpu, Memory* memory) { cpu->set_V(false); } };
+struct Cld { static void execute(CPU* cpu, Memory* memory) { cpu->set_D(false); } };
+struct Sed { static void execute(CPU* cpu, Memory* memory) { cpu->set_D(true); } };
 
-// 0x36
-uint8_t Instructions::rol_zpg_x(CPU* cpu, Memory* memory)
+struct Nop
 {
-    // Get zero page address and add X register to it
-    uint8_t zpg_addr = AddressingModes::zero_page_x(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(zpg_addr);
-
-    // Shift value left
-    uint8_t result = (val << 1) | cpu->get_C();
-
-    // Write result to memory
-    memory->write(zpg_addr, result);
-
-    // Set flags
-    cpu->set_C(val & 0x80);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-
-    return 6;
-}
+    static void execute(CPU* cpu, Memory* memory) {}
 
-// 0x38
-uint8_t Instructions::sec_impl(CPU* cpu, Memory* memory)
-{
-    // Set C flag
-    cpu->set_C(true);
+    // Unofficial NOPs with an operand still perform the read
+    static void execute(CPU* cpu, uint8_t value) {}
+};
 
-    return 2;
-}
+struct Pha { static void execute(CPU* cpu, Memory* memory) { CPUHelpers::push_to_stack8(cpu, memory, cpu->get_A()); } };
 
-// 0x39
-uint8_t Instructions::and_abs_y(CPU* cpu, Memory* memory)
+struct Php
 {
-    bool page_crossed = false;
-    // Get absolute address and add Y register to it
-    uint16_t addr = AddressingModes::absolute_y(cpu, memory, &page_crossed);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // AND value with A
-    cpu->set_A(cpu->get_A() & val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_A() == 0);
-    cpu->set_N(cpu->get_A() & 0x80);
-
-    // Check if page boundary was crossed
-    if (page_crossed)
+    static void execute(CPU* cpu, Memory* memory)
     {
-        return 5;
+        // Push P with B and U set
+        CPUHelpers::push_to_stack8(cpu, memory, cpu->get_P() | CPU::FLAG_BREAK | CPU::FLAG_UNUSED);
     }
+};
 
-    return 4;
-}
-
-// 0x3D
-uint8_t Instructions::and_abs_x(CPU* cpu, Memory* memory)
+struct Pla
 {
-    bool page_crossed = false;
-    // Get absolute address and add X register to it
-    uint16_t addr = AddressingModes::absolute_x(cpu, memory, &page_crossed);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // AND value with A
-    cpu->set_A(cpu->get_A() & val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_A() == 0);
-    cpu->set_N(cpu->get_A() & 0x80);
-
-    // Check if page boundary was crossed
-    if (page_crossed)
+    static void execute(CPU* cpu, Memory* memory)
     {
-        return 5;
+        cpu->set_A(CPUHelpers::pop_from_stack8(cpu, memory));
+        cpu->set_NZ(cpu->get_A());
     }
+};
 
-    return 4;
-}
-
-// 0x3E
-uint8_t Instructions::rol_abs_x(CPU* cpu, Memory* memory)
+struct Plp
 {
-    bool page_crossed = false;
-    // Get absolute address and add X register to it
-    uint16_t addr = AddressingModes::absolute_x(cpu, memory, &page_crossed);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // Shift value left
-    uint8_t result = (val << 1) | cpu->get_C();
-
-    // Write result to memory
-    memory->write(addr, result);
-
-    // Set flags
-    cpu->set_C(val & 0x80);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-
-    // Check if page boundary was crossed
-    if (page_crossed)
+    static void execute(CPU* cpu, Memory* memory)
     {
-        return 7;
+        // Pull P, clearing B and setting U
+        cpu->set_P(CPUHelpers::pop_from_stack8(cpu, memory));
+        cpu->set_B(false);
+        cpu->set_U(true);
     }
+};
 
-    return 6;
-}
-
-// 0x40
-uint8_t Instructions::rti_impl(CPU* cpu, Memory* memory)
-{
-    // Pull P from stack
-    uint8_t pulledP = CPUHelpers::pop_from_stack8(cpu, memory);
-    cpu->set_P(pulledP);
-
-    // Pull PC from stack
-    cpu->set_PC(CPUHelpers::pop_from_stack16(cpu, memory));
-
-    return 6;
-}
-
-// 0x41
-uint8_t Instructions::eor_x_ind(CPU* cpu, Memory* memory)
-{
-    // Get zero page address and add X register to it
-    uint8_t zpg_addr = AddressingModes::zero_page_x(cpu, memory);
-
-    // Get the 16-bit address stored at the zero page location
-    uint8_t lo = memory->read(zpg_addr & 0xFF);
-    uint8_t hi = memory->read((zpg_addr + 1) & 0xFF);
-    uint16_t addr = (hi << 8) | lo;
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // XOR value with A
-    cpu->set_A(cpu->get_A() ^ val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_A() == 0);
-    cpu->set_N(cpu->get_A() & 0x80);
-
-    return 6;
-}
-
-// 0x45
-uint8_t Instructions::eor_zpg(CPU* cpu, Memory* memory)
-{
-    // Get zero page address
-    uint8_t zpg_addr = AddressingModes::zero_page(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(zpg_addr);
-
-    // XOR value with A
-    cpu->set_A(cpu->get_A() ^ val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_A() == 0);
-    cpu->set_N(cpu->get_A() & 0x80);
-
-    return 3;
-}
-
-// 0x46
-uint8_t Instructions::lsr_zpg(CPU* cpu, Memory* memory)
-{
-    // Get zero page address
-    uint8_t zpg_addr = AddressingModes::zero_page(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(zpg_addr);
-
-    // Shift value right
-    uint8_t result = val >> 1;
-
-    // Write result to memory
-    memory->write(zpg_addr, result);
-
-    // Set flags
-    cpu->set_C(val & 0x01);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-
-    return 5;
-}
-
-// 0x48
-uint8_t Instructions::pha_impl(CPU* cpu, Memory* memory)
+struct JmpAbsolute
 {
-    if (cpu->get_PC() == 0xC860)
+    static void execute(CPU* cpu, Memory* memory)
     {
-        printf("PHA\n");
+        cpu->set_PC(cpu->get_operand());
     }
-    // Push A onto stack
-    CPUHelpers::push_to_stack8(cpu, memory, cpu->get_A());
-
-    return 3;
-}
+};
 
-// 0x49
-uint8_t Instructions::eor_imm(CPU* cpu, Memory* memory)
+struct JmpIndirect
 {
-    // Get immediate value
-    uint8_t val = AddressingModes::immediate(cpu, memory);
-
-    // XOR value with A
-    cpu->set_A(cpu->get_A() ^ val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_A() == 0);
-    cpu->set_N(cpu->get_A() & 0x80);
-
-    return 2;
-}
+    static void execute(CPU* cpu, Memory* memory)
+    {
+        uint16_t addr = cpu->get_operand();
+        cpu->set_PC(memory->read(addr) | (memory->read(addr + 1) << 8));
+    }
+};
 
-// 0x4A
-uint8_t Instructions::lsr_a(CPU* cpu, Memory* memory)
+struct Jsr
 {
-    // Get A
-    uint8_t val = cpu->get_A();
-
-    // Shift value right
-    uint8_t result = val >> 1;
-
-    // Write result to A
-    cpu->set_A(result);
-
-    // Set flags
-    cpu->set_C(val & 0x01);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-
-    return 2;
-}
+    static void execute(CPU* cpu, Memory* memory)
+    {
+        // Push the address of the last byte of this instruction
+        CPUHelpers::push_to_stack16(cpu, memory, cpu->get_PC() - 1);
+        cpu->set_PC(cpu->get_operand());
+    }
+};
 
-// 0x4C
-uint8_t Instructions::jmp_abs(CPU* cpu, Memory* memory)
+struct Rts
 {
-    // Get absolute address
-    uint16_t addr = AddressingModes::absolute(cpu, memory);
-
-    // Set PC to address
-    cpu->set_PC(addr);
-
-    return 3;
+    static void execute(CPU* cpu, Memory* memory)
+    {
+        cpu->set_PC(CPUHelpers::pop_from_stack16(cpu, memory) + 1);
+    }
+};
+
+struct Rti
+{
+    static void execute(CPU* cpu, Memory* memory)
+    {
+        cpu->set_P(CPUHelpers::pop_from_stack8(cpu, memory));
+        cpu->set_PC(CPUHelpers::pop_from_stack16(cpu, memory));
+    }
+};
+
+struct Brk
+{
+    static void execute(CPU* cpu, Memory* memory)
+    {
+        // The padding byte was consumed as the operand, the interrupt handler
+        // does the rest
+        cpu->set_interrupt(InterruptType::BRK);
+    }
+};
+
+struct Jam
+{
+    static void execute(CPU* cpu, Memory* memory)
+    {
+        // KIL locks the CPU up: keep fetching the same opcode until reset
+        cpu->set_PC(cpu->get_PC() - 1);
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Opcode table
+// ---------------------------------------------------------------------------
+
+const Instructions::InstructionFunction Instructions::ins_table[256] = {
+    implied_op<Brk, 0>,                          // 0x00 BRK
+    read_op<IndirectX, Ora, 6>,                  // 0x01 ORA
+    implied_op<Jam, 2>,                          // 0x02 KIL
+    modify_op<IndirectX, Slo, 8>,                // 0x03 SLO
+    read_op<ZeroPage, Nop, 3>,                   // 0x04 NOP
+    read_op<ZeroPage, Ora, 3>,                   // 0x05 ORA
+    modify_op<ZeroPage, Asl, 5>,                 // 0x06 ASL
+    modify_op<ZeroPage, Slo, 5>,                 // 0x07 SLO
+    implied_op<Php, 3>,                          // 0x08 PHP
+    immediate_op<Ora, 2>,                        // 0x09 ORA
+    accumulator_op<Asl, 2>,                      // 0x0A ASL
+    immediate_op<Anc, 2>,                        // 0x0B ANC
+    read_op<Absolute, Nop, 4>,                   // 0x0C NOP
+    read_op<Absolute, Ora, 4>,                   // 0x0D ORA
+    modify_op<Absolute, Asl, 6>,                 // 0x0E ASL
+    modify_op<Absolute, Slo, 6>,                 // 0x0F SLO
+    branch_op<&CPU::get_N, false>,               // 0x10 BPL
+    read_op<IndirectY, Ora, 5>,                  // 0x11 ORA
+    implied_op<Jam, 2>,                          // 0x12 KIL
+    modify_op<IndirectY, Slo, 8>,                // 0x13 SLO
+    read_op<ZeroPageX, Nop, 4>,                  // 0x14 NOP
+    read_op<ZeroPageX, Ora, 4>,                  // 0x15 ORA
+    modify_op<ZeroPageX, Asl, 6>,                // 0x16 ASL
+    modify_op<ZeroPageX, Slo, 6>,                // 0x17 SLO
+    implied_op<Clc, 2>,                          // 0x18 CLC
+    read_op<AbsoluteY, Ora, 4>,                  // 0x19 ORA
+    implied_op<Nop, 2>,                          // 0x1A NOP
+    modify_op<AbsoluteY, Slo, 7>,                // 0x1B SLO
+    read_op<AbsoluteX, Nop, 4>,                  // 0x1C NOP
+    read_op<AbsoluteX, Ora, 4>,                  // 0x1D ORA
+    modify_op<AbsoluteX, Asl, 7>,                // 0x1E ASL
+    modify_op<AbsoluteX, Slo, 7>,                // 0x1F SLO
+    implied_op<Jsr, 6>,                          // 0x20 JSR
+    read_op<IndirectX, And, 6>,                  // 0x21 AND
+    implied_op<Jam, 2>,                          // 0x22 KIL
+    modify_op<IndirectX, Rla, 8>,                // 0x23 RLA
+    read_op<ZeroPage, Bit, 3>,                   // 0x24 BIT
+    read_op<ZeroPage, And, 3>,                   // 0x25 AND
+    modify_op<ZeroPage, Rol, 5>,                 // 0x26 ROL
+    modify_op<ZeroPage, Rla, 5>,                 // 0x27 RLA
+    implied_op<Plp, 4>,                          // 0x28 PLP
+    immediate_op<And, 2>,                        // 0x29 AND
+    accumulator_op<Rol, 2>,                      // 0x2A ROL
+    immediate_op<Anc, 2>,                        // 0x2B ANC
+    read_op<Absolute, Bit, 4>,                   // 0x2C BIT
+    read_op<Absolute, And, 4>,                   // 0x2D AND
+    modify_op<Absolute, Rol, 6>,                 // 0x2E ROL
+    modify_op<Absolute, Rla, 6>,                 // 0x2F RLA
+    branch_op<&CPU::get_N, true>,                // 0x30 BMI
+    read_op<IndirectY, And, 5>,                  // 0x31 AND
+    implied_op<Jam, 2>,                          // 0x32 KIL
+    modify_op<IndirectY, Rla, 8>,                // 0x33 RLA
+    read_op<ZeroPageX, Nop, 4>,                  // 0x34 NOP
+    read_op<ZeroPageX, And, 4>,                  // 0x35 AND
+    modify_op<ZeroPageX, Rol, 6>,                // 0x36 ROL
+    modify_op<ZeroPageX, Rla, 6>,                // 0x37 RLA
+    implied_op<Sec, 2>,                          // 0x38 SEC
+    read_op<AbsoluteY, And, 4>,                  // 0x39 AND
+    implied_op<Nop, 2>,                          // 0x3A NOP
+    modify_op<AbsoluteY, Rla, 7>,                // 0x3B RLA
+    read_op<AbsoluteX, Nop, 4>,                  // 0x3C NOP
+    read_op<AbsoluteX, And, 4>,                  // 0x3D AND
+    modify_op<AbsoluteX, Rol, 7>,                // 0x3E ROL
+    modify_op<AbsoluteX, Rla, 7>,                // 0x3F RLA
+    implied_op<Rti, 6>,                          // 0x40 RTI
+    read_op<IndirectX, Eor, 6>,                  // 0x41 EOR
+    implied_op<Jam, 2>,                          // 0x42 KIL
+    modify_op<IndirectX, Sre, 8>,                // 0x43 SRE
+    read_op<ZeroPage, Nop, 3>,                   // 0x44 NOP
+    read_op<ZeroPage, Eor, 3>,                   // 0x45 EOR
+    modify_op<ZeroPage, Lsr, 5>,                 // 0x46 LSR
+    modify_op<ZeroPage, Sre, 5>,                 // 0x47 SRE
+    implied_op<Pha, 3>,                          // 0x48 PHA
+    immediate_op<Eor, 2>,                        // 0x49 EOR
+    accumulator_op<Lsr, 2>,                      // 0x4A LSR
+    immediate_op<Alr, 2>,                        // 0x4B ALR
+    implied_op<JmpAbsolute, 3>,                  // 0x4C JMP
+    read_op<Absolute, Eor, 4>,                   // 0x4D EOR
+    modify_op<Absolute, Lsr, 6>,                 // 0x4E LSR
+    modify_op<Absolute, Sre, 6>,                 // 0x4F SRE
+    branch_op<&CPU::get_V, false>,               // 0x50 BVC
+    read_op<IndirectY, Eor, 5>,                  // 0x51 EOR
+    implied_op<Jam, 2>,                          // 0x52 KIL
+    modify_op<IndirectY, Sre, 8>,                // 0x53 SRE
+    read_op<ZeroPageX, Nop, 4>,                  // 0x54 NOP
+    read_op<ZeroPageX, Eor, 4>,                  // 0x55 EOR
+    modify_op<ZeroPageX, Lsr, 6>,                // 0x56 LSR
+    modify_op<ZeroPageX, Sre, 6>,                // 0x57 SRE
+    implied_op<Cli, 2>,                          // 0x58 CLI
+    read_op<AbsoluteY, Eor, 4>,                  // 0x59 EOR
+    implied_op<Nop, 2>,                          // 0x5A NOP
+    modify_op<AbsoluteY, Sre, 7>,                // 0x5B SRE
+    read_op<AbsoluteX, Nop, 4>,                  // 0x5C NOP
+    read_op<AbsoluteX, Eor, 4>,                  // 0x5D EOR
+    modify_op<AbsoluteX, Lsr, 7>,                // 0x5E LSR
+    modify_op<AbsoluteX, Sre, 7>,                // 0x5F SRE
+    implied_op<Rts, 6>,                          // 0x60 RTS
+    read_op<IndirectX, Adc, 6>,                  // 0x61 ADC
+    implied_op<Jam, 2>,                          // 0x62 KIL
+    modify_op<IndirectX, Rra, 8>,                // 0x63 RRA
+    read_op<ZeroPage, Nop, 3>,                   // 0x64 NOP
+    read_op<ZeroPage, Adc, 3>,                   // 0x65 ADC
+    modify_op<ZeroPage, Ror, 5>,                 // 0x66 ROR
+    modify_op<ZeroPage, Rra, 5>,                 // 0x67 RRA
+    implied_op<Pla, 4>,                          // 0x68 PLA
+    immediate_op<Adc, 2>,                        // 0x69 ADC
+    accumulator_op<Ror, 2>,                      // 0x6A ROR
+    immediate_op<Arr, 2>,                        // 0x6B ARR
+    implied_op<JmpIndirect, 5>,                  // 0x6C JMP
+    read_op<Absolute, Adc, 4>,                   // 0x6D ADC
+    modify_op<Absolute, Ror, 6>,                 // 0x6E ROR
+    modify_op<Absolute, Rra, 6>,                 // 0x6F RRA
+    branch_op<&CPU::get_V, true>,                // 0x70 BVS
+    read_op<IndirectY, Adc, 5>,                  // 0x71 ADC
+    implied_op<Jam, 2>,                          // 0x72 KIL
+    modify_op<IndirectY, Rra, 8>,                // 0x73 RRA
+    read_op<ZeroPageX, Nop, 4>,                  // 0x74 NOP
+    read_op<ZeroPageX, Adc, 4>,                  // 0x75 ADC
+    modify_op<ZeroPageX, Ror, 6>,                // 0x76 ROR
+    modify_op<ZeroPageX, Rra, 6>,                // 0x77 RRA
+    implied_op<Sei, 2>,                          // 0x78 SEI
+    read_op<AbsoluteY, Adc, 4>,                  // 0x79 ADC
+    implied_op<Nop, 2>,                          // 0x7A NOP
+    modify_op<AbsoluteY, Rra, 7>,                // 0x7B RRA
+    read_op<AbsoluteX, Nop, 4>,                  // 0x7C NOP
+    read_op<AbsoluteX, Adc, 4>,                  // 0x7D ADC
+    modify_op<AbsoluteX, Ror, 7>,                // 0x7E ROR
+    modify_op<AbsoluteX, Rra, 7>,                // 0x7F RRA
+    immediate_op<Nop, 2>,                        // 0x80 NOP
+    write_op<IndirectX, Sta, 6>,                 // 0x81 STA
+    immediate_op<Nop, 2>,                        // 0x82 NOP
+    write_op<IndirectX, Sax, 6>,                 // 0x83 SAX
+    write_op<ZeroPage, Sty, 3>,                  // 0x84 STY
+    write_op<ZeroPage, Sta, 3>,                  // 0x85 STA
+    write_op<ZeroPage, Stx, 3>,                  // 0x86 STX
+    write_op<ZeroPage, Sax, 3>,                  // 0x87 SAX
+    implied_op<Dey, 2>,                          // 0x88 DEY
+    immediate_op<Nop, 2>,                        // 0x89 NOP
+    implied_op<Txa, 2>,                          // 0x8A TXA
+    immediate_op<Xaa, 2>,                        // 0x8B XAA
+    write_op<Absolute, Sty, 4>,                  // 0x8C STY
+    write_op<Absolute, Sta, 4>,                  // 0x8D STA
+    write_op<Absolute, Stx, 4>,                  // 0x8E STX
+    write_op<Absolute, Sax, 4>,                  // 0x8F SAX
+    branch_op<&CPU::get_C, false>,               // 0x90 BCC
+    write_op<IndirectY, Sta, 6>,                 // 0x91 STA
+    implied_op<Jam, 2>,                          // 0x92 KIL
+    store_high_op<IndirectY, Ahx, 6>,            // 0x93 AHX
+    write_op<ZeroPageX, Sty, 4>,                 // 0x94 STY
+    write_op<ZeroPageX, Sta, 4>,                 // 0x95 STA
+    write_op<ZeroPageY, Stx, 4>,                 // 0x96 STX
+    write_op<ZeroPageY, Sax, 4>,                 // 0x97 SAX
+    implied_op<Tya, 2>,                          // 0x98 TYA
+    write_op<AbsoluteY, Sta, 5>,                 // 0x99 STA
+    implied_op<Txs, 2>,                          // 0x9A TXS
+    store_high_op<AbsoluteY, Tas, 5>,            // 0x9B TAS
+    store_high_op<AbsoluteX, Shy, 5>,            // 0x9C SHY
+    write_op<AbsoluteX, Sta, 5>,                 // 0x9D STA
+    store_high_op<AbsoluteY, Shx, 5>,            // 0x9E SHX
+    store_high_op<AbsoluteY, Ahx, 5>,            // 0x9F AHX
+    immediate_op<Ldy, 2>,                        // 0xA0 LDY
+    read_op<IndirectX, Lda, 6>,                  // 0xA1 LDA
+    immediate_op<Ldx, 2>,                        // 0xA2 LDX
+    read_op<IndirectX, Lax, 6>,                  // 0xA3 LAX
+    read_op<ZeroPage, Ldy, 3>,                   // 0xA4 LDY
+    read_op<ZeroPage, Lda, 3>,                   // 0xA5 LDA
+    read_op<ZeroPage, Ldx, 3>,                   // 0xA6 LDX
+    read_op<ZeroPage, Lax, 3>,                   // 0xA7 LAX
+    implied_op<Tay, 2>,                          // 0xA8 TAY
+    immediate_op<Lda, 2>,                        // 0xA9 LDA
+    implied_op<Tax, 2>,                          // 0xAA TAX
+    immediate_op<Lxa, 2>,                        // 0xAB LAX
+    read_op<Absolute, Ldy, 4>,                   // 0xAC LDY
+    read_op<Absolute, Lda, 4>,                   // 0xAD LDA
+    read_op<Absolute, Ldx, 4>,                   // 0xAE LDX
+    read_op<Absolute, Lax, 4>,                   // 0xAF LAX
+    branch_op<&CPU::get_C, true>,                // 0xB0 BCS
+    read_op<IndirectY, Lda, 5>,                  // 0xB1 LDA
+    implied_op<Jam, 2>,                          // 0xB2 KIL
+    read_op<IndirectY, Lax, 5>,                  // 0xB3 LAX
+    read_op<ZeroPageX, Ldy, 4>,                  // 0xB4 LDY
+    read_op<ZeroPageX, Lda, 4>,                  // 0xB5 LDA
+    read_op<ZeroPageY, Ldx, 4>,                  // 0xB6 LDX
+    read_op<ZeroPageY, Lax, 4>,                  // 0xB7 LAX
+    implied_op<Clv, 2>,                          // 0xB8 CLV
+    read_op<AbsoluteY, Lda, 4>,                  // 0xB9 LDA
+    implied_op<Tsx, 2>,                          // 0xBA TSX
+    read_op<AbsoluteY, Las, 4>,                  // 0xBB LAS
+    read_op<AbsoluteX, Ldy, 4>,                  // 0xBC LDY
+    read_op<AbsoluteX, Lda, 4>,                  // 0xBD LDA
+    read_op<AbsoluteY, Ldx, 4>,                  // 0xBE LDX
+    read_op<AbsoluteY, Lax, 4>,                  // 0xBF LAX
+    immediate_op<Cpy, 2>,                        // 0xC0 CPY
+    read_op<IndirectX, Cmp, 6>,                  // 0xC1 CMP
+    immediate_op<Nop, 2>,                        // 0xC2 NOP
+    modify_op<IndirectX, Dcp, 8>,                // 0xC3 DCP
+    read_op<ZeroPage, Cpy, 3>,                   // 0xC4 CPY
+    read_op<ZeroPage, Cmp, 3>,                   // 0xC5 CMP
+    modify_op<ZeroPage, Dec, 5>,                 // 0xC6 DEC
+    modify_op<ZeroPage, Dcp, 5>,                 // 0xC7 DCP
+    implied_op<Iny, 2>,                          // 0xC8 INY
+    immediate_op<Cmp, 2>,                        // 0xC9 CMP
+    implied_op<Dex, 2>,                          // 0xCA DEX
+    immediate_op<Axs, 2>,                        // 0xCB AXS
+    read_op<Absolute, Cpy, 4>,                   // 0xCC CPY
+    read_op<Absolute, Cmp, 4>,                   // 0xCD CMP
+    modify_op<Absolute, Dec, 6>,                 // 0xCE DEC
+    modify_op<Absolute, Dcp, 6>,                 // 0xCF DCP
+    branch_op<&CPU::get_Z, false>,               // 0xD0 BNE
+    read_op<IndirectY, Cmp, 5>,                  // 0xD1 CMP
+    implied_op<Jam, 2>,                          // 0xD2 KIL
+    modify_op<IndirectY, Dcp, 8>,                // 0xD3 DCP
+    read_op<ZeroPageX, Nop, 4>,                  // 0xD4 NOP
+    read_op<ZeroPageX, Cmp, 4>,                  // 0xD5 CMP
+    modify_op<ZeroPageX, Dec, 6>,                // 0xD6 DEC
+    modify_op<ZeroPageX, Dcp, 6>,                // 0xD7 DCP
+    implied_op<Cld, 2>,                          // 0xD8 CLD
+    read_op<AbsoluteY, Cmp, 4>,                  // 0xD9 CMP
+    implied_op<Nop, 2>,                          // 0xDA NOP
+    modify_op<AbsoluteY, Dcp, 7>,                // 0xDB DCP
+    read_op<AbsoluteX, Nop, 4>,                  // 0xDC NOP
+    read_op<AbsoluteX, Cmp, 4>,                  // 0xDD CMP
+    modify_op<AbsoluteX, Dec, 7>,                // 0xDE DEC
+    modify_op<AbsoluteX, Dcp, 7>,                // 0xDF DCP
+    immediate_op<Cpx, 2>,                        // 0xE0 CPX
+    read_op<IndirectX, Sbc, 6>,                  // 0xE1 SBC
+    immediate_op<Nop, 2>,                        // 0xE2 NOP
+    modify_op<IndirectX, Isc, 8>,                // 0xE3 ISC
+    read_op<ZeroPage, Cpx, 3>,                   // 0xE4 CPX
+    read_op<ZeroPage, Sbc, 3>,                   // 0xE5 SBC
+    modify_op<ZeroPage, Inc, 5>,                 // 0xE6 INC
+    modify_op<ZeroPage, Isc, 5>,                 // 0xE7 ISC
+    implied_op<Inx, 2>,                          // 0xE8 INX
+    immediate_op<Sbc, 2>,                        // 0xE9 SBC
+    implied_op<Nop, 2>,                          // 0xEA NOP
+    immediate_op<Sbc, 2>,                        // 0xEB SBC
+    read_op<Absolute, Cpx, 4>,                   // 0xEC CPX
+    read_op<Absolute, Sbc, 4>,                   // 0xED SBC
+    modify_op<Absolute, Inc, 6>,                 // 0xEE INC
+    modify_op<Absolute, Isc, 6>,                 // 0xEF ISC
+    branch_op<&CPU::get_Z, true>,                // 0xF0 BEQ
+    read_op<IndirectY, Sbc, 5>,                  // 0xF1 SBC
+    implied_op<Jam, 2>,                          // 0xF2 KIL
+    modify_op<IndirectY, Isc, 8>,                // 0xF3 ISC
+    read_op<ZeroPageX, Nop, 4>,                  // 0xF4 NOP
+    read_op<ZeroPageX, Sbc, 4>,                  // 0xF5 SBC
+    modify_op<ZeroPageX, Inc, 6>,                // 0xF6 INC
+    modify_op<ZeroPageX, Isc, 6>,                // 0xF7 ISC
+    implied_op<Sed, 2>,                          // 0xF8 SED
+    read_op<AbsoluteY, Sbc, 4>,                  // 0xF9 SBC
+    implied_op<Nop, 2>,                          // 0xFA NOP
+    modify_op<AbsoluteY, Isc, 7>,                // 0xFB ISC
+    read_op<AbsoluteX, Nop, 4>,                  // 0xFC NOP
+    read_op<AbsoluteX, Sbc, 4>,                  // 0xFD SBC
+    modify_op<AbsoluteX, Inc, 7>,                // 0xFE INC
+    modify_op<AbsoluteX, Isc, 7>                 // 0xFF ISC
+};
+
+// Opcode + operand bytes; BRK counts its padding byte
+const uint8_t Instructions::ins_length[256] = {
+    2, 2, 1, 2, 2, 2, 2, 2, 1, 2, 1, 2, 3, 3, 3, 3, // 0x00
+    2, 2, 1, 2, 2, 2, 2, 2, 1, 3, 1, 3, 3, 3, 3, 3, // 0x10
+    3, 2, 1, 2, 2, 2, 2, 2, 1, 2, 1, 2, 3, 3, 3, 3, // 0x20
+    2, 2, 1, 2, 2, 2, 2, 2, 1, 3, 1, 3, 3, 3, 3, 3, // 0x30
+    1, 2, 1, 2, 2, 2, 2, 2, 1, 2, 1, 2, 3, 3, 3, 3, // 0x40
+    2, 2, 1, 2, 2, 2, 2, 2, 1, 3, 1, 3, 3, 3, 3, 3, // 0x50
+    1, 2, 1, 2, 2, 2, 2, 2, 1, 2, 1, 2, 3, 3, 3, 3, // 0x60
+    2, 2, 1, 2, 2, 2, 2, 2, 1, 3, 1, 3, 3, 3, 3, 3, // 0x70
+    2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 1, 2, 3, 3, 3, 3, // 0x80
+    2, 2, 1, 2, 2, 2, 2, 2, 1, 3, 1, 3, 3, 3, 3, 3, // 0x90
+    2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 1, 2, 3, 3, 3, 3, // 0xA0
+    2, 2, 1, 2, 2, 2, 2, 2, 1, 3, 1, 3, 3, 3, 3, 3, // 0xB0
+    2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 1, 2, 3, 3, 3, 3, // 0xC0
+    2, 2, 1, 2, 2, 2, 2, 2, 1, 3, 1, 3, 3, 3, 3, 3, // 0xD0
+    2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 1, 2, 3, 3, 3, 3, // 0xE0
+    2, 2, 1, 2, 2, 2, 2, 2, 1, 3, 1, 3, 3, 3, 3, 3  // 0xF0
+};
+
+bool Instructions::ends_block(uint8_t opcode)
+{
+    // Branches
+    if ((opcode & 0x1F) == 0x10)
+    {
+        return true;
+    }
+
+    switch (opcode)
+    {
+    case 0x00: // BRK
+    case 0x20: // JSR
+    case 0x40: // RTI
+    case 0x4C: // JMP abs
+    case 0x60: // RTS
+    case 0x6C: // JMP ind
+    case 0x02: case 0x12: case 0x22: case 0x32: // KIL
+    case 0x42: case 0x52: case 0x62: case 0x72:
+    case 0x92: case 0xB2: case 0xD2: case 0xF2:
+        return true;
+    }
+
+    return false;
 }
-
-// 0x4D
-uint8_t Instructions::eor_abs(CPU* cpu, Memory* memory)
-{
-    // Get absolute address
-    uint16_t addr = AddressingModes::absolute(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // XOR value with A
-    cpu->set_A(cpu->get_A() ^ val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_A() == 0);
-    cpu->set_N(cpu->get_A() & 0x80);
-
-    return 4;
-}
-
-// 0x4E
-uint8_t Instructions::lsr_abs(CPU* cpu, Memory* memory)
-{
-    // Get absolute address
-    uint16_t addr = AddressingModes::absolute(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // Shift value right
-    uint8_t result = val >> 1;
-
-    // Write result to memory
-    memory->write(addr, result);
-
-    // Set flags
-    cpu->set_C(val & 0x01);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-
-    return 6;
-}
-
-// 0x50
-uint8_t Instructions::bvc_rel(CPU* cpu, Memory* memory)
-{
-    // Get relative address
-    int8_t offset = AddressingModes::relative(cpu, memory);
-    uint16_t addr = cpu->get_PC() + offset;
-
-    // Check if overflow flag is clear
-    if (!cpu->get_V())
-    {
-        // Branch
-        cpu->set_PC(addr);
-
-        // Add cycles if page boundary is crossed
-        if ((cpu->get_PC() & 0xFF00) != (addr & 0xFF00))
-        {
-            return 4;
-        }
-        else
-        {
-            return 3;
-        }
-    }
-
-    return 2;
-}
-
-// 0x51
-uint8_t Instructions::eor_ind_y(CPU* cpu, Memory* memory)
-{
-    // Get zero page address
-    uint8_t zpg_addr = AddressingModes::zero_page(cpu, memory);
-
-    // Get the 16-bit address stored at the zero page location
-    uint8_t lo = memory->read(zpg_addr & 0xFF);
-    uint8_t hi = memory->read((zpg_addr + 1) & 0xFF);
-    uint16_t addr = (hi << 8) | lo;
-
-    // Add Y register to address
-    addr += cpu->get_Y();
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // XOR value with A
-    cpu->set_A(cpu->get_A() ^ val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_A() == 0);
-    cpu->set_N(cpu->get_A() & 0x80);
-
-    // Check if page boundary was crossed
-    if ((addr & 0xFF00) != (hi << 8))
-    {
-        return 6;
-    }
-
-    return 5;
-}
-
-// 0x55
-uint8_t Instructions::eor_zpg_x(CPU* cpu, Memory* memory)
-{
-    // Get zero page address and add X register to it
-    uint8_t zpg_addr = AddressingModes::zero_page_x(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(zpg_addr);
-
-    // XOR value with A
-    cpu->set_A(cpu->get_A() ^ val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_A() == 0);
-    cpu->set_N(cpu->get_A() & 0x80);
-
-    return 4;
-}
-
-// 0x56
-uint8_t Instructions::lsr_zpg_x(CPU* cpu, Memory* memory)
-{
-    // Get zero page address and add X register to it
-    uint8_t zpg_addr = AddressingModes::zero_page_x(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(zpg_addr);
-
-    // Shift value right
-    uint8_t result = val >> 1;
-
-    // Write result to memory
-    memory->write(zpg_addr, result);
-
-    // Set flags
-    cpu->set_C(val & 0x01);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-
-    return 6;
-}
-
-// 0x58
-uint8_t Instructions::cli_impl(CPU* cpu, Memory* memory)
-{
-    // Clear I flag
-    cpu->set_I(false);
-
-    return 2;
-}
-
-// 0x59
-uint8_t Instructions::eor_abs_y(CPU* cpu, Memory* memory)
-{
-    bool page_crossed = false;
-    // Get absolute address and add Y register to it
-    uint16_t addr = AddressingModes::absolute_y(cpu, memory, &page_crossed);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // XOR value with A
-    cpu->set_A(cpu->get_A() ^ val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_A() == 0);
-    cpu->set_N(cpu->get_A() & 0x80);
-
-    // Check if page boundary was crossed
-    if (page_crossed)
-    {
-        return 5;
-    }
-
-    return 4;
-}
-
-// 0x5D
-uint8_t Instructions::eor_abs_x(CPU* cpu, Memory* memory)
-{
-    bool page_crossed = false;
-    // Get absolute address and add X register to it
-    uint16_t addr = AddressingModes::absolute_x(cpu, memory, &page_crossed);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // XOR value with A
-    cpu->set_A(cpu->get_A() ^ val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_A() == 0);
-    cpu->set_N(cpu->get_A() & 0x80);
-
-    // Check if page boundary was crossed
-    if (page_crossed)
-    {
-        return 5;
-    }
-
-    return 4;
-}
-
-// 0x5E
-uint8_t Instructions::lsr_abs_x(CPU* cpu, Memory* memory)
-{
-    bool page_crossed = false;
-    // Get absolute address and add X register to it
-    uint16_t addr = AddressingModes::absolute_x(cpu, memory, &page_crossed);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // Shift value right
-    uint8_t result = val >> 1;
-
-    // Write result to memory
-    memory->write(addr, result);
-
-    // Set flags
-    cpu->set_C(val & 0x01);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-
-    // Check if page boundary was crossed
-    if (page_crossed)
-    {
-        return 7;
-    }
-
-    return 6;
-}
-
-// 0x60
-uint8_t Instructions::rts_impl(CPU* cpu, Memory* memory)
-{
-    // Pull PC from stack
-    cpu->set_PC(CPUHelpers::pop_from_stack16(cpu, memory));
-
-    // Increment PC
-    cpu->set_PC(cpu->get_PC() + 1);
-
-    return 6;
-}
-
-// 0x61
-uint8_t Instructions::adc_x_ind(CPU* cpu, Memory* memory)
-{
-    // Get zero page address and add X register to it
-    uint8_t zpg_addr = AddressingModes::zero_page_x(cpu, memory);
-
-    // Get the 16-bit address stored at the zero page location
-    uint8_t lo = memory->read(zpg_addr & 0xFF);
-    uint8_t hi = memory->read((zpg_addr + 1) & 0xFF);
-    uint16_t addr = (hi << 8) | lo;
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // Add value to A
-    uint16_t result = cpu->get_A() + val + cpu->get_C();
-
-    // Set A to result
-    cpu->set_A(result);
-
-    // Set flags
-    cpu->set_C(result > 0xFF);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-    cpu->set_V((cpu->get_A() ^ val) & (cpu->get_A() ^ result) & 0x80);
-
-    return 6;
-}
-
-// 0x65
-uint8_t Instructions::adc_zpg(CPU* cpu, Memory* memory)
-{
-    // Get zero page address
-    uint8_t zpg_addr = AddressingModes::zero_page(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(zpg_addr);
-
-    uint8_t originalA = cpu->get_A();
-    uint16_t result = originalA + val + cpu->get_C();
-
-    cpu->set_A(result & 0xFF);
-
-    // Set flags
-    cpu->set_C(result > 0xFF);
-    cpu->set_Z((result & 0xFF) == 0);
-    cpu->set_N(result & 0x80);
-    cpu->set_V(((originalA ^ (result & 0xFF)) & (val ^ (result & 0xFF)) & 0x80) != 0);
-
-    return 3;
-
-
-    return 3;
-}
-
-// 0x66
-uint8_t Instructions::ror_zpg(CPU* cpu, Memory* memory)
-{
-    // Get zero page address
-    uint8_t zpg_addr = AddressingModes::zero_page(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(zpg_addr);
-
-    // Rotate value right
-    uint8_t result = (val >> 1) | (cpu->get_C() << 7);
-
-    // Write result to memory
-    memory->write(zpg_addr, result);
-
-    // Set flags
-    cpu->set_C(val & 0x01);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-
-    return 5;
-}
-
-// 0x68
-uint8_t Instructions::pla_impl(CPU* cpu, Memory* memory)
-{
-    // Pull A from stack
-    cpu->set_A(CPUHelpers::pop_from_stack8(cpu, memory));
-
-    // Set flags
-    cpu->set_Z(cpu->get_A() == 0);
-    cpu->set_N(cpu->get_A() & 0x80);
-
-    return 4;
-}
-
-// 0x69
-uint8_t Instructions::adc_imm(CPU* cpu, Memory* memory)
-{
-    // Get immediate value
-    uint8_t val = AddressingModes::immediate(cpu, memory);
-
-    // Add value to A
-    uint16_t result = cpu->get_A() + val + cpu->get_C();
-
-    // Set A to result
-    cpu->set_A(result);
-
-    // Set flags
-    cpu->set_C(result > 0xFF);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-    cpu->set_V((cpu->get_A() ^ val) & (cpu->get_A() ^ result) & 0x80);
-
-    return 2;
-}
-
-// 0x6A
-uint8_t Instructions::ror_a(CPU* cpu, Memory* memory)
-{
-    // Get A
-    uint8_t val = cpu->get_A();
-
-    // Rotate value right
-    uint8_t result = (val >> 1) | (cpu->get_C() << 7);
-
-    // Write result to A
-    cpu->set_A(result);
-
-    // Set flags
-    cpu->set_C(val & 0x01);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-
-    return 2;
-}
-
-// 0x6C
-uint8_t Instructions::jmp_ind(CPU* cpu, Memory* memory)
-{
-    // Get absolute address
-    uint16_t addr = AddressingModes::indirect(cpu, memory);
-
-    // Set PC to address
-    cpu->set_PC(addr);
-
-    return 5;
-}
-
-// 0x6D
-uint8_t Instructions::adc_abs(CPU* cpu, Memory* memory)
-{
-    // Get absolute address
-    uint16_t addr = AddressingModes::absolute(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // Add value to A
-    uint16_t result = cpu->get_A() + val + cpu->get_C();
-
-    // Set A to result
-    cpu->set_A(result);
-
-    // Set flags
-    cpu->set_C(result > 0xFF);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-    cpu->set_V((cpu->get_A() ^ val) & (cpu->get_A() ^ result) & 0x80);
-
-    return 4;
-}
-
-// 0x6E
-uint8_t Instructions::ror_abs(CPU* cpu, Memory* memory)
-{
-    // Get absolute address
-    uint16_t addr = AddressingModes::absolute(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // Rotate value right
-    uint8_t result = (val >> 1) | (cpu->get_C() << 7);
-
-    // Write result to memory
-    memory->write(addr, result);
-
-    // Set flags
-    cpu->set_C(val & 0x01);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-
-    return 6;
-}
-
-// 0x70
-uint8_t Instructions::bvs_rel(CPU* cpu, Memory* memory)
-{
-    // Get relative address
-    int8_t offset = AddressingModes::relative(cpu, memory);
-    uint16_t addr = cpu->get_PC() + offset;
-
-    // Check if overflow flag is set
-    if (cpu->get_V())
-    {
-        // Branch
-        cpu->set_PC(addr);
-
-        // Add cycles if page boundary is crossed
-        if ((cpu->get_PC() & 0xFF00) != (addr & 0xFF00))
-        {
-            return 4;
-        }
-        else
-        {
-            return 3;
-        }
-    }
-
-    return 2;
-}
-
-// 0x71
-uint8_t Instructions::adc_ind_y(CPU* cpu, Memory* memory)
-{
-    // Get zero page address
-    uint8_t zpg_addr = AddressingModes::zero_page(cpu, memory);
-
-    // Get the 16-bit address stored at the zero page location
-    uint8_t lo = memory->read(zpg_addr & 0xFF);
-    uint8_t hi = memory->read((zpg_addr + 1) & 0xFF);
-    uint16_t addr = (hi << 8) | lo;
-
-    // Add Y register to address
-    addr += cpu->get_Y();
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // Add value to A
-    uint16_t result = cpu->get_A() + val + cpu->get_C();
-
-    // Set A to result
-    cpu->set_A(result);
-
-    // Set flags
-    cpu->set_C(result > 0xFF);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-    cpu->set_V((cpu->get_A() ^ val) & (cpu->get_A() ^ result) & 0x80);
-
-    // Check if page boundary was crossed
-    if ((addr & 0xFF00) != (hi << 8))
-    {
-        return 6;
-    }
-
-    return 5;
-}
-
-// 0x75
-uint8_t Instructions::adc_zpg_x(CPU* cpu, Memory* memory)
-{
-    // Get zero page address and add X register to it
-    uint8_t zpg_addr = AddressingModes::zero_page_x(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(zpg_addr);
-
-    // Add value to A
-    uint16_t result = cpu->get_A() + val + cpu->get_C();
-
-    // Set A to result
-    cpu->set_A(result);
-
-    // Set flags
-    cpu->set_C(result > 0xFF);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-    cpu->set_V((cpu->get_A() ^ val) & (cpu->get_A() ^ result) & 0x80);
-
-    return 4;
-}
-
-// 0x76
-uint8_t Instructions::ror_zpg_x(CPU* cpu, Memory* memory)
-{
-    // Get zero page address and add X register to it
-    uint8_t zpg_addr = AddressingModes::zero_page_x(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(zpg_addr);
-
-    // Rotate value right
-    uint8_t result = (val >> 1) | (cpu->get_C() << 7);
-
-    // Write result to memory
-    memory->write(zpg_addr, result);
-
-    // Set flags
-    cpu->set_C(val & 0x01);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-
-    return 6;
-}
-
-// 0x78
-uint8_t Instructions::sei_impl(CPU* cpu, Memory* memory)
-{
-    // Set I flag
-    cpu->set_I(true);
-
-    return 2;
-}
-
-// 0x79
-uint8_t Instructions::adc_abs_y(CPU* cpu, Memory* memory)
-{
-    bool page_crossed = false;
-    // Get absolute address and add Y register to it
-    uint16_t addr = AddressingModes::absolute_y(cpu, memory, &page_crossed);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // Add value to A
-    uint16_t result = cpu->get_A() + val + cpu->get_C();
-
-    // Set A to result
-    cpu->set_A(result);
-
-    // Set flags
-    cpu->set_C(result > 0xFF);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-    cpu->set_V((cpu->get_A() ^ val) & (cpu->get_A() ^ result) & 0x80);
-
-    // Check if page boundary was crossed
-    if (page_crossed)
-    {
-        return 5;
-    }
-
-    return 4;
-}
-
-// 0x7D
-uint8_t Instructions::adc_abs_x(CPU* cpu, Memory* memory)
-{
-    bool page_crossed = false;
-    // Get absolute address and add X register to it
-    uint16_t addr = AddressingModes::absolute_x(cpu, memory, &page_crossed);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // Add value to A
-    uint16_t result = cpu->get_A() + val + cpu->get_C();
-
-    // Set A to result
-    cpu->set_A(result);
-
-    // Set flags
-    cpu->set_C(result > 0xFF);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-    cpu->set_V((cpu->get_A() ^ val) & (cpu->get_A() ^ result) & 0x80);
-
-    // Check if page boundary was crossed
-    if (page_crossed)
-    {
-        return 5;
-    }
-
-    return 4;
-}
-
-// 0x7E
-uint8_t Instructions::ror_abs_x(CPU* cpu, Memory* memory)
-{
-    bool page_crossed = false;
-    // Get absolute address and add X register to it
-    uint16_t addr = AddressingModes::absolute_x(cpu, memory, &page_crossed);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // Rotate value right
-    uint8_t result = (val >> 1) | (cpu->get_C() << 7);
-
-    // Write result to memory
-    memory->write(addr, result);
-
-    // Set flags
-    cpu->set_C(val & 0x01);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-
-    // Check if page boundary was crossed
-    if (page_crossed)
-    {
-        return 7;
-    }
-
-    return 6;
-}
-
-// 0x81
-uint8_t Instructions::sta_x_ind(CPU* cpu, Memory* memory)
-{
-    // Get zero page address and add X register to it
-    uint8_t zpg_addr = AddressingModes::zero_page_x(cpu, memory);
-
-    // Get the 16-bit address stored at the zero page location
-    uint8_t lo = memory->read(zpg_addr & 0xFF);
-    uint8_t hi = memory->read((zpg_addr + 1) & 0xFF);
-    uint16_t addr = (hi << 8) | lo;
-
-    // Store A at the address
-    memory->write(addr, cpu->get_A());
-
-    return 6;
-}
-
-// 0x84
-uint8_t Instructions::sty_zpg(CPU* cpu, Memory* memory)
-{
-    // Get zero page address
-    uint8_t zpg_addr = AddressingModes::zero_page(cpu, memory);
-
-    // Store Y at the address
-    memory->write(zpg_addr, cpu->get_Y());
-
-    return 3;
-}
-
-// 0x85
-uint8_t Instructions::sta_zpg(CPU* cpu, Memory* memory)
-{
-    // Get zero page address
-    uint8_t zpg_addr = AddressingModes::zero_page(cpu, memory);
-
-    // Store A at the address
-    memory->write(zpg_addr, cpu->get_A());
-
-    return 3;
-}
-
-// 0x86
-uint8_t Instructions::stx_zpg(CPU* cpu, Memory* memory)
-{
-    // Get zero page address
-    uint8_t zpg_addr = AddressingModes::zero_page(cpu, memory);
-
-    // Store X at the address
-    memory->write(zpg_addr, cpu->get_X());
-
-    return 3;
-}
-
-// 0x88
-uint8_t Instructions::dey_impl(CPU* cpu, Memory* memory)
-{
-    // Decrement Y
-    cpu->set_Y(cpu->get_Y() - 1);
-
-    // Set flags
-    cpu->set_Z(cpu->get_Y() == 0);
-    cpu->set_N(cpu->get_Y() & 0x80);
-
-    return 2;
-}
-
-// 0x8A
-uint8_t Instructions::txa_impl(CPU* cpu, Memory* memory)
-{
-    // Transfer X to A
-    cpu->set_A(cpu->get_X());
-
-    // Set flags
-    cpu->set_Z(cpu->get_A() == 0);
-    cpu->set_N(cpu->get_A() & 0x80);
-
-    return 2;
-}
-
-// 0x8C
-uint8_t Instructions::sty_abs(CPU* cpu, Memory* memory)
-{
-    // Get absolute address
-    uint16_t addr = AddressingModes::absolute(cpu, memory);
-
-    // Store Y at the address
-    memory->write(addr, cpu->get_Y());
-
-    return 4;
-}
-
-// 0x8D
-uint8_t Instructions::sta_abs(CPU* cpu, Memory* memory)
-{
-    // Get absolute address
-    uint16_t addr = AddressingModes::absolute(cpu, memory);
-
-    // Store A at the address
-    memory->write(addr, cpu->get_A());
-
-    return 4;
-}
-
-// 0x8E
-uint8_t Instructions::stx_abs(CPU* cpu, Memory* memory)
-{
-    // Get absolute address
-    uint16_t addr = AddressingModes::absolute(cpu, memory);
-
-    // Store X at the address
-    memory->write(addr, cpu->get_X());
-
-    return 4;
-}
-
-// 0x90
-uint8_t Instructions::bcc_rel(CPU* cpu, Memory* memory)
-{
-    // Get relative address
-    int8_t offset = AddressingModes::relative(cpu, memory);
-    uint16_t originalPC = cpu->get_PC();
-    uint16_t addr = originalPC + offset;
-
-    // Check if carry flag is clear
-    if (!cpu->get_C())
-    {
-        // Branch
-        cpu->set_PC(addr);
-
-        // Add cycles if page boundary is crossed
-        if ((originalPC & 0xFF00) != (addr & 0xFF00))
-        {
-            return 4;
-        }
-        else
-        {
-            return 3;
-        }
-    }
-
-    return 2;
-}
-
-// 0x91
-uint8_t Instructions::sta_ind_y(CPU* cpu, Memory* memory)
-{
-    // Get zero page address
-    uint8_t zpg_addr = AddressingModes::zero_page(cpu, memory);
-
-    // Get the 16-bit address stored at the zero page location
-    uint8_t lo = memory->read(zpg_addr & 0xFF);
-    uint8_t hi = memory->read((zpg_addr + 1) & 0xFF);
-    uint16_t addr = (hi << 8) | lo;
-
-    // Add Y register to address
-    addr += cpu->get_Y();
-
-    // Store A at the address
-    memory->write(addr, cpu->get_A());
-
-    return 6;
-}
-
-// 0x94
-uint8_t Instructions::sty_zpg_x(CPU* cpu, Memory* memory)
-{
-    // Get zero page address and add X register to it
-    uint8_t zpg_addr = AddressingModes::zero_page_x(cpu, memory);
-
-    // Store Y at the address
-    memory->write(zpg_addr, cpu->get_Y());
-
-    return 4;
-}
-
-// 0x95
-uint8_t Instructions::sta_zpg_x(CPU* cpu, Memory* memory)
-{
-    // Get zero page address and add X register to it
-    uint8_t zpg_addr = AddressingModes::zero_page_x(cpu, memory);
-
-    // Store A at the address
-    memory->write(zpg_addr, cpu->get_A());
-
-    return 4;
-}
-
-// 0x96
-uint8_t Instructions::stx_zpg_y(CPU* cpu, Memory* memory)
-{
-    // Get zero page address and add Y register to it
-    uint8_t zpg_addr = AddressingModes::zero_page_y(cpu, memory);
-
-    // Store X at the address
-    memory->write(zpg_addr, cpu->get_X());
-
-    return 4;
-}
-
-// 0x98
-uint8_t Instructions::tya_impl(CPU* cpu, Memory* memory)
-{
-    // Transfer Y to A
-    cpu->set_A(cpu->get_Y());
-
-    // Set flags
-    cpu->set_Z(cpu->get_A() == 0);
-    cpu->set_N(cpu->get_A() & 0x80);
-
-    return 2;
-}
-
-// 0x99
-uint8_t Instructions::sta_abs_y(CPU* cpu, Memory* memory)
-{
-    bool page_crossed = false;
-    // Get absolute address and add Y register to it
-    uint16_t addr = AddressingModes::absolute_y(cpu, memory, &page_crossed);
-
-    // Store A at the address
-    memory->write(addr, cpu->get_A());
-
-    return 5;
-}
-
-// 0x9A
-uint8_t Instructions::txs_impl(CPU* cpu, Memory* memory)
-{
-    // Transfer X to SP
-    cpu->set_SP(cpu->get_X());
-
-    return 2;
-}
-
-// 0x9D
-uint8_t Instructions::sta_abs_x(CPU* cpu, Memory* memory)
-{
-    bool page_crossed = false;
-    // Get absolute address and add X register to it
-    uint16_t addr = AddressingModes::absolute_x(cpu, memory, &page_crossed);
-
-    // Store A at the address
-    memory->write(addr, cpu->get_A());
-
-    return 5;
-}
-
-// 0xA0
-uint8_t Instructions::ldy_imm(CPU* cpu, Memory* memory)
-{
-    // Get immediate value
-    uint8_t val = AddressingModes::immediate(cpu, memory);
-
-    // Set Y to value
-    cpu->set_Y(val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_Y() == 0);
-    cpu->set_N(cpu->get_Y() & 0x80);
-
-    return 2;
-}
-
-// 0xA1
-uint8_t Instructions::lda_x_ind(CPU* cpu, Memory* memory)
-{
-    // Get zero page address and add X register to it
-    uint8_t zpg_addr = AddressingModes::zero_page_x(cpu, memory);
-
-    // Get the 16-bit address stored at the zero page location
-    uint8_t lo = memory->read(zpg_addr & 0xFF);
-    uint8_t hi = memory->read((zpg_addr + 1) & 0xFF);
-    uint16_t addr = (hi << 8) | lo;
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // Set A to value
-    cpu->set_A(val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_A() == 0);
-    cpu->set_N(cpu->get_A() & 0x80);
-
-    return 6;
-}
-
-// 0xA2
-uint8_t Instructions::ldx_imm(CPU* cpu, Memory* memory)
-{
-    // Get immediate value
-    uint8_t val = AddressingModes::immediate(cpu, memory);
-
-    // Set X to value
-    cpu->set_X(val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_X() == 0);
-    cpu->set_N(cpu->get_X() & 0x80);
-
-    return 2;
-}
-
-// 0xA4
-uint8_t Instructions::ldy_zpg(CPU* cpu, Memory* memory)
-{
-    // Get zero page address
-    uint8_t zpg_addr = AddressingModes::zero_page(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(zpg_addr);
-
-    // Set Y to value
-    cpu->set_Y(val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_Y() == 0);
-    cpu->set_N(cpu->get_Y() & 0x80);
-
-    return 3;
-}
-
-// 0xA5
-uint8_t Instructions::lda_zpg(CPU* cpu, Memory* memory)
-{
-    // Get zero page address
-    uint8_t zpg_addr = AddressingModes::zero_page(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(zpg_addr);
-
-    // Set A to value
-    cpu->set_A(val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_A() == 0);
-    cpu->set_N(cpu->get_A() & 0x80);
-
-    return 3;
-}
-
-// 0xA6
-uint8_t Instructions::ldx_zpg(CPU* cpu, Memory* memory)
-{
-    // Get zero page address
-    uint8_t zpg_addr = AddressingModes::zero_page(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(zpg_addr);
-
-    // Set X to value
-    cpu->set_X(val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_X() == 0);
-    cpu->set_N(cpu->get_X() & 0x80);
-
-    return 3;
-}
-
-// 0xA8
-uint8_t Instructions::tay_impl(CPU* cpu, Memory* memory)
-{
-    // Transfer A to Y
-    cpu->set_Y(cpu->get_A());
-
-    // Set flags
-    cpu->set_Z(cpu->get_Y() == 0);
-    cpu->set_N(cpu->get_Y() & 0x80);
-
-    return 2;
-}
-
-// 0xA9
-uint8_t Instructions::lda_imm(CPU* cpu, Memory* memory)
-{
-    // Get immediate value
-    uint8_t val = AddressingModes::immediate(cpu, memory);
-
-    // Set A to value
-    cpu->set_A(val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_A() == 0);
-    cpu->set_N(cpu->get_A() & 0x80);
-
-    return 2;
-}
-
-// 0xAA
-uint8_t Instructions::tax_impl(CPU* cpu, Memory* memory)
-{
-    // Transfer A to X
-    cpu->set_X(cpu->get_A());
-
-    // Set flags
-    cpu->set_Z(cpu->get_X() == 0);
-    cpu->set_N(cpu->get_X() & 0x80);
-
-    return 2;
-}
-
-// 0xAC
-uint8_t Instructions::ldy_abs(CPU* cpu, Memory* memory)
-{
-    // Get absolute address
-    uint16_t addr = AddressingModes::absolute(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // Set Y to value
-    cpu->set_Y(val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_Y() == 0);
-    cpu->set_N(cpu->get_Y() & 0x80);
-
-    return 4;
-}
-
-// 0xAD
-uint8_t Instructions::lda_abs(CPU* cpu, Memory* memory)
-{
-    // Get absolute address
-    uint16_t addr = AddressingModes::absolute(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // Set A to value
-    cpu->set_A(val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_A() == 0);
-    cpu->set_N(cpu->get_A() & 0x80);
-
-    return 4;
-}
-
-// 0xAE
-uint8_t Instructions::ldx_abs(CPU* cpu, Memory* memory)
-{
-    // Get absolute address
-    uint16_t addr = AddressingModes::absolute(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // Set X to value
-    cpu->set_X(val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_X() == 0);
-    cpu->set_N(cpu->get_X() & 0x80);
-
-    return 4;
-}
-
-// 0xB0
-uint8_t Instructions::bcs_rel(CPU* cpu, Memory* memory)
-{
-    // Get relative address
-    int8_t offset = AddressingModes::relative(cpu, memory);
-    uint16_t addr = cpu->get_PC() + offset;
-
-    // Check if carry flag is set
-    if (cpu->get_C())
-    {
-        // Branch
-        cpu->set_PC(addr);
-
-        // Add cycles if page boundary is crossed
-        if ((cpu->get_PC() & 0xFF00) != (addr & 0xFF00))
-        {
-            return 4;
-        }
-        else
-        {
-            return 3;
-        }
-    }
-
-    return 2;
-}
-
-// 0xB1
-uint8_t Instructions::lda_ind_y(CPU* cpu, Memory* memory)
-{
-    // Get zero page address
-    uint8_t zpg_addr = AddressingModes::zero_page(cpu, memory);
-
-    // Get the 16-bit address stored at the zero page location
-    uint8_t lo = memory->read(zpg_addr & 0xFF);
-    uint8_t hi = memory->read((zpg_addr + 1) & 0xFF);
-    uint16_t addr = (hi << 8) | lo;
-
-    // Add Y register to address
-    addr += cpu->get_Y();
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // Set A to value
-    cpu->set_A(val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_A() == 0);
-    cpu->set_N(cpu->get_A() & 0x80);
-
-    // Check if page boundary was crossed
-    if ((addr & 0xFF00) != (hi << 8))
-    {
-        return 6;
-    }
-
-    return 5;
-}
-
-// 0xB4
-uint8_t Instructions::ldy_zpg_x(CPU* cpu, Memory* memory)
-{
-    // Get zero page address and add X register to it
-    uint8_t zpg_addr = AddressingModes::zero_page_x(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(zpg_addr);
-
-    // Set Y to value
-    cpu->set_Y(val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_Y() == 0);
-    cpu->set_N(cpu->get_Y() & 0x80);
-
-    return 4;
-}
-
-// 0xB5
-uint8_t Instructions::lda_zpg_x(CPU* cpu, Memory* memory)
-{
-    // Get zero page address and add X register to it
-    uint8_t zpg_addr = AddressingModes::zero_page_x(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(zpg_addr);
-
-    // Set A to value
-    cpu->set_A(val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_A() == 0);
-    cpu->set_N(cpu->get_A() & 0x80);
-
-    return 4;
-}
-
-// 0xB6
-uint8_t Instructions::ldx_zpg_y(CPU* cpu, Memory* memory)
-{
-    // Get zero page address and add Y register to it
-    uint8_t zpg_addr = AddressingModes::zero_page_y(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(zpg_addr);
-
-    // Set X to value
-    cpu->set_X(val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_X() == 0);
-    cpu->set_N(cpu->get_X() & 0x80);
-
-    return 4;
-}
-
-// 0xB8
-uint8_t Instructions::clv_impl(CPU* cpu, Memory* memory)
-{
-    // Clear V flag
-    cpu->set_V(false);
-
-    return 2;
-}
-
-// 0xB9
-uint8_t Instructions::lda_abs_y(CPU* cpu, Memory* memory)
-{
-    bool page_crossed = false;
-    // Get absolute address and add Y register to it
-    uint16_t addr = AddressingModes::absolute_y(cpu, memory, &page_crossed);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // Set A to value
-    cpu->set_A(val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_A() == 0);
-    cpu->set_N(cpu->get_A() & 0x80);
-
-    // Check if page boundary was crossed
-    if (page_crossed)
-    {
-        return 5;
-    }
-
-    return 4;
-}
-
-// 0xBA
-uint8_t Instructions::tsx_impl(CPU* cpu, Memory* memory)
-{
-    // Transfer SP to X
-    cpu->set_X(cpu->get_SP());
-
-    // Set flags
-    cpu->set_Z(cpu->get_X() == 0);
-    cpu->set_N(cpu->get_X() & 0x80);
-
-    return 2;
-}
-
-// 0xBC
-uint8_t Instructions::ldy_abs_x(CPU* cpu, Memory* memory)
-{
-    bool page_crossed = false;
-    // Get absolute address and add X register to it
-    uint16_t addr = AddressingModes::absolute_x(cpu, memory, &page_crossed);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // Set Y to value
-    cpu->set_Y(val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_Y() == 0);
-    cpu->set_N(cpu->get_Y() & 0x80);
-
-    // Check if page boundary was crossed
-    if (page_crossed)
-    {
-        return 5;
-    }
-
-    return 4;
-}
-
-// 0xBD
-uint8_t Instructions::lda_abs_x(CPU* cpu, Memory* memory)
-{
-    // Get absolute address and add X register to it
-    bool page_crossed = false;
-    uint16_t addr = AddressingModes::absolute_x(cpu, memory, &page_crossed);
-    uint8_t val = memory->read(addr);
-
-    cpu->set_A(val);
-
-    cpu->set_Z(val == 0);
-    cpu->set_N(val & 0x80);
-
-    // Check if page boundary was crossed
-    return page_crossed ? 5 : 4;
-}
-
-
-// 0xBE
-uint8_t Instructions::ldx_abs_y(CPU* cpu, Memory* memory)
-{
-    bool page_crossed = false;
-    // Get absolute address and add Y register to it
-    uint16_t addr = AddressingModes::absolute_y(cpu, memory, &page_crossed);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // Set X to value
-    cpu->set_X(val);
-
-    // Set flags
-    cpu->set_Z(cpu->get_X() == 0);
-    cpu->set_N(cpu->get_X() & 0x80);
-
-    // Check if page boundary was crossed
-    if (page_crossed)
-    {
-        return 5;
-    }
-
-    return 4;
-}
-
-// 0xC0
-uint8_t Instructions::cpy_imm(CPU* cpu, Memory* memory)
-{
-    // Get immediate value
-    uint8_t val = AddressingModes::immediate(cpu, memory);
-
-    // Compare Y to value
-    uint8_t result = cpu->get_Y() - val;
-
-    // Set flags
-    cpu->set_C(cpu->get_Y() >= val);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-
-    return 2;
-}
-
-// 0xC1
-uint8_t Instructions::cmp_x_ind(CPU* cpu, Memory* memory)
-{
-    // Get zero page address and add X register to it
-    uint8_t zpg_addr = AddressingModes::zero_page_x(cpu, memory);
-
-    // Get the 16-bit address stored at the zero page location
-    uint8_t lo = memory->read(zpg_addr & 0xFF);
-    uint8_t hi = memory->read((zpg_addr + 1) & 0xFF);
-    uint16_t addr = (hi << 8) | lo;
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // Compare A to value
-    uint8_t result = cpu->get_A() - val;
-
-    // Set flags
-    cpu->set_C(cpu->get_A() >= val);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-
-    return 6;
-}
-
-// 0xC4
-uint8_t Instructions::cpy_zpg(CPU* cpu, Memory* memory)
-{
-    // Get zero page address
-    uint8_t zpg_addr = AddressingModes::zero_page(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(zpg_addr);
-
-    // Compare Y to value
-    uint8_t result = cpu->get_Y() - val;
-
-    // Set flags
-    cpu->set_C(cpu->get_Y() >= val);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-
-    return 3;
-}
-
-// 0xC5
-uint8_t Instructions::cmp_zpg(CPU* cpu, Memory* memory)
-{
-    // Get zero page address
-    uint8_t zpg_addr = AddressingModes::zero_page(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(zpg_addr);
-
-    // Compare A to value
-    uint8_t result = cpu->get_A() - val;
-
-    // Set flags
-    cpu->set_C(cpu->get_A() >= val);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-
-    return 3;
-}
-
-// 0xC6
-uint8_t Instructions::dec_zpg(CPU* cpu, Memory* memory)
-{
-    // Get zero page address
-    uint8_t zpg_addr = AddressingModes::zero_page(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(zpg_addr);
-
-    // Decrement value
-    val--;
-
-    // Write value to memory
-    memory->write(zpg_addr, val);
-
-    // Set flags
-    cpu->set_Z(val == 0);
-    cpu->set_N(val & 0x80);
-
-    return 5;
-}
-
-// 0xC8
-uint8_t Instructions::iny_impl(CPU* cpu, Memory* memory)
-{
-    // Increment Y
-    cpu->set_Y(cpu->get_Y() + 1);
-
-    // Set flags
-    cpu->set_Z(cpu->get_Y() == 0);
-    cpu->set_N(cpu->get_Y() & 0x80);
-
-    return 2;
-}
-
-// 0xC9
-uint8_t Instructions::cmp_imm(CPU* cpu, Memory* memory)
-{
-    // Get immediate value
-    uint8_t val = AddressingModes::immediate(cpu, memory);
-
-    // Compare A to value
-    uint8_t result = cpu->get_A() - val;
-
-    // Set flags
-    cpu->set_C(cpu->get_A() >= val);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-
-    return 2;
-}
-
-// 0xCA
-uint8_t Instructions::dex_impl(CPU* cpu, Memory* memory)
-{
-    // Decrement X
-    cpu->set_X(cpu->get_X() - 1);
-
-    // Set flags
-    cpu->set_Z(cpu->get_X() == 0);
-    cpu->set_N(cpu->get_X() & 0x80);
-
-    return 2;
-}
-
-// 0xCC
-uint8_t Instructions::cpy_abs(CPU* cpu, Memory* memory)
-{
-    // Get absolute address
-    uint16_t addr = AddressingModes::absolute(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // Compare Y to value
-    uint8_t result = cpu->get_Y() - val;
-
-    // Set flags
-    cpu->set_C(cpu->get_Y() >= val);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-
-    return 4;
-}
-
-// 0xCD
-uint8_t Instructions::cmp_abs(CPU* cpu, Memory* memory)
-{
-    // Get absolute address
-    uint16_t addr = AddressingModes::absolute(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // Compare A to value
-    uint8_t result = cpu->get_A() - val;
-
-    // Set flags
-    cpu->set_C(cpu->get_A() >= val);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-
-    return 4;
-}
-
-// 0xCE
-uint8_t Instructions::dec_abs(CPU* cpu, Memory* memory)
-{
-    // Get absolute address
-    uint16_t addr = AddressingModes::absolute(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // Decrement value
-    val--;
-
-    // Write value to memory
-    memory->write(addr, val);
-
-    // Set flags
-    cpu->set_Z(val == 0);
-    cpu->set_N(val & 0x80);
-
-    return 6;
-}
-
-// 0xD0
-uint8_t Instructions::bne_rel(CPU* cpu, Memory* memory)
-{
-    // Get relative address
-    int8_t offset = AddressingModes::relative(cpu, memory);
-    uint16_t originalPC = cpu->get_PC();
-    uint16_t addr = originalPC + offset;
-
-    // Check if zero flag is clear
-    if (!cpu->get_Z())
-    {
-        // Branch
-        // Add cycles if page boundary is crossed
-        if ((originalPC & 0xFF00) != (addr & 0xFF00))
-        {
-            cpu->set_PC(addr);
-            return 4;
-        }
-        else
-        {
-            cpu->set_PC(addr);
-            return 3;
-        }
-    }
-
-    return 2;
-}
-
-
-// 0xD1
-uint8_t Instructions::cmp_ind_y(CPU* cpu, Memory* memory)
-{
-    // Get zero page address
-    uint8_t zpg_addr = AddressingModes::zero_page(cpu, memory);
-
-    // Get the 16-bit address stored at the zero page location
-    uint8_t lo = memory->read(zpg_addr & 0xFF);
-    uint8_t hi = memory->read((zpg_addr + 1) & 0xFF);
-    uint16_t addr = (hi << 8) | lo;
-
-    // Add Y register to address
-    addr += cpu->get_Y();
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // Compare A to value
-    uint8_t result = cpu->get_A() - val;
-
-    // Set flags
-    cpu->set_C(cpu->get_A() >= val);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-
-    // Check if page boundary was crossed
-    if ((addr & 0xFF00) != (hi << 8))
-    {
-        return 6;
-    }
-
-    return 5;
-}
-
-// 0xD5
-uint8_t Instructions::cmp_zpg_x(CPU* cpu, Memory* memory)
-{
-    // Get zero page address and add X register to it
-    uint8_t zpg_addr = AddressingModes::zero_page_x(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(zpg_addr);
-
-    // Compare A to value
-    uint8_t result = cpu->get_A() - val;
-
-    // Set flags
-    cpu->set_C(cpu->get_A() >= val);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-
-    return 4;
-}
-
-// 0xD6
-uint8_t Instructions::dec_zpg_x(CPU* cpu, Memory* memory)
-{
-    // Get zero page address and add X register to it
-    uint8_t zpg_addr = AddressingModes::zero_page_x(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(zpg_addr);
-
-    // Decrement value
-    val--;
-
-    // Write value to memory
-    memory->write(zpg_addr, val);
-
-    // Set flags
-    cpu->set_Z(val == 0);
-    cpu->set_N(val & 0x80);
-
-    return 6;
-}
-
-// 0xD8
-uint8_t Instructions::cld_impl(CPU* cpu, Memory* memory)
-{
-    // Clear D flag
-    cpu->set_D(false);
-
-    return 2;
-}
-
-// 0xD9
-uint8_t Instructions::cmp_abs_y(CPU* cpu, Memory* memory)
-{
-    bool page_crossed = false;
-    // Get absolute address and add Y register to it
-    uint16_t addr = AddressingModes::absolute_y(cpu, memory, &page_crossed);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // Compare A to value
-    uint8_t result = cpu->get_A() - val;
-
-    // Set flags
-    cpu->set_C(cpu->get_A() >= val);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-
-    // Check if page boundary was crossed
-    if (page_crossed)
-    {
-        return 5;
-    }
-
-    return 4;
-}
-
-// 0xDD
-uint8_t Instructions::cmp_abs_x(CPU* cpu, Memory* memory)
-{
-    bool page_crossed = false;
-    // Get absolute address and add X register to it
-    uint16_t addr = AddressingModes::absolute_x(cpu, memory, &page_crossed);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // Compare A to value
-    uint8_t result = cpu->get_A() - val;
-
-    // Set flags
-    cpu->set_C(cpu->get_A() >= val);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-
-    // Check if page boundary was crossed
-    if (page_crossed)
-    {
-        return 5;
-    }
-
-    return 4;
-}
-
-// 0xDE
-uint8_t Instructions::dec_abs_x(CPU* cpu, Memory* memory)
-{
-    bool page_crossed = false;
-    // Get absolute address and add X register to it
-    uint16_t addr = AddressingModes::absolute_x(cpu, memory, &page_crossed);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // Decrement value
-    val--;
-
-    // Write value to memory
-    memory->write(addr, val);
-
-    // Set flags
-    cpu->set_Z(val == 0);
-    cpu->set_N(val & 0x80);
-
-    // Check if page boundary was crossed
-    if (page_crossed)
-    {
-        return 7;
-    }
-
-    return 6;
-}
-
-// 0xE0
-uint8_t Instructions::cpx_imm(CPU* cpu, Memory* memory)
-{
-    // Get immediate value
-    uint8_t val = AddressingModes::immediate(cpu, memory);
-
-    // Compare X to value
-    uint8_t result = cpu->get_X() - val;
-
-    // Set flags
-    cpu->set_C(cpu->get_X() >= val);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-
-    return 2;
-}
-
-// 0xE1
-uint8_t Instructions::sbc_x_ind(CPU* cpu, Memory* memory)
-{
-    // Get zero page address and add X register to it
-    uint8_t zpg_addr = AddressingModes::zero_page_x(cpu, memory);
-
-    // Get the 16-bit address stored at the zero page location
-    uint8_t lo = memory->read(zpg_addr & 0xFF);
-    uint8_t hi = memory->read((zpg_addr + 1) & 0xFF);
-    uint16_t addr = (hi << 8) | lo;
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // Subtract value from A
-    uint8_t result = cpu->get_A() - val - (cpu->get_C() ? 0 : 1);
-
-    // Set A to result
-    cpu->set_A(result);
-
-    // Set flags
-    cpu->set_C(result <= cpu->get_A());
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-    cpu->set_V((cpu->get_A() ^ val) & (cpu->get_A() ^ result) & 0x80);
-
-    return 6;
-}
-
-// 0xE4
-uint8_t Instructions::cpx_zpg(CPU* cpu, Memory* memory)
-{
-    // Get zero page address
-    uint8_t zpg_addr = AddressingModes::zero_page(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(zpg_addr);
-
-    // Compare X to value
-    uint8_t result = cpu->get_X() - val;
-
-    // Set flags
-    cpu->set_C(cpu->get_X() >= val);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-
-    return 3;
-}
-
-// 0xE5
-uint8_t Instructions::sbc_zpg(CPU* cpu, Memory* memory)
-{
-    // Get zero page address
-    uint8_t zpg_addr = AddressingModes::zero_page(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(zpg_addr);
-
-    // Subtract value from A
-    uint8_t result = cpu->get_A() - val - (cpu->get_C() ? 0 : 1);
-
-    // Set A to result
-    cpu->set_A(result);
-
-    // Set flags
-    cpu->set_C(result <= cpu->get_A());
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-    cpu->set_V((cpu->get_A() ^ val) & (cpu->get_A() ^ result) & 0x80);
-
-    return 3;
-}
-
-// 0xE6
-uint8_t Instructions::inc_zpg(CPU* cpu, Memory* memory)
-{
-    // Get zero page address
-    uint8_t zpg_addr = AddressingModes::zero_page(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(zpg_addr);
-
-    // Increment value
-    val++;
-
-    // Write value to memory
-    memory->write(zpg_addr, val);
-
-    // Set flags
-    cpu->set_Z(val == 0);
-    cpu->set_N(val & 0x80);
-
-    return 5;
-}
-
-// 0xE8
-uint8_t Instructions::inx_impl(CPU* cpu, Memory* memory)
-{
-    // Increment X
-    cpu->set_X(cpu->get_X() + 1);
-
-    // Set flags
-    cpu->set_Z(cpu->get_X() == 0);
-    cpu->set_N(cpu->get_X() & 0x80);
-
-    return 2;
-}
-
-// 0xE9
-uint8_t Instructions::sbc_imm(CPU* cpu, Memory* memory)
-{
-    // Get immediate value
-    uint8_t val = AddressingModes::immediate(cpu, memory);
-
-    // Subtract value from A
-    uint8_t result = cpu->get_A() - val - (cpu->get_C() ? 0 : 1);
-
-    // Set A to result
-    cpu->set_A(result);
-
-    // Set flags
-    cpu->set_C(result <= cpu->get_A());
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-    cpu->set_V((cpu->get_A() ^ val) & (cpu->get_A() ^ result) & 0x80);
-
-    return 2;
-}
-
-// 0xEA
-uint8_t Instructions::nop_impl(CPU* cpu, Memory* memory)
-{
-    // Do nothing
-
-    return 2;
-}
-
-// 0xEC
-uint8_t Instructions::cpx_abs(CPU* cpu, Memory* memory)
-{
-    // Get absolute address
-    uint16_t addr = AddressingModes::absolute(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // Compare X to value
-    uint8_t result = cpu->get_X() - val;
-
-    // Set flags
-    cpu->set_C(cpu->get_X() >= val);
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-
-    return 4;
-}
-
-// 0xED
-uint8_t Instructions::sbc_abs(CPU* cpu, Memory* memory)
-{
-    // Get absolute address
-    uint16_t addr = AddressingModes::absolute(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // Subtract value from A
-    uint8_t result = cpu->get_A() - val - (cpu->get_C() ? 0 : 1);
-
-    // Set A to result
-    cpu->set_A(result);
-
-    // Set flags
-    cpu->set_C(result <= cpu->get_A());
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-    cpu->set_V((cpu->get_A() ^ val) & (cpu->get_A() ^ result) & 0x80);
-
-    return 4;
-}
-
-// 0xEE
-uint8_t Instructions::inc_abs(CPU* cpu, Memory* memory)
-{
-    // Get absolute address
-    uint16_t addr = AddressingModes::absolute(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // Increment value
-    val++;
-
-    // Write value to memory
-    memory->write(addr, val);
-
-    // Set flags
-    cpu->set_Z(val == 0);
-    cpu->set_N(val & 0x80);
-
-    return 6;
-}
-
-// 0xF0
-uint8_t Instructions::beq_rel(CPU* cpu, Memory* memory)
-{
-    // Get relative address (offset)
-    int8_t offset = AddressingModes::relative(cpu, memory);
-
-    // Base cycles (no branch taken)
-    uint8_t cycles = 2;
-
-    // Check if zero flag is set
-    if (cpu->get_Z())
-    {
-        uint16_t oldPC = cpu->get_PC();
-        uint16_t newPC = oldPC + static_cast<uint16_t>(offset);
-
-        // Add cycle for taking branch
-        cycles++;
-
-        // Add additional cycle if page boundary is crossed
-        if ((oldPC & 0xFF00) != (newPC & 0xFF00))
-        {
-            cycles++;
-        }
-
-        cpu->set_PC(newPC);  // Update PC after checking page boundary
-    }
-
-    return cycles;
-}
-
-
-// 0xF1
-uint8_t Instructions::sbc_ind_y(CPU* cpu, Memory* memory)
-{
-    // Get zero page address
-    uint8_t zpg_addr = AddressingModes::zero_page(cpu, memory);
-
-    // Get the 16-bit address stored at the zero page location
-    uint8_t lo = memory->read(zpg_addr & 0xFF);
-    uint8_t hi = memory->read((zpg_addr + 1) & 0xFF);
-    uint16_t addr = (hi << 8) | lo;
-
-    // Add Y register to address
-    addr += cpu->get_Y();
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // Subtract value from A
-    uint8_t result = cpu->get_A() - val - (cpu->get_C() ? 0 : 1);
-
-    // Set A to result
-    cpu->set_A(result);
-
-    // Set flags
-    cpu->set_C(result <= cpu->get_A());
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-    cpu->set_V((cpu->get_A() ^ val) & (cpu->get_A() ^ result) & 0x80);
-
-    // Check if page boundary was crossed
-    if ((addr & 0xFF00) != (hi << 8))
-    {
-        return 6;
-    }
-
-    return 5;
-}
-
-// 0xF5
-uint8_t Instructions::sbc_zpg_x(CPU* cpu, Memory* memory)
-{
-    // Get zero page address and add X register to it
-    uint8_t zpg_addr = AddressingModes::zero_page_x(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(zpg_addr);
-
-    // Subtract value from A
-    uint8_t result = cpu->get_A() - val - (cpu->get_C() ? 0 : 1);
-
-    // Set A to result
-    cpu->set_A(result);
-
-    // Set flags
-    cpu->set_C(result <= cpu->get_A());
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-    cpu->set_V((cpu->get_A() ^ val) & (cpu->get_A() ^ result) & 0x80);
-
-    return 4;
-}
-
-// 0xF6
-uint8_t Instructions::inc_zpg_x(CPU* cpu, Memory* memory)
-{
-    // Get zero page address and add X register to it
-    uint8_t zpg_addr = AddressingModes::zero_page_x(cpu, memory);
-
-    // Get value at the address
-    uint8_t val = memory->read(zpg_addr);
-
-    // Increment value
-    val++;
-
-    // Write value to memory
-    memory->write(zpg_addr, val);
-
-    // Set flags
-    cpu->set_Z(val == 0);
-    cpu->set_N(val & 0x80);
-
-    return 6;
-}
-
-// 0xF8
-uint8_t Instructions::sed_impl(CPU* cpu, Memory* memory)
-{
-    // Set D flag
-    cpu->set_D(true);
-
-    return 2;
-}
-
-// 0xF9
-uint8_t Instructions::sbc_abs_y(CPU* cpu, Memory* memory)
-{
-    bool page_crossed = false;
-    // Get absolute address and add Y register to it
-    uint16_t addr = AddressingModes::absolute_y(cpu, memory, &page_crossed);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // Subtract value from A
-    uint8_t result = cpu->get_A() - val - (cpu->get_C() ? 0 : 1);
-
-    // Set A to result
-    cpu->set_A(result);
-
-    // Set flags
-    cpu->set_C(result <= cpu->get_A());
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-    cpu->set_V((cpu->get_A() ^ val) & (cpu->get_A() ^ result) & 0x80);
-
-    // Check if page boundary was crossed
-    if (page_crossed)
-    {
-        return 5;
-    }
-
-    return 4;
-}
-
-// 0xFD
-uint8_t Instructions::sbc_abs_x(CPU* cpu, Memory* memory)
-{
-    bool page_crossed = false;
-    // Get absolute address and add X register to it
-    uint16_t addr = AddressingModes::absolute_x(cpu, memory, &page_crossed);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // Subtract value from A
-    uint8_t result = cpu->get_A() - val - (cpu->get_C() ? 0 : 1);
-
-    // Set A to result
-    cpu->set_A(result);
-
-    // Set flags
-    cpu->set_C(result <= cpu->get_A());
-    cpu->set_Z(result == 0);
-    cpu->set_N(result & 0x80);
-    cpu->set_V((cpu->get_A() ^ val) & (cpu->get_A() ^ result) & 0x80);
-
-    // Check if page boundary was crossed
-    if (page_crossed)
-    {
-        return 5;
-    }
-
-    return 4;
-}
-
-// 0xFE
-uint8_t Instructions::inc_abs_x(CPU* cpu, Memory* memory)
-{
-    bool page_crossed = false;
-    // Get absolute address and add X register to it
-    uint16_t addr = AddressingModes::absolute_x(cpu, memory, &page_crossed);
-
-    // Get value at the address
-    uint8_t val = memory->read(addr);
-
-    // Increment value
-    val++;
-
-    // Write value to memory
-    memory->write(addr, val);
-
-    // Set flags
-    cpu->set_Z(val == 0);
-    cpu->set_N(val & 0x80);
-
-    // Check if page boundary was crossed
-    if (page_crossed)
-    {
-        return 7;
-    }
-
-    return 6;
-}
\ No newline at end of file
@@ -72,19 +72,19 @@ void Interrupt::handle_irq(CPU* cpu, Memory* memory)
     // Check if interrupts are enabled
     if ((cpu->get_P() & CPU::FLAG_INTERRUPT_DISABLE) == 0)
     {
-        // Disable interrupts
-        cpu->set_P(cpu->get_P() | CPU::FLAG_INTERRUPT_DISABLE);
-
         // Push PC onto stack
         memory->write(0x0100 + cpu->get_SP(), (cpu->get_PC() >> 8) & 0xFF);
         cpu->set_SP(cpu->get_SP() - 1);
         memory->write(0x0100 + cpu->get_SP(), cpu->get_PC() & 0xFF);
         cpu->set_SP(cpu->get_SP() - 1);
 
-        // Push P onto stack with B unset
-        memory->write(0x0100 + cpu->get_SP(), cpu->get_P() & ~CPU::FLAG_BREAK);
+        // Push P onto stack with B unset, before I is set so RTI clears it
+        memory->write(0x0100 + cpu->get_SP(), (cpu->get_P() & ~CPU::FLAG_BREAK) | CPU::FLAG_UNUSED);
         cpu->set_SP(cpu->get_SP() - 1);
 
+        // Disable interrupts
+        cpu->set_P(cpu->get_P() | CPU::FLAG_INTERRUPT_DISABLE);
+
         // Set PC to IRQ vector
         cpu->set_PC(memory->read(CPU::IRQ_VECTOR) | (memory->read(CPU::IRQ_VECTOR + 1) << 8));
     }
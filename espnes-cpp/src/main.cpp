@@ -2,17 +2,12 @@
 
 int main(int argv, char** args)
 {
-    // Clear log file
-    std::ofstream log_file;
-    log_file.open("log.txt", std::ofstream::out | std::ofstream::trunc);
-    log_file.close();
-
+    // Tracing is off by default, the Debug menu turns it on
     Emulator emulator;
-    emulator.open_log_file();
     emulator.load_rom("roms/Donkey Kong.nes");
     emulator.set_PC_to_reset_vector();
     emulator.run();
-    emulator.close_log_file();
+    emulator.stop_trace();
 
     return 1;
 }
\ No newline at end of file
@@ -0,0 +1,187 @@
+#include "../include/mapper.hpp"
+#include "../include/mappers/nrom.hpp"
+#include "../include/mappers/mmc1.hpp"
+#include "../include/mappers/uxrom.hpp"
+#include "../include/mappers/cnrom.hpp"
+#include "../include/mappers/mmc3.hpp"
+
+Mapper::Mapper(const uint8_t *prg, uint32_t prg_size, const uint8_t *chr, uint32_t chr_size, bool chr_ram, MirroringType mirroring)
+    : prg(prg), prg_size(prg_size), chr(chr), chr_size(chr_size), chr_ram(chr_ram), mirroring(mirroring), irq(false)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        prg_windows[i] = nullptr;
+    }
+
+    for (int i = 0; i < 8; i++)
+    {
+        chr_windows[i] = chr;
+    }
+}
+
+Mapper::~Mapper()
+{
+}
+
+Mapper *Mapper::create(int number, const uint8_t *prg, uint32_t prg_size, const uint8_t *chr, uint32_t chr_size, bool chr_ram, MirroringType mirroring)
+{
+    Mapper *mapper;
+    switch (number)
+    {
+    case 0:
+        mapper = new NROM(prg, prg_size, chr, chr_size, chr_ram, mirroring);
+        break;
+    case 1:
+        mapper = new MMC1(prg, prg_size, chr, chr_size, chr_ram, mirroring);
+        break;
+    case 2:
+        mapper = new UxROM(prg, prg_size, chr, chr_size, chr_ram, mirroring);
+        break;
+    case 3:
+        mapper = new CNROM(prg, prg_size, chr, chr_size, chr_ram, mirroring);
+        break;
+    case 4:
+        mapper = new MMC3(prg, prg_size, chr, chr_size, chr_ram, mirroring);
+        break;
+    default:
+        return nullptr;
+    }
+
+    mapper->reset();
+    return mapper;
+}
+
+void Mapper::reset()
+{
+    // Fixed 32KB of PRG (16KB images mirrored) and 8KB of CHR
+    map_prg_16k(0, 0);
+    map_prg_16k(1, -1);
+    map_chr_8k(0);
+    irq = false;
+}
+
+int Mapper::write(uint16_t address, uint8_t value)
+{
+    return 0;
+}
+
+void Mapper::clock_scanline()
+{
+}
+
+int Mapper::get_scanlines_to_irq()
+{
+    return -1;
+}
+
+void Mapper::save_state(StateWriter &state)
+{
+    // Windows are stored as offsets into PRG and CHR, which never move
+    for (int i = 0; i < 4; i++)
+    {
+        state.write_value(prg_windows[i] != nullptr ? (uint32_t)(prg_windows[i] - prg) : NO_WINDOW);
+    }
+
+    for (int i = 0; i < 8; i++)
+    {
+        state.write_value((uint32_t)(chr_windows[i] - chr));
+    }
+
+    state.write_value((uint8_t)mirroring);
+    state.write_value(irq);
+}
+
+void Mapper::load_state(StateReader &state)
+{
+    uint32_t offset;
+    for (int i = 0; i < 4; i++)
+    {
+        state.read_value(offset);
+        prg_windows[i] = offset < prg_size ? prg + offset : nullptr;
+    }
+
+    for (int i = 0; i < 8; i++)
+    {
+        state.read_value(offset);
+        chr_windows[i] = chr + (offset < chr_size ? offset : 0);
+    }
+
+    uint8_t mirroring;
+    state.read_value(mirroring);
+    state.read_value(irq);
+    this->mirroring = (MirroringType)mirroring;
+}
+
+void Mapper::map_prg_8k(int window, int bank)
+{
+    int count = (int)(prg_size / 0x2000);
+    if (count == 0)
+    {
+        prg_windows[window] = nullptr;
+        return;
+    }
+
+    bank %= count;
+    if (bank < 0)
+    {
+        bank += count;
+    }
+    prg_windows[window] = prg + bank * 0x2000;
+}
+
+void Mapper::map_prg_16k(int window, int bank)
+{
+    // In 16KB units so -1 means the last 16KB, not the last 8KB
+    int count = (int)(prg_size / 0x4000);
+    if (count == 0)
+    {
+        map_prg_8k(window * 2, 0);
+        map_prg_8k(window * 2 + 1, 0);
+        return;
+    }
+
+    bank %= count;
+    if (bank < 0)
+    {
+        bank += count;
+    }
+    map_prg_8k(window * 2, bank * 2);
+    map_prg_8k(window * 2 + 1, bank * 2 + 1);
+}
+
+void Mapper::map_prg_32k(int bank)
+{
+    map_prg_16k(0, bank * 2);
+    map_prg_16k(1, bank * 2 + 1);
+}
+
+void Mapper::map_chr_1k(int window, int bank)
+{
+    int count = (int)(chr_size / 0x400);
+    bank %= count;
+    if (bank < 0)
+    {
+        bank += count;
+    }
+    chr_windows[window] = chr + bank * 0x400;
+}
+
+void Mapper::map_chr_2k(int window, int bank)
+{
+    map_chr_1k(window * 2, bank * 2);
+    map_chr_1k(window * 2 + 1, bank * 2 + 1);
+}
+
+void Mapper::map_chr_4k(int window, int bank)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        map_chr_1k(window * 4 + i, bank * 4 + i);
+    }
+}
+
+void Mapper::map_chr_8k(int bank)
+{
+    map_chr_4k(0, bank * 2);
+    map_chr_4k(1, bank * 2 + 1);
+}
\ No newline at end of file
@@ -0,0 +1,13 @@
+#include "../include/mappers/cnrom.hpp"
+
+CNROM::CNROM(const uint8_t *prg, uint32_t prg_size, const uint8_t *chr, uint32_t chr_size, bool chr_ram, MirroringType mirroring)
+    : Mapper(prg, prg_size, chr, chr_size, chr_ram, mirroring)
+{
+}
+
+int CNROM::write(uint16_t address, uint8_t value)
+{
+    // Any write to $8000-$FFFF selects the CHR bank, PRG stays put
+    map_chr_8k(value);
+    return MAPPER_CHR_CHANGED;
+}
\ No newline at end of file
@@ -0,0 +1,120 @@
+#include "../include/mappers/mmc1.hpp"
+
+MMC1::MMC1(const uint8_t *prg, uint32_t prg_size, const uint8_t *chr, uint32_t chr_size, bool chr_ram, MirroringType mirroring)
+    : Mapper(prg, prg_size, chr, chr_size, chr_ram, mirroring), shift(0x10), control(0x0C), chr_bank_0(0), chr_bank_1(0), prg_bank(0)
+{
+}
+
+void MMC1::reset()
+{
+    Mapper::reset();
+
+    // Powers up with the last PRG bank fixed at $C000
+    shift = 0x10;
+    control = 0x0C;
+    chr_bank_0 = 0;
+    chr_bank_1 = 0;
+    prg_bank = 0;
+    update_banks();
+}
+
+int MMC1::write(uint16_t address, uint8_t value)
+{
+    // Bit 7 clears the shift register and goes back to the power-up PRG mode
+    if ((value & 0x80) != 0)
+    {
+        shift = 0x10;
+        control |= 0x0C;
+        return update_banks();
+    }
+
+    // Bits come in LSB first; the marker bit reaching bit 0 means this is the fifth
+    bool full = (shift & 0x01) != 0;
+    shift = (uint8_t)((shift >> 1) | ((value & 0x01) << 4));
+    if (!full)
+    {
+        return 0;
+    }
+
+    // The address of the fifth write picks the register
+    switch ((address >> 13) & 3)
+    {
+    case 0:
+        control = shift;
+        break;
+    case 1:
+        chr_bank_0 = shift;
+        break;
+    case 2:
+        chr_bank_1 = shift;
+        break;
+    case 3:
+        prg_bank = shift;
+        break;
+    }
+
+    shift = 0x10;
+    return update_banks();
+}
+
+int MMC1::update_banks()
+{
+    MirroringType mirrorings[4] = { MIRRORING_SINGLE_LOWER, MIRRORING_SINGLE_UPPER, MIRRORING_VERTICAL, MIRRORING_HORIZONTAL };
+    mirroring = mirrorings[control & 3];
+
+    // 512KB boards (SUROM) pick the 256KB PRG half with bit 4 of the CHR bank
+    int prg_base = prg_size > 0x40000 ? (chr_bank_0 & 0x10) : 0;
+    int bank = prg_base | (prg_bank & 0x0F);
+
+    switch ((control >> 2) & 3)
+    {
+    case 0:
+    case 1:
+        // 32KB, low bit ignored
+        map_prg_16k(0, bank & ~1);
+        map_prg_16k(1, bank | 1);
+        break;
+    case 2:
+        // First bank fixed at $8000
+        map_prg_16k(0, prg_base);
+        map_prg_16k(1, bank);
+        break;
+    case 3:
+        // Last bank fixed at $C000
+        map_prg_16k(0, bank);
+        map_prg_16k(1, prg_base | 0x0F);
+        break;
+    }
+
+    if ((control & 0x10) != 0)
+    {
+        map_chr_4k(0, chr_bank_0);
+        map_chr_4k(1, chr_bank_1);
+    }
+    else
+    {
+        map_chr_8k(chr_bank_0 >> 1);
+    }
+
+    return MAPPER_PRG_CHANGED | MAPPER_MIRRORING_CHANGED | MAPPER_CHR_CHANGED;
+}
+
+void MMC1::save_state(StateWriter &state)
+{
+    Mapper::save_state(state);
+    state.write_value(shift);
+    state.write_value(control);
+    state.write_value(chr_bank_0);
+    state.write_value(chr_bank_1);
+    state.write_value(prg_bank);
+}
+
+void MMC1::load_state(StateReader &state)
+{
+    Mapper::load_state(state);
+    state.read_value(shift);
+    state.read_value(control);
+    state.read_value(chr_bank_0);
+    state.read_value(chr_bank_1);
+    state.read_value(prg_bank);
+}
\ No newline at end of file
@@ -0,0 +1,183 @@
+#include "../include/mappers/mmc3.hpp"
+
+MMC3::MMC3(const uint8_t *prg, uint32_t prg_size, const uint8_t *chr, uint32_t chr_size, bool chr_ram, MirroringType mirroring)
+    : Mapper(prg, prg_size, chr, chr_size, chr_ram, mirroring), bank_select(0), irq_latch(0), irq_counter(0), irq_reload(false), irq_enabled(false),
+    four_screen(mirroring == MIRRORING_FOUR_SCREEN)
+{
+    for (int i = 0; i < 8; i++)
+    {
+        banks[i] = 0;
+    }
+}
+
+void MMC3::reset()
+{
+    Mapper::reset();
+
+    bank_select = 0;
+    banks[0] = 0;
+    banks[1] = 2;
+    banks[2] = 4;
+    banks[3] = 5;
+    banks[4] = 6;
+    banks[5] = 7;
+    banks[6] = 0;
+    banks[7] = 1;
+    irq_latch = 0;
+    irq_counter = 0;
+    irq_reload = false;
+    irq_enabled = false;
+    update_banks();
+}
+
+int MMC3::write(uint16_t address, uint8_t value)
+{
+    // Registers are mirrored through each 8KB range, even and odd addresses
+    bool odd = (address & 1) != 0;
+    switch ((address >> 13) & 3)
+    {
+    case 0:
+        if (odd)
+        {
+            banks[bank_select & 7] = value;
+        }
+        else
+        {
+            bank_select = value;
+        }
+        update_banks();
+        return MAPPER_PRG_CHANGED | MAPPER_CHR_CHANGED;
+    case 1:
+        // Mirroring (ignored on four-screen boards); the odd register
+        // write-protects PRG RAM, which isn't emulated
+        if (!odd && !four_screen)
+        {
+            mirroring = (value & 1) != 0 ? MIRRORING_HORIZONTAL : MIRRORING_VERTICAL;
+            return MAPPER_MIRRORING_CHANGED;
+        }
+        return 0;
+    case 2:
+        // Latch, or reload the counter on the next clock
+        if (odd)
+        {
+            irq_counter = 0;
+            irq_reload = true;
+        }
+        else
+        {
+            irq_latch = value;
+        }
+        return MAPPER_IRQ_CHANGED;
+    case 3:
+        // Disabling also acknowledges a pending IRQ
+        irq_enabled = odd;
+        if (!odd)
+        {
+            irq = false;
+        }
+        return MAPPER_IRQ_CHANGED;
+    }
+
+    return 0;
+}
+
+void MMC3::update_banks()
+{
+    // Bit 6 swaps $8000 and $C000, the second-to-last bank sits in whichever is not R6
+    if ((bank_select & 0x40) != 0)
+    {
+        map_prg_8k(0, -2);
+        map_prg_8k(2, banks[6]);
+    }
+    else
+    {
+        map_prg_8k(0, banks[6]);
+        map_prg_8k(2, -2);
+    }
+    map_prg_8k(1, banks[7]);
+    map_prg_8k(3, -1);
+
+    // Bit 7 swaps the 2KB and 1KB halves of the pattern tables
+    int two_k = (bank_select & 0x80) != 0 ? 4 : 0;
+    int one_k = two_k ^ 4;
+    map_chr_1k(two_k + 0, banks[0] & 0xFE);
+    map_chr_1k(two_k + 1, banks[0] | 0x01);
+    map_chr_1k(two_k + 2, banks[1] & 0xFE);
+    map_chr_1k(two_k + 3, banks[1] | 0x01);
+    map_chr_1k(one_k + 0, banks[2]);
+    map_chr_1k(one_k + 1, banks[3]);
+    map_chr_1k(one_k + 2, banks[4]);
+    map_chr_1k(one_k + 3, banks[5]);
+}
+
+void MMC3::clock_scanline()
+{
+    if (irq_counter == 0 || irq_reload)
+    {
+        irq_counter = irq_latch;
+        irq_reload = false;
+    }
+    else
+    {
+        irq_counter--;
+    }
+
+    if (irq_counter == 0 && irq_enabled)
+    {
+        irq = true;
+    }
+}
+
+int MMC3::get_scanlines_to_irq()
+{
+    if (!irq_enabled)
+    {
+        return -1;
+    }
+
+    // Run the counter forward without touching it. Past 257 clocks it has
+    // reloaded at least once, so it never reaches zero.
+    int counter = irq_counter;
+    bool reload = irq_reload;
+    for (int clocks = 1; clocks <= 257; clocks++)
+    {
+        if (counter == 0 || reload)
+        {
+            counter = irq_latch;
+            reload = false;
+        }
+        else
+        {
+            counter--;
+        }
+
+        if (counter == 0)
+        {
+            return clocks;
+        }
+    }
+
+    return -1;
+}
+
+void MMC3::save_state(StateWriter &state)
+{
+    Mapper::save_state(state);
+    state.write_value(bank_select);
+    state.write(banks, sizeof(banks));
+    state.write_value(irq_latch);
+    state.write_value(irq_counter);
+    state.write_value(irq_reload);
+    state.write_value(irq_enabled);
+}
+
+void MMC3::load_state(StateReader &state)
+{
+    Mapper::load_state(state);
+    state.read_value(bank_select);
+    state.read(banks, sizeof(banks));
+    state.read_value(irq_latch);
+    state.read_value(irq_counter);
+    state.read_value(irq_reload);
+    state.read_value(irq_enabled);
+}
\ No newline at end of file
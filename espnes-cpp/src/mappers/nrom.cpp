@@ -0,0 +1,6 @@
+#include "../include/mappers/nrom.hpp"
+
+NROM::NROM(const uint8_t *prg, uint32_t prg_size, const uint8_t *chr, uint32_t chr_size, bool chr_ram, MirroringType mirroring)
+    : Mapper(prg, prg_size, chr, chr_size, chr_ram, mirroring)
+{
+}
\ No newline at end of file
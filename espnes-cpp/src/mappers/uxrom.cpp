@@ -0,0 +1,13 @@
+#include "../include/mappers/uxrom.hpp"
+
+UxROM::UxROM(const uint8_t *prg, uint32_t prg_size, const uint8_t *chr, uint32_t chr_size, bool chr_ram, MirroringType mirroring)
+    : Mapper(prg, prg_size, chr, chr_size, chr_ram, mirroring)
+{
+}
+
+int UxROM::write(uint16_t address, uint8_t value)
+{
+    // Any write to $8000-$FFFF selects the bank at $8000
+    map_prg_16k(0, value);
+    return MAPPER_PRG_CHANGED;
+}
\ No newline at end of file
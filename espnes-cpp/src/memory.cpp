@@ -1,49 +1,91 @@
+#include <cstring>
 #include "../include/memory.hpp"
 #include <emulator.hpp>
 
-Memory::Memory(PPU * ppu, APU* apu, Cartridge* cartridge, Controller *controller) : ppu(ppu), apu(apu), cartridge(cartridge), controller(controller)
+Memory::Memory(MachineState *machine, PPU * ppu, APU* apu, Cartridge* cartridge, Controller *controller) : ram(machine->ram),
+    ppu(ppu), apu(apu), cartridge(cartridge), controller(controller)
 {
-    memory = new uint8_t[0x10000];
-    ram = new uint8_t[0x800];
-    stack = new uint8_t[0x100];
+    memset(ram, 0, 0x800);
 
-    for (int i = 0; i < 0x10000; i++)
-    {
-		memory[i] = 0;
-	}
+    io_access = false;
+    map_pages();
+}
 
-    for (int i = 0; i < 0x800; i++)
+Memory::~Memory()
+{
+}
+
+void Memory::set_emulator(Emulator* emulator)
+{
+	this->emulator = emulator;
+}
+
+void Memory::map_pages()
+{
+    for (int page = 0; page < 0x100; page++)
     {
-		ram[i] = 0;
-	}
+        uint8_t *host = nullptr;
+
+        // RAM (mirrored every 0x800), the stack in page 1 included
+        if (page < 0x20)
+        {
+            host = &ram[(page & 0x07) << 8];
+        }
+        // PRG RAM
+        else if (page >= 0x60 && page < 0x80)
+        {
+            host = cartridge->get_ram_page(page << 8);
+        }
+
+        read_pages[page] = host;
+        read_watched[page] = false;
+
+        // ROM pages stay unmapped for writes so mapper registers see them
+        write_pages[page] = page < 0x80 ? host : nullptr;
+    }
 
-    for (int i = 0; i < 0x100; i++)
+    map_prg_pages();
+}
+
+void Memory::map_prg_pages()
+{
+    // Follows the mapper's current banks, skipping pages with a read breakpoint
+    for (int page = 0x80; page < 0x100; page++)
     {
-		stack[i] = 0;
-	}
+        read_pages[page] = read_watched[page] ? nullptr : cartridge->get_page(page << 8);
+    }
 }
 
-Memory::~Memory()
+void Memory::unmap_read_page(uint8_t page)
 {
-    delete[] memory;
-    delete[] ram;
-    delete[] stack;
+    read_pages[page] = nullptr;
+    read_watched[page] = true;
 }
 
-void Memory::set_emulator(Emulator* emulator)
+void Memory::unmap_write_page(uint8_t page)
 {
-	this->emulator = emulator;
+    write_pages[page] = nullptr;
 }
 
-uint8_t Memory::read(uint16_t address, bool resetStatus)
+uint8_t Memory::read_io(uint16_t address, bool resetStatus)
 {
-    // Read from stack
-    if (address >= 0x100 && address <= 0x1FF)
+    io_access = true;
+
+    uint8_t value = read_device(address, resetStatus);
+
+    // Check for read breakpoints, on reads the CPU makes but not on peeks
+    if (resetStatus)
     {
-        return stack[address - 0x100];
+        emulator->check_memory_breakpoint(BREAKPOINT_TYPE_READ, address, value);
     }
+
+    return value;
+}
+
+uint8_t Memory::read_device(uint16_t address, bool resetStatus)
+{
     // Read from RAM
-    else if (address >= 0x0000 && address < 0x2000)
+    if (address >= 0x0000 && address < 0x2000)
     {
         return ram[address % 0x0800];
     }
@@ -88,26 +130,15 @@ uint8_t Memory::read(uint16_t address, bool resetStatus)
     return 0;
 }
 
-void Memory::write(uint16_t address, uint8_t value)
+void Memory::write_io(uint16_t address, uint8_t value)
 {
-    if (address == 0xFA && value == 0x36)
-    {
-        printf("0xD0\n");
-    }
+    io_access = true;
 
     // Check for write breakpoints
-    if (emulator->is_breakpoint(BREAKPOINT_TYPE_WRITE, address))
-    {
-		emulator->pause();
-	}
+    emulator->check_memory_breakpoint(BREAKPOINT_TYPE_WRITE, address, value);
 
-    // Write to stack
-    if (address >= 0x100 && address <= 0x1FF)
-    {
-        stack[address - 0x100] = value;
-    }
     // Write to RAM
-    else if (address >= 0x0000 && address < 0x2000)
+    if (address >= 0x0000 && address < 0x2000)
     {
         ram[address % 0x0800] = value;
     }
@@ -124,13 +155,16 @@ void Memory::write(uint16_t address, uint8_t value)
         {
             uint16_t dma_address = value * 0x100;
 
+            // OAM changes here, so the PPU has to be up to date first
+            ppu->catch_up();
+
             for (int i = 0; i < 256; i++)
             {
                 uint8_t byte = read(dma_address + i);
                 ppu->write_oam_data(i, byte);
             }
 
-            emulator->set_dma_triggered(true);
+            emulator->schedule_dma();
 		}
         // Controller 1
         if (address == 0x4016)
@@ -154,20 +188,23 @@ void Memory::write(uint16_t address, uint8_t value)
         return;
     }
     // Write to cartridge
-    // else if (address >= 0x4020 && address <= 0xFFFF)
-    // {
-    //     cartridge->write(address, value);
-    // }
-    else
+    else if (address >= 0x4020 && address <= 0xFFFF)
     {
-        Debug::debug_print("Unknown memory write: " + std::to_string(address));
-    }
-}
+        // Lines rendered before a bank switch use the old banks
+        ppu->catch_up();
 
-void Memory::load(uint8_t* rom, uint32_t size)
-{
-    for (uint32_t i = 0; i < size; i++)
+        int changes = cartridge->write(address, value);
+        if ((changes & MAPPER_PRG_CHANGED) != 0)
+        {
+            map_prg_pages();
+        }
+        if ((changes & (MAPPER_MIRRORING_CHANGED | MAPPER_IRQ_CHANGED | MAPPER_CHR_CHANGED)) != 0)
+        {
+            ppu->update_cartridge(changes);
+        }
+    }
+    else
     {
-        memory[i] = rom[i];
+        Debug::debug_print("Unknown memory write: " + std::to_string(address));
     }
 }
\ No newline at end of file
@@ -1,27 +1,46 @@
+#include <cstring>
 #include "../include/ppu.hpp"
 #include "../include/cpu.hpp"
+#include "../include/cartridge.hpp"
+#include "../include/tile_decoder.hpp"
 
-PPU::PPU() : cycles(0), scanline(0), frame(0), total_cycles(7), control(0), mask(0), status(0), oam_address(0), oam_data(0), scroll_x(0), scroll_y(0), address(0), data(0), oam_dma(0), NMI_occurred(0)
-{
-    vram = new uint8_t[0x2000];
-    oam = new uint8_t[0x100];
-    palette = new uint8_t[0x40];
-    cycles = 21;
-    scanline = 0;
-    frame = 0;
-    total_cycles = 7;
-    old_frame = 500;
-    this->status = 0;
+// Each byte of the result is 0xFF where the byte of pixels has a non-zero
+// colour index in its low 2 bits, 0x00 where it is transparent
+static inline uint64_t opaque_mask(uint64_t pixels)
+{
+    uint64_t opaque = ((pixels & 0x0303030303030303ULL) + 0x7F7F7F7F7F7F7F7FULL) & 0x8080808080808080ULL;
+    return (opaque >> 7) * 0xFF;
+}
+
+PPU::PPU(MachineState *machine) : state(&machine->ppu), vram(machine->vram), oam(machine->oam), palette(machine->palette), cartridge(nullptr), scheduler(nullptr)
+{
+    state->control = 0;
+    state->mask = 0;
+    state->oam_address = 0;
+    state->oam_data = 0;
+    state->data = 0;
+    state->NMI_occurred = 0;
+    state->cycles = 21;
+    state->scanline = 0;
+    state->frame = 0;
+    state->total_cycles = 7;
+    state->synced_time = 0;
+    state->status = 0;
     
-    for (int i = 0; i < 0x2000; i++)
+    for (int i = 0; i < NAMETABLE_RAM_SIZE; i++)
     {
 		vram[i] = 0;
 	}   
 
-    for (int i = 0; i < 0x100; i++)
-    {
-        frame_buffer[i] = 0;
-    }
+    // Horizontal mirroring until a cartridge says otherwise
+    nametables[0] = nametables[1] = vram;
+    nametables[2] = nametables[3] = vram + 0x400;
+
+    // Black, 0x0F in the palette
+    memset(frame_indices, 0x0F, sizeof(frame_indices));
+    memset(frame_emphasis, 0, sizeof(frame_emphasis));
+    frame_buffer_dirty = true;
+    build_emphasis_colors();
 
     for (int i = 0; i < 0x100; i++)
     {
@@ -33,33 +52,28 @@ PPU::PPU() : cycles(0), scanline(0), frame(0), total_cycles(7), control(0), mask
 		palette[i] = 0;
 	}
 
-    this->oam_dma = 0;
-    this->vram_address = 0;
+    state->oam_dma = 0;
+    state->vram_address = 0;
+
+    // Decoded from the first cartridge update
+    memset(tile_cache, 0, sizeof(tile_cache));
+    flush_tile_cache();
+    flush_sprite_lines();
 }
 
 void PPU::add_cycles(int cycles)
 {
-	this->cycles += cycles;
-	this->total_cycles += cycles / 3;
-
-    // account for > 341 cycles
-    while (this->cycles >= SCANLINE_CYCLES)
-    {
-		this->cycles -= SCANLINE_CYCLES;
-		this->scanline++;
-	}
+    // Goes through step so vblank and rendering still happen on the way
+    step(cycles);
 }
 
 PPU::~PPU()
 {
-    delete[] vram;
-    delete[] oam;
-    delete[] palette;
 }
 
-long PPU::get_total_cycles()
+int64_t PPU::get_total_cycles()
 {
-    return this->total_cycles;
+    return state->total_cycles;
 }
 
 uint8_t* PPU::get_vram()
@@ -69,17 +83,17 @@ uint8_t* PPU::get_vram()
 
 int PPU::get_cycle()
 {
-    return this->cycles;
+    return state->cycles;
 }
 
 int PPU::get_scanline()
 {
-    return this->scanline;
+    return state->scanline;
 }
 
 int PPU::get_frame()
 {
-    return this->frame;
+    return state->frame;
 }
 
 uint8_t* PPU::get_palette()
@@ -89,32 +103,27 @@ uint8_t* PPU::get_palette()
 
 void PPU::reset()
 {
-    this->cycles = 21;
-    this->scanline = 0;
-    this->frame = 0;
-    this->total_cycles = 7;
-    this->control = 0;
-    this->mask = 0;
-    this->status = 0;
-    this->oam_address = 0;
-    this->oam_data = 0;
-    this->scroll_x = 0;
-    this->scroll_y = 0;
-    this->address = 0;
-    this->data = 0;
-    this->oam_dma = 0;
-    this->NMI_occurred = 0;
-    this->prev_read = 0;
-    this->old_frame = 500;
-
-    // Clear frame buffer
-    for (int i = 0; i < XRES * YRES * COLOR_DEPTH; i++)
-    {
-        frame_buffer[i] = 0;
-    }
+    state->cycles = 21;
+    state->scanline = 0;
+    state->frame = 0;
+    state->total_cycles = 7;
+    state->control = 0;
+    state->mask = 0;
+    state->status = 0;
+    state->oam_address = 0;
+    state->oam_data = 0;
+    state->data = 0;
+    state->oam_dma = 0;
+    state->NMI_occurred = 0;
+    state->prev_read = 0;
+
+    // Clear frame buffer to black
+    memset(frame_indices, 0x0F, sizeof(frame_indices));
+    memset(frame_emphasis, 0, sizeof(frame_emphasis));
+    frame_buffer_dirty = true;
 
     // Clear VRAM
-    for (int i = 0; i < 0x2000; i++)
+    for (int i = 0; i < NAMETABLE_RAM_SIZE; i++)
     {
 		vram[i] = 0;
 	}
@@ -124,6 +133,7 @@ void PPU::reset()
     {
 		oam[i] = 0;
 	}
+    flush_sprite_lines();
 
 	// Clear palette
     for (int i = 0; i < 0x40; i++)
@@ -132,29 +142,24 @@ void PPU::reset()
 	}
 
 	// Clear OAMDMA
-	this->oam_dma = 0;
+	state->oam_dma = 0;
 
     // Clear NMI
-	this->NMI_occurred = 0;
-
-    // Clear NMI triggered
-    this->nmi_triggered = 0;
+	state->NMI_occurred = 0;
 
     // Clear write toggle
-    this->write_toggle = 0;
+    state->write_toggle = 0;
 
-    // Clear VRAM address
-    this->vram_address = 0;
+    // Clear VRAM address and scroll
+    state->vram_address = 0;
+    state->temp_address = 0;
+    state->fine_x = 0;
 
     // Clear OAM address
-    this->oam_address = 0;
+    state->oam_address = 0;
 
     // Clear OAM data
-    this->oam_data = 0;
-
-    // Clear scroll
-    this->scroll_x = 0;
-    this->scroll_y = 0;
+    state->oam_data = 0;
 }
 
 void PPU::set_cpu(CPU& cpu)
@@ -162,71 +167,474 @@ void PPU::set_cpu(CPU& cpu)
     this->cpu = &cpu;
 }
 
+void PPU::set_scheduler(Scheduler& scheduler)
+{
+    this->scheduler = &scheduler;
+    state->synced_time = scheduler.get_time();
+}
+
+void PPU::set_cartridge(Cartridge& cartridge)
+{
+    this->cartridge = &cartridge;
+}
+
+void PPU::update_cartridge(int changes)
+{
+    // Called after a mapper register write, or with every flag after loading
+    catch_up();
+
+    if ((changes & MAPPER_MIRRORING_CHANGED) != 0)
+    {
+        update_mirroring();
+    }
+
+    if ((changes & MAPPER_IRQ_CHANGED) != 0)
+    {
+        cpu->set_irq_line(cartridge->get_irq());
+        schedule_irq();
+    }
+
+    if ((changes & MAPPER_CHR_CHANGED) != 0)
+    {
+        update_tile_cache();
+    }
+}
+
+void PPU::flush_tile_cache()
+{
+    // For when CHR itself was replaced (a new ROM, a loaded state), which
+    // can leave the windows pointing where they were
+    for (int i = 0; i < 8; i++)
+    {
+        cached_chr_windows[i] = nullptr;
+    }
+}
+
+void PPU::flush_sprite_lines()
+{
+    sprite_lines_dirty = true;
+}
+
+void PPU::update_tile_cache()
+{
+    // Only windows switched to another bank are decoded again
+    for (int i = 0; i < 8; i++)
+    {
+        const uint8_t *window = cartridge->get_chr_window(i);
+        if (window == cached_chr_windows[i])
+        {
+            continue;
+        }
+
+        cached_chr_windows[i] = window;
+        for (uint16_t address = i * 0x400; address < (i + 1) * 0x400; address += 16)
+        {
+            for (int row = 0; row < 8; row++)
+            {
+                decode_tile_row(address + row);
+            }
+        }
+    }
+}
+
+// Spreads the 8 bits of a bitplane row to the low bit of 8 bytes, in the
+// order the mask gives: each byte of it picks one bit
+static inline uint64_t spread_bits(uint8_t bits, uint64_t order)
+{
+    uint64_t picked = (bits * 0x0101010101010101ULL) & order;
+    return ((picked + 0x7F7F7F7F7F7F7F7FULL) >> 7) & 0x0101010101010101ULL;
+}
+
+void PPU::decode_tile_row(uint16_t address)
+{
+    // Bit 7 is the leftmost pixel, so it goes to the low byte unless flipped
+    static const uint64_t LEFT_TO_RIGHT = 0x0102040810204080ULL;
+    static const uint64_t RIGHT_TO_LEFT = 0x8040201008040201ULL;
+
+    uint8_t lo = cartridge->read_chr(address);
+    uint8_t hi = cartridge->read_chr(address | 0x08);
+    int index = get_tile_row_index(address);
+    tile_cache[0][index] = spread_bits(lo, LEFT_TO_RIGHT) | (spread_bits(hi, LEFT_TO_RIGHT) << 1);
+    tile_cache[1][index] = spread_bits(lo, RIGHT_TO_LEFT) | (spread_bits(hi, RIGHT_TO_LEFT) << 1);
+}
+
+void PPU::update_mirroring()
+{
+    static const int layouts[5][4] =
+    {
+        { 0, 0, 1, 1 }, // Horizontal
+        { 0, 1, 0, 1 }, // Vertical
+        { 0, 0, 0, 0 }, // Single screen, lower bank
+        { 1, 1, 1, 1 }, // Single screen, upper bank
+        { 0, 1, 2, 3 }  // Four screen
+    };
+
+    const int *layout = layouts[cartridge->get_mirroring()];
+    for (int i = 0; i < 4; i++)
+    {
+        nametables[i] = vram + layout[i] * 0x400;
+    }
+}
+
+bool PPU::is_rendering()
+{
+    return (state->mask & 0x18) != 0;
+}
+
+void PPU::schedule_irq()
+{
+    if (scheduler == nullptr || cartridge == nullptr)
+    {
+        return;
+    }
+
+    // The counter only sees A12 while the background or sprites are drawn
+    int clocks = cartridge->get_scanlines_to_irq();
+    if (clocks < 0 || !is_rendering())
+    {
+        scheduler->cancel(EVENT_MAPPER_IRQ);
+        return;
+    }
+
+    // Walk forward to the end of the line that delivers the last clock
+    int line = state->scanline;
+    int64_t time = state->synced_time + SCANLINE_CYCLES - state->cycles;
+    for (;;)
+    {
+        if (line < YRES || line == SCANLINES)
+        {
+            if (--clocks == 0)
+            {
+                break;
+            }
+        }
+
+        line = line == SCANLINES ? 0 : line + 1;
+        time += SCANLINE_CYCLES;
+    }
+
+    scheduler->schedule(EVENT_MAPPER_IRQ, time);
+}
+
+void PPU::schedule_events()
+{
+    // Dot 1 of the vblank line, and the wrap to the pre-render line
+    int64_t now = state->synced_time;
+    int to_vblank = (VBLANK_SCANLINE - state->scanline) * SCANLINE_CYCLES - state->cycles + 1;
+    if (to_vblank <= 0)
+    {
+        to_vblank += FRAME_CYCLES;
+    }
+    int to_frame_end = (SCANLINES + 1 - state->scanline) * SCANLINE_CYCLES - state->cycles;
+
+    scheduler->schedule(EVENT_VBLANK, now + to_vblank);
+    scheduler->schedule(EVENT_FRAME_END, now + to_frame_end);
+    schedule_sprite0_hit();
+}
+
+void PPU::schedule_sprite0_hit()
+{
+    // The line being drawn is still looked at until its fetches end
+    schedule_sprite0_line(state->cycles < FETCH_END_CYCLE ? state->scanline : state->scanline + 1);
+}
+
+void PPU::schedule_sprite0_line(int line)
+{
+    if (scheduler == nullptr)
+    {
+        return;
+    }
+
+    // Nothing to wait for once it has hit, or while either layer is off.
+    // Past the visible lines the next frame's start schedules it again.
+    int first = oam[0] + 1;
+    int last = first + get_sprite_height() - 1;
+    if (line < first)
+    {
+        line = first;
+    }
+    if ((state->status & 0x40) != 0 || (state->mask & 0x18) != 0x18 || state->scanline >= YRES || line > last || line >= YRES)
+    {
+        scheduler->cancel(EVENT_SPRITE0_HIT);
+        return;
+    }
+
+    // The start of the line, or now if it has started
+    int64_t time = state->synced_time;
+    if (line != state->scanline)
+    {
+        time += (int64_t)(line - state->scanline) * SCANLINE_CYCLES - state->cycles;
+    }
+    scheduler->schedule(EVENT_SPRITE0_HIT, time);
+}
+
+void PPU::update_sprite0_hit()
+{
+    // On each of sprite 0's lines the hit is found up front, then the flag
+    // is set at its dot. Code polling for it sleeps until then rather than
+    // spinning through the lines before.
+    if (state->cycles < FETCH_END_CYCLE && state->scanline < YRES && (state->status & 0x40) == 0 && (state->mask & 0x18) == 0x18)
+    {
+        int x = find_sprite0_hit(state->scanline);
+        if (x >= 0)
+        {
+            // Pixel x is output on dot x + 1
+            int dot = x + 1;
+            if (state->cycles >= dot)
+            {
+                state->status |= 0x40;
+                scheduler->cancel(EVENT_SPRITE0_HIT);
+            }
+            else
+            {
+                scheduler->schedule(EVENT_SPRITE0_HIT, state->synced_time + dot - state->cycles);
+            }
+            return;
+        }
+    }
+
+    schedule_sprite0_line(state->scanline + 1);
+}
+
+int PPU::find_sprite0_hit(int scanline)
+{
+    // The first pixel where sprite 0 and the background are both opaque,
+    // or -1. The background is fetched from v as the line will be drawn.
+    int row = scanline - oam[0] - 1;
+    if (row < 0 || row >= get_sprite_height())
+    {
+        return -1;
+    }
+
+    uint8_t background[(XRES / 8 + 1) * 8];
+    const uint8_t *pixels = render_background(background);
+
+    int x = oam[3];
+    uint8_t under[8];
+    for (int i = 0; i < 8; i++)
+    {
+        // Sprites can be clipped from the leftmost 8 pixels on their own
+        bool clipped = x + i < 8 && (state->mask & 0x04) == 0;
+        under[i] = x + i < XRES && !clipped ? pixels[x + i] : 0;
+    }
+
+    uint64_t back;
+    memcpy(&back, under, 8);
+    uint64_t hit = opaque_mask(get_sprite_row(oam, row)) & opaque_mask(back);
+    for (int i = 0; i < 8 && x + i < XRES - 1; i++)
+    {
+        // Never on the last pixel
+        if (((hit >> (i * 8)) & 0xFF) != 0)
+        {
+            return x + i;
+        }
+    }
+
+    return -1;
+}
+
+void PPU::catch_up()
+{
+    // Nothing to sync to when running without a scheduler (the recompiler)
+    if (scheduler == nullptr)
+    {
+        return;
+    }
+
+    // The scheduler only moves between CPU blocks, add what the CPU has run
+    // of the current one
+    int64_t now = scheduler->get_time() + (int64_t)cpu->get_block_cycles() * 3;
+    if (now > state->synced_time)
+    {
+        step((int)(now - state->synced_time));
+    }
+}
+
+void PPU::handle_event(EventType type)
+{
+    catch_up();
+
+    switch (type)
+    {
+    case EVENT_VBLANK:
+        set_vblank_flag();
+        state->NMI_occurred = 1;
+
+        // NMI follows if enabled
+        if ((state->control & 0x80) != 0)
+        {
+            scheduler->schedule(EVENT_NMI, state->synced_time);
+        }
+
+        scheduler->schedule(EVENT_VBLANK, state->synced_time + FRAME_CYCLES);
+        break;
+    case EVENT_FRAME_END:
+        // Catching up already wrapped to the pre-render line, this only wakes
+        // code polling for the end of vblank
+        scheduler->schedule(EVENT_FRAME_END, state->synced_time + FRAME_CYCLES);
+        break;
+    case EVENT_MAPPER_IRQ:
+        // Catching up clocked the counter to zero, raise the line and look
+        // for the next one
+        cpu->set_irq_line(cartridge->get_irq());
+        schedule_irq();
+        break;
+    case EVENT_SPRITE0_HIT:
+        update_sprite0_hit();
+        break;
+    default:
+        break;
+    }
+}
+
 uint8_t* PPU::get_frame_buffer()
 {
+    if (frame_buffer_dirty)
+    {
+        convert_frame();
+    }
     return frame_buffer;
 }
 
+const uint8_t *PPU::get_frame_indices()
+{
+    return frame_indices;
+}
+
+const uint8_t *PPU::get_frame_emphasis()
+{
+    return frame_emphasis;
+}
+
+void PPU::convert_frame()
+{
+    // Lines with the same emphasis, usually the whole frame, go in one call
+    int line = 0;
+    while (line < YRES)
+    {
+        int end = line + 1;
+        while (end < YRES && frame_emphasis[end] == frame_emphasis[line])
+        {
+            end++;
+        }
+
+        TileDecoder::lookup_colors(&frame_indices[line * XRES], (end - line) * XRES, emphasis_colors[frame_emphasis[line]],
+            (uint32_t *)&frame_buffer[line * XRES * COLOR_DEPTH]);
+        line = end;
+    }
+
+    frame_buffer_dirty = false;
+}
+
+void PPU::build_emphasis_colors()
+{
+    // Each emphasis bit (red, green, blue) darkens the other two channels,
+    // to about 82%
+    for (int emphasis = 0; emphasis < 8; emphasis++)
+    {
+        for (int i = 0; i < 64; i++)
+        {
+            uint32_t color = PaletteLUT_2C04_0001[i];
+            for (int channel = 0; channel < 3; channel++)
+            {
+                if ((emphasis & ~(1 << channel)) == 0)
+                {
+                    continue;
+                }
+
+                int shift = 16 - channel * 8;
+                uint32_t value = ((color >> shift) & 0xFF) * 209 / 256;
+                color = (color & ~(0xFFu << shift)) | (value << shift);
+            }
+            emphasis_colors[emphasis][i] = color;
+        }
+    }
+}
+
 uint8_t PPU::read(uint16_t address, bool resetStatus)
 {
+    // Bring the PPU up to the access before looking at its state
+    catch_up();
+
     uint8_t register_index = address & 7;
-    uint8_t old_NMI = this->NMI_occurred;
-    uint8_t current_status = this->status;
+    uint8_t old_NMI = state->NMI_occurred;
+    uint8_t current_status = state->status;
 
     switch (register_index)
     {
     case 0:
         // PPUCTRL
-        this->prev_read = this->control;
-        return this->control;
+        state->prev_read = state->control;
+        return state->control;
     case 1:
         // PPUMASK
-        this->prev_read = this->mask;
-        return this->mask;
+        state->prev_read = state->mask;
+        return state->mask;
     case 2:
     {
         if (!resetStatus)
         {
             // Return status without clearing VBlank flag or NMI
-            return (current_status & 0xE0) | (prev_read & 0x1F);
+            return (current_status & 0xE0) | (state->prev_read & 0x1F);
         }
 
         // PPUSTATUS
-        this->write_toggle = 0; // Reading status resets write toggle
+        state->write_toggle = 0; // Reading status resets write toggle
 
         // Clear VBlank flag after reading status
-        this->status &= ~0x80;
+        state->status &= ~0x80;
 
         // Clear NMI
-        this->NMI_occurred = 0;
+        state->NMI_occurred = 0;
 
         // Return status with lower 5 bits set to last value written
-        return (current_status & 0xE0) | (prev_read & 0x1F);
+        return (current_status & 0xE0) | (state->prev_read & 0x1F);
     }
     case 3:
         // OAMADDR
-        this->prev_read = this->oam_address;
-        return this->oam_address;
+        state->prev_read = state->oam_address;
+        return state->oam_address;
     case 4:
         // OAMDATA
-        this->prev_read = this->oam_data;
-        return this->oam_data;
+        state->prev_read = oam[state->oam_address];
+        return state->prev_read;
     case 5:
         // PPUSCROLL
-        // return this->scroll;
         break;
     case 6:
-        // PPUADDR
-        this->prev_read = this->address;
-        return this->address;
+        // PPUADDR is write-only
+        return state->prev_read;
     case 7:
-        // PPUDATA
-        this->prev_read = this->data;
-        return this->data;
+    {
+        // PPUDATA, a peek sees the read buffer without moving the address
+        if (!resetStatus)
+        {
+            return state->data;
+        }
+
+        // Reads below the palette come through a one-byte buffer. Palette
+        // reads are direct and fill the buffer from the nametable underneath.
+        uint16_t vram_address = state->vram_address & 0x3FFF;
+        uint8_t value;
+        if (vram_address < 0x3F00)
+        {
+            value = state->data;
+            state->data = read_bus(vram_address);
+        }
+        else
+        {
+            value = read_bus(vram_address);
+            state->data = read_bus(vram_address - 0x1000);
+        }
+
+        state->vram_address = (state->vram_address + ((state->control & 0x04) != 0 ? 32 : 1)) & 0x7FFF;
+        state->prev_read = value;
+        return value;
+    }
     case 8:
         // OAMDMA
-        this->prev_read = this->oam_dma;
-        return this->oam_dma;
+        state->prev_read = state->oam_dma;
+        return state->oam_dma;
     }
 
     Debug::debug_print("Unknown PPU read: " + std::to_string(address));
@@ -235,153 +643,290 @@ uint8_t PPU::read(uint16_t address, bool resetStatus)
 
 void PPU::write(uint16_t address, uint8_t value)
 {
+    // Lines already passed are rendered with the values they had
+    catch_up();
+
     uint8_t register_index = address & 7;
     switch (register_index)
     {
     case 0:
-        // PPUCTRL
-        this->control = value;
+    {
+        // PPUCTRL, enabling NMI during vblank raises one straight away
+        if ((value & 0x80) != 0 && (state->control & 0x80) == 0 && state->NMI_occurred && scheduler != nullptr)
+        {
+            scheduler->schedule(EVENT_NMI, state->synced_time);
+        }
+        bool size_changed = ((value ^ state->control) & 0x20) != 0;
+        state->control = value;
 
-        // Set VRAM address increment
-        this->vram_address++;
+        // Which lines sprites are on depends on their size
+        if (size_changed)
+        {
+            flush_sprite_lines();
+            schedule_sprite0_hit();
+        }
+
+        // The base nametable goes to t
+        state->temp_address = (state->temp_address & 0x73FF) | ((value & 0x03) << 10);
         break;
+    }
     case 1:
-        // PPUMASK
-        this->mask = value;
+    {
+        // PPUMASK, the mapper's scanline counter stops with rendering
+        bool rendering_changed = ((value ^ state->mask) & 0x18) != 0;
+        state->mask = value;
+        if (rendering_changed)
+        {
+            schedule_irq();
+            schedule_sprite0_hit();
+        }
         break;
+    }
     case 2:
         // PPUSTATUS
         break;
         // OAMADDR
     case 3:
-        this->oam_address = value;
+        state->oam_address = value;
         break;
     case 4:
         // OAMDATA
-        this->oam_data = value;
+        state->oam_data = value;
+        write_oam_data(state->oam_address, value);
 
         // Increment OAM address after writes
-        this->oam_address++;
+        state->oam_address++;
         break;
     case 5:
         // PPUSCROLL
-        if (this->write_toggle == 0)
+        if (state->write_toggle == 0)
         {
-            // First write
-            this->scroll_x = value;
-            this->write_toggle = 1;
+            // First write, X: coarse into t, fine into x
+            state->temp_address = (state->temp_address & 0x7FE0) | (value >> 3);
+            state->fine_x = value & 0x07;
+            state->write_toggle = 1;
         }
         else
         {
-            // Second write
-            this->scroll_y = value;
-            this->write_toggle = 0;
+            // Second write, Y: coarse and fine into t
+            state->temp_address = (state->temp_address & 0x0C1F) | ((value & 0x07) << 12) | ((value & 0xF8) << 2);
+            state->write_toggle = 0;
         }
         break;
     case 6:
         // PPUADDR
-        if (this->write_toggle == 0)
+        if (state->write_toggle == 0)
         {
-            // First write
-            this->address = value;
-            this->write_toggle = 1;
+            // First write, high byte into t (bit 14 is cleared)
+            state->temp_address = (uint16_t)(((value & 0x3F) << 8) | (state->temp_address & 0x00FF));
+            state->write_toggle = 1;
         }
         else
         {
-            // Second write
-            this->address = (this->address << 8) | value;
-            this->write_toggle = 0;
+            // Second write, low byte into t, and t into v
+            state->temp_address = (uint16_t)((state->temp_address & 0x7F00) | value);
+            state->vram_address = state->temp_address;
+            state->write_toggle = 0;
         }
         break;
     case 7:
-    {
-        // PPUDATA
-        // Adjust address for mirroring
-        unsigned int mirrored_address = this->vram_address % 0x2000;
-        this->vram[mirrored_address] = value;
-        // Increment and wrap VRAM address after writes
-        this->vram_address = (this->vram_address + 1) & 0x3FFF;
+        // PPUDATA, then step the address by 1 or 32
+        write_bus(state->vram_address, value);
+        state->vram_address = (state->vram_address + ((state->control & 0x04) != 0 ? 32 : 1)) & 0x7FFF;
         break;
-    }
     case 8:
         // OAMDMA
-        this->oam_dma = value;
+        state->oam_dma = value;
         break;
     }
 
-    this->prev_read = value;
+    state->prev_read = value;
+}
+
+uint8_t PPU::read_bus(uint16_t address)
+{
+    address &= 0x3FFF;
+
+    // Pattern tables, through the mapper's CHR banks
+    if (address < 0x2000)
+    {
+        return cartridge->read_chr(address);
+    }
+
+    // Nametables, $3000-$3EFF mirrors $2000-$2EFF
+    if (address < 0x3F00)
+    {
+        return nametables[(address >> 10) & 3][address & 0x3FF];
+    }
+
+    // Palette, with the backdrop entries of the sprite palettes mirrored down
+    uint8_t index = address & 0x1F;
+    if ((index & 0x13) == 0x10)
+    {
+        index &= 0x0F;
+    }
+    return palette[index];
 }
 
-void PPU::load(uint8_t* rom, uint32_t size)
+void PPU::write_bus(uint16_t address, uint8_t value)
 {
-    for (uint32_t i = 0; i < size; i++)
+    address &= 0x3FFF;
+
+    if (address < 0x2000)
     {
-        chr_rom[i] = rom[i];
+        cartridge->write_chr(address, value);
+
+        // The same CHR-RAM can be banked into more than one window
+        const uint8_t *window = cached_chr_windows[address >> 10];
+        for (int i = 0; i < 8; i++)
+        {
+            if (cached_chr_windows[i] == window)
+            {
+                decode_tile_row((uint16_t)((i << 10) | (address & 0x03F7)));
+            }
+        }
+    }
+    else if (address < 0x3F00)
+    {
+        nametables[(address >> 10) & 3][address & 0x3FF] = value;
+    }
+    else
+    {
+        uint8_t index = address & 0x1F;
+        if ((index & 0x13) == 0x10)
+        {
+            index &= 0x0F;
+        }
+        palette[index] = value & 0x3F;
     }
 }
 
 void PPU::set_vblank_flag()
 {
-	this->status |= 0x80;
+	state->status |= 0x80;
 }
 
 void PPU::write_oam_data(uint16_t address, uint8_t value)
 {
 	this->oam[address] = value;
+    flush_sprite_lines();
+
+    // Sprite 0's Y decides which lines can hit
+    if (address == 0)
+    {
+        schedule_sprite0_hit();
+    }
 }
 
 void PPU::step(int cycles)
 {
-    this->cycles += cycles;
-    this->total_cycles += cycles / 3;
+    state->synced_time += cycles;
+    state->total_cycles += cycles / 3;
+
+    // The PPU is only stepped when something needs its state, so this is
+    // usually many lines at once. Go a scanline at a time so every line
+    // passed is rendered exactly once. A line is drawn when its background
+    // fetches end, so scroll writes in hblank show from the next line on.
+    int from = state->cycles;
+    state->cycles += cycles;
+    for (;;)
+    {
+        if (from < FETCH_END_CYCLE && state->cycles >= FETCH_END_CYCLE)
+        {
+            draw_scanline();
+        }
+
+        if (state->cycles < SCANLINE_CYCLES)
+        {
+            break;
+        }
 
-    if (this->cycles >= SCANLINE_CYCLES)
+        state->cycles -= SCANLINE_CYCLES;
+        from = 0;
+        end_scanline();
+    }
+}
+
+void PPU::draw_scanline()
+{
+    if (state->scanline < YRES)
     {
-        this->cycles -= SCANLINE_CYCLES;
-        this->scanline++;
+        render_scanline(state->scanline);
     }
 
-    // Pre-render scanline
-    if (this->scanline == SCANLINES + 1)
+    // Past the fetches v moves down a line and takes the horizontal scroll
+    // from t again. The pre-render line then takes the vertical scroll too,
+    // which starts the frame at t.
+    if ((state->scanline >= YRES && state->scanline != SCANLINES) || !is_rendering())
     {
-        nmi_triggered = false;
-        // Clear VBlank flag
-        this->status &= ~0x80;
+        return;
+    }
 
-        // Clear NMI
-        this->NMI_occurred = 0;
+    uint16_t v = state->vram_address;
+    if ((v & 0x7000) != 0x7000)
+    {
+        // Fine Y
+        v += 0x1000;
+    }
+    else
+    {
+        // Coarse Y, wrapping into the nametable below after row 29. Rows 30
+        // and 31 are attribute bytes and wrap without switching.
+        v &= ~0x7000;
+        int y = (v & 0x03E0) >> 5;
+        if (y == 29)
+        {
+            y = 0;
+            v ^= 0x0800;
+        }
+        else if (y == 31)
+        {
+            y = 0;
+        }
+        else
+        {
+            y++;
+        }
+        v = (v & ~0x03E0) | (y << 5);
+    }
 
-        this->scanline = 0;
-        this->frame++;
+    v = (v & ~0x041F) | (state->temp_address & 0x041F);
+    if (state->scanline == SCANLINES)
+    {
+        v = (v & ~0x7BE0) | (state->temp_address & 0x7BE0);
     }
+    state->vram_address = v;
+}
 
-    // VBlank
-    if (this->scanline == VBLANK_SCANLINE && nmi_triggered == false && this->old_frame != this->frame)
+void PPU::end_scanline()
+{
+    // Visible and pre-render lines fetch from the pattern tables, which
+    // raises A12 once per line for mappers that count scanlines. The edge
+    // is taken at the end of the line.
+    if ((state->scanline < YRES || state->scanline == SCANLINES) && is_rendering() && cartridge != nullptr)
     {
-        // Set VBlank flag
-        this->status |= 0x80;
+        cartridge->clock_scanline();
+    }
 
-        old_frame = this->frame;
+    state->scanline++;
 
-        // Trigger NMI
-        this->NMI_occurred = 1;
+    // Pre-render scanline
+    if (state->scanline == SCANLINES + 1)
+    {
+        // Clear VBlank, sprite 0 hit and sprite overflow
+        state->status &= ~0xE0;
 
-        // Trigger NMI if NMI_occured is true and NMI is enabled
-        if (this->NMI_occurred && (this->control & 0x80) != 0 && !this->nmi_triggered)
-        {
-            // Trigger NMI
-            this->cpu->set_interrupt(InterruptType::NMI);
-            this->nmi_triggered = true;
-            this->NMI_occurred = 0;
-        }
-    }
+        // Clear NMI
+        state->NMI_occurred = 0;
 
-    for (int i = 0; i < 32; i++)
-    {
-        palette[i] = vram[0x3F00 + i];
+        state->scanline = 0;
+        state->frame++;
+
+        // Sprites are evaluated from OAM as it is now
+        flush_sprite_lines();
+        schedule_sprite0_hit();
     }
 
-     render_background_scanline(this->scanline);
     // draw_pattern_table(0, 8, 0, this->palette);
     // draw_pattern_table(128, 8, 1, this->palette);
     // draw_name_table(0, 8, 0, this->palette);
@@ -392,27 +937,202 @@ void PPU::draw_palette()
 {
     for (int i = 0; i < 32; i++)
     {
-        uint16_t color = palette[i];
-        draw_pixel(i % 16, i / 16, color);
+        draw_pixel(i % 16, i / 16, palette[i] & 0x3F);
+    }
+}
+
+void PPU::render_scanline(int scanline)
+{
+    // Palette indices for the line, 0-15 from the background and 16-31 from
+    // sprites
+    uint8_t background[(XRES / 8 + 1) * 8];
+    uint8_t *pixels = render_background(background);
+
+    uint8_t sprites[XRES + 8];
+    if (render_sprites(scanline, sprites))
+    {
+        // Eight pixels at a time, a sprite pixel shows where it is opaque,
+        // unless it is behind a background pixel that is too
+        for (int x = 0; x < XRES; x += 8)
+        {
+            uint64_t back;
+            uint64_t front;
+            memcpy(&back, &pixels[x], 8);
+            memcpy(&front, &sprites[x], 8);
+            uint64_t behind = ((front & 0x2020202020202020ULL) >> 5) * 0xFF;
+            uint64_t shown = opaque_mask(front) & ~(behind & opaque_mask(back));
+            back = (back & ~shown) | (front & 0x1F1F1F1F1F1F1F1FULL & shown);
+            memcpy(&pixels[x], &back, 8);
+        }
+    }
+
+    // Then into the 64 colours. Index 0 of every palette is the backdrop,
+    // and greyscale keeps only the column of grey.
+    uint8_t color_mask = (state->mask & 0x01) != 0 ? 0x30 : 0x3F;
+    uint8_t colors[32];
+    for (int i = 0; i < 32; i++)
+    {
+        colors[i] = palette[(i & 0x03) != 0 ? i : 0] & color_mask;
+    }
+
+    TileDecoder::lookup_indices(pixels, XRES, colors, &frame_indices[scanline * XRES]);
+    frame_emphasis[scanline] = state->mask >> 5;
+    frame_buffer_dirty = true;
+}
+
+uint8_t *PPU::render_background(uint8_t *line)
+{
+    // Returns the line's first visible pixel, XRES of them
+    if ((state->mask & 0x08) == 0)
+    {
+        memset(line, 0, XRES);
+        return line;
+    }
+
+    // 33 tiles cover the line at any fine X, 8 pixels each
+    uint16_t v = state->vram_address;
+    uint16_t pattern_row = ((state->control & 0x10) != 0 ? 0x1000 : 0x0000) | (v >> 12);
+    for (int tile = 0; tile < XRES / 8 + 1; tile++)
+    {
+        // Nametable byte, then the attribute byte of the tile's 4x4 group,
+        // two bits per 2x2 quadrant
+        const uint8_t *nametable = nametables[(v >> 10) & 3];
+        uint8_t index = nametable[v & 0x3FF];
+        uint8_t attribute = nametable[0x3C0 | ((v >> 4) & 0x38) | ((v >> 2) & 0x07)];
+        uint64_t palette_bits = ((attribute >> (((v >> 4) & 0x04) | (v & 0x02))) & 0x03) * 0x0404040404040404ULL;
+
+        uint64_t indices = tile_cache[0][get_tile_row_index(pattern_row + index * 16)] | palette_bits;
+        memcpy(&line[tile * 8], &indices, 8);
+
+        // Coarse X, wrapping into the nametable to the right after 31
+        if ((v & 0x001F) == 0x001F)
+        {
+            v = (v & ~0x001F) ^ 0x0400;
+        }
+        else
+        {
+            v++;
+        }
+    }
+
+    // PPUMASK can hide the leftmost 8 pixels
+    uint8_t *visible = &line[state->fine_x];
+    if ((state->mask & 0x02) == 0)
+    {
+        memset(visible, 0, 8);
     }
+
+    return visible;
 }
 
-void PPU::render_background_scanline(int scanline)
+bool PPU::render_sprites(int scanline, uint8_t *line)
 {
-    for (int x = 0; x < XRES; x++)
+    // Evaluation runs whenever rendering is on, even with sprites hidden
+    if (!is_rendering())
+    {
+        return false;
+    }
+
+    if (sprite_lines_dirty)
+    {
+        build_sprite_lines();
+    }
+
+    const SpriteLine &sprite_line = sprite_lines[scanline];
+    if (sprite_line.overflow)
     {
-        uint16_t tile = 32 * scanline / 8 + x / 8;
-        uint16_t tile_addr = 0x2000 + 0x400 * 0 + 16 * tile;
-        uint8_t* tile_data = &vram[tile_addr];
+        state->status |= 0x20;
+    }
 
-        uint8_t lo = tile_data[scanline % 8];
-        uint8_t hi = tile_data[scanline % 8 + 8];
+    if ((state->mask & 0x10) == 0 || sprite_line.count == 0)
+    {
+        return false;
+    }
 
-        
-        uint8_t color_index = ((hi >> (7 - x % 8)) & 0x1) << 1 | ((lo >> (7 - x % 8)) & 0x1);
-        uint16_t color = PaletteLUT_2C04_0001[palette[color_index]];
-        draw_pixel(x, scanline, color);
+    // The line has 8 pixels to spare for sprites near the right edge.
+    // Sprites go on back to front, so where they overlap the one first in
+    // OAM wins, even if it is behind the background and the other isn't.
+    memset(line, 0, XRES + 8);
+    for (int i = sprite_line.count - 1; i >= 0; i--)
+    {
+        const uint8_t *sprite = &oam[sprite_line.sprites[i] * 4];
+        uint64_t pixels = get_sprite_row(sprite, scanline - sprite[0] - 1);
+        uint64_t opaque = opaque_mask(pixels);
+        uint8_t flags = 0x10 | ((sprite[2] & 0x03) << 2) | (sprite[2] & SPRITE_BEHIND);
+        pixels = (pixels | flags * 0x0101010101010101ULL) & opaque;
+
+        uint64_t under;
+        memcpy(&under, &line[sprite[3]], 8);
+        under = (under & ~opaque) | pixels;
+        memcpy(&line[sprite[3]], &under, 8);
     }
+
+    // PPUMASK can hide them from the leftmost 8 pixels too
+    if ((state->mask & 0x04) == 0)
+    {
+        memset(line, 0, 8);
+    }
+
+    return true;
+}
+
+uint64_t PPU::get_sprite_row(const uint8_t *sprite, int row)
+{
+    // Row from the top of the sprite as it appears, so flipped vertically
+    // it is counted from the bottom of the tile
+    uint8_t tile = sprite[1];
+    uint8_t attributes = sprite[2];
+    int height = get_sprite_height();
+    if ((attributes & 0x80) != 0)
+    {
+        row = height - 1 - row;
+    }
+
+    // 8x16 sprites take their table from bit 0 of the tile number, and are
+    // the even tile above the odd one
+    uint16_t address;
+    if (height == 16)
+    {
+        address = (uint16_t)(((tile & 0x01) << 12) | ((tile & 0xFE) << 4) | ((row & 0x08) << 1) | (row & 0x07));
+    }
+    else
+    {
+        address = (uint16_t)(((state->control & 0x08) != 0 ? 0x1000 : 0x0000) | (tile << 4) | row);
+    }
+
+    return tile_cache[(attributes >> 6) & 1][get_tile_row_index(address)];
+}
+
+void PPU::build_sprite_lines()
+{
+    for (int line = 0; line < YRES; line++)
+    {
+        sprite_lines[line].count = 0;
+        sprite_lines[line].overflow = false;
+    }
+
+    // A sprite is drawn from the line after its Y. Only the first 8 on a
+    // line are, the rest set the overflow flag (without the hardware's
+    // buggy search for them).
+    int height = get_sprite_height();
+    for (int i = 0; i < 64; i++)
+    {
+        int top = oam[i * 4] + 1;
+        for (int line = top; line < top + height && line < YRES; line++)
+        {
+            SpriteLine &sprite_line = sprite_lines[line];
+            if (sprite_line.count < 8)
+            {
+                sprite_line.sprites[sprite_line.count++] = (uint8_t)i;
+            }
+            else
+            {
+                sprite_line.overflow = true;
+            }
+        }
+    }
+
+    sprite_lines_dirty = false;
 }
 
 void PPU::draw_pattern_table(int startX, int startY, int table, uint8_t* palette)
@@ -423,18 +1143,15 @@ void PPU::draw_pattern_table(int startX, int startY, int table, uint8_t* palette
         {
             uint16_t tile = 16 * y + x;
             uint16_t tile_addr = 0x1000 * table + 16 * tile;
-            uint8_t* tile_data = &chr_rom[tile_addr];
-
             for (int row = 0; row < 8; row++)
             {
-                uint8_t lo = tile_data[row];
-                uint8_t hi = tile_data[row + 8];
+                uint8_t lo = read_bus(tile_addr + row);
+                uint8_t hi = read_bus(tile_addr + row + 8);
 
                 for (int col = 0; col < 8; col++)
                 {
                     uint8_t color_index = ((hi >> (7 - col)) & 0x1) << 1 | ((lo >> (7 - col)) & 0x1);
-                    uint16_t color = palette[color_index];
-                    draw_pixel(startX + x * 8 + col, startY + y * 8 + row, color);
+                    draw_pixel(startX + x * 8 + col, startY + y * 8 + row, palette[color_index] & 0x3F);
                 }
             }
         }
@@ -447,46 +1164,43 @@ void PPU::draw_name_table(int nameTableIndex)
 
     for (int row = 0; row < 30; ++row) { // 30 tiles per column
         for (int col = 0; col < 32; ++col) { // 32 tiles per row
-            uint16_t tileIndex = vram[baseAddr + row * 32 + col]; // Get tile index
-            uint16_t tileAddr = 0x1000 * (control & 0x10) + 16 * tileIndex; // Get tile address
-
-            // Get tile data
-            uint8_t* tileData = &chr_rom[tileAddr];
+            uint16_t tileIndex = read_bus(baseAddr + row * 32 + col); // Get tile index
+            uint16_t tileAddr = ((state->control & 0x10) != 0 ? 0x1000 : 0) + 16 * tileIndex; // Get tile address
 
             // Calculate attribute table address for the tile
             uint16_t attrTableAddr = baseAddr + 0x3C0 + (row / 4) * 8 + (col / 4);
-            uint8_t attrByte = vram[attrTableAddr];
+            uint8_t attrByte = read_bus(attrTableAddr);
 
             // Determine which 2-bit palette number to use from the attribute byte
             int paletteShift = ((row % 4) / 2 * 2 + (col % 4) / 2 * 4);
             uint8_t paletteIndex = (attrByte >> paletteShift) & 0x03;
 
+            uint8_t colors[4];
+            for (int i = 0; i < 4; ++i) {
+                colors[i] = read_bus(0x3F00 + paletteIndex * 4 + i) & 0x3F;
+            }
+
             // Draw tile
             for (int y = 0; y < 8; ++y) {
-                uint8_t lo = tileData[y];
-                uint8_t hi = tileData[y + 8];
+                uint8_t lo = read_bus(tileAddr + y);
+                uint8_t hi = read_bus(tileAddr + y + 8);
 
                 for (int x = 0; x < 8; ++x) {
                     uint8_t colorIndex = ((hi >> (7 - x)) & 0x1) << 1 | ((lo >> (7 - x)) & 0x1);
-                    uint8_t paletteAddr = 0x3F00 + paletteIndex * 4 + colorIndex;
-                    uint16_t color = PaletteLUT_2C04_0001[palette[paletteAddr]];
-                    draw_pixel(col * 8 + x, row * 8 + y, color);
+                    draw_pixel(col * 8 + x, row * 8 + y, colors[colorIndex]);
                 }
             }
         }
     }
 }
 
-inline void PPU::draw_pixel(int x, int y, uint32_t color)
+inline void PPU::draw_pixel(int x, int y, uint8_t index)
 {
     if (x < 0 || x >= XRES || y < 0 || y >= YRES)
     {
         return;
     }
 
-    int index = (y * XRES + x) * 4;
-    this->frame_buffer[index] = color & 0xFF;             // Blue
-    this->frame_buffer[index + 1] = (color >> 8) & 0xFF;  // Green
-    this->frame_buffer[index + 2] = (color >> 16) & 0xFF; // Red
-    this->frame_buffer[index + 3] = (color >> 24) & 0xFF; // Alpha
+    frame_indices[y * XRES + x] = index;
+    frame_buffer_dirty = true;
 }
\ No newline at end of file
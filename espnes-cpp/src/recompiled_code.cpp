@@ -0,0 +1,158 @@
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+#include "../include/cpu.hpp"
+#include "../include/recompiled_code.hpp"
+
+RecompiledCode::RecompiledCode(Memory *memory) : library(nullptr), blocks(nullptr), progress(nullptr), block_start(0)
+{
+    this->memory = memory;
+
+    context.io = 0;
+    context.elapsed = 0;
+    context.instructions = 0;
+    context.read_pages = memory->get_read_pages();
+    context.write_pages = memory->get_write_pages();
+    context.host = this;
+    context.read = read;
+    context.write = write;
+}
+
+RecompiledCode::~RecompiledCode()
+{
+    unload();
+}
+
+std::string RecompiledCode::module_path(const std::string &rom_path)
+{
+#ifdef _WIN32
+    return rom_path + ".dll";
+#else
+    return rom_path + ".so";
+#endif
+}
+
+bool RecompiledCode::load(const std::string &path, uint32_t prg_crc)
+{
+    unload();
+
+    // No module is fine, the interpreter runs everything
+#ifdef _WIN32
+    HMODULE handle = LoadLibraryA(path.c_str());
+    if (handle == nullptr)
+    {
+        return false;
+    }
+    const espnes_module *module = reinterpret_cast<const espnes_module *>(GetProcAddress(handle, ESPNES_MODULE_SYMBOL));
+#else
+    // dlopen searches the library path for bare file names
+    std::string file = path.find('/') == std::string::npos ? "./" + path : path;
+    void *handle = dlopen(file.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (handle == nullptr)
+    {
+        return false;
+    }
+    const espnes_module *module = static_cast<const espnes_module *>(dlsym(handle, ESPNES_MODULE_SYMBOL));
+#endif
+    library = handle;
+
+    if (!load(module, prg_crc))
+    {
+        Debug::debug_print("Ignoring recompiled code in %s, it does not match this ROM", path.c_str());
+        unload();
+        return false;
+    }
+
+    Debug::debug_print("Loaded %u recompiled blocks from %s", module->block_count, path.c_str());
+    return true;
+}
+
+bool RecompiledCode::load(const espnes_module *module, uint32_t prg_crc)
+{
+    // Refuse code built for another ROM or an older interface
+    if (module == nullptr || module->version != ESPNES_RECOMPILED_VERSION || module->prg_crc != prg_crc)
+    {
+        return false;
+    }
+
+    // Most ROMs have no module, so the table only exists while one is loaded
+    delete[] blocks;
+    blocks = new espnes_block[0x8000]();
+    for (uint32_t i = 0; i < module->block_count; i++)
+    {
+        const espnes_block_entry &entry = module->blocks[i];
+        if (entry.pc >= 0x8000)
+        {
+            blocks[entry.pc - 0x8000] = entry.block;
+        }
+    }
+
+    return true;
+}
+
+void RecompiledCode::unload()
+{
+    delete[] blocks;
+    blocks = nullptr;
+
+    if (library == nullptr)
+    {
+        return;
+    }
+
+#ifdef _WIN32
+    FreeLibrary(static_cast<HMODULE>(library));
+#else
+    dlclose(library);
+#endif
+    library = nullptr;
+}
+
+int RecompiledCode::run(CPU *cpu, int max_cycles, int &cycles)
+{
+    context.pc = cpu->get_PC();
+    context.a = cpu->get_A();
+    context.x = cpu->get_X();
+    context.y = cpu->get_Y();
+    context.sp = cpu->get_SP();
+    context.p = cpu->get_P();
+    context.io = 0;
+    context.instructions = 0;
+
+    // Chain blocks until the budget runs out, code leaves the compiled set
+    // or an I/O access may have raised an event. cycles is the CPU's own
+    // counter, kept current so I/O can tell how far into the run it is.
+    progress = &cycles;
+    espnes_block block;
+    while (cycles < max_cycles && context.io == 0 && (block = lookup(context.pc)) != nullptr)
+    {
+        block_start = cycles;
+        cycles = block_start + block(&context);
+    }
+    progress = nullptr;
+
+    cpu->set_PC(context.pc);
+    cpu->set_A(context.a);
+    cpu->set_X(context.x);
+    cpu->set_Y(context.y);
+    cpu->set_SP(context.sp);
+    cpu->set_P(context.p);
+
+    return (int)context.instructions;
+}
+
+uint8_t RecompiledCode::read(void *host, uint16_t address)
+{
+    RecompiledCode *code = static_cast<RecompiledCode *>(host);
+    *code->progress = code->block_start + code->context.elapsed;
+    return code->memory->read(address);
+}
+
+void RecompiledCode::write(void *host, uint16_t address, uint8_t value)
+{
+    RecompiledCode *code = static_cast<RecompiledCode *>(host);
+    *code->progress = code->block_start + code->context.elapsed;
+    code->memory->write(address, value);
+}
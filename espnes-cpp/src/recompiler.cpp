@@ -0,0 +1,446 @@
+#include <cstring>
+#include <fstream>
+#include "../include/cpu.hpp"
+#include "../include/recompiler.hpp"
+
+typedef Disassembler::AddressingMode AddressingMode;
+
+// How an instruction uses its operand
+enum OperationKind
+{
+    OPERATION_READ,
+    OPERATION_WRITE,
+    OPERATION_MODIFY,
+    OPERATION_IMPLIED,
+    OPERATION_BRANCH,
+    OPERATION_JUMP
+};
+
+// C++ for each official instruction, in terms of the macros in
+// recompiled_abi.hpp. '$' stands for the operand value of reads and for the
+// byte being changed by read-modify-writes; stores name the register and
+// branches their condition.
+struct Operation
+{
+    const char *mnemonic;
+    OperationKind kind;
+    const char *code;
+};
+
+static const Operation operations[] = {
+    { "LDA", OPERATION_READ, "a = $; NZ(a);" },
+    { "LDX", OPERATION_READ, "x = $; NZ(x);" },
+    { "LDY", OPERATION_READ, "y = $; NZ(y);" },
+    { "AND", OPERATION_READ, "a &= $; NZ(a);" },
+    { "ORA", OPERATION_READ, "a |= $; NZ(a);" },
+    { "EOR", OPERATION_READ, "a ^= $; NZ(a);" },
+    { "ADC", OPERATION_READ, "ADC($);" },
+    { "SBC", OPERATION_READ, "SBC($);" },
+    { "CMP", OPERATION_READ, "CMP(a, $);" },
+    { "CPX", OPERATION_READ, "CMP(x, $);" },
+    { "CPY", OPERATION_READ, "CMP(y, $);" },
+    { "BIT", OPERATION_READ, "BIT($);" },
+    { "STA", OPERATION_WRITE, "a" },
+    { "STX", OPERATION_WRITE, "x" },
+    { "STY", OPERATION_WRITE, "y" },
+    { "ASL", OPERATION_MODIFY, "ASL($);" },
+    { "LSR", OPERATION_MODIFY, "LSR($);" },
+    { "ROL", OPERATION_MODIFY, "ROL($);" },
+    { "ROR", OPERATION_MODIFY, "ROR($);" },
+    { "INC", OPERATION_MODIFY, "$++; NZ($);" },
+    { "DEC", OPERATION_MODIFY, "$--; NZ($);" },
+    { "TAX", OPERATION_IMPLIED, "x = a; NZ(x);" },
+    { "TAY", OPERATION_IMPLIED, "y = a; NZ(y);" },
+    { "TXA", OPERATION_IMPLIED, "a = x; NZ(a);" },
+    { "TYA", OPERATION_IMPLIED, "a = y; NZ(a);" },
+    { "TSX", OPERATION_IMPLIED, "x = sp; NZ(x);" },
+    { "TXS", OPERATION_IMPLIED, "sp = x;" },
+    { "INX", OPERATION_IMPLIED, "x++; NZ(x);" },
+    { "INY", OPERATION_IMPLIED, "y++; NZ(y);" },
+    { "DEX", OPERATION_IMPLIED, "x--; NZ(x);" },
+    { "DEY", OPERATION_IMPLIED, "y--; NZ(y);" },
+    { "CLC", OPERATION_IMPLIED, "SETF(F_C, 0);" },
+    { "SEC", OPERATION_IMPLIED, "SETF(F_C, 1);" },
+    { "CLI", OPERATION_IMPLIED, "SETF(F_I, 0);" },
+    { "SEI", OPERATION_IMPLIED, "SETF(F_I, 1);" },
+    { "CLV", OPERATION_IMPLIED, "SETF(F_V, 0);" },
+    { "CLD", OPERATION_IMPLIED, "SETF(F_D, 0);" },
+    { "SED", OPERATION_IMPLIED, "SETF(F_D, 1);" },
+    { "NOP", OPERATION_IMPLIED, "" },
+    { "PHA", OPERATION_IMPLIED, "PUSH(a);" },
+    { "PHP", OPERATION_IMPLIED, "PUSH(p | F_B | F_U);" },
+    { "PLA", OPERATION_IMPLIED, "a = PULL(); NZ(a);" },
+    { "PLP", OPERATION_IMPLIED, "p = (uint8_t)((PULL() & ~F_B) | F_U);" },
+    { "BPL", OPERATION_BRANCH, "!(p & F_N)" },
+    { "BMI", OPERATION_BRANCH, "p & F_N" },
+    { "BVC", OPERATION_BRANCH, "!(p & F_V)" },
+    { "BVS", OPERATION_BRANCH, "p & F_V" },
+    { "BCC", OPERATION_BRANCH, "!(p & F_C)" },
+    { "BCS", OPERATION_BRANCH, "p & F_C" },
+    { "BNE", OPERATION_BRANCH, "!(p & F_Z)" },
+    { "BEQ", OPERATION_BRANCH, "p & F_Z" },
+    { "JMP", OPERATION_JUMP, nullptr },
+    { "JSR", OPERATION_JUMP, nullptr },
+    { "RTS", OPERATION_JUMP, nullptr },
+    { "RTI", OPERATION_JUMP, nullptr }
+};
+
+static const Operation *find_operation(const char *mnemonic)
+{
+    for (const Operation &operation : operations)
+    {
+        if (strcmp(operation.mnemonic, mnemonic) == 0)
+        {
+            return &operation;
+        }
+    }
+
+    return nullptr;
+}
+
+// Replace every '$' in code with value
+static std::string substitute(const char *code, const std::string &value)
+{
+    std::string result;
+    for (const char *c = code; *c != '\0'; c++)
+    {
+        if (*c == '$')
+        {
+            result += value;
+        }
+        else
+        {
+            result += *c;
+        }
+    }
+
+    return result;
+}
+
+Recompiler::Recompiler(Memory *memory, Disassembler *disassembler)
+{
+    this->memory = memory;
+    this->disassembler = disassembler;
+}
+
+Recompiler::~Recompiler()
+{
+}
+
+bool Recompiler::is_supported(const Disassembler::Instruction &ins)
+{
+    // Official opcodes only, BRK and the unofficial NOPs stay interpreted
+    const Operation *operation = find_operation(ins.mnemonic);
+    if (operation == nullptr || ins.length == 0)
+    {
+        return false;
+    }
+
+    return strcmp(ins.mnemonic, "NOP") != 0 || ins.opcode == 0xEA;
+}
+
+size_t Recompiler::get_block_count()
+{
+    return leaders.size();
+}
+
+void Recompiler::add_leader(uint16_t address, std::vector<uint16_t> &pending)
+{
+    // Only PRG-ROM is compiled, code in RAM can change under us
+    if (address >= 0x8000 && leaders.insert(address).second)
+    {
+        pending.push_back(address);
+    }
+}
+
+void Recompiler::trace_vectors()
+{
+    trace(memory->read(CPU::RESET_VECTOR, false) | (memory->read(CPU::RESET_VECTOR + 1, false) << 8));
+    trace(memory->read(CPU::NMI_VECTOR, false) | (memory->read(CPU::NMI_VECTOR + 1, false) << 8));
+    trace(memory->read(CPU::IRQ_VECTOR, false) | (memory->read(CPU::IRQ_VECTOR + 1, false) << 8));
+}
+
+void Recompiler::trace(uint16_t entry)
+{
+    std::vector<uint16_t> pending;
+    add_leader(entry, pending);
+
+    while (!pending.empty())
+    {
+        uint16_t pc = pending.back();
+        pending.pop_back();
+
+        // Follow straight-line code until control leaves it
+        while (pc >= 0x8000 && visited.insert(pc).second)
+        {
+            Disassembler::Instruction ins = disassembler->disassemble(pc);
+            uint16_t next = pc + ins.length;
+            uint16_t target = ins.operand1 | (ins.operand2 << 8);
+
+            // KIL, or an instruction running off the end of the address space
+            if (ins.length == 0 || next < pc)
+            {
+                break;
+            }
+
+            if (ins.addressingMode == AddressingMode::RELATIVE)
+            {
+                add_leader(next + static_cast<int8_t>(ins.operand1), pending);
+                add_leader(next, pending);
+                break;
+            }
+            else if (strcmp(ins.mnemonic, "JMP") == 0)
+            {
+                if (ins.addressingMode == AddressingMode::ABSOLUTE)
+                {
+                    add_leader(target, pending);
+                }
+                break;
+            }
+            else if (strcmp(ins.mnemonic, "JSR") == 0)
+            {
+                add_leader(target, pending);
+                add_leader(next, pending);
+                break;
+            }
+            else if (strcmp(ins.mnemonic, "RTS") == 0 || strcmp(ins.mnemonic, "RTI") == 0)
+            {
+                break;
+            }
+            else if (strcmp(ins.mnemonic, "BRK") == 0)
+            {
+                // The handler returns past the padding byte
+                add_leader(pc + 2, pending);
+                break;
+            }
+            else if (!is_supported(ins))
+            {
+                // The interpreter runs it, then hands back to the next block
+                add_leader(next, pending);
+                break;
+            }
+
+            pc = next;
+        }
+    }
+}
+
+bool Recompiler::write_source(const std::string &path, uint32_t prg_crc)
+{
+    std::ofstream out(path);
+    if (!out)
+    {
+        return false;
+    }
+
+    char line[256];
+    sprintf_s(line, sizeof(line), "// Generated by espnes_recompiler from PRG-ROM %08X, do not edit\n\n", prg_crc);
+    out << line;
+    out << "#define ESPNES_RECOMPILED_MODULE\n";
+    out << "#include \"recompiled_abi.hpp\"\n\n";
+
+    // Blocks can only start on an instruction we know how to translate
+    std::vector<uint16_t> blocks;
+    for (uint16_t leader : leaders)
+    {
+        if (is_supported(disassembler->disassemble(leader)))
+        {
+            emit_block(out, leader);
+            blocks.push_back(leader);
+        }
+    }
+
+    out << "static const espnes_block_entry blocks[] = {\n";
+    for (uint16_t block : blocks)
+    {
+        sprintf_s(line, sizeof(line), "    { 0x%04X, block_%04X },\n", block, block);
+        out << line;
+    }
+    out << "};\n\n";
+
+    sprintf_s(line, sizeof(line), "extern \"C\" ESPNES_EXPORT const espnes_module espnes_module_info = {\n"
+        "    ESPNES_RECOMPILED_VERSION, 0x%08Xu, %u, blocks\n};\n", prg_crc, (unsigned)blocks.size());
+    out << line;
+
+    return out.good();
+}
+
+void Recompiler::emit_block(std::ostream &out, uint16_t start)
+{
+    char line[64];
+    sprintf_s(line, sizeof(line), "static int block_%04X(espnes_context *ctx)\n{\n", start);
+    out << line << "    BEGIN;\n";
+
+    uint16_t pc = start;
+    for (int count = 0; ; count++)
+    {
+        Disassembler::Instruction ins = disassembler->disassemble(pc);
+        uint16_t next = pc + ins.length;
+
+        // Hand anything we can't translate back to the interpreter
+        if (!is_supported(ins))
+        {
+            sprintf_s(line, sizeof(line), "    EXIT(0x%04X);\n", pc);
+            out << line;
+            break;
+        }
+
+        if (!emit_instruction(out, ins))
+        {
+            break;
+        }
+
+        // Chain into the next block rather than duplicating it
+        if (next < 0x8000 || leaders.count(next) != 0 || count + 1 >= MAX_BLOCK_INSTRUCTIONS)
+        {
+            sprintf_s(line, sizeof(line), "    EXIT(0x%04X);\n", next);
+            out << line;
+            break;
+        }
+
+        pc = next;
+    }
+
+    out << "}\n\n";
+}
+
+bool Recompiler::emit_instruction(std::ostream &out, const Disassembler::Instruction &ins)
+{
+    const Operation *operation = find_operation(ins.mnemonic);
+    const Disassembler::OpcodeInfo &info = disassembler->get_opcode_info(ins.opcode);
+    uint16_t next = ins.address + ins.length;
+    uint16_t operand16 = ins.operand1 | (ins.operand2 << 8);
+    char buffer[160];
+
+    // Resolve the effective address. Zero page and low absolute addresses
+    // are always RAM, anything else may be I/O.
+    std::string address;
+    std::string setup;
+    std::string page_cross;
+    bool may_be_io = false;
+
+    switch (ins.addressingMode)
+    {
+    case AddressingMode::ZERO_PAGE:
+        sprintf_s(buffer, sizeof(buffer), "0x%02X", ins.operand1);
+        address = buffer;
+        break;
+    case AddressingMode::ZERO_PAGE_X:
+    case AddressingMode::ZERO_PAGE_Y:
+        sprintf_s(buffer, sizeof(buffer), "ea = (uint8_t)(0x%02X + %c); ", ins.operand1,
+            ins.addressingMode == AddressingMode::ZERO_PAGE_X ? 'x' : 'y');
+        setup = buffer;
+        address = "ea";
+        break;
+    case AddressingMode::ABSOLUTE:
+        sprintf_s(buffer, sizeof(buffer), "0x%04X", operand16);
+        address = buffer;
+        may_be_io = operand16 >= 0x2000;
+        break;
+    case AddressingMode::ABSOLUTE_X:
+    case AddressingMode::ABSOLUTE_Y:
+        sprintf_s(buffer, sizeof(buffer), "ea = (uint16_t)(0x%04X + %c); ", operand16,
+            ins.addressingMode == AddressingMode::ABSOLUTE_X ? 'x' : 'y');
+        setup = buffer;
+        sprintf_s(buffer, sizeof(buffer), "cycles += PAGE_CROSSED(0x%04X, ea); ", operand16);
+        page_cross = buffer;
+        address = "ea";
+        may_be_io = operand16 + 0xFF >= 0x2000;
+        break;
+    case AddressingMode::INDIRECT_X:
+        sprintf_s(buffer, sizeof(buffer), "ea = RD16_ZP(0x%02X + x); ", ins.operand1);
+        setup = buffer;
+        address = "ea";
+        may_be_io = true;
+        break;
+    case AddressingMode::INDIRECT_Y:
+        sprintf_s(buffer, sizeof(buffer), "base = RD16_ZP(0x%02X); ea = (uint16_t)(base + y); ", ins.operand1);
+        setup = buffer;
+        page_cross = "cycles += PAGE_CROSSED(base, ea); ";
+        address = "ea";
+        may_be_io = true;
+        break;
+    default:
+        break;
+    }
+
+    sprintf_s(buffer, sizeof(buffer), "    // %04X  %s\n    start = cycles; cycles += %d; executed++; ", ins.address, ins.mnemonic, info.cycles);
+    out << buffer;
+
+    switch (operation->kind)
+    {
+    case OPERATION_READ:
+        if (ins.addressingMode == AddressingMode::IMMEDIATE)
+        {
+            sprintf_s(buffer, sizeof(buffer), "0x%02X", ins.operand1);
+            out << substitute(operation->code, buffer);
+        }
+        else
+        {
+            out << setup << page_cross << substitute(operation->code, "RD(" + address + ")");
+        }
+        break;
+    case OPERATION_WRITE:
+        out << setup << "WR(" << address << ", " << operation->code << ");";
+        break;
+    case OPERATION_MODIFY:
+        if (ins.addressingMode == AddressingMode::ACCUMULATOR)
+        {
+            out << substitute(operation->code, "a");
+        }
+        else
+        {
+            out << setup << "t = RD(" << address << "); " << substitute(operation->code, "t")
+                << " WR(" << address << ", t);";
+        }
+        break;
+    case OPERATION_IMPLIED:
+        out << operation->code;
+        break;
+    case OPERATION_BRANCH:
+    {
+        // +1 cycle if taken, +2 if the target is on another page
+        uint16_t target = next + static_cast<int8_t>(ins.operand1);
+        sprintf_s(buffer, sizeof(buffer), "if (%s) { cycles += %d; EXIT(0x%04X); }\n    EXIT(0x%04X);\n",
+            operation->code, ((target ^ next) & 0xFF00) != 0 ? 2 : 1, target, next);
+        out << buffer;
+        return false;
+    }
+    case OPERATION_JUMP:
+        if (strcmp(ins.mnemonic, "JSR") == 0)
+        {
+            // Push the address of the last byte of this instruction
+            uint16_t ret = next - 1;
+            sprintf_s(buffer, sizeof(buffer), "PUSH(0x%02X); PUSH(0x%02X); EXIT(0x%04X);\n", ret >> 8, ret & 0xFF, operand16);
+        }
+        else if (strcmp(ins.mnemonic, "RTS") == 0)
+        {
+            sprintf_s(buffer, sizeof(buffer), "ea = PULL(); ea = (uint16_t)(ea | (PULL() << 8)); EXIT(ea + 1);\n");
+        }
+        else if (strcmp(ins.mnemonic, "RTI") == 0)
+        {
+            sprintf_s(buffer, sizeof(buffer), "p = PULL(); ea = PULL(); ea = (uint16_t)(ea | (PULL() << 8)); EXIT(ea);\n");
+        }
+        else if (ins.addressingMode == AddressingMode::INDIRECT)
+        {
+            sprintf_s(buffer, sizeof(buffer), "EXIT(RD(0x%04X) | (RD(0x%04X) << 8));\n", operand16, (uint16_t)(operand16 + 1));
+        }
+        else
+        {
+            sprintf_s(buffer, sizeof(buffer), "EXIT(0x%04X);\n", operand16);
+        }
+        out << buffer;
+        return false;
+    }
+
+    out << "\n";
+
+    // Stop after I/O so the emulator can catch the PPU up
+    if (may_be_io)
+    {
+        sprintf_s(buffer, sizeof(buffer), "    IO_EXIT(0x%04X);\n", next);
+        out << buffer;
+    }
+
+    return true;
+}
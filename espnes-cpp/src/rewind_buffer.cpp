@@ -0,0 +1,205 @@
+#include <cstring>
+#include "../include/rewind_buffer.hpp"
+
+// Lengths in deltas are LEB128 varints, one byte for anything under 128
+static size_t write_varint(uint8_t *out, size_t value)
+{
+    size_t size = 0;
+    while (value >= 0x80)
+    {
+        out[size++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    out[size++] = (uint8_t)value;
+    return size;
+}
+
+static size_t read_varint(const uint8_t *data, size_t &position)
+{
+    size_t value = 0;
+    int shift = 0;
+    uint8_t byte;
+    do
+    {
+        byte = data[position++];
+        value |= (size_t)(byte & 0x7F) << shift;
+        shift += 7;
+    } while ((byte & 0x80) != 0);
+
+    return value;
+}
+
+RewindBuffer::RewindBuffer() : first(0), count(0), write(0), used(0), has_newest(false)
+{
+}
+
+void RewindBuffer::allocate(size_t capacity, size_t state_size)
+{
+    // Unchanged states encode to nothing, so the snapshot table rather than
+    // the ring can fill up first; one entry per 32 bytes is plenty
+    ring.assign(capacity, 0);
+    snapshots.assign(capacity / 32 > 0 ? capacity / 32 : 1, Snapshot());
+    newest.assign(state_size, 0);
+
+    // Room for the worst case, every other byte changed
+    scratch.assign(state_size * 2 + 16, 0);
+    clear();
+}
+
+void RewindBuffer::release()
+{
+    std::vector<uint8_t>().swap(ring);
+    std::vector<Snapshot>().swap(snapshots);
+    std::vector<uint8_t>().swap(newest);
+    std::vector<uint8_t>().swap(scratch);
+    clear();
+}
+
+void RewindBuffer::clear()
+{
+    first = 0;
+    count = 0;
+    write = 0;
+    used = 0;
+    has_newest = false;
+}
+
+void RewindBuffer::push(const uint8_t *state)
+{
+    if (ring.empty())
+    {
+        return;
+    }
+
+    // The outgoing newest state becomes a delta against this one
+    if (has_newest)
+    {
+        size_t size = encode(newest.data(), state, scratch.data());
+        store(scratch.data(), (uint32_t)size);
+    }
+
+    memcpy(newest.data(), state, newest.size());
+    has_newest = true;
+}
+
+const uint8_t *RewindBuffer::rewind(int steps)
+{
+    if (!has_newest)
+    {
+        return nullptr;
+    }
+
+    // Undo deltas newest first, handing their space back to the ring
+    for (int i = 0; i < steps && count > 0; i++)
+    {
+        const Snapshot &snapshot = snapshots[(first + count - 1) % snapshots.size()];
+        apply(&ring[snapshot.offset], snapshot.size, newest.data());
+        write = snapshot.offset;
+        used -= snapshot.size;
+        count--;
+    }
+
+    return newest.data();
+}
+
+size_t RewindBuffer::encode(const uint8_t *older, const uint8_t *newer, uint8_t *out)
+{
+    // A delta is a list of (unchanged bytes to skip, changed byte count,
+    // changed bytes XOR) groups. A single unchanged byte costs less inside a
+    // group than it would to start a new one, so only two or more end it.
+    size_t size = newest.size();
+    size_t length = 0;
+    size_t i = 0;
+    for (;;)
+    {
+        size_t start = i;
+        while (i < size && older[i] == newer[i])
+        {
+            i++;
+        }
+        if (i == size)
+        {
+            break;
+        }
+
+        size_t changed = i;
+        while (i < size && (older[i] != newer[i] || (i + 1 < size && older[i + 1] != newer[i + 1])))
+        {
+            i++;
+        }
+
+        length += write_varint(out + length, changed - start);
+        length += write_varint(out + length, i - changed);
+        for (size_t j = changed; j < i; j++)
+        {
+            out[length++] = older[j] ^ newer[j];
+        }
+    }
+
+    return length;
+}
+
+void RewindBuffer::apply(const uint8_t *delta, size_t size, uint8_t *state)
+{
+    size_t position = 0;
+    size_t offset = 0;
+    while (position < size)
+    {
+        offset += read_varint(delta, position);
+        size_t changed = read_varint(delta, position);
+        for (size_t i = 0; i < changed; i++)
+        {
+            state[offset++] ^= delta[position++];
+        }
+    }
+}
+
+void RewindBuffer::store(const uint8_t *delta, uint32_t size)
+{
+    // A delta bigger than the whole ring breaks the chain, and with it
+    // everything older
+    if (size > ring.size())
+    {
+        while (count > 0)
+        {
+            drop_oldest();
+        }
+        return;
+    }
+
+    if (count == (int)snapshots.size())
+    {
+        drop_oldest();
+    }
+
+    // Deltas are contiguous; one that doesn't fit before the end of the
+    // ring starts over at 0 and the tail goes unused. Ring order is age
+    // order, so whatever is in the way is always the oldest.
+    bool wrap = write + size > ring.size();
+    uint32_t position = wrap ? 0 : write;
+    while (count > 0)
+    {
+        uint32_t offset = snapshots[first].offset;
+        bool in_the_way = wrap ? (offset >= write || offset < size) : (offset >= position && offset < position + size);
+        if (!in_the_way)
+        {
+            break;
+        }
+        drop_oldest();
+    }
+
+    memcpy(&ring[position], delta, size);
+    Snapshot &snapshot = snapshots[(first + count) % snapshots.size()];
+    snapshot.offset = position;
+    snapshot.size = size;
+    count++;
+    write = position + size;
+    used += size;
+}
+
+void RewindBuffer::drop_oldest()
+{
+    used -= snapshots[first].size;
+    first = (first + 1) % (int)snapshots.size();
+    count--;
+}
\ No newline at end of file
@@ -0,0 +1,222 @@
+#include <cstring>
+#include <map>
+#include <mutex>
+#include "../include/rom_image.hpp"
+
+// Images still in use somewhere, by hash. Entries expire with their last user.
+static std::mutex cache_mutex;
+static std::map<uint32_t, std::weak_ptr<RomImage>> cache;
+
+// CRC-32 (IEEE) lookup table, built before anything can open a ROM
+struct CrcTable
+{
+    uint32_t entries[256];
+
+    CrcTable()
+    {
+        for (uint32_t i = 0; i < 256; i++)
+        {
+            uint32_t value = i;
+            for (int bit = 0; bit < 8; bit++)
+            {
+                value = (value >> 1) ^ (0xEDB88320 & (0 - (value & 1)));
+            }
+            entries[i] = value;
+        }
+    }
+};
+
+static const CrcTable crc_table;
+
+// CRC-32, continuing from a previous result so PRG and CHR hash as one
+static uint32_t crc32(const uint8_t *data, uint32_t size, uint32_t crc)
+{
+    crc = ~crc;
+    for (uint32_t i = 0; i < size; i++)
+    {
+        crc = (crc >> 8) ^ crc_table.entries[(crc ^ data[i]) & 0xFF];
+    }
+
+    return ~crc;
+}
+
+// NES 2.0 sizes are either a multiple of a unit or, with the top nibble set,
+// 2^E * (M * 2 + 1) bytes
+static uint64_t nes2_rom_size(uint8_t lsb, uint8_t msb, uint32_t unit)
+{
+    if (msb == 0x0F)
+    {
+        // Past 2^32 nothing fits in a file, leave it to the size check
+        int exponent = lsb >> 2;
+        return exponent < 32 ? ((uint64_t)1 << exponent) * ((lsb & 0x03) * 2 + 1) : (uint64_t)1 << 40;
+    }
+
+    return ((uint64_t)msb << 8 | lsb) * unit;
+}
+
+RomImage::RomImage() : header(nullptr), trainer(nullptr), prg(nullptr), prg_size(0), chr(nullptr), chr_size(0), mapper_number(0), submapper(0),
+    mirroring(MIRRORING_HORIZONTAL), nes2(false), battery(false), prg_ram_size(0), chr_ram_size(0), prg_crc(0), hash(0)
+{
+}
+
+RomImage::~RomImage()
+{
+}
+
+std::shared_ptr<RomImage> RomImage::open(const std::string &path, std::string &error)
+{
+    std::shared_ptr<RomImage> image(new RomImage());
+    if (!image->file.open(path))
+    {
+        error = "Failed to open ROM file";
+        return nullptr;
+    }
+
+    if (!image->parse(image->file.get_data(), image->file.get_size(), error))
+    {
+        return nullptr;
+    }
+
+    // Hand out the image already in use if this is the same ROM, and let
+    // the new mapping go
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    std::map<uint32_t, std::weak_ptr<RomImage>>::iterator entry = cache.find(image->hash);
+    if (entry != cache.end())
+    {
+        std::shared_ptr<RomImage> shared = entry->second.lock();
+        if (shared != nullptr && shared->same_contents(*image))
+        {
+            return shared;
+        }
+    }
+
+    // Drop entries whose images have all been released
+    for (entry = cache.begin(); entry != cache.end();)
+    {
+        if (entry->second.expired())
+        {
+            entry = cache.erase(entry);
+        }
+        else
+        {
+            ++entry;
+        }
+    }
+
+    cache[image->hash] = image;
+    return image;
+}
+
+std::shared_ptr<RomImage> RomImage::create(const uint8_t *data, size_t size, std::string &error)
+{
+    std::shared_ptr<RomImage> image(new RomImage());
+    image->contents.assign(data, data + size);
+    if (!image->parse(image->contents.data(), image->contents.size(), error))
+    {
+        return nullptr;
+    }
+
+    return image;
+}
+
+bool RomImage::parse(const uint8_t *data, size_t size, std::string &error)
+{
+    // Check if ROM is valid (NES<EOF>)
+    if (size < 16 || data[0] != 0x4E || data[1] != 0x45 || data[2] != 0x53 || data[3] != 0x1A)
+    {
+        error = "Invalid ROM";
+        return false;
+    }
+    header = data;
+
+    // NES 2.0 marks byte 7 with 0b10 in bits 2-3. Old dumps often have junk
+    // from a ripper's signature in bytes 7-15, so without NES 2.0 and with
+    // bytes 12-15 dirty only the low nibble of the mapper is trusted.
+    nes2 = (header[7] & 0x0C) == 0x08;
+    bool dirty = !nes2 && (header[12] | header[13] | header[14] | header[15]) != 0;
+
+    mapper_number = header[6] >> 4;
+    if (!dirty)
+    {
+        mapper_number |= header[7] & 0xF0;
+    }
+
+    uint64_t prg_bytes;
+    uint64_t chr_bytes;
+    if (nes2)
+    {
+        mapper_number |= (header[8] & 0x0F) << 8;
+        submapper = header[8] >> 4;
+        prg_bytes = nes2_rom_size(header[4], header[9] & 0x0F, 0x4000);
+        chr_bytes = nes2_rom_size(header[5], header[9] >> 4, 0x2000);
+
+        // RAM sizes are shift counts, 64 << n bytes or none
+        int prg_ram_shift = header[10] & 0x0F;
+        int prg_nvram_shift = header[10] >> 4;
+        int chr_ram_shift = header[11] & 0x0F;
+        prg_ram_size = (prg_ram_shift != 0 ? 64u << prg_ram_shift : 0) + (prg_nvram_shift != 0 ? 64u << prg_nvram_shift : 0);
+        chr_ram_size = chr_ram_shift != 0 ? 64u << chr_ram_shift : 0;
+    }
+    else
+    {
+        prg_bytes = (uint64_t)header[4] * 0x4000;
+        chr_bytes = (uint64_t)header[5] * 0x2000;
+
+        // iNES counts PRG RAM in 8KB units, 0 meaning 8KB. Boards without
+        // CHR-ROM have 8KB of CHR-RAM.
+        prg_ram_size = (dirty || header[8] == 0 ? 1 : header[8]) * 0x2000;
+        chr_ram_size = chr_bytes == 0 ? 0x2000 : 0;
+    }
+
+    if ((header[6] & 0x08) != 0)
+    {
+        mirroring = MIRRORING_FOUR_SCREEN;
+    }
+    else if ((header[6] & 0x01) != 0)
+    {
+        mirroring = MIRRORING_VERTICAL;
+    }
+    else
+    {
+        mirroring = MIRRORING_HORIZONTAL;
+    }
+    battery = (header[6] & 0x02) != 0;
+
+    // Trainer, PRG and CHR follow the header in that order
+    uint64_t offset = 16;
+    if ((header[6] & 0x04) != 0)
+    {
+        trainer = data + offset;
+        offset += TRAINER_SIZE;
+    }
+
+    if (offset + prg_bytes + chr_bytes > size)
+    {
+        error = "Truncated ROM";
+        return false;
+    }
+
+    prg = data + offset;
+    prg_size = (uint32_t)prg_bytes;
+    chr = chr_bytes != 0 ? data + offset + prg_bytes : nullptr;
+    chr_size = (uint32_t)chr_bytes;
+
+    prg_crc = crc32(prg, prg_size, 0);
+    hash = crc32(chr, chr_size, prg_crc);
+    return true;
+}
+
+bool RomImage::same_contents(RomImage &other)
+{
+    // The hash picked the candidate, this rules out collisions and ROMs that
+    // differ only in their header
+    if (prg_size != other.prg_size || chr_size != other.chr_size || (trainer == nullptr) != (other.trainer == nullptr))
+    {
+        return false;
+    }
+
+    return memcmp(header, other.header, 16) == 0 &&
+        (trainer == nullptr || memcmp(trainer, other.trainer, TRAINER_SIZE) == 0) &&
+        memcmp(prg, other.prg, prg_size) == 0 &&
+        (chr_size == 0 || memcmp(chr, other.chr, chr_size) == 0);
+}
\ No newline at end of file
@@ -0,0 +1,100 @@
+#include "../include/scheduler.hpp"
+
+Scheduler::Scheduler()
+{
+    reset();
+}
+
+Scheduler::~Scheduler()
+{
+}
+
+void Scheduler::reset()
+{
+    events = std::priority_queue<Event, std::vector<Event>, std::greater<Event>>();
+    time = 0;
+
+    for (int i = 0; i < EVENT_TYPE_COUNT; i++)
+    {
+        scheduled[i] = NOT_SCHEDULED;
+    }
+}
+
+void Scheduler::schedule(EventType type, int64_t time)
+{
+    // Replaces any earlier schedule for the same type
+    scheduled[type] = time;
+    events.push(Event{ time, type });
+}
+
+void Scheduler::cancel(EventType type)
+{
+    scheduled[type] = NOT_SCHEDULED;
+}
+
+int64_t Scheduler::get_event_time(EventType type)
+{
+    return scheduled[type];
+}
+
+void Scheduler::drop_stale_events()
+{
+    while (!events.empty() && scheduled[events.top().type] != events.top().time)
+    {
+        events.pop();
+    }
+}
+
+bool Scheduler::pop_due_event(EventType &type)
+{
+    drop_stale_events();
+    if (events.empty() || events.top().time > time)
+    {
+        return false;
+    }
+
+    type = events.top().type;
+    scheduled[type] = NOT_SCHEDULED;
+    events.pop();
+    return true;
+}
+
+int Scheduler::get_cycles_to_next_event()
+{
+    drop_stale_events();
+    if (events.empty())
+    {
+        return 0x10000;
+    }
+
+    // Round up to whole CPU cycles, and always allow at least one
+    int64_t dots = events.top().time - time;
+    return dots > 0 ? (int)((dots + 2) / 3) : 1;
+}
+
+void Scheduler::save_state(StateWriter &state)
+{
+    // The queue is rebuilt from the pending time of each type
+    state.write_value(time);
+    state.write(scheduled, sizeof(scheduled));
+}
+
+void Scheduler::load_state(StateReader &state)
+{
+    state.read_value(time);
+    state.read(scheduled, sizeof(scheduled));
+
+    // Emptied in place, so the queue keeps its storage
+    while (!events.empty())
+    {
+        events.pop();
+    }
+
+    for (int i = 0; i < EVENT_TYPE_COUNT; i++)
+    {
+        if (scheduled[i] != NOT_SCHEDULED)
+        {
+            events.push(Event{ scheduled[i], (EventType)i });
+        }
+    }
+}
@@ -0,0 +1,179 @@
+#include "../include/tile_decoder.hpp"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__)
+#define TILE_DECODER_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+// GCC and Clang only emit AVX2 in functions marked for it, MSVC in any
+#if defined(TILE_DECODER_X86) && defined(__GNUC__)
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define TARGET_AVX2
+#endif
+
+static void lookup_scalar(const uint8_t *indices, int count, const uint32_t *colors, uint32_t *out)
+{
+    for (int i = 0; i < count; i++)
+    {
+        out[i] = colors[indices[i]];
+    }
+}
+
+static void lookup_indices_scalar(const uint8_t *indices, int count, const uint8_t *table, uint8_t *out)
+{
+    for (int i = 0; i < count; i++)
+    {
+        out[i] = table[indices[i]];
+    }
+}
+
+#ifdef TILE_DECODER_X86
+
+TARGET_AVX2 static void lookup_avx2(const uint8_t *indices, int count, const uint32_t *colors, uint32_t *out)
+{
+    // Each byte of the colours gets its own 64-byte table, a quarter per
+    // register so a byte shuffle looks up 16 entries in both lanes
+    __m256i tables[4][4];
+    for (int channel = 0; channel < 4; channel++)
+    {
+        uint8_t bytes[64];
+        for (int i = 0; i < 64; i++)
+        {
+            bytes[i] = (uint8_t)(colors[i] >> (channel * 8));
+        }
+        for (int quarter = 0; quarter < 4; quarter++)
+        {
+            tables[channel][quarter] = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)&bytes[quarter * 16]));
+        }
+    }
+
+    const __m256i sixteen = _mm256_set1_epi8(16);
+    const __m256i in_range = _mm256_set1_epi8(0x70);
+
+    int i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        // Each quarter's indices, counted from its start. A shuffle gives 0
+        // where bit 7 is set, which saturating on to 0x70 does to any index
+        // not in the quarter: those below it wrapped negative, those above
+        // are 16 or more.
+        __m256i index = _mm256_loadu_si256((const __m256i *)(indices + i));
+        __m256i quarters[4];
+        for (int quarter = 0; quarter < 4; quarter++)
+        {
+            quarters[quarter] = _mm256_adds_epu8(index, in_range);
+            index = _mm256_sub_epi8(index, sixteen);
+        }
+
+        __m256i planes[4];
+        for (int channel = 0; channel < 4; channel++)
+        {
+            planes[channel] = _mm256_or_si256(
+                _mm256_or_si256(_mm256_shuffle_epi8(tables[channel][0], quarters[0]), _mm256_shuffle_epi8(tables[channel][1], quarters[1])),
+                _mm256_or_si256(_mm256_shuffle_epi8(tables[channel][2], quarters[2]), _mm256_shuffle_epi8(tables[channel][3], quarters[3])));
+        }
+
+        // Interleave the planes back into pixels. Unpacking stays within
+        // lanes, giving pixels 0-3 and 16-19 together and so on, which the
+        // last step puts in order.
+        __m256i blue_green_low = _mm256_unpacklo_epi8(planes[0], planes[1]);
+        __m256i blue_green_high = _mm256_unpackhi_epi8(planes[0], planes[1]);
+        __m256i red_alpha_low = _mm256_unpacklo_epi8(planes[2], planes[3]);
+        __m256i red_alpha_high = _mm256_unpackhi_epi8(planes[2], planes[3]);
+        __m256i pixels_0 = _mm256_unpacklo_epi16(blue_green_low, red_alpha_low);
+        __m256i pixels_4 = _mm256_unpackhi_epi16(blue_green_low, red_alpha_low);
+        __m256i pixels_8 = _mm256_unpacklo_epi16(blue_green_high, red_alpha_high);
+        __m256i pixels_12 = _mm256_unpackhi_epi16(blue_green_high, red_alpha_high);
+
+        _mm256_storeu_si256((__m256i *)(out + i), _mm256_permute2x128_si256(pixels_0, pixels_4, 0x20));
+        _mm256_storeu_si256((__m256i *)(out + i + 8), _mm256_permute2x128_si256(pixels_8, pixels_12, 0x20));
+        _mm256_storeu_si256((__m256i *)(out + i + 16), _mm256_permute2x128_si256(pixels_0, pixels_4, 0x31));
+        _mm256_storeu_si256((__m256i *)(out + i + 24), _mm256_permute2x128_si256(pixels_8, pixels_12, 0x31));
+    }
+
+    lookup_scalar(indices + i, count - i, colors, out + i);
+}
+
+TARGET_AVX2 static void lookup_indices_avx2(const uint8_t *indices, int count, const uint8_t *table, uint8_t *out)
+{
+    // A byte shuffle looks up 16 entries within each 128-bit lane, so both
+    // lanes get a copy of each half of the table and bit 4 picks the half
+    __m256i low = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)table));
+    __m256i high = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)(table + 16)));
+
+    for (int i = 0; i < count; i += 32)
+    {
+        __m256i index = _mm256_loadu_si256((const __m256i *)(indices + i));
+        __m256i bit_4 = _mm256_slli_epi16(index, 3);
+        __m256i bytes = _mm256_blendv_epi8(_mm256_shuffle_epi8(low, index), _mm256_shuffle_epi8(high, index), bit_4);
+        _mm256_storeu_si256((__m256i *)(out + i), bytes);
+    }
+}
+
+static bool has_avx2()
+{
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7)
+    {
+        return false;
+    }
+
+    // AVX needs the OS to save the upper halves of the YMM registers
+    __cpuid(info, 1);
+    bool avx = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 && (_xgetbv(0) & 0x06) == 0x06;
+
+    __cpuidex(info, 7, 0);
+    return avx && (info[1] & (1 << 5)) != 0;
+#else
+    return __builtin_cpu_supports("avx2") != 0;
+#endif
+}
+
+#endif
+
+TileDecoder::LookupKernel TileDecoder::lookup_kernel = lookup_scalar;
+TileDecoder::IndexKernel TileDecoder::index_kernel = lookup_indices_scalar;
+TileKernel TileDecoder::kernel_type = TILE_KERNEL_SCALAR;
+
+// Picks the widest kernel before anything can look colours up
+struct KernelSelector
+{
+    KernelSelector()
+    {
+        TileDecoder::set_kernel(TILE_KERNEL_AVX2);
+    }
+};
+
+static const KernelSelector kernel_selector;
+
+bool TileDecoder::set_kernel(TileKernel kernel)
+{
+    switch (kernel)
+    {
+    case TILE_KERNEL_SCALAR:
+        lookup_kernel = lookup_scalar;
+        index_kernel = lookup_indices_scalar;
+        break;
+#ifdef TILE_DECODER_X86
+    case TILE_KERNEL_AVX2:
+        if (!has_avx2())
+        {
+            return false;
+        }
+        lookup_kernel = lookup_avx2;
+        index_kernel = lookup_indices_avx2;
+        break;
+#endif
+    default:
+        return false;
+    }
+
+    kernel_type = kernel;
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,213 @@
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include "../include/tracer.hpp"
+#include "../include/debug/debug.hpp"
+
+typedef Disassembler::AddressingMode AddressingMode;
+
+// Mnemonics of the documented opcodes, anything else is marked with a '*'
+// like nestest.log does
+static const char *OFFICIAL_MNEMONICS[] = {
+    "ADC", "AND", "ASL", "BCC", "BCS", "BEQ", "BIT", "BMI", "BNE", "BPL", "BRK", "BVC", "BVS", "CLC",
+    "CLD", "CLI", "CLV", "CMP", "CPX", "CPY", "DEC", "DEX", "DEY", "EOR", "INC", "INX", "INY", "JMP",
+    "JSR", "LDA", "LDX", "LDY", "LSR", "NOP", "ORA", "PHA", "PHP", "PLA", "PLP", "ROL", "ROR", "RTI",
+    "RTS", "SBC", "SEC", "SED", "SEI", "STA", "STX", "STY", "TAX", "TAY", "TSX", "TXA", "TXS", "TYA"
+};
+
+static bool is_official(const TraceRecord &record, const char *mnemonic)
+{
+    // The only documented NOP and SBC are $EA and $E9
+    if (strcmp(mnemonic, "NOP") == 0)
+    {
+        return record.opcode == 0xEA;
+    }
+    if (record.opcode == 0xEB)
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < sizeof(OFFICIAL_MNEMONICS) / sizeof(OFFICIAL_MNEMONICS[0]); i++)
+    {
+        if (strcmp(mnemonic, OFFICIAL_MNEMONICS[i]) == 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+Tracer::Tracer() : ring(nullptr), head(0), tail(0), running(false), enabled(false)
+{
+}
+
+Tracer::~Tracer()
+{
+    stop();
+}
+
+bool Tracer::start(const std::string &path)
+{
+    stop();
+
+    file.open(path, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        Debug::debug_print("Failed to open trace file %s", path.c_str());
+        return false;
+    }
+
+    TraceFileHeader header;
+    memcpy(header.magic, TRACE_MAGIC, sizeof(header.magic));
+    header.version = TRACE_VERSION;
+    header.record_size = sizeof(TraceRecord);
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    // Only traced machines pay for the ring
+    ring = new TraceRecord[CAPACITY];
+    head.store(0, std::memory_order_relaxed);
+    tail.store(0, std::memory_order_relaxed);
+    running.store(true, std::memory_order_release);
+    writer = std::thread(&Tracer::write_loop, this);
+    enabled = true;
+    return true;
+}
+
+void Tracer::stop()
+{
+    if (!enabled)
+    {
+        return;
+    }
+
+    // The writer drains whatever is left before it exits
+    enabled = false;
+    running.store(false, std::memory_order_release);
+    writer.join();
+    file.close();
+
+    delete[] ring;
+    ring = nullptr;
+}
+
+void Tracer::write_loop()
+{
+    for (;;)
+    {
+        // Check running before head, so records pushed before stop() are
+        // always seen
+        bool stopping = !running.load(std::memory_order_acquire);
+        uint32_t first = tail.load(std::memory_order_relaxed);
+        uint32_t last = head.load(std::memory_order_acquire);
+
+        if (first == last)
+        {
+            if (stopping)
+            {
+                break;
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            continue;
+        }
+
+        // Up to the end of the ring, the rest goes next time round
+        uint32_t slot = first & (CAPACITY - 1);
+        uint32_t count = last - first;
+        if (count > CAPACITY - slot)
+        {
+            count = CAPACITY - slot;
+        }
+
+        file.write(reinterpret_cast<const char *>(&ring[slot]), count * sizeof(TraceRecord));
+        tail.store(first + count, std::memory_order_release);
+    }
+
+    file.flush();
+}
+
+void Tracer::format(const TraceRecord &record, const Disassembler::OpcodeInfo &info, char *buffer, size_t size)
+{
+    char bytes[16];
+    switch (info.bytes)
+    {
+    case 3:
+        sprintf_s(bytes, sizeof(bytes), "%02X %02X %02X", record.opcode, record.operand1, record.operand2);
+        break;
+    case 2:
+        sprintf_s(bytes, sizeof(bytes), "%02X %02X", record.opcode, record.operand1);
+        break;
+    default:
+        sprintf_s(bytes, sizeof(bytes), "%02X", record.opcode);
+        break;
+    }
+
+    // Memory operands end with the value there, when the tracer could read it
+    char value[8] = "";
+    if ((record.flags & TRACE_HAS_VALUE) != 0)
+    {
+        sprintf_s(value, sizeof(value), " = %02X", record.value);
+    }
+
+    char operand[48];
+    uint16_t operand16 = record.operand1 | (record.operand2 << 8);
+    switch (info.addressingMode)
+    {
+    case AddressingMode::ACCUMULATOR:
+        sprintf_s(operand, sizeof(operand), "A");
+        break;
+    case AddressingMode::IMMEDIATE:
+        sprintf_s(operand, sizeof(operand), "#$%02X", record.operand1);
+        break;
+    case AddressingMode::ZERO_PAGE:
+        sprintf_s(operand, sizeof(operand), "$%02X%s", record.operand1, value);
+        break;
+    case AddressingMode::ZERO_PAGE_X:
+    case AddressingMode::ZERO_PAGE_Y:
+        sprintf_s(operand, sizeof(operand), "$%02X,%c @ %02X%s", record.operand1,
+            info.addressingMode == AddressingMode::ZERO_PAGE_X ? 'X' : 'Y', record.address, value);
+        break;
+    case AddressingMode::ABSOLUTE:
+        // Jumps show only the target
+        if (record.opcode == 0x4C || record.opcode == 0x20)
+        {
+            sprintf_s(operand, sizeof(operand), "$%04X", operand16);
+        }
+        else
+        {
+            sprintf_s(operand, sizeof(operand), "$%04X%s", operand16, value);
+        }
+        break;
+    case AddressingMode::ABSOLUTE_X:
+    case AddressingMode::ABSOLUTE_Y:
+        sprintf_s(operand, sizeof(operand), "$%04X,%c @ %04X%s", operand16,
+            info.addressingMode == AddressingMode::ABSOLUTE_X ? 'X' : 'Y', record.address, value);
+        break;
+    case AddressingMode::INDIRECT:
+        sprintf_s(operand, sizeof(operand), "($%04X) = %04X", operand16, record.address);
+        break;
+    case AddressingMode::INDIRECT_X:
+        sprintf_s(operand, sizeof(operand), "($%02X,X) @ %02X = %04X%s", record.operand1,
+            (uint8_t)(record.operand1 + record.x), record.address, value);
+        break;
+    case AddressingMode::INDIRECT_Y:
+        sprintf_s(operand, sizeof(operand), "($%02X),Y = %04X @ %04X%s", record.operand1,
+            (uint16_t)(record.address - record.y), record.address, value);
+        break;
+    case AddressingMode::RELATIVE:
+        sprintf_s(operand, sizeof(operand), "$%04X", record.address);
+        break;
+    case AddressingMode::IMPLIED:
+    default:
+        operand[0] = '\0';
+        break;
+    }
+
+    char text[64];
+    sprintf_s(text, sizeof(text), "%s %s", info.mnemonic, operand);
+
+    sprintf_s(buffer, size, "%04X  %-8s %c%-32sA:%02X X:%02X Y:%02X P:%02X SP:%02X PPU:%3d,%3d CYC:%llu",
+        record.pc, bytes, is_official(record, info.mnemonic) ? ' ' : '*', text, record.a, record.x, record.y,
+        record.p, record.sp, record.scanline, record.dot, (unsigned long long)record.cpu_cycles);
+}
\ No newline at end of file
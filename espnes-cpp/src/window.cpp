@@ -26,6 +26,8 @@ Window::Window()
     // Initialize SDL Renderer for ImGui
     ImGui_ImplSDL2_InitForSDLRenderer(this->window, this->renderer);
     ImGui_ImplSDLRenderer2_Init(this->renderer);
+
+    rewind_seconds = 0.0f;
 }
 
 Window::~Window()
@@ -298,7 +300,7 @@ void Window::render_memory_view(Emulator* emulator)
     ImGui::Begin("VRAM View");
 
     const int bytes_per_row = 16;
-    int total_rows = 0x2000 / bytes_per_row;
+    int total_rows = 0x1000 / bytes_per_row;
 
     ImGui::BeginChild("VRAM", ImVec2(0, 0), true, ImGuiWindowFlags_HorizontalScrollbar);
 
@@ -336,6 +338,7 @@ void Window::render(Emulator* emulator)
     this->render_memory_view(emulator);
     this->render_breakpoints(emulator);
     this->render_cpu_memory_view(emulator);
+    this->render_rewind(emulator);
 }
 
 void Window::render_PPU(Emulator* emulator)
@@ -355,7 +358,46 @@ void Window::render_CPU(Emulator* emulator)
     CPU* cpu = emulator->get_CPU();
     ImGui::Begin("CPU");
 
-    ImGui::Text("Cycle: %d", cpu->get_cycles());
+    ImGui::Text("Cycle: %lld", (long long)cpu->get_total_cycles());
+
+    ImGui::End();
+}
+
+void Window::render_rewind(Emulator *emulator)
+{
+    RewindBuffer *buffer = emulator->get_rewind_buffer();
+    ImGui::Begin("Rewind");
+
+    // 32MB holds well over an hour of deltas at every other frame
+    bool enabled = buffer->is_allocated();
+    if (ImGui::Checkbox("Enable", &enabled))
+    {
+        if (enabled)
+        {
+            emulator->enable_rewind(32 * 1024 * 1024, 2);
+        }
+        else
+        {
+            emulator->disable_rewind();
+        }
+        rewind_seconds = 0.0f;
+    }
+
+    if (enabled)
+    {
+        float frames_per_capture = (float)emulator->get_rewind_interval();
+        float available = buffer->get_count() * frames_per_capture / 60.0f;
+        ImGui::Text("History: %.1f s (%d states)", available, buffer->get_count());
+        ImGui::Text("Memory: %.1f / %.1f KB", buffer->get_used() / 1024.0f, buffer->get_capacity() / 1024.0f);
+
+        // Jump back once the slider is let go, not on every step of the drag
+        ImGui::SliderFloat("Seconds back", &rewind_seconds, 0.0f, available, "%.1f");
+        if (ImGui::IsItemDeactivatedAfterEdit())
+        {
+            emulator->rewind((int)(rewind_seconds * 60.0f / frames_per_capture + 0.5f));
+            rewind_seconds = 0.0f;
+        }
+    }
 
     ImGui::End();
 }
@@ -369,7 +411,14 @@ void Window::render_breakpoints(Emulator* emulator)
     auto breakpoints = emulator->get_breakpoints();
     for (auto it = breakpoints.begin(); it != breakpoints.end(); ++it)
     {
-		ImGui::Text("%04X", *it);
+        if (it->condition.empty())
+        {
+            ImGui::Text("%04X", it->address);
+        }
+        else
+        {
+            ImGui::Text("%04X if %s", it->address, it->condition.c_str());
+        }
 	}
 
     ImGui::EndChild();
@@ -396,6 +445,15 @@ void Window::render_breakpoints(Emulator* emulator)
     {
 		static char input[5] = "0000";
 		ImGui::InputText("Address", input, 5);
+
+        // Optional condition, e.g. "A == $10 && scanline > 200"
+        static char condition[128] = "";
+        static std::string condition_error;
+        ImGui::InputText("Condition", condition, sizeof(condition));
+        if (!condition_error.empty())
+        {
+            ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "%s", condition_error.c_str());
+        }
         
         // Radio button for scanline breakpoint
         static bool scanline = false;
@@ -446,6 +504,19 @@ void Window::render_breakpoints(Emulator* emulator)
         // Radio button for read breakpoint
         ImGui::RadioButton("Read", read);
 
+        if (ImGui::IsItemClicked())
+        {
+            read = true;
+
+            // Clear the other radio buttons
+            scanline = false;
+            cycle = false;
+            frame = false;
+            instruction = false;
+            write = false;
+            execute = false;
+        }
+
         // Radio button for write breakpoint
         ImGui::RadioButton("Write", write);
 
@@ -473,7 +544,11 @@ void Window::render_breakpoints(Emulator* emulator)
 
             breakpoint_type_t type;
 
-            if (cycle)
+            if (scanline)
+            {
+                type = BREAKPOINT_TYPE_SCANLINE;
+            }
+            else if (cycle)
             {
 				type = BREAKPOINT_TYPE_CYCLE;
 			}
@@ -481,6 +556,10 @@ void Window::render_breakpoints(Emulator* emulator)
             {
                 type = BREAKPOINT_TYPE_EXECUTION;
             }
+            else if (read)
+            {
+                type = BREAKPOINT_TYPE_READ;
+            }
             else if (write)
             {
 				type = BREAKPOINT_TYPE_WRITE;
@@ -490,9 +569,12 @@ void Window::render_breakpoints(Emulator* emulator)
                 type = BREAKPOINT_TYPE_ADDRESS;
 			}
 
-			emulator->add_breakpoint(type, value);
-
-			ImGui::CloseCurrentPopup();
+            // Keep the popup open while the condition doesn't compile
+            if (emulator->add_breakpoint(type, value, condition, condition_error))
+            {
+                condition_error.clear();
+                ImGui::CloseCurrentPopup();
+            }
 		}
 
 		ImGui::EndPopup();
@@ -522,6 +604,20 @@ void Window::render_menu_bar(Emulator& emulator)
                 ImGui::Checkbox("Show Disassembly", &this->show_disassembly);
             }
 
+            // Binary trace, espnes_trace dump turns it into text
+            bool tracing = emulator.is_tracing();
+            if (ImGui::MenuItem("Trace to trace.bin", nullptr, tracing))
+            {
+                if (tracing)
+                {
+                    emulator.stop_trace();
+                }
+                else
+                {
+                    emulator.start_trace("trace.bin");
+                }
+            }
+
             ImGui::EndMenu();
         }
         ImGui::EndMainMenuBar();
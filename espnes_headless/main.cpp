@@ -0,0 +1,80 @@
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include "../espnes-cpp/include/emulator.hpp"
+
+// Runs a ROM with no window for a number of frames, as fast as the host
+// allows, then prints timing and a checksum of RAM and the frame buffer. With
+// an output path it also saves the last frame as a PPM image.
+//
+//     espnes_headless <rom.nes> <frames> [frame.ppm]
+static uint32_t checksum(const uint8_t *data, size_t size)
+{
+    // FNV-1a, only used to tell runs apart
+    uint32_t hash = 0x811C9DC5;
+    for (size_t i = 0; i < size; i++)
+    {
+        hash = (hash ^ data[i]) * 0x01000193;
+    }
+
+    return hash;
+}
+
+static bool write_ppm(const std::string &path, const uint8_t *frame_buffer)
+{
+    std::ofstream file(path, std::ios::binary);
+    if (!file)
+    {
+        return false;
+    }
+
+    // The frame buffer is BGRA
+    file << "P6\n256 240\n255\n";
+    for (int i = 0; i < 256 * 240; i++)
+    {
+        const uint8_t *pixel = frame_buffer + i * 4;
+        file.put(static_cast<char>(pixel[2]));
+        file.put(static_cast<char>(pixel[1]));
+        file.put(static_cast<char>(pixel[0]));
+    }
+
+    return static_cast<bool>(file);
+}
+
+int main(int argc, char** argv)
+{
+    if (argc != 3 && argc != 4)
+    {
+        std::cerr << "usage: espnes_headless <rom.nes> <frames> [frame.ppm]" << std::endl;
+        return 1;
+    }
+
+    long frames = std::atol(argv[2]);
+    if (frames <= 0)
+    {
+        std::cerr << "Frame count must be positive" << std::endl;
+        return 1;
+    }
+
+    Emulator emulator(true);
+    emulator.load_rom(argv[1]);
+    emulator.set_PC_to_reset_vector();
+
+    RunStats stats = emulator.run_frames((int)frames);
+    std::cout << stats.frames << " frames, " << stats.cycles << " cycles, " << stats.instructions << " instructions in "
+        << stats.wall_time_ms << " ms (" << (stats.frames * 1000.0 / stats.wall_time_ms) << " fps)" << std::endl;
+
+    uint8_t *frame_buffer = emulator.get_frame_buffer();
+    std::cout << "ram " << std::hex << checksum(emulator.get_ram(), 0x800) << std::endl;
+    std::cout << "frame " << std::hex << checksum(frame_buffer, 256 * 240 * 4) << std::endl;
+
+    if (argc == 4 && !write_ppm(argv[3], frame_buffer))
+    {
+        std::cerr << "Failed to write " << argv[3] << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,75 @@
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../espnes-cpp/include/cpu.hpp"
+#include "../espnes-cpp/include/memory.hpp"
+#include "../espnes-cpp/include/recompiler.hpp"
+#include "../espnes-cpp/include/recompiled_code.hpp"
+
+// Recompiles the PRG-ROM of a mapper 0 ROM to <rom>.cpp. With --build it also
+// compiles that into the shared object the emulator loads from next to the ROM.
+//
+//     espnes_recompiler <rom.nes> [--build <espnes-cpp include dir>]
+int main(int argc, char** argv)
+{
+    if (argc != 2 && !(argc == 4 && std::string(argv[2]) == "--build"))
+    {
+        std::cerr << "usage: espnes_recompiler <rom.nes> [--build <include dir>]" << std::endl;
+        return 1;
+    }
+
+    std::string rom_path = argv[1];
+    std::string error;
+    std::shared_ptr<RomImage> image = RomImage::open(rom_path, error);
+    if (image == nullptr)
+    {
+        std::cerr << error << std::endl;
+        return 1;
+    }
+
+    // Only NROM can be compiled as a whole
+    if (image->get_mapper_number() != 0)
+    {
+        std::cerr << "Unsupported mapper" << std::endl;
+        return 1;
+    }
+
+    // Just enough of the machine to disassemble from
+    MachineState machine = MachineState();
+    PPU ppu(&machine);
+    APU apu;
+    Cartridge cartridge(&machine);
+    Controller controller;
+    Memory memory(&machine, &ppu, &apu, &cartridge, &controller);
+    CPU cpu(&machine, &memory);
+    Disassembler disassembler(&cpu, &memory);
+
+    cartridge.load(image);
+    memory.map_pages();
+
+    Recompiler recompiler(&memory, &disassembler);
+    recompiler.trace_vectors();
+
+    std::string source_path = rom_path + ".cpp";
+    if (!recompiler.write_source(source_path, cartridge.get_prg_crc()))
+    {
+        std::cerr << "Failed to write " << source_path << std::endl;
+        return 1;
+    }
+    std::cout << "Wrote " << recompiler.get_block_count() << " blocks to " << source_path << std::endl;
+
+    if (argc == 4)
+    {
+        std::string module_path = RecompiledCode::module_path(rom_path);
+#ifdef _WIN32
+        std::string command = "cl /nologo /O2 /LD /I\"" + std::string(argv[3]) + "\" \"" + source_path + "\" /Fe\"" + module_path + "\"";
+#else
+        std::string command = "c++ -O2 -shared -fPIC -I\"" + std::string(argv[3]) + "\" \"" + source_path + "\" -o \"" + module_path + "\"";
+#endif
+        std::cout << command << std::endl;
+        return std::system(command.c_str()) == 0 ? 0 : 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,267 @@
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define TRACE_COMPARE_SSE2
+#endif
+#include "../espnes-cpp/include/tracer.hpp"
+#include "../espnes-cpp/include/debug/disassembler.hpp"
+#include "trace_reader.hpp"
+
+// Offline tools for binary traces written by the emulator.
+//
+//     espnes_trace dump <trace.bin> [out.txt]
+//         Print the trace as text in nestest.log format, to out.txt if given.
+//
+//     espnes_trace compare <a> <b> [--cycles] [--ppu] [--context <n>]
+//         Report the first instruction where two traces differ in PC, opcode
+//         or registers, and optionally in CPU cycles or PPU position. Either
+//         trace can be binary or nestest.log-style text.
+
+struct CompareOptions
+{
+    bool cycles;
+    bool ppu;
+    size_t context;
+};
+
+static const size_t COMPARE_CHUNK = 1 << 16;
+
+static int dump(const std::string &path, std::ostream &out)
+{
+    TraceReader reader;
+    if (!reader.open(path))
+    {
+        std::cerr << reader.get_error() << std::endl;
+        return 1;
+    }
+
+    // Records are read in batches, lines written one by one
+    std::vector<TraceRecord> records(4096);
+    char line[160];
+    size_t count;
+    while ((count = reader.read(records.data(), records.size())) != 0)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            Tracer::format(records[i], Disassembler::get_opcode_info(records[i].opcode), line, sizeof(line));
+            out << line << '\n';
+        }
+    }
+
+    out.flush();
+    return 0;
+}
+
+// One bit per TraceRecord byte that takes part in the comparison
+static uint32_t compare_mask(const CompareOptions &options)
+{
+    uint8_t bytes[sizeof(TraceRecord)] = {};
+    memset(bytes + offsetof(TraceRecord, pc), 0xFF, sizeof(uint16_t));
+    bytes[offsetof(TraceRecord, opcode)] = 0xFF;
+    bytes[offsetof(TraceRecord, a)] = 0xFF;
+    bytes[offsetof(TraceRecord, x)] = 0xFF;
+    bytes[offsetof(TraceRecord, y)] = 0xFF;
+    bytes[offsetof(TraceRecord, p)] = 0xFF;
+    bytes[offsetof(TraceRecord, sp)] = 0xFF;
+
+    if (options.cycles)
+    {
+        memset(bytes + offsetof(TraceRecord, cpu_cycles), 0xFF, sizeof(uint64_t));
+    }
+    if (options.ppu)
+    {
+        memset(bytes + offsetof(TraceRecord, scanline), 0xFF, sizeof(uint16_t));
+        memset(bytes + offsetof(TraceRecord, dot), 0xFF, sizeof(uint16_t));
+    }
+
+    uint32_t mask = 0;
+    for (size_t i = 0; i < sizeof(TraceRecord); i++)
+    {
+        if (bytes[i] != 0)
+        {
+            mask |= 1u << i;
+        }
+    }
+
+    return mask;
+}
+
+// Index of the first record pair that differs in a masked byte, or count
+static size_t find_difference(const TraceRecord *a, const TraceRecord *b, size_t count, uint32_t mask)
+{
+#ifdef TRACE_COMPARE_SSE2
+    // A record is two 16-byte lanes, one compare and movemask each
+    for (size_t i = 0; i < count; i++)
+    {
+        const __m128i *lanes_a = reinterpret_cast<const __m128i *>(&a[i]);
+        const __m128i *lanes_b = reinterpret_cast<const __m128i *>(&b[i]);
+        __m128i low = _mm_cmpeq_epi8(_mm_loadu_si128(lanes_a), _mm_loadu_si128(lanes_b));
+        __m128i high = _mm_cmpeq_epi8(_mm_loadu_si128(lanes_a + 1), _mm_loadu_si128(lanes_b + 1));
+        uint32_t equal = static_cast<uint32_t>(_mm_movemask_epi8(low)) | (static_cast<uint32_t>(_mm_movemask_epi8(high)) << 16);
+        if ((~equal & mask) != 0)
+        {
+            return i;
+        }
+    }
+#else
+    for (size_t i = 0; i < count; i++)
+    {
+        const uint8_t *bytes_a = reinterpret_cast<const uint8_t *>(&a[i]);
+        const uint8_t *bytes_b = reinterpret_cast<const uint8_t *>(&b[i]);
+        for (size_t j = 0; j < sizeof(TraceRecord); j++)
+        {
+            if ((mask & (1u << j)) != 0 && bytes_a[j] != bytes_b[j])
+            {
+                return i;
+            }
+        }
+    }
+#endif
+
+    return count;
+}
+
+static void print_record(const char *prefix, const TraceRecord &record)
+{
+    char line[128];
+    sprintf_s(line, sizeof(line), "%s%04X  %02X %02X %02X  A:%02X X:%02X Y:%02X P:%02X SP:%02X PPU:%3d,%3d CYC:%llu", prefix,
+        record.pc, record.opcode, record.operand1, record.operand2, record.a, record.x, record.y, record.p, record.sp,
+        record.scanline, record.dot, (unsigned long long)record.cpu_cycles);
+    std::cout << line << std::endl;
+}
+
+static void report_difference(const TraceRecord *a, const TraceRecord *b, size_t position, size_t context, uint64_t instruction, const CompareOptions &options)
+{
+    const TraceRecord &first = a[position];
+    const TraceRecord &second = b[position];
+
+    std::cout << "Traces differ at instruction " << instruction + 1 << ":";
+    if (first.pc != second.pc) std::cout << " PC";
+    if (first.opcode != second.opcode) std::cout << " opcode";
+    if (first.a != second.a) std::cout << " A";
+    if (first.x != second.x) std::cout << " X";
+    if (first.y != second.y) std::cout << " Y";
+    if (first.p != second.p) std::cout << " P";
+    if (first.sp != second.sp) std::cout << " SP";
+    if (options.cycles && first.cpu_cycles != second.cpu_cycles) std::cout << " CYC";
+    if (options.ppu && (first.scanline != second.scanline || first.dot != second.dot)) std::cout << " PPU";
+    std::cout << std::endl;
+
+    // Both traces agree up to here, so one copy of the lead-in is enough
+    for (size_t i = position - context; i < position; i++)
+    {
+        print_record("  ", a[i]);
+    }
+    print_record("< ", first);
+    print_record("> ", second);
+}
+
+static int compare(const std::string &path_a, const std::string &path_b, const CompareOptions &options)
+{
+    TraceReader a;
+    TraceReader b;
+    if (!a.open(path_a) || !b.open(path_b))
+    {
+        std::cerr << (a.get_error().empty() ? b.get_error() : a.get_error()) << std::endl;
+        return 2;
+    }
+
+    // Each buffer starts with the tail of the previous chunk, for context
+    std::vector<TraceRecord> records_a(options.context + COMPARE_CHUNK);
+    std::vector<TraceRecord> records_b(options.context + COMPARE_CHUNK);
+    uint32_t mask = compare_mask(options);
+    uint64_t compared = 0;
+    size_t kept = 0;
+
+    for (;;)
+    {
+        size_t count_a = a.read(&records_a[kept], COMPARE_CHUNK);
+        size_t count_b = b.read(&records_b[kept], COMPARE_CHUNK);
+        size_t count = count_a < count_b ? count_a : count_b;
+
+        size_t index = find_difference(&records_a[kept], &records_b[kept], count, mask);
+        if (index < count)
+        {
+            report_difference(records_a.data(), records_b.data(), kept + index, kept + index < options.context ? kept + index : options.context,
+                compared + index, options);
+            return 1;
+        }
+        compared += count;
+
+        if (count_a != count_b)
+        {
+            std::cout << "Traces match for " << compared << " instructions, then " << (count_a < count_b ? path_a : path_b) << " ends" << std::endl;
+            return 1;
+        }
+        if (count == 0)
+        {
+            break;
+        }
+
+        size_t total = kept + count;
+        kept = total < options.context ? total : options.context;
+        memmove(records_a.data(), &records_a[total - kept], kept * sizeof(TraceRecord));
+        memmove(records_b.data(), &records_b[total - kept], kept * sizeof(TraceRecord));
+    }
+
+    std::cout << "Traces match for all " << compared << " instructions" << std::endl;
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc >= 4 && std::string(argv[1]) == "compare")
+    {
+        CompareOptions options = { false, false, 5 };
+        for (int i = 4; i < argc; i++)
+        {
+            std::string option = argv[i];
+            if (option == "--cycles")
+            {
+                options.cycles = true;
+            }
+            else if (option == "--ppu")
+            {
+                options.ppu = true;
+            }
+            else if (option == "--context" && i + 1 < argc)
+            {
+                options.context = static_cast<size_t>(std::atoi(argv[++i]));
+            }
+            else
+            {
+                std::cerr << "Unknown option " << option << std::endl;
+                return 2;
+            }
+        }
+
+        return compare(argv[2], argv[3], options);
+    }
+
+    if (argc >= 3 && argc <= 4 && std::string(argv[1]) == "dump")
+    {
+        if (argc == 3)
+        {
+            return dump(argv[2], std::cout);
+        }
+
+        std::ofstream out(argv[3]);
+        if (!out)
+        {
+            std::cerr << "Failed to open " << argv[3] << std::endl;
+            return 1;
+        }
+        return dump(argv[2], out);
+    }
+
+    std::cerr << "usage: espnes_trace dump <trace.bin> [out.txt]" << std::endl;
+    std::cerr << "       espnes_trace compare <a> <b> [--cycles] [--ppu] [--context <n>]" << std::endl;
+    return 1;
+}
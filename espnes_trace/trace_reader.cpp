@@ -0,0 +1,219 @@
+#include <cstring>
+#include "trace_reader.hpp"
+
+static int hex_digit(char c)
+{
+    if (c >= '0' && c <= '9')
+    {
+        return c - '0';
+    }
+    if (c >= 'A' && c <= 'F')
+    {
+        return c - 'A' + 10;
+    }
+    if (c >= 'a' && c <= 'f')
+    {
+        return c - 'a' + 10;
+    }
+    return -1;
+}
+
+static bool parse_hex(const char *p, const char *end, int digits, uint32_t &value)
+{
+    if (end - p < digits)
+    {
+        return false;
+    }
+
+    value = 0;
+    for (int i = 0; i < digits; i++)
+    {
+        int digit = hex_digit(p[i]);
+        if (digit < 0)
+        {
+            return false;
+        }
+        value = (value << 4) | digit;
+    }
+
+    return true;
+}
+
+static bool parse_decimal(const char *p, const char *end, uint64_t &value)
+{
+    while (p < end && *p == ' ')
+    {
+        p++;
+    }
+
+    if (p == end || *p < '0' || *p > '9')
+    {
+        return false;
+    }
+
+    value = 0;
+    while (p < end && *p >= '0' && *p <= '9')
+    {
+        value = value * 10 + (*p - '0');
+        p++;
+    }
+
+    return true;
+}
+
+// Position just past token, or nullptr
+static const char *find_field(const char *from, const char *end, const char *token)
+{
+    size_t length = strlen(token);
+    for (const char *p = from; p + length <= end; p++)
+    {
+        if (memcmp(p, token, length) == 0)
+        {
+            return p + length;
+        }
+    }
+
+    return nullptr;
+}
+
+TraceReader::TraceReader() : position(nullptr), end(nullptr), text(false)
+{
+}
+
+bool TraceReader::open(const std::string &path)
+{
+    if (!file.open(path))
+    {
+        error = "Failed to open " + path;
+        return false;
+    }
+
+    position = reinterpret_cast<const char *>(file.get_data());
+    end = position + file.get_size();
+
+    // Binary traces start with a header, anything else is taken as text
+    const TraceFileHeader *header = reinterpret_cast<const TraceFileHeader *>(position);
+    text = file.get_size() < sizeof(TraceFileHeader) || memcmp(header->magic, TRACE_MAGIC, sizeof(header->magic)) != 0;
+    if (!text)
+    {
+        if (header->version != TRACE_VERSION || header->record_size != sizeof(TraceRecord))
+        {
+            error = path + " was written by a different version";
+            return false;
+        }
+
+        position += sizeof(TraceFileHeader);
+    }
+
+    return true;
+}
+
+bool TraceReader::is_text()
+{
+    return text;
+}
+
+const std::string &TraceReader::get_error()
+{
+    return error;
+}
+
+size_t TraceReader::read(TraceRecord *records, size_t max_records)
+{
+    if (!text)
+    {
+        size_t count = static_cast<size_t>(end - position) / sizeof(TraceRecord);
+        if (count > max_records)
+        {
+            count = max_records;
+        }
+
+        memcpy(records, position, count * sizeof(TraceRecord));
+        position += count * sizeof(TraceRecord);
+        return count;
+    }
+
+    size_t count = 0;
+    while (count < max_records && position < end)
+    {
+        const char *line_end = static_cast<const char *>(memchr(position, '\n', end - position));
+        if (line_end == nullptr)
+        {
+            line_end = end;
+        }
+
+        // Lines that don't parse (blank, headers) are skipped
+        if (parse_line(position, line_end, records[count]))
+        {
+            count++;
+        }
+
+        position = line_end < end ? line_end + 1 : end;
+    }
+
+    return count;
+}
+
+bool TraceReader::parse_line(const char *line, const char *line_end, TraceRecord &record)
+{
+    memset(&record, 0, sizeof(record));
+
+    // C000  4C F5 C5  JMP $C5F5                       A:00 X:00 Y:00 P:24 SP:FD PPU:  0, 21 CYC:7
+    uint32_t value;
+    if (!parse_hex(line, line_end, 4, value))
+    {
+        return false;
+    }
+    record.pc = static_cast<uint16_t>(value);
+
+    // Up to three instruction bytes from column 6
+    uint8_t *bytes[3] = { &record.opcode, &record.operand1, &record.operand2 };
+    for (int i = 0; i < 3; i++)
+    {
+        if (!parse_hex(line + 6 + i * 3, line_end, 2, value))
+        {
+            if (i == 0)
+            {
+                return false;
+            }
+            break;
+        }
+        *bytes[i] = static_cast<uint8_t>(value);
+    }
+
+    // Registers, searched for past the disassembly so column shifts don't matter
+    const char *registers = line + 15 < line_end ? line + 15 : line_end;
+    const char *fields[5] = { "A:", "X:", "Y:", "P:", "SP:" };
+    uint8_t *targets[5] = { &record.a, &record.x, &record.y, &record.p, &record.sp };
+    for (int i = 0; i < 5; i++)
+    {
+        registers = find_field(registers, line_end, fields[i]);
+        if (registers == nullptr || !parse_hex(registers, line_end, 2, value))
+        {
+            return false;
+        }
+        *targets[i] = static_cast<uint8_t>(value);
+    }
+
+    // PPU position and cycles are optional, and come in either order
+    uint64_t number;
+    const char *ppu = find_field(registers, line_end, "PPU:");
+    if (ppu != nullptr && parse_decimal(ppu, line_end, number))
+    {
+        record.scanline = static_cast<uint16_t>(number);
+
+        const char *comma = static_cast<const char *>(memchr(ppu, ',', line_end - ppu));
+        if (comma != nullptr && parse_decimal(comma + 1, line_end, number))
+        {
+            record.dot = static_cast<uint16_t>(number);
+        }
+    }
+
+    const char *cycles = find_field(registers, line_end, "CYC:");
+    if (cycles != nullptr && parse_decimal(cycles, line_end, number))
+    {
+        record.cpu_cycles = number;
+    }
+
+    return true;
+}
\ No newline at end of file
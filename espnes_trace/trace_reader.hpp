@@ -0,0 +1,32 @@
+#ifndef TRACE_READER_HPP
+#define TRACE_READER_HPP
+
+#include <cstddef>
+#include <string>
+#include "../espnes-cpp/include/mapped_file.hpp"
+#include "../espnes-cpp/include/trace_record.hpp"
+
+// Streams TraceRecords out of a memory-mapped trace, either the emulator's
+// binary format or nestest.log-style text. Text lines only fill in what the
+// text has: PC, opcode and operands, registers, PPU position and cycles.
+class TraceReader
+{
+public:
+    TraceReader();
+
+    bool open(const std::string &path);
+    size_t read(TraceRecord *records, size_t max_records);
+    bool is_text();
+    const std::string &get_error();
+
+private:
+    bool parse_line(const char *line, const char *end, TraceRecord &record);
+
+    MappedFile file;
+    const char *position;
+    const char *end;
+    bool text;
+    std::string error;
+};
+
+#endif
\ No newline at end of file
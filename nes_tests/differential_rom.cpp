@@ -0,0 +1,9849 @@
+// Generated by espnes_recompiler from PRG-ROM 2BDF6EDD, do not edit
+
+#define ESPNES_RECOMPILED_MODULE
+#include "recompiled_abi.hpp"
+
+static int block_8000(espnes_context *ctx)
+{
+    BEGIN;
+    // 8000  LDA
+    start = cycles; cycles += 2; executed++; a = 0x0E; NZ(a);
+    // 8002  LDX
+    start = cycles; cycles += 2; executed++; x = 0x98; NZ(x);
+    // 8004  LDY
+    start = cycles; cycles += 2; executed++; y = 0x2A; NZ(y);
+    // 8006  LSR
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x00F0 + x); t = RD(ea); LSR(t); WR(ea, t);
+    // 8009  CPY
+    start = cycles; cycles += 4; executed++; CMP(y, RD(0xA037));
+    IO_EXIT(0x800C);
+    // 800C  ASL
+    start = cycles; cycles += 6; executed++; t = RD(0x014D); ASL(t); WR(0x014D, t);
+    // 800F  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x49 + x); a ^= RD(ea); NZ(a);
+    // 8011  BCC
+    start = cycles; cycles += 2; executed++; if (!(p & F_C)) { cycles += 1; EXIT(0x8016); }
+    EXIT(0x8013);
+}
+
+static int block_8013(espnes_context *ctx)
+{
+    BEGIN;
+    // 8013  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0410); NZ(a);
+    EXIT(0x8016);
+}
+
+static int block_8016(espnes_context *ctx)
+{
+    BEGIN;
+    // 8016  ASL
+    start = cycles; cycles += 2; executed++; ASL(a);
+    // 8017  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xE794 + y); cycles += PAGE_CROSSED(0xE794, ea); ADC(RD(ea));
+    IO_EXIT(0x801A);
+    // 801A  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 1; EXIT(0x801F); }
+    EXIT(0x801C);
+}
+
+static int block_801C(espnes_context *ctx)
+{
+    BEGIN;
+    // 801C  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0259); NZ(a);
+    EXIT(0x801F);
+}
+
+static int block_801F(espnes_context *ctx)
+{
+    BEGIN;
+    // 801F  LDX
+    start = cycles; cycles += 3; executed++; x = RD(0x36); NZ(x);
+    // 8021  BEQ
+    start = cycles; cycles += 2; executed++; if (p & F_Z) { cycles += 1; EXIT(0x8026); }
+    EXIT(0x8023);
+}
+
+static int block_8023(espnes_context *ctx)
+{
+    BEGIN;
+    // 8023  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0126); NZ(a);
+    EXIT(0x8026);
+}
+
+static int block_8026(espnes_context *ctx)
+{
+    BEGIN;
+    // 8026  LDX
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x02C3 + y); cycles += PAGE_CROSSED(0x02C3, ea); x = RD(ea); NZ(x);
+    // 8029  LDA
+    start = cycles; cycles += 2; executed++; a = 0x91; NZ(a);
+    // 802B  STA
+    start = cycles; cycles += 3; executed++; WR(0xB3, a);
+    // 802D  LDA
+    start = cycles; cycles += 2; executed++; a = 0xB4; NZ(a);
+    // 802F  STA
+    start = cycles; cycles += 3; executed++; WR(0xB4, a);
+    // 8031  ORA
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0xB3); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a |= RD(ea); NZ(a);
+    IO_EXIT(0x8033);
+    // 8033  STA
+    start = cycles; cycles += 3; executed++; WR(0x7E, a);
+    // 8035  DEY
+    start = cycles; cycles += 2; executed++; y--; NZ(y);
+    // 8036  PLA
+    start = cycles; cycles += 4; executed++; a = PULL(); NZ(a);
+    // 8037  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xB1 + x); a ^= RD(ea); NZ(a);
+    // 8039  ORA
+    start = cycles; cycles += 3; executed++; a |= RD(0x18); NZ(a);
+    // 803B  TAX
+    start = cycles; cycles += 2; executed++; x = a; NZ(x);
+    // 803C  LSR
+    start = cycles; cycles += 2; executed++; LSR(a);
+    // 803D  SBC
+    start = cycles; cycles += 2; executed++; SBC(0xA1);
+    // 803F  ROR
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x31 + x); t = RD(ea); ROR(t); WR(ea, t);
+    // 8041  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 1; EXIT(0x8046); }
+    EXIT(0x8043);
+}
+
+static int block_8043(espnes_context *ctx)
+{
+    BEGIN;
+    // 8043  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xB9E0); NZ(a);
+    IO_EXIT(0x8046);
+    EXIT(0x8046);
+}
+
+static int block_8046(espnes_context *ctx)
+{
+    BEGIN;
+    // 8046  LDA
+    start = cycles; cycles += 2; executed++; a = 0xC6; NZ(a);
+    // 8048  STA
+    start = cycles; cycles += 3; executed++; WR(0xBD, a);
+    // 804A  LDA
+    start = cycles; cycles += 2; executed++; a = 0xA2; NZ(a);
+    // 804C  STA
+    start = cycles; cycles += 3; executed++; WR(0xBE, a);
+    // 804E  CMP
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0xBD); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); CMP(a, RD(ea));
+    IO_EXIT(0x8050);
+    // 8050  ROR
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x06CB + x); t = RD(ea); ROR(t); WR(ea, t);
+    // 8053  BIT
+    start = cycles; cycles += 3; executed++; BIT(RD(0x1E));
+    // 8055  ORA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0551 + y); cycles += PAGE_CROSSED(0x0551, ea); a |= RD(ea); NZ(a);
+    // 8058  BCC
+    start = cycles; cycles += 2; executed++; if (!(p & F_C)) { cycles += 1; EXIT(0x805D); }
+    EXIT(0x805A);
+}
+
+static int block_805A(espnes_context *ctx)
+{
+    BEGIN;
+    // 805A  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xDA5C); NZ(a);
+    IO_EXIT(0x805D);
+    EXIT(0x805D);
+}
+
+static int block_805D(espnes_context *ctx)
+{
+    BEGIN;
+    // 805D  LDA
+    start = cycles; cycles += 2; executed++; a = 0xF3; NZ(a);
+    // 805F  STA
+    start = cycles; cycles += 3; executed++; WR(0x34, a);
+    // 8061  LDA
+    start = cycles; cycles += 2; executed++; a = 0xF6; NZ(a);
+    // 8063  STA
+    start = cycles; cycles += 3; executed++; WR(0x35, a);
+    // 8065  LDA
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x34); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a = RD(ea); NZ(a);
+    IO_EXIT(0x8067);
+    // 8067  STX
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x0D + y); WR(ea, x);
+    // 8069  LDX
+    start = cycles; cycles += 2; executed++; x = 0x2E; NZ(x);
+    // 806B  LDA
+    start = cycles; cycles += 2; executed++; a = 0xBC; NZ(a);
+    // 806D  STA
+    start = cycles; cycles += 3; executed++; WR(0x03, a);
+    // 806F  LDA
+    start = cycles; cycles += 2; executed++; a = 0xF4; NZ(a);
+    // 8071  STA
+    start = cycles; cycles += 3; executed++; WR(0x04, a);
+    // 8073  EOR
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0xD5 + x); a ^= RD(ea); NZ(a);
+    IO_EXIT(0x8075);
+    // 8075  ORA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0340 + x); cycles += PAGE_CROSSED(0x0340, ea); a |= RD(ea); NZ(a);
+    // 8078  STA
+    start = cycles; cycles += 5; executed++; ea = (uint16_t)(0x0657 + x); WR(ea, a);
+    // 807B  SBC
+    start = cycles; cycles += 3; executed++; SBC(RD(0xE1));
+    // 807D  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xDC5A + x); cycles += PAGE_CROSSED(0xDC5A, ea); a ^= RD(ea); NZ(a);
+    IO_EXIT(0x8080);
+    // 8080  CLD
+    start = cycles; cycles += 2; executed++; SETF(F_D, 0);
+    // 8081  LDX
+    start = cycles; cycles += 4; executed++; x = RD(0x038B); NZ(x);
+    // 8084  BVC
+    start = cycles; cycles += 2; executed++; if (!(p & F_V)) { cycles += 1; EXIT(0x8089); }
+    EXIT(0x8086);
+}
+
+static int block_8086(espnes_context *ctx)
+{
+    BEGIN;
+    // 8086  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x04CB); NZ(a);
+    EXIT(0x8089);
+}
+
+static int block_8089(espnes_context *ctx)
+{
+    BEGIN;
+    // 8089  LDX
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x02E0 + y); cycles += PAGE_CROSSED(0x02E0, ea); x = RD(ea); NZ(x);
+    // 808C  LDX
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xCD50 + y); cycles += PAGE_CROSSED(0xCD50, ea); x = RD(ea); NZ(x);
+    IO_EXIT(0x808F);
+    // 808F  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0568 + x); cycles += PAGE_CROSSED(0x0568, ea); ADC(RD(ea));
+    // 8092  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x031B + y); cycles += PAGE_CROSSED(0x031B, ea); a ^= RD(ea); NZ(a);
+    // 8095  CMP
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xE0 + x); CMP(a, RD(ea));
+    // 8097  CMP
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0268 + y); cycles += PAGE_CROSSED(0x0268, ea); CMP(a, RD(ea));
+    // 809A  EOR
+    start = cycles; cycles += 4; executed++; a ^= RD(0xB32C); NZ(a);
+    IO_EXIT(0x809D);
+    // 809D  ADC
+    start = cycles; cycles += 2; executed++; ADC(0x2D);
+    // 809F  BMI
+    start = cycles; cycles += 2; executed++; if (p & F_N) { cycles += 1; EXIT(0x80A4); }
+    EXIT(0x80A1);
+}
+
+static int block_80A1(espnes_context *ctx)
+{
+    BEGIN;
+    // 80A1  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xA29D); NZ(a);
+    IO_EXIT(0x80A4);
+    EXIT(0x80A4);
+}
+
+static int block_80A4(espnes_context *ctx)
+{
+    BEGIN;
+    // 80A4  LDX
+    start = cycles; cycles += 2; executed++; x = 0xED; NZ(x);
+    // 80A6  LDA
+    start = cycles; cycles += 2; executed++; a = 0xA0; NZ(a);
+    // 80A8  STA
+    start = cycles; cycles += 3; executed++; WR(0x55, a);
+    // 80AA  LDA
+    start = cycles; cycles += 2; executed++; a = 0x03; NZ(a);
+    // 80AC  STA
+    start = cycles; cycles += 3; executed++; WR(0x56, a);
+    // 80AE  CMP
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x68 + x); CMP(a, RD(ea));
+    IO_EXIT(0x80B0);
+    // 80B0  LDX
+    start = cycles; cycles += 2; executed++; x = 0xB4; NZ(x);
+    // 80B2  LDA
+    start = cycles; cycles += 2; executed++; a = 0x51; NZ(a);
+    // 80B4  STA
+    start = cycles; cycles += 3; executed++; WR(0xBE, a);
+    // 80B6  LDA
+    start = cycles; cycles += 2; executed++; a = 0xEF; NZ(a);
+    // 80B8  STA
+    start = cycles; cycles += 3; executed++; WR(0xBF, a);
+    // 80BA  ADC
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x0A + x); ADC(RD(ea));
+    IO_EXIT(0x80BC);
+    // 80BC  DEY
+    start = cycles; cycles += 2; executed++; y--; NZ(y);
+    // 80BD  BMI
+    start = cycles; cycles += 2; executed++; if (p & F_N) { cycles += 1; EXIT(0x80C2); }
+    EXIT(0x80BF);
+}
+
+static int block_80BF(espnes_context *ctx)
+{
+    BEGIN;
+    // 80BF  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xE6F8); NZ(a);
+    IO_EXIT(0x80C2);
+    EXIT(0x80C2);
+}
+
+static int block_80C2(espnes_context *ctx)
+{
+    BEGIN;
+    // 80C2  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xE750 + x); cycles += PAGE_CROSSED(0xE750, ea); ADC(RD(ea));
+    IO_EXIT(0x80C5);
+    // 80C5  PHA
+    start = cycles; cycles += 3; executed++; PUSH(a);
+    // 80C6  LDA
+    start = cycles; cycles += 2; executed++; a = 0x40; NZ(a);
+    // 80C8  STA
+    start = cycles; cycles += 3; executed++; WR(0xB0, a);
+    // 80CA  LDA
+    start = cycles; cycles += 2; executed++; a = 0xA7; NZ(a);
+    // 80CC  STA
+    start = cycles; cycles += 3; executed++; WR(0xB1, a);
+    // 80CE  ORA
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0xB0); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a |= RD(ea); NZ(a);
+    IO_EXIT(0x80D0);
+    // 80D0  AND
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xD1 + x); a &= RD(ea); NZ(a);
+    // 80D2  LDA
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x6A + x); a = RD(ea); NZ(a);
+    // 80D4  SBC
+    start = cycles; cycles += 4; executed++; SBC(RD(0x06BE));
+    // 80D7  CMP
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x35 + x); CMP(a, RD(ea));
+    // 80D9  ORA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xAA1C + y); cycles += PAGE_CROSSED(0xAA1C, ea); a |= RD(ea); NZ(a);
+    IO_EXIT(0x80DC);
+    // 80DC  BEQ
+    start = cycles; cycles += 2; executed++; if (p & F_Z) { cycles += 1; EXIT(0x80E1); }
+    EXIT(0x80DE);
+}
+
+static int block_80DE(espnes_context *ctx)
+{
+    BEGIN;
+    // 80DE  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x8EB7); NZ(a);
+    IO_EXIT(0x80E1);
+    EXIT(0x80E1);
+}
+
+static int block_80E1(espnes_context *ctx)
+{
+    BEGIN;
+    // 80E1  ORA
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xA1 + x); a |= RD(ea); NZ(a);
+    // 80E3  ASL
+    start = cycles; cycles += 5; executed++; t = RD(0xEB); ASL(t); WR(0xEB, t);
+    // 80E5  LDA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xC39F + y); cycles += PAGE_CROSSED(0xC39F, ea); a = RD(ea); NZ(a);
+    IO_EXIT(0x80E8);
+    // 80E8  ROL
+    start = cycles; cycles += 2; executed++; ROL(a);
+    // 80E9  LDA
+    start = cycles; cycles += 2; executed++; a = 0x6D; NZ(a);
+    // 80EB  STA
+    start = cycles; cycles += 3; executed++; WR(0x92, a);
+    // 80ED  LDA
+    start = cycles; cycles += 2; executed++; a = 0xD8; NZ(a);
+    // 80EF  STA
+    start = cycles; cycles += 3; executed++; WR(0x93, a);
+    // 80F1  LDA
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x92); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a = RD(ea); NZ(a);
+    IO_EXIT(0x80F3);
+    // 80F3  LDA
+    start = cycles; cycles += 2; executed++; a = 0xD0; NZ(a);
+    // 80F5  STA
+    start = cycles; cycles += 3; executed++; WR(0xB4, a);
+    // 80F7  DEC
+    start = cycles; cycles += 6; executed++; t = RD(0x0068); t--; NZ(t); WR(0x0068, t);
+    // 80FA  PLA
+    start = cycles; cycles += 4; executed++; a = PULL(); NZ(a);
+    // 80FB  LDA
+    start = cycles; cycles += 2; executed++; a = 0x4B; NZ(a);
+    // 80FD  STA
+    start = cycles; cycles += 3; executed++; WR(0xAC, a);
+    // 80FF  LDA
+    start = cycles; cycles += 2; executed++; a = 0x00; NZ(a);
+    // 8101  STA
+    start = cycles; cycles += 3; executed++; WR(0xAD, a);
+    // 8103  AND
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0xAC); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a &= RD(ea); NZ(a);
+    IO_EXIT(0x8105);
+    // 8105  AND
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x4F + x); a &= RD(ea); NZ(a);
+    // 8107  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 1; EXIT(0x810C); }
+    EXIT(0x8109);
+}
+
+static int block_8109(espnes_context *ctx)
+{
+    BEGIN;
+    // 8109  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0133); NZ(a);
+    EXIT(0x810C);
+}
+
+static int block_810C(espnes_context *ctx)
+{
+    BEGIN;
+    // 810C  AND
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x062F + x); cycles += PAGE_CROSSED(0x062F, ea); a &= RD(ea); NZ(a);
+    // 810F  CPX
+    start = cycles; cycles += 2; executed++; CMP(x, 0x19);
+    // 8111  DEC
+    start = cycles; cycles += 6; executed++; t = RD(0x0326); t--; NZ(t); WR(0x0326, t);
+    // 8114  CLV
+    start = cycles; cycles += 2; executed++; SETF(F_V, 0);
+    // 8115  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xB497 + x); cycles += PAGE_CROSSED(0xB497, ea); ADC(RD(ea));
+    IO_EXIT(0x8118);
+    // 8118  STY
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x58 + x); WR(ea, y);
+    // 811A  LDA
+    start = cycles; cycles += 3; executed++; a = RD(0xA6); NZ(a);
+    // 811C  LDY
+    start = cycles; cycles += 2; executed++; y = 0x8F; NZ(y);
+    // 811E  STY
+    start = cycles; cycles += 3; executed++; WR(0xD0, y);
+    // 8120  PHA
+    start = cycles; cycles += 3; executed++; PUSH(a);
+    // 8121  SBC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xC7F3 + y); cycles += PAGE_CROSSED(0xC7F3, ea); SBC(RD(ea));
+    IO_EXIT(0x8124);
+    // 8124  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xA840 + y); cycles += PAGE_CROSSED(0xA840, ea); a ^= RD(ea); NZ(a);
+    IO_EXIT(0x8127);
+    // 8127  BVS
+    start = cycles; cycles += 2; executed++; if (p & F_V) { cycles += 1; EXIT(0x812C); }
+    EXIT(0x8129);
+}
+
+static int block_8129(espnes_context *ctx)
+{
+    BEGIN;
+    // 8129  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x03F6); NZ(a);
+    EXIT(0x812C);
+}
+
+static int block_812C(espnes_context *ctx)
+{
+    BEGIN;
+    // 812C  BIT
+    start = cycles; cycles += 4; executed++; BIT(RD(0xAF50));
+    IO_EXIT(0x812F);
+    // 812F  ROR
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x28 + x); t = RD(ea); ROR(t); WR(ea, t);
+    // 8131  ASL
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x53 + x); t = RD(ea); ASL(t); WR(ea, t);
+    // 8133  AND
+    start = cycles; cycles += 3; executed++; a &= RD(0x3A); NZ(a);
+    // 8135  STA
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x04 + x); WR(ea, a);
+    // 8137  STY
+    start = cycles; cycles += 3; executed++; WR(0x92, y);
+    // 8139  STA
+    start = cycles; cycles += 5; executed++; ea = (uint16_t)(0x0212 + y); WR(ea, a);
+    // 813C  LDA
+    start = cycles; cycles += 3; executed++; a = RD(0x56); NZ(a);
+    // 813E  PLA
+    start = cycles; cycles += 4; executed++; a = PULL(); NZ(a);
+    // 813F  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x86 + x); a ^= RD(ea); NZ(a);
+    // 8141  BVC
+    start = cycles; cycles += 2; executed++; if (!(p & F_V)) { cycles += 1; EXIT(0x8146); }
+    EXIT(0x8143);
+}
+
+static int block_8143(espnes_context *ctx)
+{
+    BEGIN;
+    // 8143  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0563); NZ(a);
+    EXIT(0x8146);
+}
+
+static int block_8146(espnes_context *ctx)
+{
+    BEGIN;
+    // 8146  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xD0FF); NZ(a);
+    IO_EXIT(0x8149);
+    // 8149  SBC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0419 + x); cycles += PAGE_CROSSED(0x0419, ea); SBC(RD(ea));
+    // 814C  ADC
+    start = cycles; cycles += 4; executed++; ADC(RD(0xDFE3));
+    IO_EXIT(0x814F);
+    // 814F  BVS
+    start = cycles; cycles += 2; executed++; if (p & F_V) { cycles += 1; EXIT(0x8154); }
+    EXIT(0x8151);
+}
+
+static int block_8151(espnes_context *ctx)
+{
+    BEGIN;
+    // 8151  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0344); NZ(a);
+    EXIT(0x8154);
+}
+
+static int block_8154(espnes_context *ctx)
+{
+    BEGIN;
+    // 8154  LDA
+    start = cycles; cycles += 2; executed++; a = 0xF7; NZ(a);
+    // 8156  STA
+    start = cycles; cycles += 3; executed++; WR(0xF5, a);
+    // 8158  LDA
+    start = cycles; cycles += 2; executed++; a = 0x06; NZ(a);
+    // 815A  STA
+    start = cycles; cycles += 3; executed++; WR(0xF6, a);
+    // 815C  AND
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0xF5); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a &= RD(ea); NZ(a);
+    IO_EXIT(0x815E);
+    // 815E  LDX
+    start = cycles; cycles += 2; executed++; x = 0x35; NZ(x);
+    // 8160  BMI
+    start = cycles; cycles += 2; executed++; if (p & F_N) { cycles += 1; EXIT(0x8165); }
+    EXIT(0x8162);
+}
+
+static int block_8162(espnes_context *ctx)
+{
+    BEGIN;
+    // 8162  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xDF4A); NZ(a);
+    IO_EXIT(0x8165);
+    EXIT(0x8165);
+}
+
+static int block_8165(espnes_context *ctx)
+{
+    BEGIN;
+    // 8165  PHP
+    start = cycles; cycles += 3; executed++; PUSH(p | F_B | F_U);
+    // 8166  LDY
+    start = cycles; cycles += 2; executed++; y = 0x69; NZ(y);
+    // 8168  EOR
+    start = cycles; cycles += 2; executed++; a ^= 0x28; NZ(a);
+    // 816A  BEQ
+    start = cycles; cycles += 2; executed++; if (p & F_Z) { cycles += 1; EXIT(0x816F); }
+    EXIT(0x816C);
+}
+
+static int block_816C(espnes_context *ctx)
+{
+    BEGIN;
+    // 816C  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x007E); NZ(a);
+    EXIT(0x816F);
+}
+
+static int block_816F(espnes_context *ctx)
+{
+    BEGIN;
+    // 816F  TAY
+    start = cycles; cycles += 2; executed++; y = a; NZ(y);
+    // 8170  LDA
+    start = cycles; cycles += 2; executed++; a = 0xD0; NZ(a);
+    // 8172  STA
+    start = cycles; cycles += 3; executed++; WR(0x44, a);
+    // 8174  LDA
+    start = cycles; cycles += 2; executed++; a = 0xFA; NZ(a);
+    // 8176  STA
+    start = cycles; cycles += 3; executed++; WR(0x45, a);
+    // 8178  SBC
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x44); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); SBC(RD(ea));
+    IO_EXIT(0x817A);
+    // 817A  ROR
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x0202 + x); t = RD(ea); ROR(t); WR(ea, t);
+    // 817D  STA
+    start = cycles; cycles += 4; executed++; WR(0x04F8, a);
+    // 8180  INC
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x0387 + x); t = RD(ea); t++; NZ(t); WR(ea, t);
+    // 8183  LDA
+    start = cycles; cycles += 2; executed++; a = 0xAC; NZ(a);
+    // 8185  STA
+    start = cycles; cycles += 3; executed++; WR(0x3D, a);
+    // 8187  LDA
+    start = cycles; cycles += 2; executed++; a = 0xC6; NZ(a);
+    // 8189  STA
+    start = cycles; cycles += 3; executed++; WR(0x3E, a);
+    // 818B  ADC
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x3D); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); ADC(RD(ea));
+    IO_EXIT(0x818D);
+    // 818D  SBC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x015C + x); cycles += PAGE_CROSSED(0x015C, ea); SBC(RD(ea));
+    // 8190  DEC
+    start = cycles; cycles += 5; executed++; t = RD(0xF7); t--; NZ(t); WR(0xF7, t);
+    // 8192  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 1; EXIT(0x8197); }
+    EXIT(0x8194);
+}
+
+static int block_8194(espnes_context *ctx)
+{
+    BEGIN;
+    // 8194  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xD6CD); NZ(a);
+    IO_EXIT(0x8197);
+    EXIT(0x8197);
+}
+
+static int block_8197(espnes_context *ctx)
+{
+    BEGIN;
+    // 8197  AND
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xEB57 + y); cycles += PAGE_CROSSED(0xEB57, ea); a &= RD(ea); NZ(a);
+    IO_EXIT(0x819A);
+    // 819A  BMI
+    start = cycles; cycles += 2; executed++; if (p & F_N) { cycles += 1; EXIT(0x819F); }
+    EXIT(0x819C);
+}
+
+static int block_819C(espnes_context *ctx)
+{
+    BEGIN;
+    // 819C  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x04F4); NZ(a);
+    EXIT(0x819F);
+}
+
+static int block_819F(espnes_context *ctx)
+{
+    BEGIN;
+    // 819F  ORA
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x31 + x); a |= RD(ea); NZ(a);
+    // 81A1  ASL
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x15 + x); t = RD(ea); ASL(t); WR(ea, t);
+    // 81A3  LDA
+    start = cycles; cycles += 2; executed++; a = 0x38; NZ(a);
+    // 81A5  STA
+    start = cycles; cycles += 3; executed++; WR(0x5C, a);
+    // 81A7  LDA
+    start = cycles; cycles += 2; executed++; a = 0xC4; NZ(a);
+    // 81A9  STA
+    start = cycles; cycles += 3; executed++; WR(0x5D, a);
+    // 81AB  EOR
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x5C); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a ^= RD(ea); NZ(a);
+    IO_EXIT(0x81AD);
+    // 81AD  BIT
+    start = cycles; cycles += 3; executed++; BIT(RD(0x84));
+    // 81AF  AND
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x045E + y); cycles += PAGE_CROSSED(0x045E, ea); a &= RD(ea); NZ(a);
+    // 81B2  BIT
+    start = cycles; cycles += 4; executed++; BIT(RD(0x02D8));
+    // 81B5  INX
+    start = cycles; cycles += 2; executed++; x++; NZ(x);
+    // 81B6  SBC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0392 + x); cycles += PAGE_CROSSED(0x0392, ea); SBC(RD(ea));
+    // 81B9  STY
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x8B + x); WR(ea, y);
+    // 81BB  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x003B); NZ(a);
+    // 81BE  BCS
+    start = cycles; cycles += 2; executed++; if (p & F_C) { cycles += 1; EXIT(0x81C3); }
+    EXIT(0x81C0);
+}
+
+static int block_81C0(espnes_context *ctx)
+{
+    BEGIN;
+    // 81C0  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xB12F); NZ(a);
+    IO_EXIT(0x81C3);
+    EXIT(0x81C3);
+}
+
+static int block_81C3(espnes_context *ctx)
+{
+    BEGIN;
+    // 81C3  CPY
+    start = cycles; cycles += 2; executed++; CMP(y, 0x03);
+    // 81C5  CLC
+    start = cycles; cycles += 2; executed++; SETF(F_C, 0);
+    // 81C6  ORA
+    start = cycles; cycles += 3; executed++; a |= RD(0xD4); NZ(a);
+    // 81C8  TXS
+    start = cycles; cycles += 2; executed++; sp = x;
+    // 81C9  BIT
+    start = cycles; cycles += 4; executed++; BIT(RD(0xCE8A));
+    IO_EXIT(0x81CC);
+    // 81CC  STA
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x74 + x); WR(ea, a);
+    // 81CE  LDA
+    start = cycles; cycles += 2; executed++; a = 0x1B; NZ(a);
+    // 81D0  STA
+    start = cycles; cycles += 3; executed++; WR(0x75, a);
+    // 81D2  LDA
+    start = cycles; cycles += 2; executed++; a = 0xCD; NZ(a);
+    // 81D4  STA
+    start = cycles; cycles += 3; executed++; WR(0x76, a);
+    // 81D6  EOR
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x75); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a ^= RD(ea); NZ(a);
+    IO_EXIT(0x81D8);
+    // 81D8  ROL
+    start = cycles; cycles += 5; executed++; t = RD(0xDF); ROL(t); WR(0xDF, t);
+    // 81DA  INC
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x0165 + x); t = RD(ea); t++; NZ(t); WR(ea, t);
+    // 81DD  ASL
+    start = cycles; cycles += 2; executed++; ASL(a);
+    // 81DE  LDX
+    start = cycles; cycles += 2; executed++; x = 0xEF; NZ(x);
+    // 81E0  LDA
+    start = cycles; cycles += 2; executed++; a = 0xED; NZ(a);
+    // 81E2  STA
+    start = cycles; cycles += 3; executed++; WR(0x23, a);
+    // 81E4  LDA
+    start = cycles; cycles += 2; executed++; a = 0x05; NZ(a);
+    // 81E6  STA
+    start = cycles; cycles += 3; executed++; WR(0x24, a);
+    // 81E8  ORA
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x34 + x); a |= RD(ea); NZ(a);
+    IO_EXIT(0x81EA);
+    // 81EA  ROL
+    start = cycles; cycles += 6; executed++; t = RD(0x051A); ROL(t); WR(0x051A, t);
+    // 81ED  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 1; EXIT(0x81F2); }
+    EXIT(0x81EF);
+}
+
+static int block_81EF(espnes_context *ctx)
+{
+    BEGIN;
+    // 81EF  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0411); NZ(a);
+    EXIT(0x81F2);
+}
+
+static int block_81F2(espnes_context *ctx)
+{
+    BEGIN;
+    // 81F2  DEC
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0xFA + x); t = RD(ea); t--; NZ(t); WR(ea, t);
+    // 81F4  TSX
+    start = cycles; cycles += 2; executed++; x = sp; NZ(x);
+    // 81F5  CPX
+    start = cycles; cycles += 3; executed++; CMP(x, RD(0xAA));
+    // 81F7  STY
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x3F + x); WR(ea, y);
+    // 81F9  ASL
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x7F + x); t = RD(ea); ASL(t); WR(ea, t);
+    // 81FB  AND
+    start = cycles; cycles += 3; executed++; a &= RD(0xEB); NZ(a);
+    // 81FD  DEC
+    start = cycles; cycles += 5; executed++; t = RD(0xC5); t--; NZ(t); WR(0xC5, t);
+    // 81FF  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 1; EXIT(0x8204); }
+    EXIT(0x8201);
+}
+
+static int block_8201(espnes_context *ctx)
+{
+    BEGIN;
+    // 8201  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xB705); NZ(a);
+    IO_EXIT(0x8204);
+    EXIT(0x8204);
+}
+
+static int block_8204(espnes_context *ctx)
+{
+    BEGIN;
+    // 8204  CPY
+    start = cycles; cycles += 4; executed++; CMP(y, RD(0x8E4F));
+    IO_EXIT(0x8207);
+    // 8207  SEI
+    start = cycles; cycles += 2; executed++; SETF(F_I, 1);
+    // 8208  LDA
+    start = cycles; cycles += 2; executed++; a = 0xEE; NZ(a);
+    // 820A  STA
+    start = cycles; cycles += 3; executed++; WR(0x14, a);
+    // 820C  LDA
+    start = cycles; cycles += 2; executed++; a = 0x02; NZ(a);
+    // 820E  STA
+    start = cycles; cycles += 3; executed++; WR(0x15, a);
+    // 8210  ADC
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x14); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); ADC(RD(ea));
+    IO_EXIT(0x8212);
+    // 8212  STA
+    start = cycles; cycles += 5; executed++; ea = (uint16_t)(0x059D + y); WR(ea, a);
+    // 8215  BVC
+    start = cycles; cycles += 2; executed++; if (!(p & F_V)) { cycles += 1; EXIT(0x821A); }
+    EXIT(0x8217);
+}
+
+static int block_8217(espnes_context *ctx)
+{
+    BEGIN;
+    // 8217  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xEEC1); NZ(a);
+    IO_EXIT(0x821A);
+    EXIT(0x821A);
+}
+
+static int block_821A(espnes_context *ctx)
+{
+    BEGIN;
+    // 821A  LDA
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xF9 + x); a = RD(ea); NZ(a);
+    // 821C  ORA
+    start = cycles; cycles += 3; executed++; a |= RD(0x84); NZ(a);
+    // 821E  LSR
+    start = cycles; cycles += 6; executed++; t = RD(0x018E); LSR(t); WR(0x018E, t);
+    // 8221  PHA
+    start = cycles; cycles += 3; executed++; PUSH(a);
+    // 8222  LDA
+    start = cycles; cycles += 2; executed++; a = 0x8B; NZ(a);
+    // 8224  CMP
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x6C + x); CMP(a, RD(ea));
+    // 8226  INC
+    start = cycles; cycles += 6; executed++; t = RD(0x04FD); t++; NZ(t); WR(0x04FD, t);
+    // 8229  CLV
+    start = cycles; cycles += 2; executed++; SETF(F_V, 0);
+    // 822A  CLD
+    start = cycles; cycles += 2; executed++; SETF(F_D, 0);
+    // 822B  LDA
+    start = cycles; cycles += 3; executed++; a = RD(0x8B); NZ(a);
+    // 822D  ADC
+    start = cycles; cycles += 3; executed++; ADC(RD(0x66));
+    // 822F  BVC
+    start = cycles; cycles += 2; executed++; if (!(p & F_V)) { cycles += 1; EXIT(0x8234); }
+    EXIT(0x8231);
+}
+
+static int block_8231(espnes_context *ctx)
+{
+    BEGIN;
+    // 8231  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xAA1D); NZ(a);
+    IO_EXIT(0x8234);
+    EXIT(0x8234);
+}
+
+static int block_8234(espnes_context *ctx)
+{
+    BEGIN;
+    // 8234  ROR
+    start = cycles; cycles += 6; executed++; t = RD(0x04FD); ROR(t); WR(0x04FD, t);
+    // 8237  LSR
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x018A + x); t = RD(ea); LSR(t); WR(ea, t);
+    // 823A  DEY
+    start = cycles; cycles += 2; executed++; y--; NZ(y);
+    // 823B  CPY
+    start = cycles; cycles += 2; executed++; CMP(y, 0xE0);
+    // 823D  BCS
+    start = cycles; cycles += 2; executed++; if (p & F_C) { cycles += 1; EXIT(0x8242); }
+    EXIT(0x823F);
+}
+
+static int block_823F(espnes_context *ctx)
+{
+    BEGIN;
+    // 823F  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0326); NZ(a);
+    EXIT(0x8242);
+}
+
+static int block_8242(espnes_context *ctx)
+{
+    BEGIN;
+    // 8242  ADC
+    start = cycles; cycles += 2; executed++; ADC(0xCA);
+    // 8244  ROL
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x01B1 + x); t = RD(ea); ROL(t); WR(ea, t);
+    // 8247  LDX
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xD894 + y); cycles += PAGE_CROSSED(0xD894, ea); x = RD(ea); NZ(x);
+    IO_EXIT(0x824A);
+    // 824A  ADC
+    start = cycles; cycles += 3; executed++; ADC(RD(0xE7));
+    // 824C  SBC
+    start = cycles; cycles += 3; executed++; SBC(RD(0x6E));
+    // 824E  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 1; EXIT(0x8253); }
+    EXIT(0x8250);
+}
+
+static int block_8250(espnes_context *ctx)
+{
+    BEGIN;
+    // 8250  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xEB91); NZ(a);
+    IO_EXIT(0x8253);
+    EXIT(0x8253);
+}
+
+static int block_8253(espnes_context *ctx)
+{
+    BEGIN;
+    // 8253  ORA
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x92 + x); a |= RD(ea); NZ(a);
+    // 8255  PHA
+    start = cycles; cycles += 3; executed++; PUSH(a);
+    // 8256  PHA
+    start = cycles; cycles += 3; executed++; PUSH(a);
+    // 8257  ASL
+    start = cycles; cycles += 5; executed++; t = RD(0xCA); ASL(t); WR(0xCA, t);
+    // 8259  BCS
+    start = cycles; cycles += 2; executed++; if (p & F_C) { cycles += 1; EXIT(0x825E); }
+    EXIT(0x825B);
+}
+
+static int block_825B(espnes_context *ctx)
+{
+    BEGIN;
+    // 825B  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x008D); NZ(a);
+    EXIT(0x825E);
+}
+
+static int block_825E(espnes_context *ctx)
+{
+    BEGIN;
+    // 825E  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x04A4 + x); cycles += PAGE_CROSSED(0x04A4, ea); ADC(RD(ea));
+    // 8261  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xDA9A); NZ(a);
+    IO_EXIT(0x8264);
+    // 8264  AND
+    start = cycles; cycles += 3; executed++; a &= RD(0xDB); NZ(a);
+    // 8266  CLV
+    start = cycles; cycles += 2; executed++; SETF(F_V, 0);
+    // 8267  CPX
+    start = cycles; cycles += 4; executed++; CMP(x, RD(0xD7E2));
+    IO_EXIT(0x826A);
+    // 826A  PLA
+    start = cycles; cycles += 4; executed++; a = PULL(); NZ(a);
+    // 826B  STY
+    start = cycles; cycles += 4; executed++; WR(0x068A, y);
+    // 826E  ASL
+    start = cycles; cycles += 6; executed++; t = RD(0x06BE); ASL(t); WR(0x06BE, t);
+    // 8271  ORA
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xCC + x); a |= RD(ea); NZ(a);
+    // 8273  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xC69A + x); cycles += PAGE_CROSSED(0xC69A, ea); a ^= RD(ea); NZ(a);
+    IO_EXIT(0x8276);
+    // 8276  BCS
+    start = cycles; cycles += 2; executed++; if (p & F_C) { cycles += 1; EXIT(0x827B); }
+    EXIT(0x8278);
+}
+
+static int block_8278(espnes_context *ctx)
+{
+    BEGIN;
+    // 8278  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xB951); NZ(a);
+    IO_EXIT(0x827B);
+    EXIT(0x827B);
+}
+
+static int block_827B(espnes_context *ctx)
+{
+    BEGIN;
+    // 827B  SED
+    start = cycles; cycles += 2; executed++; SETF(F_D, 1);
+    // 827C  AND
+    start = cycles; cycles += 2; executed++; a &= 0xF5; NZ(a);
+    // 827E  CMP
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x41 + x); CMP(a, RD(ea));
+    // 8280  EOR
+    start = cycles; cycles += 4; executed++; a ^= RD(0x002E); NZ(a);
+    // 8283  EOR
+    start = cycles; cycles += 3; executed++; a ^= RD(0x1E); NZ(a);
+    // 8285  DEY
+    start = cycles; cycles += 2; executed++; y--; NZ(y);
+    // 8286  AND
+    start = cycles; cycles += 2; executed++; a &= 0xE5; NZ(a);
+    // 8288  ROL
+    start = cycles; cycles += 6; executed++; t = RD(0x040A); ROL(t); WR(0x040A, t);
+    // 828B  BVC
+    start = cycles; cycles += 2; executed++; if (!(p & F_V)) { cycles += 1; EXIT(0x8290); }
+    EXIT(0x828D);
+}
+
+static int block_828D(espnes_context *ctx)
+{
+    BEGIN;
+    // 828D  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0255); NZ(a);
+    EXIT(0x8290);
+}
+
+static int block_8290(espnes_context *ctx)
+{
+    BEGIN;
+    // 8290  LDY
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x17 + x); y = RD(ea); NZ(y);
+    // 8292  SED
+    start = cycles; cycles += 2; executed++; SETF(F_D, 1);
+    // 8293  STY
+    start = cycles; cycles += 4; executed++; WR(0x05D4, y);
+    // 8296  TXA
+    start = cycles; cycles += 2; executed++; a = x; NZ(a);
+    // 8297  BCC
+    start = cycles; cycles += 2; executed++; if (!(p & F_C)) { cycles += 1; EXIT(0x829C); }
+    EXIT(0x8299);
+}
+
+static int block_8299(espnes_context *ctx)
+{
+    BEGIN;
+    // 8299  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x04CB); NZ(a);
+    EXIT(0x829C);
+}
+
+static int block_829C(espnes_context *ctx)
+{
+    BEGIN;
+    // 829C  LDA
+    start = cycles; cycles += 2; executed++; a = 0xF4; NZ(a);
+    // 829E  STA
+    start = cycles; cycles += 3; executed++; WR(0x59, a);
+    // 82A0  LDA
+    start = cycles; cycles += 2; executed++; a = 0xAA; NZ(a);
+    // 82A2  STA
+    start = cycles; cycles += 3; executed++; WR(0x5A, a);
+    // 82A4  ORA
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x59); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a |= RD(ea); NZ(a);
+    IO_EXIT(0x82A6);
+    // 82A6  TXS
+    start = cycles; cycles += 2; executed++; sp = x;
+    // 82A7  LDY
+    start = cycles; cycles += 4; executed++; y = RD(0x04F0); NZ(y);
+    // 82AA  ASL
+    start = cycles; cycles += 2; executed++; ASL(a);
+    // 82AB  DEX
+    start = cycles; cycles += 2; executed++; x--; NZ(x);
+    // 82AC  ROL
+    start = cycles; cycles += 5; executed++; t = RD(0xFE); ROL(t); WR(0xFE, t);
+    // 82AE  STX
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x30 + y); WR(ea, x);
+    // 82B0  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 1; EXIT(0x82B5); }
+    EXIT(0x82B2);
+}
+
+static int block_82B2(espnes_context *ctx)
+{
+    BEGIN;
+    // 82B2  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x02DE); NZ(a);
+    EXIT(0x82B5);
+}
+
+static int block_82B5(espnes_context *ctx)
+{
+    BEGIN;
+    // 82B5  LDX
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0259 + y); cycles += PAGE_CROSSED(0x0259, ea); x = RD(ea); NZ(x);
+    // 82B8  ROR
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x046F + x); t = RD(ea); ROR(t); WR(ea, t);
+    // 82BB  STA
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x9C + x); WR(ea, a);
+    // 82BD  ROL
+    start = cycles; cycles += 2; executed++; ROL(a);
+    // 82BE  EOR
+    start = cycles; cycles += 4; executed++; a ^= RD(0x8211); NZ(a);
+    IO_EXIT(0x82C1);
+    // 82C1  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 1; EXIT(0x82C6); }
+    EXIT(0x82C3);
+}
+
+static int block_82C3(espnes_context *ctx)
+{
+    BEGIN;
+    // 82C3  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xBA9D); NZ(a);
+    IO_EXIT(0x82C6);
+    EXIT(0x82C6);
+}
+
+static int block_82C6(espnes_context *ctx)
+{
+    BEGIN;
+    // 82C6  ROL
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x015F + x); t = RD(ea); ROL(t); WR(ea, t);
+    // 82C9  ASL
+    start = cycles; cycles += 6; executed++; t = RD(0x030A); ASL(t); WR(0x030A, t);
+    // 82CC  AND
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xCD3F + x); cycles += PAGE_CROSSED(0xCD3F, ea); a &= RD(ea); NZ(a);
+    IO_EXIT(0x82CF);
+    // 82CF  STY
+    start = cycles; cycles += 3; executed++; WR(0x1B, y);
+    // 82D1  ORA
+    start = cycles; cycles += 2; executed++; a |= 0x67; NZ(a);
+    // 82D3  LDX
+    start = cycles; cycles += 2; executed++; x = 0x68; NZ(x);
+    // 82D5  LDA
+    start = cycles; cycles += 2; executed++; a = 0x96; NZ(a);
+    // 82D7  STA
+    start = cycles; cycles += 3; executed++; WR(0x0B, a);
+    // 82D9  LDA
+    start = cycles; cycles += 2; executed++; a = 0x9B; NZ(a);
+    // 82DB  STA
+    start = cycles; cycles += 3; executed++; WR(0x0C, a);
+    // 82DD  SBC
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0xA3 + x); SBC(RD(ea));
+    IO_EXIT(0x82DF);
+    // 82DF  AND
+    start = cycles; cycles += 2; executed++; a &= 0xD5; NZ(a);
+    // 82E1  SEI
+    start = cycles; cycles += 2; executed++; SETF(F_I, 1);
+    // 82E2  SEC
+    start = cycles; cycles += 2; executed++; SETF(F_C, 1);
+    // 82E3  ROR
+    start = cycles; cycles += 6; executed++; t = RD(0x061E); ROR(t); WR(0x061E, t);
+    // 82E6  PHP
+    start = cycles; cycles += 3; executed++; PUSH(p | F_B | F_U);
+    // 82E7  TYA
+    start = cycles; cycles += 2; executed++; a = y; NZ(a);
+    // 82E8  BVC
+    start = cycles; cycles += 2; executed++; if (!(p & F_V)) { cycles += 1; EXIT(0x82ED); }
+    EXIT(0x82EA);
+}
+
+static int block_82EA(espnes_context *ctx)
+{
+    BEGIN;
+    // 82EA  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xB518); NZ(a);
+    IO_EXIT(0x82ED);
+    EXIT(0x82ED);
+}
+
+static int block_82ED(espnes_context *ctx)
+{
+    BEGIN;
+    // 82ED  EOR
+    start = cycles; cycles += 2; executed++; a ^= 0x56; NZ(a);
+    // 82EF  CMP
+    start = cycles; cycles += 4; executed++; CMP(a, RD(0x03B6));
+    // 82F2  TXS
+    start = cycles; cycles += 2; executed++; sp = x;
+    // 82F3  CPX
+    start = cycles; cycles += 3; executed++; CMP(x, RD(0xDB));
+    // 82F5  CMP
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x8B + x); CMP(a, RD(ea));
+    // 82F7  CMP
+    start = cycles; cycles += 3; executed++; CMP(a, RD(0x56));
+    // 82F9  CPY
+    start = cycles; cycles += 2; executed++; CMP(y, 0x59);
+    // 82FB  LDY
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xBC + x); y = RD(ea); NZ(y);
+    // 82FD  LSR
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x0410 + x); t = RD(ea); LSR(t); WR(ea, t);
+    // 8300  LDX
+    start = cycles; cycles += 2; executed++; x = 0x08; NZ(x);
+    // 8302  LDA
+    start = cycles; cycles += 2; executed++; a = 0xAC; NZ(a);
+    // 8304  STA
+    start = cycles; cycles += 3; executed++; WR(0xEF, a);
+    // 8306  LDA
+    start = cycles; cycles += 2; executed++; a = 0x04; NZ(a);
+    // 8308  STA
+    start = cycles; cycles += 3; executed++; WR(0xF0, a);
+    // 830A  EOR
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0xE7 + x); a ^= RD(ea); NZ(a);
+    IO_EXIT(0x830C);
+    // 830C  ORA
+    start = cycles; cycles += 3; executed++; a |= RD(0x67); NZ(a);
+    // 830E  EOR
+    start = cycles; cycles += 3; executed++; a ^= RD(0x0A); NZ(a);
+    // 8310  BMI
+    start = cycles; cycles += 2; executed++; if (p & F_N) { cycles += 1; EXIT(0x8315); }
+    EXIT(0x8312);
+}
+
+static int block_8312(espnes_context *ctx)
+{
+    BEGIN;
+    // 8312  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xB346); NZ(a);
+    IO_EXIT(0x8315);
+    EXIT(0x8315);
+}
+
+static int block_8315(espnes_context *ctx)
+{
+    BEGIN;
+    // 8315  ASL
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x93 + x); t = RD(ea); ASL(t); WR(ea, t);
+    // 8317  SED
+    start = cycles; cycles += 2; executed++; SETF(F_D, 1);
+    // 8318  STA
+    start = cycles; cycles += 5; executed++; ea = (uint16_t)(0x03C7 + y); WR(ea, a);
+    // 831B  LDA
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x2C + x); a = RD(ea); NZ(a);
+    // 831D  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 1; EXIT(0x8322); }
+    EXIT(0x831F);
+}
+
+static int block_831F(espnes_context *ctx)
+{
+    BEGIN;
+    // 831F  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0381); NZ(a);
+    EXIT(0x8322);
+}
+
+static int block_8322(espnes_context *ctx)
+{
+    BEGIN;
+    // 8322  CPX
+    start = cycles; cycles += 3; executed++; CMP(x, RD(0x88));
+    // 8324  AND
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x061D + x); cycles += PAGE_CROSSED(0x061D, ea); a &= RD(ea); NZ(a);
+    // 8327  STA
+    start = cycles; cycles += 4; executed++; WR(0x0569, a);
+    // 832A  SEI
+    start = cycles; cycles += 2; executed++; SETF(F_I, 1);
+    // 832B  DEC
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x54 + x); t = RD(ea); t--; NZ(t); WR(ea, t);
+    // 832D  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xE2A8 + y); cycles += PAGE_CROSSED(0xE2A8, ea); ADC(RD(ea));
+    IO_EXIT(0x8330);
+    // 8330  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0137 + x); cycles += PAGE_CROSSED(0x0137, ea); ADC(RD(ea));
+    // 8333  LDX
+    start = cycles; cycles += 4; executed++; x = RD(0x046B); NZ(x);
+    // 8336  BEQ
+    start = cycles; cycles += 2; executed++; if (p & F_Z) { cycles += 1; EXIT(0x833B); }
+    EXIT(0x8338);
+}
+
+static int block_8338(espnes_context *ctx)
+{
+    BEGIN;
+    // 8338  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x043C); NZ(a);
+    EXIT(0x833B);
+}
+
+static int block_833B(espnes_context *ctx)
+{
+    BEGIN;
+    // 833B  LDY
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x52 + x); y = RD(ea); NZ(y);
+    // 833D  ORA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0597 + x); cycles += PAGE_CROSSED(0x0597, ea); a |= RD(ea); NZ(a);
+    // 8340  LSR
+    start = cycles; cycles += 6; executed++; t = RD(0x051D); LSR(t); WR(0x051D, t);
+    // 8343  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xCAE4 + x); cycles += PAGE_CROSSED(0xCAE4, ea); a ^= RD(ea); NZ(a);
+    IO_EXIT(0x8346);
+    // 8346  STA
+    start = cycles; cycles += 5; executed++; ea = (uint16_t)(0x04DA + y); WR(ea, a);
+    // 8349  EOR
+    start = cycles; cycles += 4; executed++; a ^= RD(0xA451); NZ(a);
+    IO_EXIT(0x834C);
+    // 834C  STA
+    start = cycles; cycles += 5; executed++; ea = (uint16_t)(0x057C + x); WR(ea, a);
+    // 834F  CPY
+    start = cycles; cycles += 3; executed++; CMP(y, RD(0xAE));
+    // 8351  BVC
+    start = cycles; cycles += 2; executed++; if (!(p & F_V)) { cycles += 1; EXIT(0x8356); }
+    EXIT(0x8353);
+}
+
+static int block_8353(espnes_context *ctx)
+{
+    BEGIN;
+    // 8353  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0389); NZ(a);
+    EXIT(0x8356);
+}
+
+static int block_8356(espnes_context *ctx)
+{
+    BEGIN;
+    // 8356  EOR
+    start = cycles; cycles += 2; executed++; a ^= 0xE9; NZ(a);
+    // 8358  BCS
+    start = cycles; cycles += 2; executed++; if (p & F_C) { cycles += 1; EXIT(0x835D); }
+    EXIT(0x835A);
+}
+
+static int block_835A(espnes_context *ctx)
+{
+    BEGIN;
+    // 835A  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xD898); NZ(a);
+    IO_EXIT(0x835D);
+    EXIT(0x835D);
+}
+
+static int block_835D(espnes_context *ctx)
+{
+    BEGIN;
+    // 835D  INC
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0xA4 + x); t = RD(ea); t++; NZ(t); WR(ea, t);
+    // 835F  BCC
+    start = cycles; cycles += 2; executed++; if (!(p & F_C)) { cycles += 1; EXIT(0x8364); }
+    EXIT(0x8361);
+}
+
+static int block_8361(espnes_context *ctx)
+{
+    BEGIN;
+    // 8361  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xE7F8); NZ(a);
+    IO_EXIT(0x8364);
+    EXIT(0x8364);
+}
+
+static int block_8364(espnes_context *ctx)
+{
+    BEGIN;
+    // 8364  LDX
+    start = cycles; cycles += 2; executed++; x = 0xAF; NZ(x);
+    // 8366  LDA
+    start = cycles; cycles += 2; executed++; a = 0x7D; NZ(a);
+    // 8368  STA
+    start = cycles; cycles += 3; executed++; WR(0xA5, a);
+    // 836A  LDA
+    start = cycles; cycles += 2; executed++; a = 0x02; NZ(a);
+    // 836C  STA
+    start = cycles; cycles += 3; executed++; WR(0xA6, a);
+    // 836E  ORA
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0xF6 + x); a |= RD(ea); NZ(a);
+    IO_EXIT(0x8370);
+    // 8370  STA
+    start = cycles; cycles += 5; executed++; ea = (uint16_t)(0x02D4 + x); WR(ea, a);
+    // 8373  STY
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xE0 + x); WR(ea, y);
+    // 8375  SBC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xBB69 + y); cycles += PAGE_CROSSED(0xBB69, ea); SBC(RD(ea));
+    IO_EXIT(0x8378);
+    // 8378  STA
+    start = cycles; cycles += 3; executed++; WR(0x0F, a);
+    // 837A  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x40 + x); a ^= RD(ea); NZ(a);
+    // 837C  BVS
+    start = cycles; cycles += 2; executed++; if (p & F_V) { cycles += 1; EXIT(0x8381); }
+    EXIT(0x837E);
+}
+
+static int block_837E(espnes_context *ctx)
+{
+    BEGIN;
+    // 837E  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xC8DC); NZ(a);
+    IO_EXIT(0x8381);
+    EXIT(0x8381);
+}
+
+static int block_8381(espnes_context *ctx)
+{
+    BEGIN;
+    // 8381  ROR
+    start = cycles; cycles += 2; executed++; ROR(a);
+    // 8382  ADC
+    start = cycles; cycles += 2; executed++; ADC(0x09);
+    // 8384  INC
+    start = cycles; cycles += 5; executed++; t = RD(0x6E); t++; NZ(t); WR(0x6E, t);
+    // 8386  LDA
+    start = cycles; cycles += 2; executed++; a = 0x59; NZ(a);
+    // 8388  STA
+    start = cycles; cycles += 3; executed++; WR(0x0B, a);
+    // 838A  LDA
+    start = cycles; cycles += 2; executed++; a = 0x00; NZ(a);
+    // 838C  STA
+    start = cycles; cycles += 3; executed++; WR(0x0C, a);
+    // 838E  EOR
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x0B); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a ^= RD(ea); NZ(a);
+    IO_EXIT(0x8390);
+    // 8390  DEC
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x0592 + x); t = RD(ea); t--; NZ(t); WR(ea, t);
+    // 8393  BVC
+    start = cycles; cycles += 2; executed++; if (!(p & F_V)) { cycles += 1; EXIT(0x8398); }
+    EXIT(0x8395);
+}
+
+static int block_8395(espnes_context *ctx)
+{
+    BEGIN;
+    // 8395  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x05AE); NZ(a);
+    EXIT(0x8398);
+}
+
+static int block_8398(espnes_context *ctx)
+{
+    BEGIN;
+    // 8398  AND
+    start = cycles; cycles += 3; executed++; a &= RD(0x65); NZ(a);
+    // 839A  STY
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xBD + x); WR(ea, y);
+    // 839C  BCC
+    start = cycles; cycles += 2; executed++; if (!(p & F_C)) { cycles += 1; EXIT(0x83A1); }
+    EXIT(0x839E);
+}
+
+static int block_839E(espnes_context *ctx)
+{
+    BEGIN;
+    // 839E  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xAEC0); NZ(a);
+    IO_EXIT(0x83A1);
+    EXIT(0x83A1);
+}
+
+static int block_83A1(espnes_context *ctx)
+{
+    BEGIN;
+    // 83A1  ROR
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x0626 + x); t = RD(ea); ROR(t); WR(ea, t);
+    // 83A4  ROL
+    start = cycles; cycles += 2; executed++; ROL(a);
+    // 83A5  CMP
+    start = cycles; cycles += 3; executed++; CMP(a, RD(0x82));
+    // 83A7  ROR
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x02BE + x); t = RD(ea); ROR(t); WR(ea, t);
+    // 83AA  SBC
+    start = cycles; cycles += 3; executed++; SBC(RD(0x02));
+    // 83AC  CPY
+    start = cycles; cycles += 2; executed++; CMP(y, 0x66);
+    // 83AE  LDX
+    start = cycles; cycles += 4; executed++; x = RD(0xB53E); NZ(x);
+    IO_EXIT(0x83B1);
+    // 83B1  LDX
+    start = cycles; cycles += 2; executed++; x = 0x37; NZ(x);
+    // 83B3  LDA
+    start = cycles; cycles += 2; executed++; a = 0xE7; NZ(a);
+    // 83B5  STA
+    start = cycles; cycles += 3; executed++; WR(0x44, a);
+    // 83B7  LDA
+    start = cycles; cycles += 2; executed++; a = 0x06; NZ(a);
+    // 83B9  STA
+    start = cycles; cycles += 3; executed++; WR(0x45, a);
+    // 83BB  LDA
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x0D + x); a = RD(ea); NZ(a);
+    IO_EXIT(0x83BD);
+    // 83BD  ASL
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x1F + x); t = RD(ea); ASL(t); WR(ea, t);
+    // 83BF  BCC
+    start = cycles; cycles += 2; executed++; if (!(p & F_C)) { cycles += 1; EXIT(0x83C4); }
+    EXIT(0x83C1);
+}
+
+static int block_83C1(espnes_context *ctx)
+{
+    BEGIN;
+    // 83C1  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x84D3); NZ(a);
+    IO_EXIT(0x83C4);
+    EXIT(0x83C4);
+}
+
+static int block_83C4(espnes_context *ctx)
+{
+    BEGIN;
+    // 83C4  INC
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0xC6 + x); t = RD(ea); t++; NZ(t); WR(ea, t);
+    // 83C6  LDX
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xF976 + y); cycles += PAGE_CROSSED(0xF976, ea); x = RD(ea); NZ(x);
+    IO_EXIT(0x83C9);
+    // 83C9  INX
+    start = cycles; cycles += 2; executed++; x++; NZ(x);
+    // 83CA  ADC
+    start = cycles; cycles += 4; executed++; ADC(RD(0xCA5F));
+    IO_EXIT(0x83CD);
+    // 83CD  LDA
+    start = cycles; cycles += 2; executed++; a = 0xDF; NZ(a);
+    // 83CF  STA
+    start = cycles; cycles += 3; executed++; WR(0x68, a);
+    // 83D1  LDA
+    start = cycles; cycles += 2; executed++; a = 0xDC; NZ(a);
+    // 83D3  STA
+    start = cycles; cycles += 3; executed++; WR(0x69, a);
+    // 83D5  LDA
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x68); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a = RD(ea); NZ(a);
+    IO_EXIT(0x83D7);
+    // 83D7  LDA
+    start = cycles; cycles += 2; executed++; a = 0x79; NZ(a);
+    // 83D9  STA
+    start = cycles; cycles += 3; executed++; WR(0xA9, a);
+    // 83DB  LDA
+    start = cycles; cycles += 2; executed++; a = 0x81; NZ(a);
+    // 83DD  STA
+    start = cycles; cycles += 3; executed++; WR(0xAA, a);
+    // 83DF  SBC
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0xA9); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); SBC(RD(ea));
+    IO_EXIT(0x83E1);
+    // 83E1  ORA
+    start = cycles; cycles += 4; executed++; a |= RD(0x0315); NZ(a);
+    // 83E4  CLV
+    start = cycles; cycles += 2; executed++; SETF(F_V, 0);
+    // 83E5  LSR
+    start = cycles; cycles += 2; executed++; LSR(a);
+    // 83E6  INY
+    start = cycles; cycles += 2; executed++; y++; NZ(y);
+    // 83E7  TSX
+    start = cycles; cycles += 2; executed++; x = sp; NZ(x);
+    // 83E8  CPX
+    start = cycles; cycles += 2; executed++; CMP(x, 0xA3);
+    // 83EA  BPL
+    start = cycles; cycles += 2; executed++; if (!(p & F_N)) { cycles += 1; EXIT(0x83EF); }
+    EXIT(0x83EC);
+}
+
+static int block_83EC(espnes_context *ctx)
+{
+    BEGIN;
+    // 83EC  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xE83E); NZ(a);
+    IO_EXIT(0x83EF);
+    EXIT(0x83EF);
+}
+
+static int block_83EF(espnes_context *ctx)
+{
+    BEGIN;
+    // 83EF  ORA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x063F + y); cycles += PAGE_CROSSED(0x063F, ea); a |= RD(ea); NZ(a);
+    // 83F2  DEC
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x019B + x); t = RD(ea); t--; NZ(t); WR(ea, t);
+    // 83F5  SBC
+    start = cycles; cycles += 4; executed++; SBC(RD(0xBC91));
+    IO_EXIT(0x83F8);
+    // 83F8  CLD
+    start = cycles; cycles += 2; executed++; SETF(F_D, 0);
+    // 83F9  CMP
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x00E0 + y); cycles += PAGE_CROSSED(0x00E0, ea); CMP(a, RD(ea));
+    // 83FC  LDA
+    start = cycles; cycles += 2; executed++; a = 0x87; NZ(a);
+    // 83FE  STA
+    start = cycles; cycles += 3; executed++; WR(0x31, a);
+    // 8400  LDA
+    start = cycles; cycles += 2; executed++; a = 0xA6; NZ(a);
+    // 8402  STA
+    start = cycles; cycles += 3; executed++; WR(0x32, a);
+    // 8404  CMP
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x31); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); CMP(a, RD(ea));
+    IO_EXIT(0x8406);
+    // 8406  BVS
+    start = cycles; cycles += 2; executed++; if (p & F_V) { cycles += 1; EXIT(0x840B); }
+    EXIT(0x8408);
+}
+
+static int block_8408(espnes_context *ctx)
+{
+    BEGIN;
+    // 8408  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xC61A); NZ(a);
+    IO_EXIT(0x840B);
+    EXIT(0x840B);
+}
+
+static int block_840B(espnes_context *ctx)
+{
+    BEGIN;
+    // 840B  LDY
+    start = cycles; cycles += 4; executed++; y = RD(0xB853); NZ(y);
+    IO_EXIT(0x840E);
+    // 840E  STX
+    start = cycles; cycles += 3; executed++; WR(0x6A, x);
+    // 8410  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x048C); NZ(a);
+    // 8413  TYA
+    start = cycles; cycles += 2; executed++; a = y; NZ(a);
+    // 8414  ROR
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x05C8 + x); t = RD(ea); ROR(t); WR(ea, t);
+    // 8417  SEC
+    start = cycles; cycles += 2; executed++; SETF(F_C, 1);
+    // 8418  CPX
+    start = cycles; cycles += 3; executed++; CMP(x, RD(0xFF));
+    // 841A  BMI
+    start = cycles; cycles += 2; executed++; if (p & F_N) { cycles += 1; EXIT(0x841F); }
+    EXIT(0x841C);
+}
+
+static int block_841C(espnes_context *ctx)
+{
+    BEGIN;
+    // 841C  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0654); NZ(a);
+    EXIT(0x841F);
+}
+
+static int block_841F(espnes_context *ctx)
+{
+    BEGIN;
+    // 841F  LDY
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x04D9 + x); cycles += PAGE_CROSSED(0x04D9, ea); y = RD(ea); NZ(y);
+    // 8422  NOP
+    start = cycles; cycles += 2; executed++; 
+    // 8423  CPX
+    start = cycles; cycles += 4; executed++; CMP(x, RD(0x8E40));
+    IO_EXIT(0x8426);
+    // 8426  LDX
+    start = cycles; cycles += 2; executed++; x = 0xD3; NZ(x);
+    // 8428  LDA
+    start = cycles; cycles += 2; executed++; a = 0x58; NZ(a);
+    // 842A  STA
+    start = cycles; cycles += 3; executed++; WR(0xBC, a);
+    // 842C  LDA
+    start = cycles; cycles += 2; executed++; a = 0xA4; NZ(a);
+    // 842E  STA
+    start = cycles; cycles += 3; executed++; WR(0xBD, a);
+    // 8430  AND
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0xE9 + x); a &= RD(ea); NZ(a);
+    IO_EXIT(0x8432);
+    // 8432  ADC
+    start = cycles; cycles += 4; executed++; ADC(RD(0x8CC0));
+    IO_EXIT(0x8435);
+    // 8435  STA
+    start = cycles; cycles += 3; executed++; WR(0xE1, a);
+    // 8437  INY
+    start = cycles; cycles += 2; executed++; y++; NZ(y);
+    // 8438  BIT
+    start = cycles; cycles += 4; executed++; BIT(RD(0x046E));
+    // 843B  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 1; EXIT(0x8440); }
+    EXIT(0x843D);
+}
+
+static int block_843D(espnes_context *ctx)
+{
+    BEGIN;
+    // 843D  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x05A3); NZ(a);
+    EXIT(0x8440);
+}
+
+static int block_8440(espnes_context *ctx)
+{
+    BEGIN;
+    // 8440  SBC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x8A40 + x); cycles += PAGE_CROSSED(0x8A40, ea); SBC(RD(ea));
+    IO_EXIT(0x8443);
+    // 8443  BCS
+    start = cycles; cycles += 2; executed++; if (p & F_C) { cycles += 1; EXIT(0x8448); }
+    EXIT(0x8445);
+}
+
+static int block_8445(espnes_context *ctx)
+{
+    BEGIN;
+    // 8445  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xAC48); NZ(a);
+    IO_EXIT(0x8448);
+    EXIT(0x8448);
+}
+
+static int block_8448(espnes_context *ctx)
+{
+    BEGIN;
+    // 8448  LDX
+    start = cycles; cycles += 2; executed++; x = 0x27; NZ(x);
+    // 844A  LDA
+    start = cycles; cycles += 2; executed++; a = 0x4B; NZ(a);
+    // 844C  STA
+    start = cycles; cycles += 3; executed++; WR(0x71, a);
+    // 844E  LDA
+    start = cycles; cycles += 2; executed++; a = 0x06; NZ(a);
+    // 8450  STA
+    start = cycles; cycles += 3; executed++; WR(0x72, a);
+    // 8452  AND
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x4A + x); a &= RD(ea); NZ(a);
+    IO_EXIT(0x8454);
+    // 8454  LDA
+    start = cycles; cycles += 3; executed++; a = RD(0x0A); NZ(a);
+    // 8456  BEQ
+    start = cycles; cycles += 2; executed++; if (p & F_Z) { cycles += 1; EXIT(0x845B); }
+    EXIT(0x8458);
+}
+
+static int block_8458(espnes_context *ctx)
+{
+    BEGIN;
+    // 8458  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0692); NZ(a);
+    EXIT(0x845B);
+}
+
+static int block_845B(espnes_context *ctx)
+{
+    BEGIN;
+    // 845B  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xAC + x); a ^= RD(ea); NZ(a);
+    // 845D  TYA
+    start = cycles; cycles += 2; executed++; a = y; NZ(a);
+    // 845E  SBC
+    start = cycles; cycles += 4; executed++; SBC(RD(0xACAD));
+    IO_EXIT(0x8461);
+    // 8461  ROL
+    start = cycles; cycles += 2; executed++; ROL(a);
+    // 8462  CPY
+    start = cycles; cycles += 4; executed++; CMP(y, RD(0xF74D));
+    IO_EXIT(0x8465);
+    // 8465  LDY
+    start = cycles; cycles += 4; executed++; y = RD(0xF239); NZ(y);
+    IO_EXIT(0x8468);
+    // 8468  LDX
+    start = cycles; cycles += 2; executed++; x = 0x5E; NZ(x);
+    // 846A  LDA
+    start = cycles; cycles += 2; executed++; a = 0xD1; NZ(a);
+    // 846C  STA
+    start = cycles; cycles += 3; executed++; WR(0x02, a);
+    // 846E  LDA
+    start = cycles; cycles += 2; executed++; a = 0xF8; NZ(a);
+    // 8470  STA
+    start = cycles; cycles += 3; executed++; WR(0x03, a);
+    // 8472  ORA
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0xA4 + x); a |= RD(ea); NZ(a);
+    IO_EXIT(0x8474);
+    // 8474  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0557); NZ(a);
+    // 8477  CMP
+    start = cycles; cycles += 4; executed++; CMP(a, RD(0x0585));
+    // 847A  DEC
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x1D + x); t = RD(ea); t--; NZ(t); WR(ea, t);
+    // 847C  AND
+    start = cycles; cycles += 4; executed++; a &= RD(0x06E1); NZ(a);
+    // 847F  SBC
+    start = cycles; cycles += 3; executed++; SBC(RD(0xD5));
+    // 8481  BEQ
+    start = cycles; cycles += 2; executed++; if (p & F_Z) { cycles += 1; EXIT(0x8486); }
+    EXIT(0x8483);
+}
+
+static int block_8483(espnes_context *ctx)
+{
+    BEGIN;
+    // 8483  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xA46D); NZ(a);
+    IO_EXIT(0x8486);
+    EXIT(0x8486);
+}
+
+static int block_8486(espnes_context *ctx)
+{
+    BEGIN;
+    // 8486  LDA
+    start = cycles; cycles += 2; executed++; a = 0x7A; NZ(a);
+    // 8488  STA
+    start = cycles; cycles += 3; executed++; WR(0x7B, a);
+    // 848A  LDA
+    start = cycles; cycles += 2; executed++; a = 0xD8; NZ(a);
+    // 848C  STA
+    start = cycles; cycles += 3; executed++; WR(0x7C, a);
+    // 848E  SBC
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x7B); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); SBC(RD(ea));
+    IO_EXIT(0x8490);
+    // 8490  SED
+    start = cycles; cycles += 2; executed++; SETF(F_D, 1);
+    // 8491  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x02F0 + x); cycles += PAGE_CROSSED(0x02F0, ea); ADC(RD(ea));
+    // 8494  BCS
+    start = cycles; cycles += 2; executed++; if (p & F_C) { cycles += 1; EXIT(0x8499); }
+    EXIT(0x8496);
+}
+
+static int block_8496(espnes_context *ctx)
+{
+    BEGIN;
+    // 8496  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0198); NZ(a);
+    EXIT(0x8499);
+}
+
+static int block_8499(espnes_context *ctx)
+{
+    BEGIN;
+    // 8499  AND
+    start = cycles; cycles += 2; executed++; a &= 0xE3; NZ(a);
+    // 849B  ORA
+    start = cycles; cycles += 4; executed++; a |= RD(0xA446); NZ(a);
+    IO_EXIT(0x849E);
+    // 849E  INX
+    start = cycles; cycles += 2; executed++; x++; NZ(x);
+    // 849F  STX
+    start = cycles; cycles += 3; executed++; WR(0xBA, x);
+    // 84A1  LDX
+    start = cycles; cycles += 2; executed++; x = 0x07; NZ(x);
+    // 84A3  LDA
+    start = cycles; cycles += 2; executed++; a = 0x54; NZ(a);
+    // 84A5  STA
+    start = cycles; cycles += 3; executed++; WR(0x4D, a);
+    // 84A7  LDA
+    start = cycles; cycles += 2; executed++; a = 0x00; NZ(a);
+    // 84A9  STA
+    start = cycles; cycles += 3; executed++; WR(0x4E, a);
+    // 84AB  LDA
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x46 + x); a = RD(ea); NZ(a);
+    IO_EXIT(0x84AD);
+    // 84AD  BMI
+    start = cycles; cycles += 2; executed++; if (p & F_N) { cycles += 1; EXIT(0x84B2); }
+    EXIT(0x84AF);
+}
+
+static int block_84AF(espnes_context *ctx)
+{
+    BEGIN;
+    // 84AF  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xAF17); NZ(a);
+    IO_EXIT(0x84B2);
+    EXIT(0x84B2);
+}
+
+static int block_84B2(espnes_context *ctx)
+{
+    BEGIN;
+    // 84B2  PLA
+    start = cycles; cycles += 4; executed++; a = PULL(); NZ(a);
+    // 84B3  TYA
+    start = cycles; cycles += 2; executed++; a = y; NZ(a);
+    // 84B4  CMP
+    start = cycles; cycles += 2; executed++; CMP(a, 0xC4);
+    // 84B6  EOR
+    start = cycles; cycles += 4; executed++; a ^= RD(0xC303); NZ(a);
+    IO_EXIT(0x84B9);
+    // 84B9  LDY
+    start = cycles; cycles += 4; executed++; y = RD(0x0115); NZ(y);
+    // 84BC  ROL
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x0506 + x); t = RD(ea); ROL(t); WR(ea, t);
+    // 84BF  BEQ
+    start = cycles; cycles += 2; executed++; if (p & F_Z) { cycles += 1; EXIT(0x84C4); }
+    EXIT(0x84C1);
+}
+
+static int block_84C1(espnes_context *ctx)
+{
+    BEGIN;
+    // 84C1  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xDC01); NZ(a);
+    IO_EXIT(0x84C4);
+    EXIT(0x84C4);
+}
+
+static int block_84C4(espnes_context *ctx)
+{
+    BEGIN;
+    // 84C4  CPY
+    start = cycles; cycles += 4; executed++; CMP(y, RD(0x985E));
+    IO_EXIT(0x84C7);
+    // 84C7  BVC
+    start = cycles; cycles += 2; executed++; if (!(p & F_V)) { cycles += 1; EXIT(0x84CC); }
+    EXIT(0x84C9);
+}
+
+static int block_84C9(espnes_context *ctx)
+{
+    BEGIN;
+    // 84C9  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xCBEF); NZ(a);
+    IO_EXIT(0x84CC);
+    EXIT(0x84CC);
+}
+
+static int block_84CC(espnes_context *ctx)
+{
+    BEGIN;
+    // 84CC  CPY
+    start = cycles; cycles += 4; executed++; CMP(y, RD(0xB510));
+    IO_EXIT(0x84CF);
+    // 84CF  LDX
+    start = cycles; cycles += 2; executed++; x = 0xA3; NZ(x);
+    // 84D1  LDA
+    start = cycles; cycles += 2; executed++; a = 0xC5; NZ(a);
+    // 84D3  STA
+    start = cycles; cycles += 3; executed++; WR(0xBE, a);
+    // 84D5  LDA
+    start = cycles; cycles += 2; executed++; a = 0xF5; NZ(a);
+    // 84D7  STA
+    start = cycles; cycles += 3; executed++; WR(0xBF, a);
+    // 84D9  CMP
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x1B + x); CMP(a, RD(ea));
+    IO_EXIT(0x84DB);
+    // 84DB  ROL
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x07 + x); t = RD(ea); ROL(t); WR(ea, t);
+    // 84DD  INY
+    start = cycles; cycles += 2; executed++; y++; NZ(y);
+    // 84DE  LSR
+    start = cycles; cycles += 6; executed++; t = RD(0x0537); LSR(t); WR(0x0537, t);
+    // 84E1  DEC
+    start = cycles; cycles += 6; executed++; t = RD(0x03B0); t--; NZ(t); WR(0x03B0, t);
+    // 84E4  BEQ
+    start = cycles; cycles += 2; executed++; if (p & F_Z) { cycles += 1; EXIT(0x84E9); }
+    EXIT(0x84E6);
+}
+
+static int block_84E6(espnes_context *ctx)
+{
+    BEGIN;
+    // 84E6  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0267); NZ(a);
+    EXIT(0x84E9);
+}
+
+static int block_84E9(espnes_context *ctx)
+{
+    BEGIN;
+    // 84E9  DEC
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0xA3 + x); t = RD(ea); t--; NZ(t); WR(ea, t);
+    // 84EB  AND
+    start = cycles; cycles += 4; executed++; a &= RD(0x8075); NZ(a);
+    IO_EXIT(0x84EE);
+    // 84EE  ROL
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x046C + x); t = RD(ea); ROL(t); WR(ea, t);
+    // 84F1  PHP
+    start = cycles; cycles += 3; executed++; PUSH(p | F_B | F_U);
+    // 84F2  AND
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x02AB + y); cycles += PAGE_CROSSED(0x02AB, ea); a &= RD(ea); NZ(a);
+    // 84F5  STX
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xA6 + y); WR(ea, x);
+    // 84F7  LDY
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x98 + x); y = RD(ea); NZ(y);
+    // 84F9  PLA
+    start = cycles; cycles += 4; executed++; a = PULL(); NZ(a);
+    // 84FA  SBC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xFB07 + x); cycles += PAGE_CROSSED(0xFB07, ea); SBC(RD(ea));
+    IO_EXIT(0x84FD);
+    // 84FD  BIT
+    start = cycles; cycles += 4; executed++; BIT(RD(0x0137));
+    // 8500  STY
+    start = cycles; cycles += 4; executed++; WR(0x03E8, y);
+    // 8503  INC
+    start = cycles; cycles += 6; executed++; t = RD(0x0591); t++; NZ(t); WR(0x0591, t);
+    // 8506  BPL
+    start = cycles; cycles += 2; executed++; if (!(p & F_N)) { cycles += 1; EXIT(0x850B); }
+    EXIT(0x8508);
+}
+
+static int block_8508(espnes_context *ctx)
+{
+    BEGIN;
+    // 8508  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0379); NZ(a);
+    EXIT(0x850B);
+}
+
+static int block_850B(espnes_context *ctx)
+{
+    BEGIN;
+    // 850B  LSR
+    start = cycles; cycles += 2; executed++; LSR(a);
+    // 850C  CMP
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x00F9 + x); cycles += PAGE_CROSSED(0x00F9, ea); CMP(a, RD(ea));
+    // 850F  BMI
+    start = cycles; cycles += 2; executed++; if (p & F_N) { cycles += 1; EXIT(0x8514); }
+    EXIT(0x8511);
+}
+
+static int block_8511(espnes_context *ctx)
+{
+    BEGIN;
+    // 8511  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x031F); NZ(a);
+    EXIT(0x8514);
+}
+
+static int block_8514(espnes_context *ctx)
+{
+    BEGIN;
+    // 8514  ORA
+    start = cycles; cycles += 4; executed++; a |= RD(0x0509); NZ(a);
+    // 8517  ORA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xDED8 + x); cycles += PAGE_CROSSED(0xDED8, ea); a |= RD(ea); NZ(a);
+    IO_EXIT(0x851A);
+    // 851A  BVC
+    start = cycles; cycles += 2; executed++; if (!(p & F_V)) { cycles += 1; EXIT(0x851F); }
+    EXIT(0x851C);
+}
+
+static int block_851C(espnes_context *ctx)
+{
+    BEGIN;
+    // 851C  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0251); NZ(a);
+    EXIT(0x851F);
+}
+
+static int block_851F(espnes_context *ctx)
+{
+    BEGIN;
+    // 851F  AND
+    start = cycles; cycles += 4; executed++; a &= RD(0xEA19); NZ(a);
+    IO_EXIT(0x8522);
+    // 8522  LSR
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x96 + x); t = RD(ea); LSR(t); WR(ea, t);
+    // 8524  ROL
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x0641 + x); t = RD(ea); ROL(t); WR(ea, t);
+    // 8527  LDX
+    start = cycles; cycles += 2; executed++; x = 0x56; NZ(x);
+    // 8529  LDA
+    start = cycles; cycles += 2; executed++; a = 0x09; NZ(a);
+    // 852B  STA
+    start = cycles; cycles += 3; executed++; WR(0x4E, a);
+    // 852D  LDA
+    start = cycles; cycles += 2; executed++; a = 0x01; NZ(a);
+    // 852F  STA
+    start = cycles; cycles += 3; executed++; WR(0x4F, a);
+    // 8531  AND
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0xF8 + x); a &= RD(ea); NZ(a);
+    IO_EXIT(0x8533);
+    // 8533  CPX
+    start = cycles; cycles += 4; executed++; CMP(x, RD(0x80C7));
+    IO_EXIT(0x8536);
+    // 8536  ADC
+    start = cycles; cycles += 2; executed++; ADC(0x0A);
+    // 8538  STA
+    start = cycles; cycles += 3; executed++; WR(0x3C, a);
+    // 853A  LDX
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x9935 + y); cycles += PAGE_CROSSED(0x9935, ea); x = RD(ea); NZ(x);
+    IO_EXIT(0x853D);
+    // 853D  ORA
+    start = cycles; cycles += 4; executed++; a |= RD(0xCB1F); NZ(a);
+    IO_EXIT(0x8540);
+    // 8540  CMP
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xCA31 + y); cycles += PAGE_CROSSED(0xCA31, ea); CMP(a, RD(ea));
+    IO_EXIT(0x8543);
+    // 8543  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xC62C + y); cycles += PAGE_CROSSED(0xC62C, ea); ADC(RD(ea));
+    IO_EXIT(0x8546);
+    // 8546  BVC
+    start = cycles; cycles += 2; executed++; if (!(p & F_V)) { cycles += 1; EXIT(0x854B); }
+    EXIT(0x8548);
+}
+
+static int block_8548(espnes_context *ctx)
+{
+    BEGIN;
+    // 8548  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0648); NZ(a);
+    EXIT(0x854B);
+}
+
+static int block_854B(espnes_context *ctx)
+{
+    BEGIN;
+    // 854B  CPY
+    start = cycles; cycles += 4; executed++; CMP(y, RD(0xF828));
+    IO_EXIT(0x854E);
+    // 854E  LDA
+    start = cycles; cycles += 2; executed++; a = 0x36; NZ(a);
+    // 8550  STA
+    start = cycles; cycles += 3; executed++; WR(0x1A, a);
+    // 8552  LDA
+    start = cycles; cycles += 2; executed++; a = 0x03; NZ(a);
+    // 8554  STA
+    start = cycles; cycles += 3; executed++; WR(0x1B, a);
+    // 8556  SBC
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x1A); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); SBC(RD(ea));
+    IO_EXIT(0x8558);
+    // 8558  PHA
+    start = cycles; cycles += 3; executed++; PUSH(a);
+    // 8559  CMP
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x81A4 + y); cycles += PAGE_CROSSED(0x81A4, ea); CMP(a, RD(ea));
+    IO_EXIT(0x855C);
+    // 855C  BMI
+    start = cycles; cycles += 2; executed++; if (p & F_N) { cycles += 1; EXIT(0x8561); }
+    EXIT(0x855E);
+}
+
+static int block_855E(espnes_context *ctx)
+{
+    BEGIN;
+    // 855E  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x06BB); NZ(a);
+    EXIT(0x8561);
+}
+
+static int block_8561(espnes_context *ctx)
+{
+    BEGIN;
+    // 8561  ROR
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x00BB + x); t = RD(ea); ROR(t); WR(ea, t);
+    // 8564  ASL
+    start = cycles; cycles += 2; executed++; ASL(a);
+    // 8565  LDA
+    start = cycles; cycles += 2; executed++; a = 0x78; NZ(a);
+    // 8567  STA
+    start = cycles; cycles += 3; executed++; WR(0xC4, a);
+    // 8569  LDA
+    start = cycles; cycles += 2; executed++; a = 0x9E; NZ(a);
+    // 856B  STA
+    start = cycles; cycles += 3; executed++; WR(0xC5, a);
+    // 856D  EOR
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0xC4); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a ^= RD(ea); NZ(a);
+    IO_EXIT(0x856F);
+    // 856F  ROL
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x066F + x); t = RD(ea); ROL(t); WR(ea, t);
+    // 8572  STX
+    start = cycles; cycles += 3; executed++; WR(0xEA, x);
+    // 8574  ROL
+    start = cycles; cycles += 2; executed++; ROL(a);
+    // 8575  CMP
+    start = cycles; cycles += 3; executed++; CMP(a, RD(0xCD));
+    // 8577  BCS
+    start = cycles; cycles += 2; executed++; if (p & F_C) { cycles += 1; EXIT(0x857C); }
+    EXIT(0x8579);
+}
+
+static int block_8579(espnes_context *ctx)
+{
+    BEGIN;
+    // 8579  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0396); NZ(a);
+    EXIT(0x857C);
+}
+
+static int block_857C(espnes_context *ctx)
+{
+    BEGIN;
+    // 857C  INX
+    start = cycles; cycles += 2; executed++; x++; NZ(x);
+    // 857D  ROR
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x9E + x); t = RD(ea); ROR(t); WR(ea, t);
+    // 857F  LDA
+    start = cycles; cycles += 2; executed++; a = 0x9E; NZ(a);
+    // 8581  STA
+    start = cycles; cycles += 3; executed++; WR(0x22, a);
+    // 8583  LDA
+    start = cycles; cycles += 2; executed++; a = 0xCB; NZ(a);
+    // 8585  STA
+    start = cycles; cycles += 3; executed++; WR(0x23, a);
+    // 8587  AND
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x22); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a &= RD(ea); NZ(a);
+    IO_EXIT(0x8589);
+    // 8589  ROR
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x06AF + x); t = RD(ea); ROR(t); WR(ea, t);
+    // 858C  ROL
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x0537 + x); t = RD(ea); ROL(t); WR(ea, t);
+    // 858F  BVS
+    start = cycles; cycles += 2; executed++; if (p & F_V) { cycles += 1; EXIT(0x8594); }
+    EXIT(0x8591);
+}
+
+static int block_8591(espnes_context *ctx)
+{
+    BEGIN;
+    // 8591  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x02E4); NZ(a);
+    EXIT(0x8594);
+}
+
+static int block_8594(espnes_context *ctx)
+{
+    BEGIN;
+    // 8594  LDY
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x9C + x); y = RD(ea); NZ(y);
+    // 8596  LDX
+    start = cycles; cycles += 2; executed++; x = 0xD0; NZ(x);
+    // 8598  DEC
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0xF0 + x); t = RD(ea); t--; NZ(t); WR(ea, t);
+    // 859A  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xBF79 + y); cycles += PAGE_CROSSED(0xBF79, ea); ADC(RD(ea));
+    IO_EXIT(0x859D);
+    // 859D  BVS
+    start = cycles; cycles += 2; executed++; if (p & F_V) { cycles += 1; EXIT(0x85A2); }
+    EXIT(0x859F);
+}
+
+static int block_859F(espnes_context *ctx)
+{
+    BEGIN;
+    // 859F  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0016); NZ(a);
+    EXIT(0x85A2);
+}
+
+static int block_85A2(espnes_context *ctx)
+{
+    BEGIN;
+    // 85A2  STA
+    start = cycles; cycles += 5; executed++; ea = (uint16_t)(0x0304 + y); WR(ea, a);
+    // 85A5  LDY
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xEB + x); y = RD(ea); NZ(y);
+    // 85A7  LDX
+    start = cycles; cycles += 2; executed++; x = 0x8C; NZ(x);
+    // 85A9  LDA
+    start = cycles; cycles += 2; executed++; a = 0x9D; NZ(a);
+    // 85AB  STA
+    start = cycles; cycles += 3; executed++; WR(0xD5, a);
+    // 85AD  LDA
+    start = cycles; cycles += 2; executed++; a = 0x80; NZ(a);
+    // 85AF  STA
+    start = cycles; cycles += 3; executed++; WR(0xD6, a);
+    // 85B1  ORA
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x49 + x); a |= RD(ea); NZ(a);
+    IO_EXIT(0x85B3);
+    // 85B3  LDX
+    start = cycles; cycles += 2; executed++; x = 0x5B; NZ(x);
+    // 85B5  LDA
+    start = cycles; cycles += 2; executed++; a = 0x84; NZ(a);
+    // 85B7  STA
+    start = cycles; cycles += 3; executed++; WR(0x62, a);
+    // 85B9  LDA
+    start = cycles; cycles += 2; executed++; a = 0x00; NZ(a);
+    // 85BB  STA
+    start = cycles; cycles += 3; executed++; WR(0x63, a);
+    // 85BD  SBC
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x07 + x); SBC(RD(ea));
+    IO_EXIT(0x85BF);
+    // 85BF  ROL
+    start = cycles; cycles += 5; executed++; t = RD(0x65); ROL(t); WR(0x65, t);
+    // 85C1  BIT
+    start = cycles; cycles += 3; executed++; BIT(RD(0x29));
+    // 85C3  LDX
+    start = cycles; cycles += 2; executed++; x = 0xB8; NZ(x);
+    // 85C5  LDA
+    start = cycles; cycles += 2; executed++; a = 0xB4; NZ(a);
+    // 85C7  STA
+    start = cycles; cycles += 3; executed++; WR(0x9C, a);
+    // 85C9  LDA
+    start = cycles; cycles += 2; executed++; a = 0x04; NZ(a);
+    // 85CB  STA
+    start = cycles; cycles += 3; executed++; WR(0x9D, a);
+    // 85CD  SBC
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0xE4 + x); SBC(RD(ea));
+    IO_EXIT(0x85CF);
+    // 85CF  BVS
+    start = cycles; cycles += 2; executed++; if (p & F_V) { cycles += 1; EXIT(0x85D4); }
+    EXIT(0x85D1);
+}
+
+static int block_85D1(espnes_context *ctx)
+{
+    BEGIN;
+    // 85D1  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x9D44); NZ(a);
+    IO_EXIT(0x85D4);
+    EXIT(0x85D4);
+}
+
+static int block_85D4(espnes_context *ctx)
+{
+    BEGIN;
+    // 85D4  PHA
+    start = cycles; cycles += 3; executed++; PUSH(a);
+    // 85D5  ASL
+    start = cycles; cycles += 2; executed++; ASL(a);
+    // 85D6  SEC
+    start = cycles; cycles += 2; executed++; SETF(F_C, 1);
+    // 85D7  CLC
+    start = cycles; cycles += 2; executed++; SETF(F_C, 0);
+    // 85D8  PHP
+    start = cycles; cycles += 3; executed++; PUSH(p | F_B | F_U);
+    // 85D9  LDA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0274 + y); cycles += PAGE_CROSSED(0x0274, ea); a = RD(ea); NZ(a);
+    // 85DC  DEC
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x4B + x); t = RD(ea); t--; NZ(t); WR(ea, t);
+    // 85DE  STY
+    start = cycles; cycles += 3; executed++; WR(0x57, y);
+    // 85E0  ROR
+    start = cycles; cycles += 5; executed++; t = RD(0xC7); ROR(t); WR(0xC7, t);
+    // 85E2  AND
+    start = cycles; cycles += 3; executed++; a &= RD(0xCE); NZ(a);
+    // 85E4  ORA
+    start = cycles; cycles += 2; executed++; a |= 0x79; NZ(a);
+    // 85E6  DEY
+    start = cycles; cycles += 2; executed++; y--; NZ(y);
+    // 85E7  BPL
+    start = cycles; cycles += 2; executed++; if (!(p & F_N)) { cycles += 1; EXIT(0x85EC); }
+    EXIT(0x85E9);
+}
+
+static int block_85E9(espnes_context *ctx)
+{
+    BEGIN;
+    // 85E9  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xF68D); NZ(a);
+    IO_EXIT(0x85EC);
+    EXIT(0x85EC);
+}
+
+static int block_85EC(espnes_context *ctx)
+{
+    BEGIN;
+    // 85EC  ROL
+    start = cycles; cycles += 6; executed++; t = RD(0x0036); ROL(t); WR(0x0036, t);
+    // 85EF  ADC
+    start = cycles; cycles += 2; executed++; ADC(0x6A);
+    // 85F1  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xAF + x); ADC(RD(ea));
+    // 85F3  PLA
+    start = cycles; cycles += 4; executed++; a = PULL(); NZ(a);
+    // 85F4  NOP
+    start = cycles; cycles += 2; executed++; 
+    // 85F5  CPX
+    start = cycles; cycles += 2; executed++; CMP(x, 0x82);
+    // 85F7  LDY
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xB465 + x); cycles += PAGE_CROSSED(0xB465, ea); y = RD(ea); NZ(y);
+    IO_EXIT(0x85FA);
+    // 85FA  BMI
+    start = cycles; cycles += 2; executed++; if (p & F_N) { cycles += 1; EXIT(0x85FF); }
+    EXIT(0x85FC);
+}
+
+static int block_85FC(espnes_context *ctx)
+{
+    BEGIN;
+    // 85FC  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xA2B4); NZ(a);
+    IO_EXIT(0x85FF);
+    EXIT(0x85FF);
+}
+
+static int block_85FF(espnes_context *ctx)
+{
+    BEGIN;
+    // 85FF  ASL
+    start = cycles; cycles += 5; executed++; t = RD(0x56); ASL(t); WR(0x56, t);
+    // 8601  AND
+    start = cycles; cycles += 2; executed++; a &= 0x8F; NZ(a);
+    // 8603  LDX
+    start = cycles; cycles += 4; executed++; x = RD(0x0552); NZ(x);
+    // 8606  BVS
+    start = cycles; cycles += 2; executed++; if (p & F_V) { cycles += 1; EXIT(0x860B); }
+    EXIT(0x8608);
+}
+
+static int block_8608(espnes_context *ctx)
+{
+    BEGIN;
+    // 8608  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0171); NZ(a);
+    EXIT(0x860B);
+}
+
+static int block_860B(espnes_context *ctx)
+{
+    BEGIN;
+    // 860B  STX
+    start = cycles; cycles += 3; executed++; WR(0xAE, x);
+    // 860D  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 1; EXIT(0x8612); }
+    EXIT(0x860F);
+}
+
+static int block_860F(espnes_context *ctx)
+{
+    BEGIN;
+    // 860F  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xA0C4); NZ(a);
+    IO_EXIT(0x8612);
+    EXIT(0x8612);
+}
+
+static int block_8612(espnes_context *ctx)
+{
+    BEGIN;
+    // 8612  DEY
+    start = cycles; cycles += 2; executed++; y--; NZ(y);
+    // 8613  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x06D2 + y); cycles += PAGE_CROSSED(0x06D2, ea); a ^= RD(ea); NZ(a);
+    // 8616  BVS
+    start = cycles; cycles += 2; executed++; if (p & F_V) { cycles += 1; EXIT(0x861B); }
+    EXIT(0x8618);
+}
+
+static int block_8618(espnes_context *ctx)
+{
+    BEGIN;
+    // 8618  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x92FC); NZ(a);
+    IO_EXIT(0x861B);
+    EXIT(0x861B);
+}
+
+static int block_861B(espnes_context *ctx)
+{
+    BEGIN;
+    // 861B  CLC
+    start = cycles; cycles += 2; executed++; SETF(F_C, 0);
+    // 861C  STY
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xF8 + x); WR(ea, y);
+    // 861E  LSR
+    start = cycles; cycles += 5; executed++; t = RD(0xAD); LSR(t); WR(0xAD, t);
+    // 8620  SBC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0476 + x); cycles += PAGE_CROSSED(0x0476, ea); SBC(RD(ea));
+    // 8623  CPY
+    start = cycles; cycles += 3; executed++; CMP(y, RD(0x76));
+    // 8625  SEI
+    start = cycles; cycles += 2; executed++; SETF(F_I, 1);
+    // 8626  CMP
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0116 + y); cycles += PAGE_CROSSED(0x0116, ea); CMP(a, RD(ea));
+    // 8629  ROL
+    start = cycles; cycles += 2; executed++; ROL(a);
+    // 862A  ORA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xEEFF + x); cycles += PAGE_CROSSED(0xEEFF, ea); a |= RD(ea); NZ(a);
+    IO_EXIT(0x862D);
+    // 862D  STA
+    start = cycles; cycles += 4; executed++; WR(0x0278, a);
+    // 8630  BVS
+    start = cycles; cycles += 2; executed++; if (p & F_V) { cycles += 1; EXIT(0x8635); }
+    EXIT(0x8632);
+}
+
+static int block_8632(espnes_context *ctx)
+{
+    BEGIN;
+    // 8632  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xE653); NZ(a);
+    IO_EXIT(0x8635);
+    EXIT(0x8635);
+}
+
+static int block_8635(espnes_context *ctx)
+{
+    BEGIN;
+    // 8635  DEC
+    start = cycles; cycles += 5; executed++; t = RD(0x14); t--; NZ(t); WR(0x14, t);
+    // 8637  SBC
+    start = cycles; cycles += 3; executed++; SBC(RD(0xC7));
+    // 8639  INC
+    start = cycles; cycles += 5; executed++; t = RD(0x82); t++; NZ(t); WR(0x82, t);
+    // 863B  TYA
+    start = cycles; cycles += 2; executed++; a = y; NZ(a);
+    // 863C  LDA
+    start = cycles; cycles += 2; executed++; a = 0x4A; NZ(a);
+    // 863E  STA
+    start = cycles; cycles += 3; executed++; WR(0xE7, a);
+    // 8640  LDA
+    start = cycles; cycles += 2; executed++; a = 0x03; NZ(a);
+    // 8642  STA
+    start = cycles; cycles += 3; executed++; WR(0xE8, a);
+    // 8644  SBC
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0xE7); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); SBC(RD(ea));
+    IO_EXIT(0x8646);
+    // 8646  ORA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xA4BD + x); cycles += PAGE_CROSSED(0xA4BD, ea); a |= RD(ea); NZ(a);
+    IO_EXIT(0x8649);
+    // 8649  TXS
+    start = cycles; cycles += 2; executed++; sp = x;
+    // 864A  CMP
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x06E3 + x); cycles += PAGE_CROSSED(0x06E3, ea); CMP(a, RD(ea));
+    // 864D  LDX
+    start = cycles; cycles += 2; executed++; x = 0xEF; NZ(x);
+    // 864F  LDA
+    start = cycles; cycles += 2; executed++; a = 0x67; NZ(a);
+    // 8651  STA
+    start = cycles; cycles += 3; executed++; WR(0x00, a);
+    // 8653  LDA
+    start = cycles; cycles += 2; executed++; a = 0x8E; NZ(a);
+    // 8655  STA
+    start = cycles; cycles += 3; executed++; WR(0x01, a);
+    // 8657  EOR
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x11 + x); a ^= RD(ea); NZ(a);
+    IO_EXIT(0x8659);
+    // 8659  BPL
+    start = cycles; cycles += 2; executed++; if (!(p & F_N)) { cycles += 1; EXIT(0x865E); }
+    EXIT(0x865B);
+}
+
+static int block_865B(espnes_context *ctx)
+{
+    BEGIN;
+    // 865B  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0580); NZ(a);
+    EXIT(0x865E);
+}
+
+static int block_865E(espnes_context *ctx)
+{
+    BEGIN;
+    // 865E  ROL
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x48 + x); t = RD(ea); ROL(t); WR(ea, t);
+    // 8660  LDY
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xBC + x); y = RD(ea); NZ(y);
+    // 8662  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x7C + x); ADC(RD(ea));
+    // 8664  TXS
+    start = cycles; cycles += 2; executed++; sp = x;
+    // 8665  BVC
+    start = cycles; cycles += 2; executed++; if (!(p & F_V)) { cycles += 1; EXIT(0x866A); }
+    EXIT(0x8667);
+}
+
+static int block_8667(espnes_context *ctx)
+{
+    BEGIN;
+    // 8667  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xE2FF); NZ(a);
+    IO_EXIT(0x866A);
+    EXIT(0x866A);
+}
+
+static int block_866A(espnes_context *ctx)
+{
+    BEGIN;
+    // 866A  ROL
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x81 + x); t = RD(ea); ROL(t); WR(ea, t);
+    // 866C  TXS
+    start = cycles; cycles += 2; executed++; sp = x;
+    // 866D  ORA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0230 + x); cycles += PAGE_CROSSED(0x0230, ea); a |= RD(ea); NZ(a);
+    // 8670  ROR
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x0D + x); t = RD(ea); ROR(t); WR(ea, t);
+    // 8672  ORA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0491 + x); cycles += PAGE_CROSSED(0x0491, ea); a |= RD(ea); NZ(a);
+    // 8675  STA
+    start = cycles; cycles += 4; executed++; WR(0x01CA, a);
+    // 8678  DEC
+    start = cycles; cycles += 5; executed++; t = RD(0xF2); t--; NZ(t); WR(0xF2, t);
+    // 867A  LSR
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x05FD + x); t = RD(ea); LSR(t); WR(ea, t);
+    // 867D  CLD
+    start = cycles; cycles += 2; executed++; SETF(F_D, 0);
+    // 867E  BVC
+    start = cycles; cycles += 2; executed++; if (!(p & F_V)) { cycles += 1; EXIT(0x8683); }
+    EXIT(0x8680);
+}
+
+static int block_8680(espnes_context *ctx)
+{
+    BEGIN;
+    // 8680  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x00D2); NZ(a);
+    EXIT(0x8683);
+}
+
+static int block_8683(espnes_context *ctx)
+{
+    BEGIN;
+    // 8683  CMP
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xCB70 + y); cycles += PAGE_CROSSED(0xCB70, ea); CMP(a, RD(ea));
+    IO_EXIT(0x8686);
+    // 8686  BVC
+    start = cycles; cycles += 2; executed++; if (!(p & F_V)) { cycles += 1; EXIT(0x868B); }
+    EXIT(0x8688);
+}
+
+static int block_8688(espnes_context *ctx)
+{
+    BEGIN;
+    // 8688  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xCFCE); NZ(a);
+    IO_EXIT(0x868B);
+    EXIT(0x868B);
+}
+
+static int block_868B(espnes_context *ctx)
+{
+    BEGIN;
+    // 868B  LDX
+    start = cycles; cycles += 2; executed++; x = 0x2F; NZ(x);
+    // 868D  LDA
+    start = cycles; cycles += 2; executed++; a = 0xF2; NZ(a);
+    // 868F  STA
+    start = cycles; cycles += 3; executed++; WR(0x20, a);
+    // 8691  LDA
+    start = cycles; cycles += 2; executed++; a = 0x87; NZ(a);
+    // 8693  STA
+    start = cycles; cycles += 3; executed++; WR(0x21, a);
+    // 8695  AND
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0xF1 + x); a &= RD(ea); NZ(a);
+    IO_EXIT(0x8697);
+    // 8697  ROL
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0xF1 + x); t = RD(ea); ROL(t); WR(ea, t);
+    // 8699  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x01BA + y); cycles += PAGE_CROSSED(0x01BA, ea); a ^= RD(ea); NZ(a);
+    // 869C  LDX
+    start = cycles; cycles += 2; executed++; x = 0x2A; NZ(x);
+    // 869E  LDA
+    start = cycles; cycles += 2; executed++; a = 0x1D; NZ(a);
+    // 86A0  STA
+    start = cycles; cycles += 3; executed++; WR(0x31, a);
+    // 86A2  LDA
+    start = cycles; cycles += 2; executed++; a = 0x94; NZ(a);
+    // 86A4  STA
+    start = cycles; cycles += 3; executed++; WR(0x32, a);
+    // 86A6  LDA
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x07 + x); a = RD(ea); NZ(a);
+    IO_EXIT(0x86A8);
+    // 86A8  CPX
+    start = cycles; cycles += 2; executed++; CMP(x, 0x63);
+    // 86AA  AND
+    start = cycles; cycles += 4; executed++; a &= RD(0x03BD); NZ(a);
+    // 86AD  CPX
+    start = cycles; cycles += 4; executed++; CMP(x, RD(0x0027));
+    // 86B0  EOR
+    start = cycles; cycles += 3; executed++; a ^= RD(0xCE); NZ(a);
+    // 86B2  ROR
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x002D + x); t = RD(ea); ROR(t); WR(ea, t);
+    // 86B5  ROR
+    start = cycles; cycles += 2; executed++; ROR(a);
+    // 86B6  BCC
+    start = cycles; cycles += 2; executed++; if (!(p & F_C)) { cycles += 1; EXIT(0x86BB); }
+    EXIT(0x86B8);
+}
+
+static int block_86B8(espnes_context *ctx)
+{
+    BEGIN;
+    // 86B8  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x00D5); NZ(a);
+    EXIT(0x86BB);
+}
+
+static int block_86BB(espnes_context *ctx)
+{
+    BEGIN;
+    // 86BB  ROL
+    start = cycles; cycles += 5; executed++; t = RD(0x38); ROL(t); WR(0x38, t);
+    // 86BD  AND
+    start = cycles; cycles += 3; executed++; a &= RD(0x0C); NZ(a);
+    // 86BF  INY
+    start = cycles; cycles += 2; executed++; y++; NZ(y);
+    // 86C0  ORA
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x05 + x); a |= RD(ea); NZ(a);
+    // 86C2  SED
+    start = cycles; cycles += 2; executed++; SETF(F_D, 1);
+    // 86C3  BPL
+    start = cycles; cycles += 2; executed++; if (!(p & F_N)) { cycles += 1; EXIT(0x86C8); }
+    EXIT(0x86C5);
+}
+
+static int block_86C5(espnes_context *ctx)
+{
+    BEGIN;
+    // 86C5  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0186); NZ(a);
+    EXIT(0x86C8);
+}
+
+static int block_86C8(espnes_context *ctx)
+{
+    BEGIN;
+    // 86C8  LDX
+    start = cycles; cycles += 2; executed++; x = 0x4E; NZ(x);
+    // 86CA  AND
+    start = cycles; cycles += 4; executed++; a &= RD(0x8D48); NZ(a);
+    IO_EXIT(0x86CD);
+    // 86CD  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x01CE + x); cycles += PAGE_CROSSED(0x01CE, ea); a ^= RD(ea); NZ(a);
+    // 86D0  DEC
+    start = cycles; cycles += 5; executed++; t = RD(0x91); t--; NZ(t); WR(0x91, t);
+    // 86D2  LDA
+    start = cycles; cycles += 2; executed++; a = 0x7E; NZ(a);
+    // 86D4  STA
+    start = cycles; cycles += 3; executed++; WR(0x57, a);
+    // 86D6  LDA
+    start = cycles; cycles += 2; executed++; a = 0x05; NZ(a);
+    // 86D8  STA
+    start = cycles; cycles += 3; executed++; WR(0x58, a);
+    // 86DA  LDA
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x57); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a = RD(ea); NZ(a);
+    IO_EXIT(0x86DC);
+    // 86DC  ORA
+    start = cycles; cycles += 2; executed++; a |= 0x04; NZ(a);
+    // 86DE  NOP
+    start = cycles; cycles += 2; executed++; 
+    // 86DF  SBC
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xC6 + x); SBC(RD(ea));
+    // 86E1  BEQ
+    start = cycles; cycles += 2; executed++; if (p & F_Z) { cycles += 1; EXIT(0x86E6); }
+    EXIT(0x86E3);
+}
+
+static int block_86E3(espnes_context *ctx)
+{
+    BEGIN;
+    // 86E3  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x05AE); NZ(a);
+    EXIT(0x86E6);
+}
+
+static int block_86E6(espnes_context *ctx)
+{
+    BEGIN;
+    // 86E6  ROL
+    start = cycles; cycles += 2; executed++; ROL(a);
+    // 86E7  DEC
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x03C2 + x); t = RD(ea); t--; NZ(t); WR(ea, t);
+    // 86EA  ORA
+    start = cycles; cycles += 2; executed++; a |= 0xCA; NZ(a);
+    // 86EC  BIT
+    start = cycles; cycles += 3; executed++; BIT(RD(0x83));
+    // 86EE  TXS
+    start = cycles; cycles += 2; executed++; sp = x;
+    // 86EF  AND
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x19 + x); a &= RD(ea); NZ(a);
+    // 86F1  SBC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x034E + y); cycles += PAGE_CROSSED(0x034E, ea); SBC(RD(ea));
+    // 86F4  NOP
+    start = cycles; cycles += 2; executed++; 
+    // 86F5  LSR
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x0037 + x); t = RD(ea); LSR(t); WR(ea, t);
+    // 86F8  EOR
+    start = cycles; cycles += 4; executed++; a ^= RD(0x05C6); NZ(a);
+    // 86FB  LDX
+    start = cycles; cycles += 2; executed++; x = 0xAE; NZ(x);
+    // 86FD  LDA
+    start = cycles; cycles += 2; executed++; a = 0xE4; NZ(a);
+    // 86FF  STA
+    start = cycles; cycles += 3; executed++; WR(0xC5, a);
+    // 8701  LDA
+    start = cycles; cycles += 2; executed++; a = 0xCD; NZ(a);
+    // 8703  STA
+    start = cycles; cycles += 3; executed++; WR(0xC6, a);
+    // 8705  AND
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x17 + x); a &= RD(ea); NZ(a);
+    IO_EXIT(0x8707);
+    // 8707  BEQ
+    start = cycles; cycles += 2; executed++; if (p & F_Z) { cycles += 1; EXIT(0x870C); }
+    EXIT(0x8709);
+}
+
+static int block_8709(espnes_context *ctx)
+{
+    BEGIN;
+    // 8709  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x02DD); NZ(a);
+    EXIT(0x870C);
+}
+
+static int block_870C(espnes_context *ctx)
+{
+    BEGIN;
+    // 870C  CMP
+    start = cycles; cycles += 2; executed++; CMP(a, 0xD6);
+    // 870E  CLV
+    start = cycles; cycles += 2; executed++; SETF(F_V, 0);
+    // 870F  DEC
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x0211 + x); t = RD(ea); t--; NZ(t); WR(ea, t);
+    // 8712  BCC
+    start = cycles; cycles += 2; executed++; if (!(p & F_C)) { cycles += 1; EXIT(0x8717); }
+    EXIT(0x8714);
+}
+
+static int block_8714(espnes_context *ctx)
+{
+    BEGIN;
+    // 8714  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x9768); NZ(a);
+    IO_EXIT(0x8717);
+    EXIT(0x8717);
+}
+
+static int block_8717(espnes_context *ctx)
+{
+    BEGIN;
+    // 8717  LDX
+    start = cycles; cycles += 2; executed++; x = 0xCD; NZ(x);
+    // 8719  LDA
+    start = cycles; cycles += 2; executed++; a = 0x6B; NZ(a);
+    // 871B  STA
+    start = cycles; cycles += 3; executed++; WR(0xE4, a);
+    // 871D  LDA
+    start = cycles; cycles += 2; executed++; a = 0x01; NZ(a);
+    // 871F  STA
+    start = cycles; cycles += 3; executed++; WR(0xE5, a);
+    // 8721  AND
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x17 + x); a &= RD(ea); NZ(a);
+    IO_EXIT(0x8723);
+    // 8723  ROL
+    start = cycles; cycles += 5; executed++; t = RD(0xCB); ROL(t); WR(0xCB, t);
+    // 8725  ROR
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x71 + x); t = RD(ea); ROR(t); WR(ea, t);
+    // 8727  ASL
+    start = cycles; cycles += 6; executed++; t = RD(0x00FA); ASL(t); WR(0x00FA, t);
+    // 872A  LDX
+    start = cycles; cycles += 2; executed++; x = 0x91; NZ(x);
+    // 872C  LDA
+    start = cycles; cycles += 2; executed++; a = 0xA9; NZ(a);
+    // 872E  STA
+    start = cycles; cycles += 3; executed++; WR(0xD5, a);
+    // 8730  LDA
+    start = cycles; cycles += 2; executed++; a = 0x89; NZ(a);
+    // 8732  STA
+    start = cycles; cycles += 3; executed++; WR(0xD6, a);
+    // 8734  LDA
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x44 + x); a = RD(ea); NZ(a);
+    IO_EXIT(0x8736);
+    // 8736  BCC
+    start = cycles; cycles += 2; executed++; if (!(p & F_C)) { cycles += 1; EXIT(0x873B); }
+    EXIT(0x8738);
+}
+
+static int block_8738(espnes_context *ctx)
+{
+    BEGIN;
+    // 8738  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x00A9); NZ(a);
+    EXIT(0x873B);
+}
+
+static int block_873B(espnes_context *ctx)
+{
+    BEGIN;
+    // 873B  LDX
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xE86B + y); cycles += PAGE_CROSSED(0xE86B, ea); x = RD(ea); NZ(x);
+    IO_EXIT(0x873E);
+    // 873E  NOP
+    start = cycles; cycles += 2; executed++; 
+    // 873F  LDY
+    start = cycles; cycles += 2; executed++; y = 0x37; NZ(y);
+    // 8741  BCS
+    start = cycles; cycles += 2; executed++; if (p & F_C) { cycles += 1; EXIT(0x8746); }
+    EXIT(0x8743);
+}
+
+static int block_8743(espnes_context *ctx)
+{
+    BEGIN;
+    // 8743  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xC08D); NZ(a);
+    IO_EXIT(0x8746);
+    EXIT(0x8746);
+}
+
+static int block_8746(espnes_context *ctx)
+{
+    BEGIN;
+    // 8746  STX
+    start = cycles; cycles += 3; executed++; WR(0x71, x);
+    // 8748  PHA
+    start = cycles; cycles += 3; executed++; PUSH(a);
+    // 8749  LDA
+    start = cycles; cycles += 2; executed++; a = 0xAB; NZ(a);
+    // 874B  STA
+    start = cycles; cycles += 3; executed++; WR(0xFB, a);
+    // 874D  LDA
+    start = cycles; cycles += 2; executed++; a = 0x06; NZ(a);
+    // 874F  STA
+    start = cycles; cycles += 3; executed++; WR(0xFC, a);
+    // 8751  LDA
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0xFB); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a = RD(ea); NZ(a);
+    IO_EXIT(0x8753);
+    // 8753  PLA
+    start = cycles; cycles += 4; executed++; a = PULL(); NZ(a);
+    // 8754  LDY
+    start = cycles; cycles += 4; executed++; y = RD(0xEAE6); NZ(y);
+    IO_EXIT(0x8757);
+    // 8757  STA
+    start = cycles; cycles += 4; executed++; WR(0x035D, a);
+    // 875A  ASL
+    start = cycles; cycles += 2; executed++; ASL(a);
+    // 875B  ROL
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x0F + x); t = RD(ea); ROL(t); WR(ea, t);
+    // 875D  LDA
+    start = cycles; cycles += 2; executed++; a = 0x0A; NZ(a);
+    // 875F  STA
+    start = cycles; cycles += 3; executed++; WR(0xEA, a);
+    // 8761  LDA
+    start = cycles; cycles += 2; executed++; a = 0x06; NZ(a);
+    // 8763  STA
+    start = cycles; cycles += 3; executed++; WR(0xEB, a);
+    // 8765  ADC
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0xEA); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); ADC(RD(ea));
+    IO_EXIT(0x8767);
+    // 8767  EOR
+    start = cycles; cycles += 2; executed++; a ^= 0x36; NZ(a);
+    // 8769  TAY
+    start = cycles; cycles += 2; executed++; y = a; NZ(y);
+    // 876A  AND
+    start = cycles; cycles += 4; executed++; a &= RD(0x9560); NZ(a);
+    IO_EXIT(0x876D);
+    // 876D  BPL
+    start = cycles; cycles += 2; executed++; if (!(p & F_N)) { cycles += 1; EXIT(0x8772); }
+    EXIT(0x876F);
+}
+
+static int block_876F(espnes_context *ctx)
+{
+    BEGIN;
+    // 876F  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x044B); NZ(a);
+    EXIT(0x8772);
+}
+
+static int block_8772(espnes_context *ctx)
+{
+    BEGIN;
+    // 8772  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x7E + x); ADC(RD(ea));
+    // 8774  BEQ
+    start = cycles; cycles += 2; executed++; if (p & F_Z) { cycles += 1; EXIT(0x8779); }
+    EXIT(0x8776);
+}
+
+static int block_8776(espnes_context *ctx)
+{
+    BEGIN;
+    // 8776  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xE950); NZ(a);
+    IO_EXIT(0x8779);
+    EXIT(0x8779);
+}
+
+static int block_8779(espnes_context *ctx)
+{
+    BEGIN;
+    // 8779  SBC
+    start = cycles; cycles += 3; executed++; SBC(RD(0x75));
+    // 877B  SBC
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x63 + x); SBC(RD(ea));
+    // 877D  INC
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x05BB + x); t = RD(ea); t++; NZ(t); WR(ea, t);
+    // 8780  BPL
+    start = cycles; cycles += 2; executed++; if (!(p & F_N)) { cycles += 1; EXIT(0x8785); }
+    EXIT(0x8782);
+}
+
+static int block_8782(espnes_context *ctx)
+{
+    BEGIN;
+    // 8782  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x001D); NZ(a);
+    EXIT(0x8785);
+}
+
+static int block_8785(espnes_context *ctx)
+{
+    BEGIN;
+    // 8785  ORA
+    start = cycles; cycles += 2; executed++; a |= 0xC0; NZ(a);
+    // 8787  LDA
+    start = cycles; cycles += 2; executed++; a = 0x3E; NZ(a);
+    // 8789  STA
+    start = cycles; cycles += 3; executed++; WR(0x33, a);
+    // 878B  LDA
+    start = cycles; cycles += 2; executed++; a = 0x05; NZ(a);
+    // 878D  STA
+    start = cycles; cycles += 3; executed++; WR(0x34, a);
+    // 878F  LDA
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x33); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a = RD(ea); NZ(a);
+    IO_EXIT(0x8791);
+    // 8791  LDX
+    start = cycles; cycles += 2; executed++; x = 0x21; NZ(x);
+    // 8793  BVC
+    start = cycles; cycles += 2; executed++; if (!(p & F_V)) { cycles += 1; EXIT(0x8798); }
+    EXIT(0x8795);
+}
+
+static int block_8795(espnes_context *ctx)
+{
+    BEGIN;
+    // 8795  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xB757); NZ(a);
+    IO_EXIT(0x8798);
+    EXIT(0x8798);
+}
+
+static int block_8798(espnes_context *ctx)
+{
+    BEGIN;
+    // 8798  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x56 + x); a ^= RD(ea); NZ(a);
+    // 879A  BCS
+    start = cycles; cycles += 2; executed++; if (p & F_C) { cycles += 1; EXIT(0x879F); }
+    EXIT(0x879C);
+}
+
+static int block_879C(espnes_context *ctx)
+{
+    BEGIN;
+    // 879C  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x000C); NZ(a);
+    EXIT(0x879F);
+}
+
+static int block_879F(espnes_context *ctx)
+{
+    BEGIN;
+    // 879F  PHA
+    start = cycles; cycles += 3; executed++; PUSH(a);
+    // 87A0  CMP
+    start = cycles; cycles += 3; executed++; CMP(a, RD(0xD1));
+    // 87A2  CPX
+    start = cycles; cycles += 2; executed++; CMP(x, 0xD1);
+    // 87A4  LDX
+    start = cycles; cycles += 4; executed++; x = RD(0x0604); NZ(x);
+    // 87A7  LSR
+    start = cycles; cycles += 5; executed++; t = RD(0x1C); LSR(t); WR(0x1C, t);
+    // 87A9  STA
+    start = cycles; cycles += 5; executed++; ea = (uint16_t)(0x01ED + y); WR(ea, a);
+    // 87AC  SBC
+    start = cycles; cycles += 2; executed++; SBC(0x18);
+    // 87AE  LSR
+    start = cycles; cycles += 5; executed++; t = RD(0x62); LSR(t); WR(0x62, t);
+    // 87B0  LDX
+    start = cycles; cycles += 2; executed++; x = 0x8E; NZ(x);
+    // 87B2  LDA
+    start = cycles; cycles += 2; executed++; a = 0xDA; NZ(a);
+    // 87B4  STA
+    start = cycles; cycles += 3; executed++; WR(0xDF, a);
+    // 87B6  LDA
+    start = cycles; cycles += 2; executed++; a = 0x82; NZ(a);
+    // 87B8  STA
+    start = cycles; cycles += 3; executed++; WR(0xE0, a);
+    // 87BA  CMP
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x51 + x); CMP(a, RD(ea));
+    IO_EXIT(0x87BC);
+    // 87BC  LDA
+    start = cycles; cycles += 2; executed++; a = 0x27; NZ(a);
+    // 87BE  CPX
+    start = cycles; cycles += 2; executed++; CMP(x, 0x56);
+    // 87C0  LDA
+    start = cycles; cycles += 3; executed++; a = RD(0x66); NZ(a);
+    // 87C2  BCS
+    start = cycles; cycles += 2; executed++; if (p & F_C) { cycles += 1; EXIT(0x87C7); }
+    EXIT(0x87C4);
+}
+
+static int block_87C4(espnes_context *ctx)
+{
+    BEGIN;
+    // 87C4  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x02F3); NZ(a);
+    EXIT(0x87C7);
+}
+
+static int block_87C7(espnes_context *ctx)
+{
+    BEGIN;
+    // 87C7  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xAF49 + x); cycles += PAGE_CROSSED(0xAF49, ea); ADC(RD(ea));
+    IO_EXIT(0x87CA);
+    // 87CA  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x13 + x); ADC(RD(ea));
+    // 87CC  BEQ
+    start = cycles; cycles += 2; executed++; if (p & F_Z) { cycles += 1; EXIT(0x87D1); }
+    EXIT(0x87CE);
+}
+
+static int block_87CE(espnes_context *ctx)
+{
+    BEGIN;
+    // 87CE  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xA9D6); NZ(a);
+    IO_EXIT(0x87D1);
+    EXIT(0x87D1);
+}
+
+static int block_87D1(espnes_context *ctx)
+{
+    BEGIN;
+    // 87D1  SBC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0301 + y); cycles += PAGE_CROSSED(0x0301, ea); SBC(RD(ea));
+    // 87D4  LDY
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x9279 + x); cycles += PAGE_CROSSED(0x9279, ea); y = RD(ea); NZ(y);
+    IO_EXIT(0x87D7);
+    // 87D7  STX
+    start = cycles; cycles += 3; executed++; WR(0x82, x);
+    // 87D9  AND
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xC40C + y); cycles += PAGE_CROSSED(0xC40C, ea); a &= RD(ea); NZ(a);
+    IO_EXIT(0x87DC);
+    // 87DC  ROL
+    start = cycles; cycles += 5; executed++; t = RD(0x79); ROL(t); WR(0x79, t);
+    // 87DE  ASL
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x9E + x); t = RD(ea); ASL(t); WR(ea, t);
+    // 87E0  AND
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x98 + x); a &= RD(ea); NZ(a);
+    // 87E2  CMP
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x952D + y); cycles += PAGE_CROSSED(0x952D, ea); CMP(a, RD(ea));
+    IO_EXIT(0x87E5);
+    // 87E5  DEC
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x0292 + x); t = RD(ea); t--; NZ(t); WR(ea, t);
+    // 87E8  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x015F); NZ(a);
+    // 87EB  ROR
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x26 + x); t = RD(ea); ROR(t); WR(ea, t);
+    // 87ED  BVS
+    start = cycles; cycles += 2; executed++; if (p & F_V) { cycles += 1; EXIT(0x87F2); }
+    EXIT(0x87EF);
+}
+
+static int block_87EF(espnes_context *ctx)
+{
+    BEGIN;
+    // 87EF  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xC90C); NZ(a);
+    IO_EXIT(0x87F2);
+    EXIT(0x87F2);
+}
+
+static int block_87F2(espnes_context *ctx)
+{
+    BEGIN;
+    // 87F2  CPX
+    start = cycles; cycles += 2; executed++; CMP(x, 0x47);
+    // 87F4  PHP
+    start = cycles; cycles += 3; executed++; PUSH(p | F_B | F_U);
+    // 87F5  ORA
+    start = cycles; cycles += 4; executed++; a |= RD(0x0352); NZ(a);
+    // 87F8  BMI
+    start = cycles; cycles += 2; executed++; if (p & F_N) { cycles += 1; EXIT(0x87FD); }
+    EXIT(0x87FA);
+}
+
+static int block_87FA(espnes_context *ctx)
+{
+    BEGIN;
+    // 87FA  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xC7E1); NZ(a);
+    IO_EXIT(0x87FD);
+    EXIT(0x87FD);
+}
+
+static int block_87FD(espnes_context *ctx)
+{
+    BEGIN;
+    // 87FD  ORA
+    start = cycles; cycles += 3; executed++; a |= RD(0x2A); NZ(a);
+    // 87FF  ROL
+    start = cycles; cycles += 6; executed++; t = RD(0x0142); ROL(t); WR(0x0142, t);
+    // 8802  CLD
+    start = cycles; cycles += 2; executed++; SETF(F_D, 0);
+    // 8803  LDY
+    start = cycles; cycles += 4; executed++; y = RD(0xBEA3); NZ(y);
+    IO_EXIT(0x8806);
+    // 8806  LDX
+    start = cycles; cycles += 2; executed++; x = 0x60; NZ(x);
+    // 8808  LDA
+    start = cycles; cycles += 2; executed++; a = 0x82; NZ(a);
+    // 880A  STA
+    start = cycles; cycles += 3; executed++; WR(0x97, a);
+    // 880C  LDA
+    start = cycles; cycles += 2; executed++; a = 0x00; NZ(a);
+    // 880E  STA
+    start = cycles; cycles += 3; executed++; WR(0x98, a);
+    // 8810  LDA
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x37 + x); a = RD(ea); NZ(a);
+    IO_EXIT(0x8812);
+    // 8812  INC
+    start = cycles; cycles += 5; executed++; t = RD(0xCA); t++; NZ(t); WR(0xCA, t);
+    // 8814  LDX
+    start = cycles; cycles += 3; executed++; x = RD(0xC9); NZ(x);
+    // 8816  CLV
+    start = cycles; cycles += 2; executed++; SETF(F_V, 0);
+    // 8817  LDX
+    start = cycles; cycles += 2; executed++; x = 0xED; NZ(x);
+    // 8819  LDA
+    start = cycles; cycles += 2; executed++; a = 0x61; NZ(a);
+    // 881B  STA
+    start = cycles; cycles += 3; executed++; WR(0xF0, a);
+    // 881D  LDA
+    start = cycles; cycles += 2; executed++; a = 0x00; NZ(a);
+    // 881F  STA
+    start = cycles; cycles += 3; executed++; WR(0xF1, a);
+    // 8821  LDA
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x03 + x); a = RD(ea); NZ(a);
+    IO_EXIT(0x8823);
+    // 8823  LDX
+    start = cycles; cycles += 2; executed++; x = 0xB4; NZ(x);
+    // 8825  LDA
+    start = cycles; cycles += 2; executed++; a = 0x01; NZ(a);
+    // 8827  STA
+    start = cycles; cycles += 3; executed++; WR(0xAF, a);
+    // 8829  LDA
+    start = cycles; cycles += 2; executed++; a = 0x9D; NZ(a);
+    // 882B  STA
+    start = cycles; cycles += 3; executed++; WR(0xB0, a);
+    // 882D  EOR
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0xFB + x); a ^= RD(ea); NZ(a);
+    IO_EXIT(0x882F);
+    // 882F  LDX
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xBB + y); x = RD(ea); NZ(x);
+    // 8831  BCC
+    start = cycles; cycles += 2; executed++; if (!(p & F_C)) { cycles += 1; EXIT(0x8836); }
+    EXIT(0x8833);
+}
+
+static int block_8833(espnes_context *ctx)
+{
+    BEGIN;
+    // 8833  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0115); NZ(a);
+    EXIT(0x8836);
+}
+
+static int block_8836(espnes_context *ctx)
+{
+    BEGIN;
+    // 8836  LSR
+    start = cycles; cycles += 6; executed++; t = RD(0x0559); LSR(t); WR(0x0559, t);
+    // 8839  LSR
+    start = cycles; cycles += 6; executed++; t = RD(0x001F); LSR(t); WR(0x001F, t);
+    // 883C  BPL
+    start = cycles; cycles += 2; executed++; if (!(p & F_N)) { cycles += 1; EXIT(0x8841); }
+    EXIT(0x883E);
+}
+
+static int block_883E(espnes_context *ctx)
+{
+    BEGIN;
+    // 883E  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xC4F9); NZ(a);
+    IO_EXIT(0x8841);
+    EXIT(0x8841);
+}
+
+static int block_8841(espnes_context *ctx)
+{
+    BEGIN;
+    // 8841  CPY
+    start = cycles; cycles += 3; executed++; CMP(y, RD(0x1E));
+    // 8843  BIT
+    start = cycles; cycles += 4; executed++; BIT(RD(0xD830));
+    IO_EXIT(0x8846);
+    // 8846  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x020B + y); cycles += PAGE_CROSSED(0x020B, ea); ADC(RD(ea));
+    // 8849  ROL
+    start = cycles; cycles += 2; executed++; ROL(a);
+    // 884A  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xB860 + y); cycles += PAGE_CROSSED(0xB860, ea); a ^= RD(ea); NZ(a);
+    IO_EXIT(0x884D);
+    // 884D  DEC
+    start = cycles; cycles += 6; executed++; t = RD(0x0220); t--; NZ(t); WR(0x0220, t);
+    // 8850  EOR
+    start = cycles; cycles += 4; executed++; a ^= RD(0xA5E9); NZ(a);
+    IO_EXIT(0x8853);
+    // 8853  STX
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x86 + y); WR(ea, x);
+    // 8855  STA
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xE4 + x); WR(ea, a);
+    // 8857  LDX
+    start = cycles; cycles += 2; executed++; x = 0x35; NZ(x);
+    // 8859  LDA
+    start = cycles; cycles += 2; executed++; a = 0xAE; NZ(a);
+    // 885B  STA
+    start = cycles; cycles += 3; executed++; WR(0xC8, a);
+    // 885D  LDA
+    start = cycles; cycles += 2; executed++; a = 0x06; NZ(a);
+    // 885F  STA
+    start = cycles; cycles += 3; executed++; WR(0xC9, a);
+    // 8861  AND
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x93 + x); a &= RD(ea); NZ(a);
+    IO_EXIT(0x8863);
+    // 8863  SEI
+    start = cycles; cycles += 2; executed++; SETF(F_I, 1);
+    // 8864  BIT
+    start = cycles; cycles += 4; executed++; BIT(RD(0x0512));
+    // 8867  BPL
+    start = cycles; cycles += 2; executed++; if (!(p & F_N)) { cycles += 1; EXIT(0x886C); }
+    EXIT(0x8869);
+}
+
+static int block_8869(espnes_context *ctx)
+{
+    BEGIN;
+    // 8869  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x9321); NZ(a);
+    IO_EXIT(0x886C);
+    EXIT(0x886C);
+}
+
+static int block_886C(espnes_context *ctx)
+{
+    BEGIN;
+    // 886C  CMP
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x03F8 + y); cycles += PAGE_CROSSED(0x03F8, ea); CMP(a, RD(ea));
+    // 886F  LDA
+    start = cycles; cycles += 2; executed++; a = 0x0C; NZ(a);
+    // 8871  DEC
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x25 + x); t = RD(ea); t--; NZ(t); WR(ea, t);
+    // 8873  BIT
+    start = cycles; cycles += 4; executed++; BIT(RD(0x8889));
+    IO_EXIT(0x8876);
+    // 8876  LDA
+    start = cycles; cycles += 2; executed++; a = 0xC3; NZ(a);
+    // 8878  STA
+    start = cycles; cycles += 3; executed++; WR(0x23, a);
+    // 887A  LDA
+    start = cycles; cycles += 2; executed++; a = 0xE4; NZ(a);
+    // 887C  STA
+    start = cycles; cycles += 3; executed++; WR(0x24, a);
+    // 887E  ADC
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x23); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); ADC(RD(ea));
+    IO_EXIT(0x8880);
+    // 8880  CPX
+    start = cycles; cycles += 2; executed++; CMP(x, 0xA6);
+    // 8882  CPY
+    start = cycles; cycles += 3; executed++; CMP(y, RD(0x82));
+    // 8884  SEI
+    start = cycles; cycles += 2; executed++; SETF(F_I, 1);
+    // 8885  SBC
+    start = cycles; cycles += 4; executed++; SBC(RD(0x003F));
+    // 8888  BEQ
+    start = cycles; cycles += 2; executed++; if (p & F_Z) { cycles += 1; EXIT(0x888D); }
+    EXIT(0x888A);
+}
+
+static int block_888A(espnes_context *ctx)
+{
+    BEGIN;
+    // 888A  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x05DA); NZ(a);
+    EXIT(0x888D);
+}
+
+static int block_888D(espnes_context *ctx)
+{
+    BEGIN;
+    // 888D  LDA
+    start = cycles; cycles += 3; executed++; a = RD(0x78); NZ(a);
+    // 888F  CPY
+    start = cycles; cycles += 4; executed++; CMP(y, RD(0xC076));
+    IO_EXIT(0x8892);
+    // 8892  ROR
+    start = cycles; cycles += 5; executed++; t = RD(0x1C); ROR(t); WR(0x1C, t);
+    // 8894  STX
+    start = cycles; cycles += 3; executed++; WR(0x47, x);
+    // 8896  CPX
+    start = cycles; cycles += 3; executed++; CMP(x, RD(0x89));
+    // 8898  BVC
+    start = cycles; cycles += 2; executed++; if (!(p & F_V)) { cycles += 1; EXIT(0x889D); }
+    EXIT(0x889A);
+}
+
+static int block_889A(espnes_context *ctx)
+{
+    BEGIN;
+    // 889A  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xD85D); NZ(a);
+    IO_EXIT(0x889D);
+    EXIT(0x889D);
+}
+
+static int block_889D(espnes_context *ctx)
+{
+    BEGIN;
+    // 889D  EOR
+    start = cycles; cycles += 4; executed++; a ^= RD(0xB32E); NZ(a);
+    IO_EXIT(0x88A0);
+    // 88A0  ASL
+    start = cycles; cycles += 2; executed++; ASL(a);
+    // 88A1  SBC
+    start = cycles; cycles += 4; executed++; SBC(RD(0x012C));
+    // 88A4  CPX
+    start = cycles; cycles += 4; executed++; CMP(x, RD(0x01BE));
+    // 88A7  SBC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xB906 + x); cycles += PAGE_CROSSED(0xB906, ea); SBC(RD(ea));
+    IO_EXIT(0x88AA);
+    // 88AA  ROR
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x0F + x); t = RD(ea); ROR(t); WR(ea, t);
+    // 88AC  LDX
+    start = cycles; cycles += 2; executed++; x = 0x92; NZ(x);
+    // 88AE  LDA
+    start = cycles; cycles += 2; executed++; a = 0x1B; NZ(a);
+    // 88B0  STA
+    start = cycles; cycles += 3; executed++; WR(0x4B, a);
+    // 88B2  LDA
+    start = cycles; cycles += 2; executed++; a = 0x04; NZ(a);
+    // 88B4  STA
+    start = cycles; cycles += 3; executed++; WR(0x4C, a);
+    // 88B6  LDA
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0xB9 + x); a = RD(ea); NZ(a);
+    IO_EXIT(0x88B8);
+    // 88B8  DEC
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x19 + x); t = RD(ea); t--; NZ(t); WR(ea, t);
+    // 88BA  STA
+    start = cycles; cycles += 4; executed++; WR(0x0491, a);
+    // 88BD  DEC
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x82 + x); t = RD(ea); t--; NZ(t); WR(ea, t);
+    // 88BF  LDA
+    start = cycles; cycles += 2; executed++; a = 0x99; NZ(a);
+    // 88C1  STA
+    start = cycles; cycles += 3; executed++; WR(0xB8, a);
+    // 88C3  LDA
+    start = cycles; cycles += 2; executed++; a = 0x03; NZ(a);
+    // 88C5  STA
+    start = cycles; cycles += 3; executed++; WR(0xB9, a);
+    // 88C7  ADC
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0xB8); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); ADC(RD(ea));
+    IO_EXIT(0x88C9);
+    // 88C9  BCS
+    start = cycles; cycles += 2; executed++; if (p & F_C) { cycles += 1; EXIT(0x88CE); }
+    EXIT(0x88CB);
+}
+
+static int block_88CB(espnes_context *ctx)
+{
+    BEGIN;
+    // 88CB  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0372); NZ(a);
+    EXIT(0x88CE);
+}
+
+static int block_88CE(espnes_context *ctx)
+{
+    BEGIN;
+    // 88CE  LDY
+    start = cycles; cycles += 3; executed++; y = RD(0x3C); NZ(y);
+    // 88D0  PHA
+    start = cycles; cycles += 3; executed++; PUSH(a);
+    // 88D1  CPX
+    start = cycles; cycles += 2; executed++; CMP(x, 0xB0);
+    // 88D3  BMI
+    start = cycles; cycles += 2; executed++; if (p & F_N) { cycles += 1; EXIT(0x88D8); }
+    EXIT(0x88D5);
+}
+
+static int block_88D5(espnes_context *ctx)
+{
+    BEGIN;
+    // 88D5  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x04FD); NZ(a);
+    EXIT(0x88D8);
+}
+
+static int block_88D8(espnes_context *ctx)
+{
+    BEGIN;
+    // 88D8  SEI
+    start = cycles; cycles += 2; executed++; SETF(F_I, 1);
+    // 88D9  ROL
+    start = cycles; cycles += 6; executed++; t = RD(0x0111); ROL(t); WR(0x0111, t);
+    // 88DC  TYA
+    start = cycles; cycles += 2; executed++; a = y; NZ(a);
+    // 88DD  LDA
+    start = cycles; cycles += 2; executed++; a = 0x3F; NZ(a);
+    // 88DF  STA
+    start = cycles; cycles += 3; executed++; WR(0xAD, a);
+    // 88E1  LDA
+    start = cycles; cycles += 2; executed++; a = 0x05; NZ(a);
+    // 88E3  STA
+    start = cycles; cycles += 3; executed++; WR(0xAE, a);
+    // 88E5  EOR
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0xAD); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a ^= RD(ea); NZ(a);
+    IO_EXIT(0x88E7);
+    // 88E7  SBC
+    start = cycles; cycles += 3; executed++; SBC(RD(0x46));
+    // 88E9  LDX
+    start = cycles; cycles += 2; executed++; x = 0xF1; NZ(x);
+    // 88EB  LDA
+    start = cycles; cycles += 2; executed++; a = 0x8B; NZ(a);
+    // 88ED  STA
+    start = cycles; cycles += 3; executed++; WR(0xA8, a);
+    // 88EF  LDA
+    start = cycles; cycles += 2; executed++; a = 0x03; NZ(a);
+    // 88F1  STA
+    start = cycles; cycles += 3; executed++; WR(0xA9, a);
+    // 88F3  ADC
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0xB7 + x); ADC(RD(ea));
+    IO_EXIT(0x88F5);
+    // 88F5  TXA
+    start = cycles; cycles += 2; executed++; a = x; NZ(a);
+    // 88F6  DEC
+    start = cycles; cycles += 6; executed++; t = RD(0x02D6); t--; NZ(t); WR(0x02D6, t);
+    // 88F9  EOR
+    start = cycles; cycles += 4; executed++; a ^= RD(0xAAEA); NZ(a);
+    IO_EXIT(0x88FC);
+    // 88FC  LDX
+    start = cycles; cycles += 2; executed++; x = 0xF7; NZ(x);
+    // 88FE  LDA
+    start = cycles; cycles += 2; executed++; a = 0x46; NZ(a);
+    // 8900  STA
+    start = cycles; cycles += 3; executed++; WR(0x86, a);
+    // 8902  LDA
+    start = cycles; cycles += 2; executed++; a = 0x00; NZ(a);
+    // 8904  STA
+    start = cycles; cycles += 3; executed++; WR(0x87, a);
+    // 8906  EOR
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x8F + x); a ^= RD(ea); NZ(a);
+    IO_EXIT(0x8908);
+    // 8908  EOR
+    start = cycles; cycles += 4; executed++; a ^= RD(0xB3BA); NZ(a);
+    IO_EXIT(0x890B);
+    // 890B  DEX
+    start = cycles; cycles += 2; executed++; x--; NZ(x);
+    // 890C  BVS
+    start = cycles; cycles += 2; executed++; if (p & F_V) { cycles += 1; EXIT(0x8911); }
+    EXIT(0x890E);
+}
+
+static int block_890E(espnes_context *ctx)
+{
+    BEGIN;
+    // 890E  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x062F); NZ(a);
+    EXIT(0x8911);
+}
+
+static int block_8911(espnes_context *ctx)
+{
+    BEGIN;
+    // 8911  LDY
+    start = cycles; cycles += 3; executed++; y = RD(0x55); NZ(y);
+    // 8913  ORA
+    start = cycles; cycles += 3; executed++; a |= RD(0x12); NZ(a);
+    // 8915  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xD8AA + y); cycles += PAGE_CROSSED(0xD8AA, ea); a ^= RD(ea); NZ(a);
+    IO_EXIT(0x8918);
+    // 8918  ROL
+    start = cycles; cycles += 2; executed++; ROL(a);
+    // 8919  DEC
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x0553 + x); t = RD(ea); t--; NZ(t); WR(ea, t);
+    // 891C  CMP
+    start = cycles; cycles += 2; executed++; CMP(a, 0x90);
+    // 891E  ADC
+    start = cycles; cycles += 2; executed++; ADC(0x44);
+    // 8920  BIT
+    start = cycles; cycles += 4; executed++; BIT(RD(0xECFD));
+    IO_EXIT(0x8923);
+    // 8923  LDA
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xD7 + x); a = RD(ea); NZ(a);
+    // 8925  SBC
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x2D + x); SBC(RD(ea));
+    // 8927  ASL
+    start = cycles; cycles += 2; executed++; ASL(a);
+    // 8928  BCC
+    start = cycles; cycles += 2; executed++; if (!(p & F_C)) { cycles += 1; EXIT(0x892D); }
+    EXIT(0x892A);
+}
+
+static int block_892A(espnes_context *ctx)
+{
+    BEGIN;
+    // 892A  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xB65F); NZ(a);
+    IO_EXIT(0x892D);
+    EXIT(0x892D);
+}
+
+static int block_892D(espnes_context *ctx)
+{
+    BEGIN;
+    // 892D  INC
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x029C + x); t = RD(ea); t++; NZ(t); WR(ea, t);
+    // 8930  SBC
+    start = cycles; cycles += 4; executed++; SBC(RD(0x0264));
+    // 8933  CLV
+    start = cycles; cycles += 2; executed++; SETF(F_V, 0);
+    // 8934  STA
+    start = cycles; cycles += 5; executed++; ea = (uint16_t)(0x02AD + y); WR(ea, a);
+    // 8937  STY
+    start = cycles; cycles += 4; executed++; WR(0x0428, y);
+    // 893A  BMI
+    start = cycles; cycles += 2; executed++; if (p & F_N) { cycles += 1; EXIT(0x893F); }
+    EXIT(0x893C);
+}
+
+static int block_893C(espnes_context *ctx)
+{
+    BEGIN;
+    // 893C  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x062A); NZ(a);
+    EXIT(0x893F);
+}
+
+static int block_893F(espnes_context *ctx)
+{
+    BEGIN;
+    // 893F  EOR
+    start = cycles; cycles += 2; executed++; a ^= 0xCE; NZ(a);
+    // 8941  TAY
+    start = cycles; cycles += 2; executed++; y = a; NZ(y);
+    // 8942  LDX
+    start = cycles; cycles += 2; executed++; x = 0x63; NZ(x);
+    // 8944  LDA
+    start = cycles; cycles += 2; executed++; a = 0x31; NZ(a);
+    // 8946  STA
+    start = cycles; cycles += 3; executed++; WR(0x5D, a);
+    // 8948  LDA
+    start = cycles; cycles += 2; executed++; a = 0x03; NZ(a);
+    // 894A  STA
+    start = cycles; cycles += 3; executed++; WR(0x5E, a);
+    // 894C  AND
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0xFA + x); a &= RD(ea); NZ(a);
+    IO_EXIT(0x894E);
+    // 894E  LDX
+    start = cycles; cycles += 4; executed++; x = RD(0x0164); NZ(x);
+    // 8951  INC
+    start = cycles; cycles += 6; executed++; t = RD(0x047A); t++; NZ(t); WR(0x047A, t);
+    // 8954  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xB341 + y); cycles += PAGE_CROSSED(0xB341, ea); a ^= RD(ea); NZ(a);
+    IO_EXIT(0x8957);
+    // 8957  DEC
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x80 + x); t = RD(ea); t--; NZ(t); WR(ea, t);
+    // 8959  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 1; EXIT(0x895E); }
+    EXIT(0x895B);
+}
+
+static int block_895B(espnes_context *ctx)
+{
+    BEGIN;
+    // 895B  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xBA52); NZ(a);
+    IO_EXIT(0x895E);
+    EXIT(0x895E);
+}
+
+static int block_895E(espnes_context *ctx)
+{
+    BEGIN;
+    // 895E  CPY
+    start = cycles; cycles += 2; executed++; CMP(y, 0x1D);
+    // 8960  TXS
+    start = cycles; cycles += 2; executed++; sp = x;
+    // 8961  LSR
+    start = cycles; cycles += 5; executed++; t = RD(0x5A); LSR(t); WR(0x5A, t);
+    // 8963  DEC
+    start = cycles; cycles += 5; executed++; t = RD(0x31); t--; NZ(t); WR(0x31, t);
+    // 8965  ROL
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x74 + x); t = RD(ea); ROL(t); WR(ea, t);
+    // 8967  SED
+    start = cycles; cycles += 2; executed++; SETF(F_D, 1);
+    // 8968  BMI
+    start = cycles; cycles += 2; executed++; if (p & F_N) { cycles += 1; EXIT(0x896D); }
+    EXIT(0x896A);
+}
+
+static int block_896A(espnes_context *ctx)
+{
+    BEGIN;
+    // 896A  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0231); NZ(a);
+    EXIT(0x896D);
+}
+
+static int block_896D(espnes_context *ctx)
+{
+    BEGIN;
+    // 896D  TXA
+    start = cycles; cycles += 2; executed++; a = x; NZ(a);
+    // 896E  SBC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xD7A2 + x); cycles += PAGE_CROSSED(0xD7A2, ea); SBC(RD(ea));
+    IO_EXIT(0x8971);
+    // 8971  ROR
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x4E + x); t = RD(ea); ROR(t); WR(ea, t);
+    // 8973  ROR
+    start = cycles; cycles += 5; executed++; t = RD(0xB8); ROR(t); WR(0xB8, t);
+    // 8975  LDX
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x013B + y); cycles += PAGE_CROSSED(0x013B, ea); x = RD(ea); NZ(x);
+    // 8978  LDX
+    start = cycles; cycles += 2; executed++; x = 0x6E; NZ(x);
+    // 897A  LDA
+    start = cycles; cycles += 2; executed++; a = 0x98; NZ(a);
+    // 897C  STA
+    start = cycles; cycles += 3; executed++; WR(0xE1, a);
+    // 897E  LDA
+    start = cycles; cycles += 2; executed++; a = 0x02; NZ(a);
+    // 8980  STA
+    start = cycles; cycles += 3; executed++; WR(0xE2, a);
+    // 8982  EOR
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x73 + x); a ^= RD(ea); NZ(a);
+    IO_EXIT(0x8984);
+    // 8984  ORA
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x6F + x); a |= RD(ea); NZ(a);
+    // 8986  DEX
+    start = cycles; cycles += 2; executed++; x--; NZ(x);
+    // 8987  ORA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xE470 + y); cycles += PAGE_CROSSED(0xE470, ea); a |= RD(ea); NZ(a);
+    IO_EXIT(0x898A);
+    // 898A  SEI
+    start = cycles; cycles += 2; executed++; SETF(F_I, 1);
+    // 898B  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xCD + x); ADC(RD(ea));
+    // 898D  LDA
+    start = cycles; cycles += 2; executed++; a = 0x6E; NZ(a);
+    // 898F  STA
+    start = cycles; cycles += 3; executed++; WR(0x08, a);
+    // 8991  LDA
+    start = cycles; cycles += 2; executed++; a = 0xB4; NZ(a);
+    // 8993  STA
+    start = cycles; cycles += 3; executed++; WR(0x09, a);
+    // 8995  ORA
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x08); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a |= RD(ea); NZ(a);
+    IO_EXIT(0x8997);
+    // 8997  BEQ
+    start = cycles; cycles += 2; executed++; if (p & F_Z) { cycles += 1; EXIT(0x899C); }
+    EXIT(0x8999);
+}
+
+static int block_8999(espnes_context *ctx)
+{
+    BEGIN;
+    // 8999  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x037C); NZ(a);
+    EXIT(0x899C);
+}
+
+static int block_899C(espnes_context *ctx)
+{
+    BEGIN;
+    // 899C  LDY
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xE867 + x); cycles += PAGE_CROSSED(0xE867, ea); y = RD(ea); NZ(y);
+    IO_EXIT(0x899F);
+    // 899F  CPY
+    start = cycles; cycles += 4; executed++; CMP(y, RD(0x0460));
+    // 89A2  LDA
+    start = cycles; cycles += 2; executed++; a = 0x4D; NZ(a);
+    // 89A4  STA
+    start = cycles; cycles += 3; executed++; WR(0xDA, a);
+    // 89A6  LDA
+    start = cycles; cycles += 2; executed++; a = 0x84; NZ(a);
+    // 89A8  STA
+    start = cycles; cycles += 3; executed++; WR(0xDB, a);
+    // 89AA  ADC
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0xDA); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); ADC(RD(ea));
+    IO_EXIT(0x89AC);
+    // 89AC  SBC
+    start = cycles; cycles += 4; executed++; SBC(RD(0x03FA));
+    // 89AF  BEQ
+    start = cycles; cycles += 2; executed++; if (p & F_Z) { cycles += 1; EXIT(0x89B4); }
+    EXIT(0x89B1);
+}
+
+static int block_89B1(espnes_context *ctx)
+{
+    BEGIN;
+    // 89B1  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xEE6A); NZ(a);
+    IO_EXIT(0x89B4);
+    EXIT(0x89B4);
+}
+
+static int block_89B4(espnes_context *ctx)
+{
+    BEGIN;
+    // 89B4  AND
+    start = cycles; cycles += 3; executed++; a &= RD(0x3F); NZ(a);
+    // 89B6  SBC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xF8F3 + y); cycles += PAGE_CROSSED(0xF8F3, ea); SBC(RD(ea));
+    IO_EXIT(0x89B9);
+    // 89B9  LDX
+    start = cycles; cycles += 2; executed++; x = 0xB0; NZ(x);
+    // 89BB  LDA
+    start = cycles; cycles += 2; executed++; a = 0xDB; NZ(a);
+    // 89BD  STA
+    start = cycles; cycles += 3; executed++; WR(0x0B, a);
+    // 89BF  LDA
+    start = cycles; cycles += 2; executed++; a = 0x98; NZ(a);
+    // 89C1  STA
+    start = cycles; cycles += 3; executed++; WR(0x0C, a);
+    // 89C3  CMP
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x5B + x); CMP(a, RD(ea));
+    IO_EXIT(0x89C5);
+    // 89C5  LDX
+    start = cycles; cycles += 2; executed++; x = 0xE2; NZ(x);
+    // 89C7  LDA
+    start = cycles; cycles += 2; executed++; a = 0x29; NZ(a);
+    // 89C9  STA
+    start = cycles; cycles += 3; executed++; WR(0x68, a);
+    // 89CB  LDA
+    start = cycles; cycles += 2; executed++; a = 0x03; NZ(a);
+    // 89CD  STA
+    start = cycles; cycles += 3; executed++; WR(0x69, a);
+    // 89CF  AND
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x86 + x); a &= RD(ea); NZ(a);
+    IO_EXIT(0x89D1);
+    // 89D1  BCC
+    start = cycles; cycles += 2; executed++; if (!(p & F_C)) { cycles += 1; EXIT(0x89D6); }
+    EXIT(0x89D3);
+}
+
+static int block_89D3(espnes_context *ctx)
+{
+    BEGIN;
+    // 89D3  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x017D); NZ(a);
+    EXIT(0x89D6);
+}
+
+static int block_89D6(espnes_context *ctx)
+{
+    BEGIN;
+    // 89D6  LSR
+    start = cycles; cycles += 6; executed++; t = RD(0x00DC); LSR(t); WR(0x00DC, t);
+    // 89D9  INY
+    start = cycles; cycles += 2; executed++; y++; NZ(y);
+    // 89DA  TYA
+    start = cycles; cycles += 2; executed++; a = y; NZ(a);
+    // 89DB  TAX
+    start = cycles; cycles += 2; executed++; x = a; NZ(x);
+    // 89DC  LDX
+    start = cycles; cycles += 4; executed++; x = RD(0x05B3); NZ(x);
+    // 89DF  INC
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x00BE + x); t = RD(ea); t++; NZ(t); WR(ea, t);
+    // 89E2  LDX
+    start = cycles; cycles += 2; executed++; x = 0x60; NZ(x);
+    // 89E4  LDA
+    start = cycles; cycles += 2; executed++; a = 0xB5; NZ(a);
+    // 89E6  STA
+    start = cycles; cycles += 3; executed++; WR(0xE4, a);
+    // 89E8  LDA
+    start = cycles; cycles += 2; executed++; a = 0x02; NZ(a);
+    // 89EA  STA
+    start = cycles; cycles += 3; executed++; WR(0xE5, a);
+    // 89EC  ADC
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x84 + x); ADC(RD(ea));
+    IO_EXIT(0x89EE);
+    // 89EE  INX
+    start = cycles; cycles += 2; executed++; x++; NZ(x);
+    // 89EF  DEC
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x13 + x); t = RD(ea); t--; NZ(t); WR(ea, t);
+    // 89F1  SBC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xAB73 + x); cycles += PAGE_CROSSED(0xAB73, ea); SBC(RD(ea));
+    IO_EXIT(0x89F4);
+    // 89F4  TXS
+    start = cycles; cycles += 2; executed++; sp = x;
+    // 89F5  BVS
+    start = cycles; cycles += 2; executed++; if (p & F_V) { cycles += 1; EXIT(0x89FA); }
+    EXIT(0x89F7);
+}
+
+static int block_89F7(espnes_context *ctx)
+{
+    BEGIN;
+    // 89F7  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xE2B5); NZ(a);
+    IO_EXIT(0x89FA);
+    EXIT(0x89FA);
+}
+
+static int block_89FA(espnes_context *ctx)
+{
+    BEGIN;
+    // 89FA  LDY
+    start = cycles; cycles += 2; executed++; y = 0x8D; NZ(y);
+    // 89FC  BCC
+    start = cycles; cycles += 2; executed++; if (!(p & F_C)) { cycles += 2; EXIT(0x8A01); }
+    EXIT(0x89FE);
+}
+
+static int block_89FE(espnes_context *ctx)
+{
+    BEGIN;
+    // 89FE  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x04BD); NZ(a);
+    EXIT(0x8A01);
+}
+
+static int block_8A01(espnes_context *ctx)
+{
+    BEGIN;
+    // 8A01  DEC
+    start = cycles; cycles += 6; executed++; t = RD(0x04B6); t--; NZ(t); WR(0x04B6, t);
+    // 8A04  LDA
+    start = cycles; cycles += 2; executed++; a = 0xAA; NZ(a);
+    // 8A06  STA
+    start = cycles; cycles += 3; executed++; WR(0xF1, a);
+    // 8A08  LDA
+    start = cycles; cycles += 2; executed++; a = 0x8F; NZ(a);
+    // 8A0A  STA
+    start = cycles; cycles += 3; executed++; WR(0xF2, a);
+    // 8A0C  CMP
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0xF1); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); CMP(a, RD(ea));
+    IO_EXIT(0x8A0E);
+    // 8A0E  ADC
+    start = cycles; cycles += 2; executed++; ADC(0x28);
+    // 8A10  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x03D6 + y); cycles += PAGE_CROSSED(0x03D6, ea); a ^= RD(ea); NZ(a);
+    // 8A13  LDA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x9D31 + y); cycles += PAGE_CROSSED(0x9D31, ea); a = RD(ea); NZ(a);
+    IO_EXIT(0x8A16);
+    // 8A16  INC
+    start = cycles; cycles += 5; executed++; t = RD(0x20); t++; NZ(t); WR(0x20, t);
+    // 8A18  LDX
+    start = cycles; cycles += 2; executed++; x = 0x4D; NZ(x);
+    // 8A1A  LDA
+    start = cycles; cycles += 2; executed++; a = 0xC2; NZ(a);
+    // 8A1C  STA
+    start = cycles; cycles += 3; executed++; WR(0x40, a);
+    // 8A1E  LDA
+    start = cycles; cycles += 2; executed++; a = 0x00; NZ(a);
+    // 8A20  STA
+    start = cycles; cycles += 3; executed++; WR(0x41, a);
+    // 8A22  ADC
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0xF3 + x); ADC(RD(ea));
+    IO_EXIT(0x8A24);
+    // 8A24  LDA
+    start = cycles; cycles += 2; executed++; a = 0xF0; NZ(a);
+    // 8A26  STA
+    start = cycles; cycles += 3; executed++; WR(0xAF, a);
+    // 8A28  LDA
+    start = cycles; cycles += 2; executed++; a = 0xAF; NZ(a);
+    // 8A2A  STA
+    start = cycles; cycles += 3; executed++; WR(0xB0, a);
+    // 8A2C  CMP
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0xAF); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); CMP(a, RD(ea));
+    IO_EXIT(0x8A2E);
+    // 8A2E  LDX
+    start = cycles; cycles += 4; executed++; x = RD(0x9EC0); NZ(x);
+    IO_EXIT(0x8A31);
+    // 8A31  SEC
+    start = cycles; cycles += 2; executed++; SETF(F_C, 1);
+    // 8A32  SBC
+    start = cycles; cycles += 2; executed++; SBC(0xBB);
+    // 8A34  BCC
+    start = cycles; cycles += 2; executed++; if (!(p & F_C)) { cycles += 1; EXIT(0x8A39); }
+    EXIT(0x8A36);
+}
+
+static int block_8A36(espnes_context *ctx)
+{
+    BEGIN;
+    // 8A36  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x00A5); NZ(a);
+    EXIT(0x8A39);
+}
+
+static int block_8A39(espnes_context *ctx)
+{
+    BEGIN;
+    // 8A39  INX
+    start = cycles; cycles += 2; executed++; x++; NZ(x);
+    // 8A3A  TAY
+    start = cycles; cycles += 2; executed++; y = a; NZ(y);
+    // 8A3B  LDA
+    start = cycles; cycles += 2; executed++; a = 0xEB; NZ(a);
+    // 8A3D  STA
+    start = cycles; cycles += 3; executed++; WR(0x2E, a);
+    // 8A3F  LDA
+    start = cycles; cycles += 2; executed++; a = 0x06; NZ(a);
+    // 8A41  STA
+    start = cycles; cycles += 3; executed++; WR(0x2F, a);
+    // 8A43  CMP
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x2E); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); CMP(a, RD(ea));
+    IO_EXIT(0x8A45);
+    // 8A45  ROR
+    start = cycles; cycles += 2; executed++; ROR(a);
+    // 8A46  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0380 + y); cycles += PAGE_CROSSED(0x0380, ea); ADC(RD(ea));
+    // 8A49  BVS
+    start = cycles; cycles += 2; executed++; if (p & F_V) { cycles += 1; EXIT(0x8A4E); }
+    EXIT(0x8A4B);
+}
+
+static int block_8A4B(espnes_context *ctx)
+{
+    BEGIN;
+    // 8A4B  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0319); NZ(a);
+    EXIT(0x8A4E);
+}
+
+static int block_8A4E(espnes_context *ctx)
+{
+    BEGIN;
+    // 8A4E  TAY
+    start = cycles; cycles += 2; executed++; y = a; NZ(y);
+    // 8A4F  LDA
+    start = cycles; cycles += 2; executed++; a = 0xD9; NZ(a);
+    // 8A51  STA
+    start = cycles; cycles += 3; executed++; WR(0x94, a);
+    // 8A53  LDA
+    start = cycles; cycles += 2; executed++; a = 0xC2; NZ(a);
+    // 8A55  STA
+    start = cycles; cycles += 3; executed++; WR(0x95, a);
+    // 8A57  SBC
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x94); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); SBC(RD(ea));
+    IO_EXIT(0x8A59);
+    // 8A59  AND
+    start = cycles; cycles += 4; executed++; a &= RD(0x0351); NZ(a);
+    // 8A5C  STY
+    start = cycles; cycles += 3; executed++; WR(0x53, y);
+    // 8A5E  ADC
+    start = cycles; cycles += 3; executed++; ADC(RD(0xB5));
+    // 8A60  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x8C8C + y); cycles += PAGE_CROSSED(0x8C8C, ea); a ^= RD(ea); NZ(a);
+    IO_EXIT(0x8A63);
+    // 8A63  LDA
+    start = cycles; cycles += 2; executed++; a = 0xD7; NZ(a);
+    // 8A65  STA
+    start = cycles; cycles += 3; executed++; WR(0x56, a);
+    // 8A67  LDA
+    start = cycles; cycles += 2; executed++; a = 0xAB; NZ(a);
+    // 8A69  STA
+    start = cycles; cycles += 3; executed++; WR(0x57, a);
+    // 8A6B  LDA
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x56); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a = RD(ea); NZ(a);
+    IO_EXIT(0x8A6D);
+    // 8A6D  ASL
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x050E + x); t = RD(ea); ASL(t); WR(ea, t);
+    // 8A70  LDX
+    start = cycles; cycles += 3; executed++; x = RD(0x74); NZ(x);
+    // 8A72  AND
+    start = cycles; cycles += 4; executed++; a &= RD(0xBF36); NZ(a);
+    IO_EXIT(0x8A75);
+    // 8A75  LDA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x019F + y); cycles += PAGE_CROSSED(0x019F, ea); a = RD(ea); NZ(a);
+    // 8A78  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 1; EXIT(0x8A7D); }
+    EXIT(0x8A7A);
+}
+
+static int block_8A7A(espnes_context *ctx)
+{
+    BEGIN;
+    // 8A7A  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xD284); NZ(a);
+    IO_EXIT(0x8A7D);
+    EXIT(0x8A7D);
+}
+
+static int block_8A7D(espnes_context *ctx)
+{
+    BEGIN;
+    // 8A7D  LDX
+    start = cycles; cycles += 2; executed++; x = 0x52; NZ(x);
+    // 8A7F  LDA
+    start = cycles; cycles += 2; executed++; a = 0x3C; NZ(a);
+    // 8A81  STA
+    start = cycles; cycles += 3; executed++; WR(0x30, a);
+    // 8A83  LDA
+    start = cycles; cycles += 2; executed++; a = 0x9B; NZ(a);
+    // 8A85  STA
+    start = cycles; cycles += 3; executed++; WR(0x31, a);
+    // 8A87  ORA
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0xDE + x); a |= RD(ea); NZ(a);
+    IO_EXIT(0x8A89);
+    // 8A89  CLV
+    start = cycles; cycles += 2; executed++; SETF(F_V, 0);
+    // 8A8A  STX
+    start = cycles; cycles += 4; executed++; WR(0x00AF, x);
+    // 8A8D  ROL
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x37 + x); t = RD(ea); ROL(t); WR(ea, t);
+    // 8A8F  NOP
+    start = cycles; cycles += 2; executed++; 
+    // 8A90  ROR
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x035F + x); t = RD(ea); ROR(t); WR(ea, t);
+    // 8A93  LDX
+    start = cycles; cycles += 2; executed++; x = 0x70; NZ(x);
+    // 8A95  STY
+    start = cycles; cycles += 3; executed++; WR(0x8F, y);
+    // 8A97  CPY
+    start = cycles; cycles += 2; executed++; CMP(y, 0x28);
+    // 8A99  BPL
+    start = cycles; cycles += 2; executed++; if (!(p & F_N)) { cycles += 1; EXIT(0x8A9E); }
+    EXIT(0x8A9B);
+}
+
+static int block_8A9B(espnes_context *ctx)
+{
+    BEGIN;
+    // 8A9B  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x9315); NZ(a);
+    IO_EXIT(0x8A9E);
+    EXIT(0x8A9E);
+}
+
+static int block_8A9E(espnes_context *ctx)
+{
+    BEGIN;
+    // 8A9E  LDX
+    start = cycles; cycles += 2; executed++; x = 0x3F; NZ(x);
+    // 8AA0  LDA
+    start = cycles; cycles += 2; executed++; a = 0xA4; NZ(a);
+    // 8AA2  STA
+    start = cycles; cycles += 3; executed++; WR(0x2C, a);
+    // 8AA4  LDA
+    start = cycles; cycles += 2; executed++; a = 0xC6; NZ(a);
+    // 8AA6  STA
+    start = cycles; cycles += 3; executed++; WR(0x2D, a);
+    // 8AA8  SBC
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0xED + x); SBC(RD(ea));
+    IO_EXIT(0x8AAA);
+    // 8AAA  ORA
+    start = cycles; cycles += 3; executed++; a |= RD(0x7E); NZ(a);
+    // 8AAC  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x5F + x); ADC(RD(ea));
+    // 8AAE  AND
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x034A + y); cycles += PAGE_CROSSED(0x034A, ea); a &= RD(ea); NZ(a);
+    // 8AB1  ORA
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x2D + x); a |= RD(ea); NZ(a);
+    // 8AB3  BCC
+    start = cycles; cycles += 2; executed++; if (!(p & F_C)) { cycles += 1; EXIT(0x8AB8); }
+    EXIT(0x8AB5);
+}
+
+static int block_8AB5(espnes_context *ctx)
+{
+    BEGIN;
+    // 8AB5  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0225); NZ(a);
+    EXIT(0x8AB8);
+}
+
+static int block_8AB8(espnes_context *ctx)
+{
+    BEGIN;
+    // 8AB8  CPY
+    start = cycles; cycles += 2; executed++; CMP(y, 0x0C);
+    // 8ABA  STX
+    start = cycles; cycles += 4; executed++; WR(0x06D9, x);
+    // 8ABD  STY
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x71 + x); WR(ea, y);
+    // 8ABF  DEC
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0xF5 + x); t = RD(ea); t--; NZ(t); WR(ea, t);
+    // 8AC1  LDX
+    start = cycles; cycles += 2; executed++; x = 0x16; NZ(x);
+    // 8AC3  LDA
+    start = cycles; cycles += 2; executed++; a = 0x15; NZ(a);
+    // 8AC5  STA
+    start = cycles; cycles += 3; executed++; WR(0x97, a);
+    // 8AC7  LDA
+    start = cycles; cycles += 2; executed++; a = 0x01; NZ(a);
+    // 8AC9  STA
+    start = cycles; cycles += 3; executed++; WR(0x98, a);
+    // 8ACB  ORA
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x81 + x); a |= RD(ea); NZ(a);
+    IO_EXIT(0x8ACD);
+    // 8ACD  LDX
+    start = cycles; cycles += 3; executed++; x = RD(0xAC); NZ(x);
+    // 8ACF  CMP
+    start = cycles; cycles += 2; executed++; CMP(a, 0xCC);
+    // 8AD1  BEQ
+    start = cycles; cycles += 2; executed++; if (p & F_Z) { cycles += 1; EXIT(0x8AD6); }
+    EXIT(0x8AD3);
+}
+
+static int block_8AD3(espnes_context *ctx)
+{
+    BEGIN;
+    // 8AD3  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x00E1); NZ(a);
+    EXIT(0x8AD6);
+}
+
+static int block_8AD6(espnes_context *ctx)
+{
+    BEGIN;
+    // 8AD6  LDA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0157 + x); cycles += PAGE_CROSSED(0x0157, ea); a = RD(ea); NZ(a);
+    // 8AD9  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x056A + x); cycles += PAGE_CROSSED(0x056A, ea); ADC(RD(ea));
+    // 8ADC  BVS
+    start = cycles; cycles += 2; executed++; if (p & F_V) { cycles += 1; EXIT(0x8AE1); }
+    EXIT(0x8ADE);
+}
+
+static int block_8ADE(espnes_context *ctx)
+{
+    BEGIN;
+    // 8ADE  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x865F); NZ(a);
+    IO_EXIT(0x8AE1);
+    EXIT(0x8AE1);
+}
+
+static int block_8AE1(espnes_context *ctx)
+{
+    BEGIN;
+    // 8AE1  LSR
+    start = cycles; cycles += 5; executed++; t = RD(0xA3); LSR(t); WR(0xA3, t);
+    // 8AE3  LDX
+    start = cycles; cycles += 2; executed++; x = 0x93; NZ(x);
+    // 8AE5  LDA
+    start = cycles; cycles += 2; executed++; a = 0xC5; NZ(a);
+    // 8AE7  STA
+    start = cycles; cycles += 3; executed++; WR(0x96, a);
+    // 8AE9  LDA
+    start = cycles; cycles += 2; executed++; a = 0xEC; NZ(a);
+    // 8AEB  STA
+    start = cycles; cycles += 3; executed++; WR(0x97, a);
+    // 8AED  AND
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x03 + x); a &= RD(ea); NZ(a);
+    IO_EXIT(0x8AEF);
+    // 8AEF  CMP
+    start = cycles; cycles += 3; executed++; CMP(a, RD(0x83));
+    // 8AF1  LDY
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x1B + x); y = RD(ea); NZ(y);
+    // 8AF3  LDX
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0696 + y); cycles += PAGE_CROSSED(0x0696, ea); x = RD(ea); NZ(x);
+    // 8AF6  TAX
+    start = cycles; cycles += 2; executed++; x = a; NZ(x);
+    // 8AF7  LSR
+    start = cycles; cycles += 6; executed++; t = RD(0x03C4); LSR(t); WR(0x03C4, t);
+    // 8AFA  PHA
+    start = cycles; cycles += 3; executed++; PUSH(a);
+    // 8AFB  LDA
+    start = cycles; cycles += 2; executed++; a = 0xB3; NZ(a);
+    // 8AFD  STA
+    start = cycles; cycles += 3; executed++; WR(0x51, a);
+    // 8AFF  LDA
+    start = cycles; cycles += 2; executed++; a = 0x03; NZ(a);
+    // 8B01  STA
+    start = cycles; cycles += 3; executed++; WR(0x52, a);
+    // 8B03  AND
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x51); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a &= RD(ea); NZ(a);
+    IO_EXIT(0x8B05);
+    // 8B05  EOR
+    start = cycles; cycles += 2; executed++; a ^= 0x64; NZ(a);
+    // 8B07  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x001D + x); cycles += PAGE_CROSSED(0x001D, ea); ADC(RD(ea));
+    // 8B0A  EOR
+    start = cycles; cycles += 2; executed++; a ^= 0x5F; NZ(a);
+    // 8B0C  BCC
+    start = cycles; cycles += 2; executed++; if (!(p & F_C)) { cycles += 1; EXIT(0x8B11); }
+    EXIT(0x8B0E);
+}
+
+static int block_8B0E(espnes_context *ctx)
+{
+    BEGIN;
+    // 8B0E  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0676); NZ(a);
+    EXIT(0x8B11);
+}
+
+static int block_8B11(espnes_context *ctx)
+{
+    BEGIN;
+    // 8B11  SEI
+    start = cycles; cycles += 2; executed++; SETF(F_I, 1);
+    // 8B12  CMP
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x8B62 + x); cycles += PAGE_CROSSED(0x8B62, ea); CMP(a, RD(ea));
+    IO_EXIT(0x8B15);
+    // 8B15  ROL
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x064B + x); t = RD(ea); ROL(t); WR(ea, t);
+    // 8B18  SBC
+    start = cycles; cycles += 3; executed++; SBC(RD(0x45));
+    // 8B1A  LSR
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x29 + x); t = RD(ea); LSR(t); WR(ea, t);
+    // 8B1C  LDX
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x11 + y); x = RD(ea); NZ(x);
+    // 8B1E  STA
+    start = cycles; cycles += 5; executed++; ea = (uint16_t)(0x00F3 + y); WR(ea, a);
+    // 8B21  INC
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x04CD + x); t = RD(ea); t++; NZ(t); WR(ea, t);
+    // 8B24  CPX
+    start = cycles; cycles += 3; executed++; CMP(x, RD(0x0D));
+    // 8B26  LDX
+    start = cycles; cycles += 3; executed++; x = RD(0x83); NZ(x);
+    // 8B28  LDX
+    start = cycles; cycles += 2; executed++; x = 0xAF; NZ(x);
+    // 8B2A  BIT
+    start = cycles; cycles += 3; executed++; BIT(RD(0x09));
+    // 8B2C  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 1; EXIT(0x8B31); }
+    EXIT(0x8B2E);
+}
+
+static int block_8B2E(espnes_context *ctx)
+{
+    BEGIN;
+    // 8B2E  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x8F21); NZ(a);
+    IO_EXIT(0x8B31);
+    EXIT(0x8B31);
+}
+
+static int block_8B31(espnes_context *ctx)
+{
+    BEGIN;
+    // 8B31  CMP
+    start = cycles; cycles += 3; executed++; CMP(a, RD(0x63));
+    // 8B33  CLD
+    start = cycles; cycles += 2; executed++; SETF(F_D, 0);
+    // 8B34  ADC
+    start = cycles; cycles += 4; executed++; ADC(RD(0xFAD4));
+    IO_EXIT(0x8B37);
+    // 8B37  DEC
+    start = cycles; cycles += 6; executed++; t = RD(0x0629); t--; NZ(t); WR(0x0629, t);
+    // 8B3A  PHA
+    start = cycles; cycles += 3; executed++; PUSH(a);
+    // 8B3B  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x16 + x); a ^= RD(ea); NZ(a);
+    // 8B3D  BVS
+    start = cycles; cycles += 2; executed++; if (p & F_V) { cycles += 1; EXIT(0x8B42); }
+    EXIT(0x8B3F);
+}
+
+static int block_8B3F(espnes_context *ctx)
+{
+    BEGIN;
+    // 8B3F  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0511); NZ(a);
+    EXIT(0x8B42);
+}
+
+static int block_8B42(espnes_context *ctx)
+{
+    BEGIN;
+    // 8B42  ROL
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x01E8 + x); t = RD(ea); ROL(t); WR(ea, t);
+    // 8B45  PHA
+    start = cycles; cycles += 3; executed++; PUSH(a);
+    // 8B46  STY
+    start = cycles; cycles += 3; executed++; WR(0x3D, y);
+    // 8B48  DEC
+    start = cycles; cycles += 6; executed++; t = RD(0x0228); t--; NZ(t); WR(0x0228, t);
+    // 8B4B  SEI
+    start = cycles; cycles += 2; executed++; SETF(F_I, 1);
+    // 8B4C  ROR
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x32 + x); t = RD(ea); ROR(t); WR(ea, t);
+    // 8B4E  ROL
+    start = cycles; cycles += 6; executed++; t = RD(0x05FA); ROL(t); WR(0x05FA, t);
+    // 8B51  ROR
+    start = cycles; cycles += 6; executed++; t = RD(0x0696); ROR(t); WR(0x0696, t);
+    // 8B54  ROL
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x0684 + x); t = RD(ea); ROL(t); WR(ea, t);
+    // 8B57  STA
+    start = cycles; cycles += 4; executed++; WR(0x0497, a);
+    // 8B5A  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x8D68 + y); cycles += PAGE_CROSSED(0x8D68, ea); ADC(RD(ea));
+    IO_EXIT(0x8B5D);
+    // 8B5D  BVS
+    start = cycles; cycles += 2; executed++; if (p & F_V) { cycles += 1; EXIT(0x8B62); }
+    EXIT(0x8B5F);
+}
+
+static int block_8B5F(espnes_context *ctx)
+{
+    BEGIN;
+    // 8B5F  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x9DB6); NZ(a);
+    IO_EXIT(0x8B62);
+    EXIT(0x8B62);
+}
+
+static int block_8B62(espnes_context *ctx)
+{
+    BEGIN;
+    // 8B62  STX
+    start = cycles; cycles += 4; executed++; WR(0x068D, x);
+    // 8B65  ASL
+    start = cycles; cycles += 5; executed++; t = RD(0x08); ASL(t); WR(0x08, t);
+    // 8B67  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x05E3 + x); cycles += PAGE_CROSSED(0x05E3, ea); ADC(RD(ea));
+    // 8B6A  TSX
+    start = cycles; cycles += 2; executed++; x = sp; NZ(x);
+    // 8B6B  ORA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0411 + y); cycles += PAGE_CROSSED(0x0411, ea); a |= RD(ea); NZ(a);
+    // 8B6E  LSR
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x0134 + x); t = RD(ea); LSR(t); WR(ea, t);
+    // 8B71  BCC
+    start = cycles; cycles += 2; executed++; if (!(p & F_C)) { cycles += 1; EXIT(0x8B76); }
+    EXIT(0x8B73);
+}
+
+static int block_8B73(espnes_context *ctx)
+{
+    BEGIN;
+    // 8B73  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0610); NZ(a);
+    EXIT(0x8B76);
+}
+
+static int block_8B76(espnes_context *ctx)
+{
+    BEGIN;
+    // 8B76  LDA
+    start = cycles; cycles += 2; executed++; a = 0xB4; NZ(a);
+    // 8B78  STA
+    start = cycles; cycles += 3; executed++; WR(0x15, a);
+    // 8B7A  LDA
+    start = cycles; cycles += 2; executed++; a = 0x06; NZ(a);
+    // 8B7C  STA
+    start = cycles; cycles += 3; executed++; WR(0x16, a);
+    // 8B7E  CMP
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x15); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); CMP(a, RD(ea));
+    IO_EXIT(0x8B80);
+    // 8B80  ORA
+    start = cycles; cycles += 4; executed++; a |= RD(0xC5DB); NZ(a);
+    IO_EXIT(0x8B83);
+    // 8B83  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xB044 + x); cycles += PAGE_CROSSED(0xB044, ea); ADC(RD(ea));
+    IO_EXIT(0x8B86);
+    // 8B86  ROL
+    start = cycles; cycles += 2; executed++; ROL(a);
+    // 8B87  LDX
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x72 + y); x = RD(ea); NZ(x);
+    // 8B89  LDY
+    start = cycles; cycles += 2; executed++; y = 0xB0; NZ(y);
+    // 8B8B  LDA
+    start = cycles; cycles += 2; executed++; a = 0xCB; NZ(a);
+    // 8B8D  STA
+    start = cycles; cycles += 3; executed++; WR(0x5A, a);
+    // 8B8F  LDA
+    start = cycles; cycles += 2; executed++; a = 0x01; NZ(a);
+    // 8B91  STA
+    start = cycles; cycles += 3; executed++; WR(0x5B, a);
+    // 8B93  ADC
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x5A); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); ADC(RD(ea));
+    IO_EXIT(0x8B95);
+    // 8B95  ROR
+    start = cycles; cycles += 2; executed++; ROR(a);
+    // 8B96  BCC
+    start = cycles; cycles += 2; executed++; if (!(p & F_C)) { cycles += 1; EXIT(0x8B9B); }
+    EXIT(0x8B98);
+}
+
+static int block_8B98(espnes_context *ctx)
+{
+    BEGIN;
+    // 8B98  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x02CE); NZ(a);
+    EXIT(0x8B9B);
+}
+
+static int block_8B9B(espnes_context *ctx)
+{
+    BEGIN;
+    // 8B9B  ORA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xDFF7 + x); cycles += PAGE_CROSSED(0xDFF7, ea); a |= RD(ea); NZ(a);
+    IO_EXIT(0x8B9E);
+    // 8B9E  LSR
+    start = cycles; cycles += 2; executed++; LSR(a);
+    // 8B9F  NOP
+    start = cycles; cycles += 2; executed++; 
+    // 8BA0  LSR
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x0244 + x); t = RD(ea); LSR(t); WR(ea, t);
+    // 8BA3  ASL
+    start = cycles; cycles += 2; executed++; ASL(a);
+    // 8BA4  ORA
+    start = cycles; cycles += 3; executed++; a |= RD(0x00); NZ(a);
+    // 8BA6  LDA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xEC6D + y); cycles += PAGE_CROSSED(0xEC6D, ea); a = RD(ea); NZ(a);
+    IO_EXIT(0x8BA9);
+    // 8BA9  AND
+    start = cycles; cycles += 3; executed++; a &= RD(0xF0); NZ(a);
+    // 8BAB  BMI
+    start = cycles; cycles += 2; executed++; if (p & F_N) { cycles += 1; EXIT(0x8BB0); }
+    EXIT(0x8BAD);
+}
+
+static int block_8BAD(espnes_context *ctx)
+{
+    BEGIN;
+    // 8BAD  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x06C2); NZ(a);
+    EXIT(0x8BB0);
+}
+
+static int block_8BB0(espnes_context *ctx)
+{
+    BEGIN;
+    // 8BB0  SBC
+    start = cycles; cycles += 2; executed++; SBC(0xFC);
+    // 8BB2  CMP
+    start = cycles; cycles += 2; executed++; CMP(a, 0x8B);
+    // 8BB4  DEX
+    start = cycles; cycles += 2; executed++; x--; NZ(x);
+    // 8BB5  STY
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x09 + x); WR(ea, y);
+    // 8BB7  LSR
+    start = cycles; cycles += 6; executed++; t = RD(0x04E4); LSR(t); WR(0x04E4, t);
+    // 8BBA  CPX
+    start = cycles; cycles += 2; executed++; CMP(x, 0xCD);
+    // 8BBC  DEC
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0xDE + x); t = RD(ea); t--; NZ(t); WR(ea, t);
+    // 8BBE  DEX
+    start = cycles; cycles += 2; executed++; x--; NZ(x);
+    // 8BBF  SED
+    start = cycles; cycles += 2; executed++; SETF(F_D, 1);
+    // 8BC0  CMP
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xE6 + x); CMP(a, RD(ea));
+    // 8BC2  BCC
+    start = cycles; cycles += 2; executed++; if (!(p & F_C)) { cycles += 1; EXIT(0x8BC7); }
+    EXIT(0x8BC4);
+}
+
+static int block_8BC4(espnes_context *ctx)
+{
+    BEGIN;
+    // 8BC4  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0284); NZ(a);
+    EXIT(0x8BC7);
+}
+
+static int block_8BC7(espnes_context *ctx)
+{
+    BEGIN;
+    // 8BC7  ROR
+    start = cycles; cycles += 2; executed++; ROR(a);
+    // 8BC8  LDA
+    start = cycles; cycles += 2; executed++; a = 0x8C; NZ(a);
+    // 8BCA  STA
+    start = cycles; cycles += 3; executed++; WR(0xBD, a);
+    // 8BCC  LDA
+    start = cycles; cycles += 2; executed++; a = 0x05; NZ(a);
+    // 8BCE  STA
+    start = cycles; cycles += 3; executed++; WR(0xBE, a);
+    // 8BD0  ORA
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0xBD); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a |= RD(ea); NZ(a);
+    IO_EXIT(0x8BD2);
+    // 8BD2  LDY
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x79 + x); y = RD(ea); NZ(y);
+    // 8BD4  STA
+    start = cycles; cycles += 3; executed++; WR(0xAC, a);
+    // 8BD6  LDX
+    start = cycles; cycles += 3; executed++; x = RD(0xD1); NZ(x);
+    // 8BD8  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 1; EXIT(0x8BDD); }
+    EXIT(0x8BDA);
+}
+
+static int block_8BDA(espnes_context *ctx)
+{
+    BEGIN;
+    // 8BDA  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x03ED); NZ(a);
+    EXIT(0x8BDD);
+}
+
+static int block_8BDD(espnes_context *ctx)
+{
+    BEGIN;
+    // 8BDD  DEX
+    start = cycles; cycles += 2; executed++; x--; NZ(x);
+    // 8BDE  AND
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xC0 + x); a &= RD(ea); NZ(a);
+    // 8BE0  ASL
+    start = cycles; cycles += 6; executed++; t = RD(0x04F0); ASL(t); WR(0x04F0, t);
+    // 8BE3  CLV
+    start = cycles; cycles += 2; executed++; SETF(F_V, 0);
+    // 8BE4  ORA
+    start = cycles; cycles += 4; executed++; a |= RD(0x9F73); NZ(a);
+    IO_EXIT(0x8BE7);
+    // 8BE7  AND
+    start = cycles; cycles += 2; executed++; a &= 0x4D; NZ(a);
+    // 8BE9  BCS
+    start = cycles; cycles += 2; executed++; if (p & F_C) { cycles += 1; EXIT(0x8BEE); }
+    EXIT(0x8BEB);
+}
+
+static int block_8BEB(espnes_context *ctx)
+{
+    BEGIN;
+    // 8BEB  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0033); NZ(a);
+    EXIT(0x8BEE);
+}
+
+static int block_8BEE(espnes_context *ctx)
+{
+    BEGIN;
+    // 8BEE  LDX
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xB5 + y); x = RD(ea); NZ(x);
+    // 8BF0  LSR
+    start = cycles; cycles += 5; executed++; t = RD(0x4E); LSR(t); WR(0x4E, t);
+    // 8BF2  LDA
+    start = cycles; cycles += 2; executed++; a = 0x98; NZ(a);
+    // 8BF4  STA
+    start = cycles; cycles += 3; executed++; WR(0xD6, a);
+    // 8BF6  LDA
+    start = cycles; cycles += 2; executed++; a = 0xF8; NZ(a);
+    // 8BF8  STA
+    start = cycles; cycles += 3; executed++; WR(0xD7, a);
+    // 8BFA  SBC
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0xD6); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); SBC(RD(ea));
+    IO_EXIT(0x8BFC);
+    // 8BFC  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 2; EXIT(0x8C01); }
+    EXIT(0x8BFE);
+}
+
+static int block_8BFE(espnes_context *ctx)
+{
+    BEGIN;
+    // 8BFE  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x011F); NZ(a);
+    EXIT(0x8C01);
+}
+
+static int block_8C01(espnes_context *ctx)
+{
+    BEGIN;
+    // 8C01  LDX
+    start = cycles; cycles += 2; executed++; x = 0x56; NZ(x);
+    // 8C03  LDA
+    start = cycles; cycles += 2; executed++; a = 0x78; NZ(a);
+    // 8C05  STA
+    start = cycles; cycles += 3; executed++; WR(0xC2, a);
+    // 8C07  LDA
+    start = cycles; cycles += 2; executed++; a = 0xE0; NZ(a);
+    // 8C09  STA
+    start = cycles; cycles += 3; executed++; WR(0xC3, a);
+    // 8C0B  LDA
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x6C + x); a = RD(ea); NZ(a);
+    IO_EXIT(0x8C0D);
+    // 8C0D  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xE65E + y); cycles += PAGE_CROSSED(0xE65E, ea); ADC(RD(ea));
+    IO_EXIT(0x8C10);
+    // 8C10  PHA
+    start = cycles; cycles += 3; executed++; PUSH(a);
+    // 8C11  INC
+    start = cycles; cycles += 5; executed++; t = RD(0x1A); t++; NZ(t); WR(0x1A, t);
+    // 8C13  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 1; EXIT(0x8C18); }
+    EXIT(0x8C15);
+}
+
+static int block_8C15(espnes_context *ctx)
+{
+    BEGIN;
+    // 8C15  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xC346); NZ(a);
+    IO_EXIT(0x8C18);
+    EXIT(0x8C18);
+}
+
+static int block_8C18(espnes_context *ctx)
+{
+    BEGIN;
+    // 8C18  CPX
+    start = cycles; cycles += 4; executed++; CMP(x, RD(0xD6B3));
+    IO_EXIT(0x8C1B);
+    // 8C1B  ROL
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x93 + x); t = RD(ea); ROL(t); WR(ea, t);
+    // 8C1D  CMP
+    start = cycles; cycles += 2; executed++; CMP(a, 0xFA);
+    // 8C1F  BEQ
+    start = cycles; cycles += 2; executed++; if (p & F_Z) { cycles += 1; EXIT(0x8C24); }
+    EXIT(0x8C21);
+}
+
+static int block_8C21(espnes_context *ctx)
+{
+    BEGIN;
+    // 8C21  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0046); NZ(a);
+    EXIT(0x8C24);
+}
+
+static int block_8C24(espnes_context *ctx)
+{
+    BEGIN;
+    // 8C24  STX
+    start = cycles; cycles += 4; executed++; WR(0x0321, x);
+    // 8C27  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x9CFF + y); cycles += PAGE_CROSSED(0x9CFF, ea); a ^= RD(ea); NZ(a);
+    IO_EXIT(0x8C2A);
+    // 8C2A  BEQ
+    start = cycles; cycles += 2; executed++; if (p & F_Z) { cycles += 1; EXIT(0x8C2F); }
+    EXIT(0x8C2C);
+}
+
+static int block_8C2C(espnes_context *ctx)
+{
+    BEGIN;
+    // 8C2C  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x05D7); NZ(a);
+    EXIT(0x8C2F);
+}
+
+static int block_8C2F(espnes_context *ctx)
+{
+    BEGIN;
+    // 8C2F  CMP
+    start = cycles; cycles += 2; executed++; CMP(a, 0x79);
+    // 8C31  LDA
+    start = cycles; cycles += 2; executed++; a = 0x0B; NZ(a);
+    // 8C33  STA
+    start = cycles; cycles += 3; executed++; WR(0x75, a);
+    // 8C35  LDA
+    start = cycles; cycles += 2; executed++; a = 0xE5; NZ(a);
+    // 8C37  STA
+    start = cycles; cycles += 3; executed++; WR(0x76, a);
+    // 8C39  ADC
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x75); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); ADC(RD(ea));
+    IO_EXIT(0x8C3B);
+    // 8C3B  BMI
+    start = cycles; cycles += 2; executed++; if (p & F_N) { cycles += 1; EXIT(0x8C40); }
+    EXIT(0x8C3D);
+}
+
+static int block_8C3D(espnes_context *ctx)
+{
+    BEGIN;
+    // 8C3D  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x03E1); NZ(a);
+    EXIT(0x8C40);
+}
+
+static int block_8C40(espnes_context *ctx)
+{
+    BEGIN;
+    // 8C40  ROR
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x03E0 + x); t = RD(ea); ROR(t); WR(ea, t);
+    // 8C43  ASL
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x031B + x); t = RD(ea); ASL(t); WR(ea, t);
+    // 8C46  ASL
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x0518 + x); t = RD(ea); ASL(t); WR(ea, t);
+    // 8C49  CLC
+    start = cycles; cycles += 2; executed++; SETF(F_C, 0);
+    // 8C4A  SBC
+    start = cycles; cycles += 2; executed++; SBC(0x91);
+    // 8C4C  LDX
+    start = cycles; cycles += 2; executed++; x = 0xDB; NZ(x);
+    // 8C4E  LDA
+    start = cycles; cycles += 2; executed++; a = 0xA9; NZ(a);
+    // 8C50  STA
+    start = cycles; cycles += 3; executed++; WR(0xD7, a);
+    // 8C52  LDA
+    start = cycles; cycles += 2; executed++; a = 0xCD; NZ(a);
+    // 8C54  STA
+    start = cycles; cycles += 3; executed++; WR(0xD8, a);
+    // 8C56  ORA
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0xFC + x); a |= RD(ea); NZ(a);
+    IO_EXIT(0x8C58);
+    // 8C58  STA
+    start = cycles; cycles += 5; executed++; ea = (uint16_t)(0x0647 + y); WR(ea, a);
+    // 8C5B  TAY
+    start = cycles; cycles += 2; executed++; y = a; NZ(y);
+    // 8C5C  INC
+    start = cycles; cycles += 5; executed++; t = RD(0x47); t++; NZ(t); WR(0x47, t);
+    // 8C5E  DEC
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x7A + x); t = RD(ea); t--; NZ(t); WR(ea, t);
+    // 8C60  SED
+    start = cycles; cycles += 2; executed++; SETF(F_D, 1);
+    // 8C61  LSR
+    start = cycles; cycles += 2; executed++; LSR(a);
+    // 8C62  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 1; EXIT(0x8C67); }
+    EXIT(0x8C64);
+}
+
+static int block_8C64(espnes_context *ctx)
+{
+    BEGIN;
+    // 8C64  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0304); NZ(a);
+    EXIT(0x8C67);
+}
+
+static int block_8C67(espnes_context *ctx)
+{
+    BEGIN;
+    // 8C67  STY
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xB0 + x); WR(ea, y);
+    // 8C69  TXS
+    start = cycles; cycles += 2; executed++; sp = x;
+    // 8C6A  LDX
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xCEB7 + y); cycles += PAGE_CROSSED(0xCEB7, ea); x = RD(ea); NZ(x);
+    IO_EXIT(0x8C6D);
+    // 8C6D  ADC
+    start = cycles; cycles += 3; executed++; ADC(RD(0xE2));
+    // 8C6F  CMP
+    start = cycles; cycles += 2; executed++; CMP(a, 0x04);
+    // 8C71  EOR
+    start = cycles; cycles += 3; executed++; a ^= RD(0xE3); NZ(a);
+    // 8C73  LDA
+    start = cycles; cycles += 2; executed++; a = 0x84; NZ(a);
+    // 8C75  STA
+    start = cycles; cycles += 3; executed++; WR(0xA6, a);
+    // 8C77  LDA
+    start = cycles; cycles += 2; executed++; a = 0x00; NZ(a);
+    // 8C79  STA
+    start = cycles; cycles += 3; executed++; WR(0xA7, a);
+    // 8C7B  LDA
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0xA6); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a = RD(ea); NZ(a);
+    IO_EXIT(0x8C7D);
+    // 8C7D  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 1; EXIT(0x8C82); }
+    EXIT(0x8C7F);
+}
+
+static int block_8C7F(espnes_context *ctx)
+{
+    BEGIN;
+    // 8C7F  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x9AD9); NZ(a);
+    IO_EXIT(0x8C82);
+    EXIT(0x8C82);
+}
+
+static int block_8C82(espnes_context *ctx)
+{
+    BEGIN;
+    // 8C82  ADC
+    start = cycles; cycles += 3; executed++; ADC(RD(0x7F));
+    // 8C84  BIT
+    start = cycles; cycles += 3; executed++; BIT(RD(0xBE));
+    // 8C86  ORA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x010E + x); cycles += PAGE_CROSSED(0x010E, ea); a |= RD(ea); NZ(a);
+    // 8C89  INY
+    start = cycles; cycles += 2; executed++; y++; NZ(y);
+    // 8C8A  LSR
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0xE3 + x); t = RD(ea); LSR(t); WR(ea, t);
+    // 8C8C  SBC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0339 + x); cycles += PAGE_CROSSED(0x0339, ea); SBC(RD(ea));
+    // 8C8F  DEX
+    start = cycles; cycles += 2; executed++; x--; NZ(x);
+    // 8C90  BCC
+    start = cycles; cycles += 2; executed++; if (!(p & F_C)) { cycles += 1; EXIT(0x8C95); }
+    EXIT(0x8C92);
+}
+
+static int block_8C92(espnes_context *ctx)
+{
+    BEGIN;
+    // 8C92  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xF1AD); NZ(a);
+    IO_EXIT(0x8C95);
+    EXIT(0x8C95);
+}
+
+static int block_8C95(espnes_context *ctx)
+{
+    BEGIN;
+    // 8C95  STA
+    start = cycles; cycles += 4; executed++; WR(0x0421, a);
+    // 8C98  ASL
+    start = cycles; cycles += 6; executed++; t = RD(0x06E2); ASL(t); WR(0x06E2, t);
+    // 8C9B  LDA
+    start = cycles; cycles += 2; executed++; a = 0xE0; NZ(a);
+    // 8C9D  STA
+    start = cycles; cycles += 3; executed++; WR(0x1D, a);
+    // 8C9F  LDA
+    start = cycles; cycles += 2; executed++; a = 0x06; NZ(a);
+    // 8CA1  STA
+    start = cycles; cycles += 3; executed++; WR(0x1E, a);
+    // 8CA3  CMP
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x1D); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); CMP(a, RD(ea));
+    IO_EXIT(0x8CA5);
+    // 8CA5  BCS
+    start = cycles; cycles += 2; executed++; if (p & F_C) { cycles += 1; EXIT(0x8CAA); }
+    EXIT(0x8CA7);
+}
+
+static int block_8CA7(espnes_context *ctx)
+{
+    BEGIN;
+    // 8CA7  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xFE22); NZ(a);
+    IO_EXIT(0x8CAA);
+    EXIT(0x8CAA);
+}
+
+static int block_8CAA(espnes_context *ctx)
+{
+    BEGIN;
+    // 8CAA  INC
+    start = cycles; cycles += 6; executed++; t = RD(0x055A); t++; NZ(t); WR(0x055A, t);
+    // 8CAD  ASL
+    start = cycles; cycles += 6; executed++; t = RD(0x062F); ASL(t); WR(0x062F, t);
+    // 8CB0  CPX
+    start = cycles; cycles += 4; executed++; CMP(x, RD(0xB3F1));
+    IO_EXIT(0x8CB3);
+    // 8CB3  SED
+    start = cycles; cycles += 2; executed++; SETF(F_D, 1);
+    // 8CB4  LSR
+    start = cycles; cycles += 6; executed++; t = RD(0x06DB); LSR(t); WR(0x06DB, t);
+    // 8CB7  EOR
+    start = cycles; cycles += 3; executed++; a ^= RD(0xD4); NZ(a);
+    // 8CB9  NOP
+    start = cycles; cycles += 2; executed++; 
+    // 8CBA  BVC
+    start = cycles; cycles += 2; executed++; if (!(p & F_V)) { cycles += 1; EXIT(0x8CBF); }
+    EXIT(0x8CBC);
+}
+
+static int block_8CBC(espnes_context *ctx)
+{
+    BEGIN;
+    // 8CBC  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x04D9); NZ(a);
+    EXIT(0x8CBF);
+}
+
+static int block_8CBF(espnes_context *ctx)
+{
+    BEGIN;
+    // 8CBF  LDA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0133 + y); cycles += PAGE_CROSSED(0x0133, ea); a = RD(ea); NZ(a);
+    // 8CC2  LDA
+    start = cycles; cycles += 2; executed++; a = 0xBD; NZ(a);
+    // 8CC4  STA
+    start = cycles; cycles += 3; executed++; WR(0x22, a);
+    // 8CC6  LDA
+    start = cycles; cycles += 2; executed++; a = 0xCE; NZ(a);
+    // 8CC8  STA
+    start = cycles; cycles += 3; executed++; WR(0x23, a);
+    // 8CCA  LDA
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x22); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a = RD(ea); NZ(a);
+    IO_EXIT(0x8CCC);
+    // 8CCC  LDA
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x12 + x); a = RD(ea); NZ(a);
+    // 8CCE  CPX
+    start = cycles; cycles += 3; executed++; CMP(x, RD(0x26));
+    // 8CD0  TAX
+    start = cycles; cycles += 2; executed++; x = a; NZ(x);
+    // 8CD1  CLC
+    start = cycles; cycles += 2; executed++; SETF(F_C, 0);
+    // 8CD2  BVC
+    start = cycles; cycles += 2; executed++; if (!(p & F_V)) { cycles += 1; EXIT(0x8CD7); }
+    EXIT(0x8CD4);
+}
+
+static int block_8CD4(espnes_context *ctx)
+{
+    BEGIN;
+    // 8CD4  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xD6D8); NZ(a);
+    IO_EXIT(0x8CD7);
+    EXIT(0x8CD7);
+}
+
+static int block_8CD7(espnes_context *ctx)
+{
+    BEGIN;
+    // 8CD7  SEI
+    start = cycles; cycles += 2; executed++; SETF(F_I, 1);
+    // 8CD8  BPL
+    start = cycles; cycles += 2; executed++; if (!(p & F_N)) { cycles += 1; EXIT(0x8CDD); }
+    EXIT(0x8CDA);
+}
+
+static int block_8CDA(espnes_context *ctx)
+{
+    BEGIN;
+    // 8CDA  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0566); NZ(a);
+    EXIT(0x8CDD);
+}
+
+static int block_8CDD(espnes_context *ctx)
+{
+    BEGIN;
+    // 8CDD  ASL
+    start = cycles; cycles += 6; executed++; t = RD(0x0677); ASL(t); WR(0x0677, t);
+    // 8CE0  SBC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0603 + x); cycles += PAGE_CROSSED(0x0603, ea); SBC(RD(ea));
+    // 8CE3  STA
+    start = cycles; cycles += 4; executed++; WR(0x01A9, a);
+    // 8CE6  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0019 + x); cycles += PAGE_CROSSED(0x0019, ea); ADC(RD(ea));
+    // 8CE9  BVC
+    start = cycles; cycles += 2; executed++; if (!(p & F_V)) { cycles += 1; EXIT(0x8CEE); }
+    EXIT(0x8CEB);
+}
+
+static int block_8CEB(espnes_context *ctx)
+{
+    BEGIN;
+    // 8CEB  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x053D); NZ(a);
+    EXIT(0x8CEE);
+}
+
+static int block_8CEE(espnes_context *ctx)
+{
+    BEGIN;
+    // 8CEE  ROL
+    start = cycles; cycles += 6; executed++; t = RD(0x04C6); ROL(t); WR(0x04C6, t);
+    // 8CF1  ORA
+    start = cycles; cycles += 3; executed++; a |= RD(0x62); NZ(a);
+    // 8CF3  LDA
+    start = cycles; cycles += 2; executed++; a = 0xE5; NZ(a);
+    // 8CF5  STA
+    start = cycles; cycles += 3; executed++; WR(0x6E, a);
+    // 8CF7  LDA
+    start = cycles; cycles += 2; executed++; a = 0x84; NZ(a);
+    // 8CF9  STA
+    start = cycles; cycles += 3; executed++; WR(0x6F, a);
+    // 8CFB  SBC
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x6E); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); SBC(RD(ea));
+    IO_EXIT(0x8CFD);
+    // 8CFD  LDY
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xE3 + x); y = RD(ea); NZ(y);
+    // 8CFF  BVC
+    start = cycles; cycles += 2; executed++; if (!(p & F_V)) { cycles += 1; EXIT(0x8D04); }
+    EXIT(0x8D01);
+}
+
+static int block_8D01(espnes_context *ctx)
+{
+    BEGIN;
+    // 8D01  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0442); NZ(a);
+    EXIT(0x8D04);
+}
+
+static int block_8D04(espnes_context *ctx)
+{
+    BEGIN;
+    // 8D04  TSX
+    start = cycles; cycles += 2; executed++; x = sp; NZ(x);
+    // 8D05  DEY
+    start = cycles; cycles += 2; executed++; y--; NZ(y);
+    // 8D06  LDA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x8A95 + y); cycles += PAGE_CROSSED(0x8A95, ea); a = RD(ea); NZ(a);
+    IO_EXIT(0x8D09);
+    // 8D09  CMP
+    start = cycles; cycles += 3; executed++; CMP(a, RD(0xFF));
+    // 8D0B  LDX
+    start = cycles; cycles += 4; executed++; x = RD(0x0079); NZ(x);
+    // 8D0E  LDY
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x1C + x); y = RD(ea); NZ(y);
+    // 8D10  LDA
+    start = cycles; cycles += 2; executed++; a = 0x72; NZ(a);
+    // 8D12  STA
+    start = cycles; cycles += 3; executed++; WR(0x1D, a);
+    // 8D14  LDA
+    start = cycles; cycles += 2; executed++; a = 0x01; NZ(a);
+    // 8D16  STA
+    start = cycles; cycles += 3; executed++; WR(0x1E, a);
+    // 8D18  LDA
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x1D); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a = RD(ea); NZ(a);
+    IO_EXIT(0x8D1A);
+    // 8D1A  LDY
+    start = cycles; cycles += 2; executed++; y = 0xA5; NZ(y);
+    // 8D1C  CPY
+    start = cycles; cycles += 4; executed++; CMP(y, RD(0xB491));
+    IO_EXIT(0x8D1F);
+    // 8D1F  LSR
+    start = cycles; cycles += 6; executed++; t = RD(0x0476); LSR(t); WR(0x0476, t);
+    // 8D22  CMP
+    start = cycles; cycles += 2; executed++; CMP(a, 0x6F);
+    // 8D24  TYA
+    start = cycles; cycles += 2; executed++; a = y; NZ(a);
+    // 8D25  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 1; EXIT(0x8D2A); }
+    EXIT(0x8D27);
+}
+
+static int block_8D27(espnes_context *ctx)
+{
+    BEGIN;
+    // 8D27  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0434); NZ(a);
+    EXIT(0x8D2A);
+}
+
+static int block_8D2A(espnes_context *ctx)
+{
+    BEGIN;
+    // 8D2A  ADC
+    start = cycles; cycles += 3; executed++; ADC(RD(0x4F));
+    // 8D2C  ROL
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x75 + x); t = RD(ea); ROL(t); WR(ea, t);
+    // 8D2E  BCS
+    start = cycles; cycles += 2; executed++; if (p & F_C) { cycles += 1; EXIT(0x8D33); }
+    EXIT(0x8D30);
+}
+
+static int block_8D30(espnes_context *ctx)
+{
+    BEGIN;
+    // 8D30  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0249); NZ(a);
+    EXIT(0x8D33);
+}
+
+static int block_8D33(espnes_context *ctx)
+{
+    BEGIN;
+    // 8D33  LDY
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xF69C + x); cycles += PAGE_CROSSED(0xF69C, ea); y = RD(ea); NZ(y);
+    IO_EXIT(0x8D36);
+    // 8D36  SBC
+    start = cycles; cycles += 2; executed++; SBC(0xB5);
+    // 8D38  CLC
+    start = cycles; cycles += 2; executed++; SETF(F_C, 0);
+    // 8D39  CPY
+    start = cycles; cycles += 3; executed++; CMP(y, RD(0x8B));
+    // 8D3B  BCS
+    start = cycles; cycles += 2; executed++; if (p & F_C) { cycles += 1; EXIT(0x8D40); }
+    EXIT(0x8D3D);
+}
+
+static int block_8D3D(espnes_context *ctx)
+{
+    BEGIN;
+    // 8D3D  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x9F7E); NZ(a);
+    IO_EXIT(0x8D40);
+    EXIT(0x8D40);
+}
+
+static int block_8D40(espnes_context *ctx)
+{
+    BEGIN;
+    // 8D40  AND
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0621 + y); cycles += PAGE_CROSSED(0x0621, ea); a &= RD(ea); NZ(a);
+    // 8D43  STA
+    start = cycles; cycles += 4; executed++; WR(0x04E3, a);
+    // 8D46  LDA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xDF93 + y); cycles += PAGE_CROSSED(0xDF93, ea); a = RD(ea); NZ(a);
+    IO_EXIT(0x8D49);
+    // 8D49  ASL
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x0588 + x); t = RD(ea); ASL(t); WR(ea, t);
+    // 8D4C  CLV
+    start = cycles; cycles += 2; executed++; SETF(F_V, 0);
+    // 8D4D  STA
+    start = cycles; cycles += 5; executed++; ea = (uint16_t)(0x00A0 + y); WR(ea, a);
+    // 8D50  SBC
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x3D + x); SBC(RD(ea));
+    // 8D52  ROR
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x58 + x); t = RD(ea); ROR(t); WR(ea, t);
+    // 8D54  SED
+    start = cycles; cycles += 2; executed++; SETF(F_D, 1);
+    // 8D55  BMI
+    start = cycles; cycles += 2; executed++; if (p & F_N) { cycles += 1; EXIT(0x8D5A); }
+    EXIT(0x8D57);
+}
+
+static int block_8D57(espnes_context *ctx)
+{
+    BEGIN;
+    // 8D57  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x043E); NZ(a);
+    EXIT(0x8D5A);
+}
+
+static int block_8D5A(espnes_context *ctx)
+{
+    BEGIN;
+    // 8D5A  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xC8B5 + y); cycles += PAGE_CROSSED(0xC8B5, ea); a ^= RD(ea); NZ(a);
+    IO_EXIT(0x8D5D);
+    // 8D5D  PHP
+    start = cycles; cycles += 3; executed++; PUSH(p | F_B | F_U);
+    // 8D5E  LDA
+    start = cycles; cycles += 2; executed++; a = 0x6D; NZ(a);
+    // 8D60  STA
+    start = cycles; cycles += 3; executed++; WR(0x36, a);
+    // 8D62  LDA
+    start = cycles; cycles += 2; executed++; a = 0x04; NZ(a);
+    // 8D64  STA
+    start = cycles; cycles += 3; executed++; WR(0x37, a);
+    // 8D66  LDA
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x36); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a = RD(ea); NZ(a);
+    IO_EXIT(0x8D68);
+    // 8D68  ORA
+    start = cycles; cycles += 2; executed++; a |= 0x15; NZ(a);
+    // 8D6A  TSX
+    start = cycles; cycles += 2; executed++; x = sp; NZ(x);
+    // 8D6B  CLC
+    start = cycles; cycles += 2; executed++; SETF(F_C, 0);
+    // 8D6C  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xD8 + x); ADC(RD(ea));
+    // 8D6E  LDX
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xB766 + y); cycles += PAGE_CROSSED(0xB766, ea); x = RD(ea); NZ(x);
+    IO_EXIT(0x8D71);
+    // 8D71  BVS
+    start = cycles; cycles += 2; executed++; if (p & F_V) { cycles += 1; EXIT(0x8D76); }
+    EXIT(0x8D73);
+}
+
+static int block_8D73(espnes_context *ctx)
+{
+    BEGIN;
+    // 8D73  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xF3C0); NZ(a);
+    IO_EXIT(0x8D76);
+    EXIT(0x8D76);
+}
+
+static int block_8D76(espnes_context *ctx)
+{
+    BEGIN;
+    // 8D76  SBC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x8E75 + x); cycles += PAGE_CROSSED(0x8E75, ea); SBC(RD(ea));
+    IO_EXIT(0x8D79);
+    // 8D79  ASL
+    start = cycles; cycles += 5; executed++; t = RD(0x97); ASL(t); WR(0x97, t);
+    // 8D7B  LDX
+    start = cycles; cycles += 2; executed++; x = 0xA2; NZ(x);
+    // 8D7D  LDA
+    start = cycles; cycles += 2; executed++; a = 0x74; NZ(a);
+    // 8D7F  STA
+    start = cycles; cycles += 3; executed++; WR(0x99, a);
+    // 8D81  LDA
+    start = cycles; cycles += 2; executed++; a = 0x96; NZ(a);
+    // 8D83  STA
+    start = cycles; cycles += 3; executed++; WR(0x9A, a);
+    // 8D85  AND
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0xF7 + x); a &= RD(ea); NZ(a);
+    IO_EXIT(0x8D87);
+    // 8D87  DEC
+    start = cycles; cycles += 5; executed++; t = RD(0x58); t--; NZ(t); WR(0x58, t);
+    // 8D89  BCC
+    start = cycles; cycles += 2; executed++; if (!(p & F_C)) { cycles += 1; EXIT(0x8D8E); }
+    EXIT(0x8D8B);
+}
+
+static int block_8D8B(espnes_context *ctx)
+{
+    BEGIN;
+    // 8D8B  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xC9B9); NZ(a);
+    IO_EXIT(0x8D8E);
+    EXIT(0x8D8E);
+}
+
+static int block_8D8E(espnes_context *ctx)
+{
+    BEGIN;
+    // 8D8E  INC
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x00CF + x); t = RD(ea); t++; NZ(t); WR(ea, t);
+    // 8D91  AND
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xB757 + y); cycles += PAGE_CROSSED(0xB757, ea); a &= RD(ea); NZ(a);
+    IO_EXIT(0x8D94);
+    // 8D94  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xE2 + x); ADC(RD(ea));
+    // 8D96  LDX
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x3F + y); x = RD(ea); NZ(x);
+    // 8D98  LDX
+    start = cycles; cycles += 2; executed++; x = 0xB4; NZ(x);
+    // 8D9A  TAX
+    start = cycles; cycles += 2; executed++; x = a; NZ(x);
+    // 8D9B  ORA
+    start = cycles; cycles += 4; executed++; a |= RD(0x0201); NZ(a);
+    // 8D9E  ROL
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x0361 + x); t = RD(ea); ROL(t); WR(ea, t);
+    // 8DA1  STA
+    start = cycles; cycles += 5; executed++; ea = (uint16_t)(0x06EC + x); WR(ea, a);
+    // 8DA4  LDA
+    start = cycles; cycles += 2; executed++; a = 0x4E; NZ(a);
+    // 8DA6  BEQ
+    start = cycles; cycles += 2; executed++; if (p & F_Z) { cycles += 1; EXIT(0x8DAB); }
+    EXIT(0x8DA8);
+}
+
+static int block_8DA8(espnes_context *ctx)
+{
+    BEGIN;
+    // 8DA8  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xFEF5); NZ(a);
+    IO_EXIT(0x8DAB);
+    EXIT(0x8DAB);
+}
+
+static int block_8DAB(espnes_context *ctx)
+{
+    BEGIN;
+    // 8DAB  PHA
+    start = cycles; cycles += 3; executed++; PUSH(a);
+    // 8DAC  STA
+    start = cycles; cycles += 3; executed++; WR(0xDD, a);
+    // 8DAE  SED
+    start = cycles; cycles += 2; executed++; SETF(F_D, 1);
+    // 8DAF  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0047 + x); cycles += PAGE_CROSSED(0x0047, ea); a ^= RD(ea); NZ(a);
+    // 8DB2  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0151 + x); cycles += PAGE_CROSSED(0x0151, ea); a ^= RD(ea); NZ(a);
+    // 8DB5  EOR
+    start = cycles; cycles += 4; executed++; a ^= RD(0x83B5); NZ(a);
+    IO_EXIT(0x8DB8);
+    // 8DB8  LSR
+    start = cycles; cycles += 5; executed++; t = RD(0xFB); LSR(t); WR(0xFB, t);
+    // 8DBA  STY
+    start = cycles; cycles += 4; executed++; WR(0x02F4, y);
+    // 8DBD  LDA
+    start = cycles; cycles += 2; executed++; a = 0x81; NZ(a);
+    // 8DBF  STA
+    start = cycles; cycles += 3; executed++; WR(0xEB, a);
+    // 8DC1  LDA
+    start = cycles; cycles += 2; executed++; a = 0x8B; NZ(a);
+    // 8DC3  STA
+    start = cycles; cycles += 3; executed++; WR(0xEC, a);
+    // 8DC5  SBC
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0xEB); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); SBC(RD(ea));
+    IO_EXIT(0x8DC7);
+    // 8DC7  CLC
+    start = cycles; cycles += 2; executed++; SETF(F_C, 0);
+    // 8DC8  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 1; EXIT(0x8DCD); }
+    EXIT(0x8DCA);
+}
+
+static int block_8DCA(espnes_context *ctx)
+{
+    BEGIN;
+    // 8DCA  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xAA84); NZ(a);
+    IO_EXIT(0x8DCD);
+    EXIT(0x8DCD);
+}
+
+static int block_8DCD(espnes_context *ctx)
+{
+    BEGIN;
+    // 8DCD  CLD
+    start = cycles; cycles += 2; executed++; SETF(F_D, 0);
+    // 8DCE  SBC
+    start = cycles; cycles += 4; executed++; SBC(RD(0xF205));
+    IO_EXIT(0x8DD1);
+    // 8DD1  CLD
+    start = cycles; cycles += 2; executed++; SETF(F_D, 0);
+    // 8DD2  INC
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x0099 + x); t = RD(ea); t++; NZ(t); WR(ea, t);
+    // 8DD5  LDY
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xFE + x); y = RD(ea); NZ(y);
+    // 8DD7  DEC
+    start = cycles; cycles += 5; executed++; t = RD(0xAC); t--; NZ(t); WR(0xAC, t);
+    // 8DD9  BMI
+    start = cycles; cycles += 2; executed++; if (p & F_N) { cycles += 1; EXIT(0x8DDE); }
+    EXIT(0x8DDB);
+}
+
+static int block_8DDB(espnes_context *ctx)
+{
+    BEGIN;
+    // 8DDB  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xB4D5); NZ(a);
+    IO_EXIT(0x8DDE);
+    EXIT(0x8DDE);
+}
+
+static int block_8DDE(espnes_context *ctx)
+{
+    BEGIN;
+    // 8DDE  PLA
+    start = cycles; cycles += 4; executed++; a = PULL(); NZ(a);
+    // 8DDF  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xB7D6 + x); cycles += PAGE_CROSSED(0xB7D6, ea); ADC(RD(ea));
+    IO_EXIT(0x8DE2);
+    // 8DE2  DEC
+    start = cycles; cycles += 6; executed++; t = RD(0x06EB); t--; NZ(t); WR(0x06EB, t);
+    // 8DE5  INY
+    start = cycles; cycles += 2; executed++; y++; NZ(y);
+    // 8DE6  BCC
+    start = cycles; cycles += 2; executed++; if (!(p & F_C)) { cycles += 1; EXIT(0x8DEB); }
+    EXIT(0x8DE8);
+}
+
+static int block_8DE8(espnes_context *ctx)
+{
+    BEGIN;
+    // 8DE8  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x945F); NZ(a);
+    IO_EXIT(0x8DEB);
+    EXIT(0x8DEB);
+}
+
+static int block_8DEB(espnes_context *ctx)
+{
+    BEGIN;
+    // 8DEB  CPY
+    start = cycles; cycles += 2; executed++; CMP(y, 0x20);
+    // 8DED  BMI
+    start = cycles; cycles += 2; executed++; if (p & F_N) { cycles += 1; EXIT(0x8DF2); }
+    EXIT(0x8DEF);
+}
+
+static int block_8DEF(espnes_context *ctx)
+{
+    BEGIN;
+    // 8DEF  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x06A7); NZ(a);
+    EXIT(0x8DF2);
+}
+
+static int block_8DF2(espnes_context *ctx)
+{
+    BEGIN;
+    // 8DF2  TYA
+    start = cycles; cycles += 2; executed++; a = y; NZ(a);
+    // 8DF3  LDX
+    start = cycles; cycles += 2; executed++; x = 0x70; NZ(x);
+    // 8DF5  LDA
+    start = cycles; cycles += 2; executed++; a = 0x4C; NZ(a);
+    // 8DF7  STA
+    start = cycles; cycles += 3; executed++; WR(0x22, a);
+    // 8DF9  LDA
+    start = cycles; cycles += 2; executed++; a = 0x03; NZ(a);
+    // 8DFB  STA
+    start = cycles; cycles += 3; executed++; WR(0x23, a);
+    // 8DFD  ORA
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0xB2 + x); a |= RD(ea); NZ(a);
+    IO_EXIT(0x8DFF);
+    // 8DFF  LDX
+    start = cycles; cycles += 3; executed++; x = RD(0x65); NZ(x);
+    // 8E01  LDA
+    start = cycles; cycles += 2; executed++; a = 0x0A; NZ(a);
+    // 8E03  STA
+    start = cycles; cycles += 3; executed++; WR(0x8C, a);
+    // 8E05  LDA
+    start = cycles; cycles += 2; executed++; a = 0xFF; NZ(a);
+    // 8E07  STA
+    start = cycles; cycles += 3; executed++; WR(0x8D, a);
+    // 8E09  ADC
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x8C); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); ADC(RD(ea));
+    IO_EXIT(0x8E0B);
+    // 8E0B  ROL
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x90 + x); t = RD(ea); ROL(t); WR(ea, t);
+    // 8E0D  BVS
+    start = cycles; cycles += 2; executed++; if (p & F_V) { cycles += 1; EXIT(0x8E12); }
+    EXIT(0x8E0F);
+}
+
+static int block_8E0F(espnes_context *ctx)
+{
+    BEGIN;
+    // 8E0F  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x972D); NZ(a);
+    IO_EXIT(0x8E12);
+    EXIT(0x8E12);
+}
+
+static int block_8E12(espnes_context *ctx)
+{
+    BEGIN;
+    // 8E12  TAX
+    start = cycles; cycles += 2; executed++; x = a; NZ(x);
+    // 8E13  LDX
+    start = cycles; cycles += 2; executed++; x = 0xA1; NZ(x);
+    // 8E15  LDA
+    start = cycles; cycles += 2; executed++; a = 0x5D; NZ(a);
+    // 8E17  STA
+    start = cycles; cycles += 3; executed++; WR(0x37, a);
+    // 8E19  LDA
+    start = cycles; cycles += 2; executed++; a = 0x06; NZ(a);
+    // 8E1B  STA
+    start = cycles; cycles += 3; executed++; WR(0x38, a);
+    // 8E1D  AND
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x96 + x); a &= RD(ea); NZ(a);
+    IO_EXIT(0x8E1F);
+    // 8E1F  LSR
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x0029 + x); t = RD(ea); LSR(t); WR(ea, t);
+    // 8E22  ROL
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0xA6 + x); t = RD(ea); ROL(t); WR(ea, t);
+    // 8E24  TAX
+    start = cycles; cycles += 2; executed++; x = a; NZ(x);
+    // 8E25  SEI
+    start = cycles; cycles += 2; executed++; SETF(F_I, 1);
+    // 8E26  AND
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x44 + x); a &= RD(ea); NZ(a);
+    // 8E28  INY
+    start = cycles; cycles += 2; executed++; y++; NZ(y);
+    // 8E29  BCC
+    start = cycles; cycles += 2; executed++; if (!(p & F_C)) { cycles += 1; EXIT(0x8E2E); }
+    EXIT(0x8E2B);
+}
+
+static int block_8E2B(espnes_context *ctx)
+{
+    BEGIN;
+    // 8E2B  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xF1A8); NZ(a);
+    IO_EXIT(0x8E2E);
+    EXIT(0x8E2E);
+}
+
+static int block_8E2E(espnes_context *ctx)
+{
+    BEGIN;
+    // 8E2E  LDA
+    start = cycles; cycles += 2; executed++; a = 0x88; NZ(a);
+    // 8E30  STA
+    start = cycles; cycles += 3; executed++; WR(0x8B, a);
+    // 8E32  LDA
+    start = cycles; cycles += 2; executed++; a = 0x00; NZ(a);
+    // 8E34  STA
+    start = cycles; cycles += 3; executed++; WR(0x8C, a);
+    // 8E36  SBC
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x8B); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); SBC(RD(ea));
+    IO_EXIT(0x8E38);
+    // 8E38  SED
+    start = cycles; cycles += 2; executed++; SETF(F_D, 1);
+    // 8E39  CPY
+    start = cycles; cycles += 2; executed++; CMP(y, 0x8A);
+    // 8E3B  ROL
+    start = cycles; cycles += 2; executed++; ROL(a);
+    // 8E3C  BEQ
+    start = cycles; cycles += 2; executed++; if (p & F_Z) { cycles += 1; EXIT(0x8E41); }
+    EXIT(0x8E3E);
+}
+
+static int block_8E3E(espnes_context *ctx)
+{
+    BEGIN;
+    // 8E3E  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xDB42); NZ(a);
+    IO_EXIT(0x8E41);
+    EXIT(0x8E41);
+}
+
+static int block_8E41(espnes_context *ctx)
+{
+    BEGIN;
+    // 8E41  ASL
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x84 + x); t = RD(ea); ASL(t); WR(ea, t);
+    // 8E43  CMP
+    start = cycles; cycles += 3; executed++; CMP(a, RD(0x51));
+    // 8E45  DEX
+    start = cycles; cycles += 2; executed++; x--; NZ(x);
+    // 8E46  EOR
+    start = cycles; cycles += 4; executed++; a ^= RD(0x9ED0); NZ(a);
+    IO_EXIT(0x8E49);
+    // 8E49  CMP
+    start = cycles; cycles += 3; executed++; CMP(a, RD(0xA7));
+    // 8E4B  ASL
+    start = cycles; cycles += 6; executed++; t = RD(0x04C1); ASL(t); WR(0x04C1, t);
+    // 8E4E  LSR
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0xB3 + x); t = RD(ea); LSR(t); WR(ea, t);
+    // 8E50  BVC
+    start = cycles; cycles += 2; executed++; if (!(p & F_V)) { cycles += 1; EXIT(0x8E55); }
+    EXIT(0x8E52);
+}
+
+static int block_8E52(espnes_context *ctx)
+{
+    BEGIN;
+    // 8E52  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xAEA7); NZ(a);
+    IO_EXIT(0x8E55);
+    EXIT(0x8E55);
+}
+
+static int block_8E55(espnes_context *ctx)
+{
+    BEGIN;
+    // 8E55  ASL
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x059C + x); t = RD(ea); ASL(t); WR(ea, t);
+    // 8E58  ADC
+    start = cycles; cycles += 3; executed++; ADC(RD(0xF5));
+    // 8E5A  CMP
+    start = cycles; cycles += 3; executed++; CMP(a, RD(0xCE));
+    // 8E5C  LSR
+    start = cycles; cycles += 6; executed++; t = RD(0x0050); LSR(t); WR(0x0050, t);
+    // 8E5F  LDA
+    start = cycles; cycles += 2; executed++; a = 0x6B; NZ(a);
+    // 8E61  LDX
+    start = cycles; cycles += 2; executed++; x = 0xA0; NZ(x);
+    // 8E63  LDA
+    start = cycles; cycles += 2; executed++; a = 0xC4; NZ(a);
+    // 8E65  STA
+    start = cycles; cycles += 3; executed++; WR(0xA3, a);
+    // 8E67  LDA
+    start = cycles; cycles += 2; executed++; a = 0x05; NZ(a);
+    // 8E69  STA
+    start = cycles; cycles += 3; executed++; WR(0xA4, a);
+    // 8E6B  AND
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x03 + x); a &= RD(ea); NZ(a);
+    IO_EXIT(0x8E6D);
+    // 8E6D  LDY
+    start = cycles; cycles += 3; executed++; y = RD(0x6D); NZ(y);
+    // 8E6F  ROL
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x0040 + x); t = RD(ea); ROL(t); WR(ea, t);
+    // 8E72  PHP
+    start = cycles; cycles += 3; executed++; PUSH(p | F_B | F_U);
+    // 8E73  LDY
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x12 + x); y = RD(ea); NZ(y);
+    // 8E75  BVC
+    start = cycles; cycles += 2; executed++; if (!(p & F_V)) { cycles += 1; EXIT(0x8E7A); }
+    EXIT(0x8E77);
+}
+
+static int block_8E77(espnes_context *ctx)
+{
+    BEGIN;
+    // 8E77  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x021A); NZ(a);
+    EXIT(0x8E7A);
+}
+
+static int block_8E7A(espnes_context *ctx)
+{
+    BEGIN;
+    // 8E7A  ADC
+    start = cycles; cycles += 2; executed++; ADC(0xD2);
+    // 8E7C  BCC
+    start = cycles; cycles += 2; executed++; if (!(p & F_C)) { cycles += 1; EXIT(0x8E81); }
+    EXIT(0x8E7E);
+}
+
+static int block_8E7E(espnes_context *ctx)
+{
+    BEGIN;
+    // 8E7E  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xEDE9); NZ(a);
+    IO_EXIT(0x8E81);
+    EXIT(0x8E81);
+}
+
+static int block_8E81(espnes_context *ctx)
+{
+    BEGIN;
+    // 8E81  ROL
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x009F + x); t = RD(ea); ROL(t); WR(ea, t);
+    // 8E84  LDA
+    start = cycles; cycles += 2; executed++; a = 0x4F; NZ(a);
+    // 8E86  STA
+    start = cycles; cycles += 3; executed++; WR(0x0F, a);
+    // 8E88  LDA
+    start = cycles; cycles += 2; executed++; a = 0x05; NZ(a);
+    // 8E8A  STA
+    start = cycles; cycles += 3; executed++; WR(0x10, a);
+    // 8E8C  ORA
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x0F); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a |= RD(ea); NZ(a);
+    IO_EXIT(0x8E8E);
+    // 8E8E  LSR
+    start = cycles; cycles += 2; executed++; LSR(a);
+    // 8E8F  LDY
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x8F44 + x); cycles += PAGE_CROSSED(0x8F44, ea); y = RD(ea); NZ(y);
+    IO_EXIT(0x8E92);
+    // 8E92  LSR
+    start = cycles; cycles += 2; executed++; LSR(a);
+    // 8E93  STA
+    start = cycles; cycles += 4; executed++; WR(0x0024, a);
+    // 8E96  TXA
+    start = cycles; cycles += 2; executed++; a = x; NZ(a);
+    // 8E97  SEI
+    start = cycles; cycles += 2; executed++; SETF(F_I, 1);
+    // 8E98  LDX
+    start = cycles; cycles += 2; executed++; x = 0x98; NZ(x);
+    // 8E9A  LDA
+    start = cycles; cycles += 2; executed++; a = 0xD0; NZ(a);
+    // 8E9C  STA
+    start = cycles; cycles += 3; executed++; WR(0xCA, a);
+    // 8E9E  LDA
+    start = cycles; cycles += 2; executed++; a = 0xD3; NZ(a);
+    // 8EA0  STA
+    start = cycles; cycles += 3; executed++; WR(0xCB, a);
+    // 8EA2  CMP
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x32 + x); CMP(a, RD(ea));
+    IO_EXIT(0x8EA4);
+    // 8EA4  STA
+    start = cycles; cycles += 3; executed++; WR(0xAF, a);
+    // 8EA6  TXA
+    start = cycles; cycles += 2; executed++; a = x; NZ(a);
+    // 8EA7  BEQ
+    start = cycles; cycles += 2; executed++; if (p & F_Z) { cycles += 1; EXIT(0x8EAC); }
+    EXIT(0x8EA9);
+}
+
+static int block_8EA9(espnes_context *ctx)
+{
+    BEGIN;
+    // 8EA9  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xE65B); NZ(a);
+    IO_EXIT(0x8EAC);
+    EXIT(0x8EAC);
+}
+
+static int block_8EAC(espnes_context *ctx)
+{
+    BEGIN;
+    // 8EAC  ROL
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x87 + x); t = RD(ea); ROL(t); WR(ea, t);
+    // 8EAE  BMI
+    start = cycles; cycles += 2; executed++; if (p & F_N) { cycles += 1; EXIT(0x8EB3); }
+    EXIT(0x8EB0);
+}
+
+static int block_8EB0(espnes_context *ctx)
+{
+    BEGIN;
+    // 8EB0  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xFC3A); NZ(a);
+    IO_EXIT(0x8EB3);
+    EXIT(0x8EB3);
+}
+
+static int block_8EB3(espnes_context *ctx)
+{
+    BEGIN;
+    // 8EB3  STA
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x5C + x); WR(ea, a);
+    // 8EB5  PHA
+    start = cycles; cycles += 3; executed++; PUSH(a);
+    // 8EB6  DEC
+    start = cycles; cycles += 5; executed++; t = RD(0x19); t--; NZ(t); WR(0x19, t);
+    // 8EB8  STX
+    start = cycles; cycles += 3; executed++; WR(0x18, x);
+    // 8EBA  ORA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x90B3 + y); cycles += PAGE_CROSSED(0x90B3, ea); a |= RD(ea); NZ(a);
+    IO_EXIT(0x8EBD);
+    // 8EBD  LDA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x059E + x); cycles += PAGE_CROSSED(0x059E, ea); a = RD(ea); NZ(a);
+    // 8EC0  LSR
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x41 + x); t = RD(ea); LSR(t); WR(ea, t);
+    // 8EC2  ORA
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xA8 + x); a |= RD(ea); NZ(a);
+    // 8EC4  BVC
+    start = cycles; cycles += 2; executed++; if (!(p & F_V)) { cycles += 1; EXIT(0x8EC9); }
+    EXIT(0x8EC6);
+}
+
+static int block_8EC6(espnes_context *ctx)
+{
+    BEGIN;
+    // 8EC6  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x8BDE); NZ(a);
+    IO_EXIT(0x8EC9);
+    EXIT(0x8EC9);
+}
+
+static int block_8EC9(espnes_context *ctx)
+{
+    BEGIN;
+    // 8EC9  LDX
+    start = cycles; cycles += 2; executed++; x = 0x90; NZ(x);
+    // 8ECB  LDA
+    start = cycles; cycles += 2; executed++; a = 0x7C; NZ(a);
+    // 8ECD  STA
+    start = cycles; cycles += 3; executed++; WR(0xF2, a);
+    // 8ECF  LDA
+    start = cycles; cycles += 2; executed++; a = 0x06; NZ(a);
+    // 8ED1  STA
+    start = cycles; cycles += 3; executed++; WR(0xF3, a);
+    // 8ED3  SBC
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x62 + x); SBC(RD(ea));
+    IO_EXIT(0x8ED5);
+    // 8ED5  CPY
+    start = cycles; cycles += 2; executed++; CMP(y, 0xD4);
+    // 8ED7  STA
+    start = cycles; cycles += 4; executed++; WR(0x00FF, a);
+    // 8EDA  STA
+    start = cycles; cycles += 5; executed++; ea = (uint16_t)(0x0634 + x); WR(ea, a);
+    // 8EDD  INC
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x56 + x); t = RD(ea); t++; NZ(t); WR(ea, t);
+    // 8EDF  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0558 + x); cycles += PAGE_CROSSED(0x0558, ea); ADC(RD(ea));
+    // 8EE2  LDA
+    start = cycles; cycles += 3; executed++; a = RD(0xB7); NZ(a);
+    // 8EE4  BPL
+    start = cycles; cycles += 2; executed++; if (!(p & F_N)) { cycles += 1; EXIT(0x8EE9); }
+    EXIT(0x8EE6);
+}
+
+static int block_8EE6(espnes_context *ctx)
+{
+    BEGIN;
+    // 8EE6  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0638); NZ(a);
+    EXIT(0x8EE9);
+}
+
+static int block_8EE9(espnes_context *ctx)
+{
+    BEGIN;
+    // 8EE9  CMP
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xE69B + x); cycles += PAGE_CROSSED(0xE69B, ea); CMP(a, RD(ea));
+    IO_EXIT(0x8EEC);
+    // 8EEC  TXS
+    start = cycles; cycles += 2; executed++; sp = x;
+    // 8EED  INC
+    start = cycles; cycles += 6; executed++; t = RD(0x01C9); t++; NZ(t); WR(0x01C9, t);
+    // 8EF0  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xF2C9 + y); cycles += PAGE_CROSSED(0xF2C9, ea); a ^= RD(ea); NZ(a);
+    IO_EXIT(0x8EF3);
+    // 8EF3  LDX
+    start = cycles; cycles += 2; executed++; x = 0xAE; NZ(x);
+    // 8EF5  LDA
+    start = cycles; cycles += 2; executed++; a = 0x0B; NZ(a);
+    // 8EF7  STA
+    start = cycles; cycles += 3; executed++; WR(0xDB, a);
+    // 8EF9  LDA
+    start = cycles; cycles += 2; executed++; a = 0xE7; NZ(a);
+    // 8EFB  STA
+    start = cycles; cycles += 3; executed++; WR(0xDC, a);
+    // 8EFD  EOR
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x2D + x); a ^= RD(ea); NZ(a);
+    IO_EXIT(0x8EFF);
+    // 8EFF  BMI
+    start = cycles; cycles += 2; executed++; if (p & F_N) { cycles += 1; EXIT(0x8F04); }
+    EXIT(0x8F01);
+}
+
+static int block_8F01(espnes_context *ctx)
+{
+    BEGIN;
+    // 8F01  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x04FD); NZ(a);
+    EXIT(0x8F04);
+}
+
+static int block_8F04(espnes_context *ctx)
+{
+    BEGIN;
+    // 8F04  STA
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x59 + x); WR(ea, a);
+    // 8F06  DEC
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x05E1 + x); t = RD(ea); t--; NZ(t); WR(ea, t);
+    // 8F09  EOR
+    start = cycles; cycles += 4; executed++; a ^= RD(0xD94C); NZ(a);
+    IO_EXIT(0x8F0C);
+    // 8F0C  ASL
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x0A + x); t = RD(ea); ASL(t); WR(ea, t);
+    // 8F0E  STX
+    start = cycles; cycles += 4; executed++; WR(0x0225, x);
+    // 8F11  AND
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xE76A + y); cycles += PAGE_CROSSED(0xE76A, ea); a &= RD(ea); NZ(a);
+    IO_EXIT(0x8F14);
+    // 8F14  BIT
+    start = cycles; cycles += 4; executed++; BIT(RD(0xC440));
+    IO_EXIT(0x8F17);
+    // 8F17  ASL
+    start = cycles; cycles += 6; executed++; t = RD(0x02DB); ASL(t); WR(0x02DB, t);
+    // 8F1A  STX
+    start = cycles; cycles += 4; executed++; WR(0x04D4, x);
+    // 8F1D  CLV
+    start = cycles; cycles += 2; executed++; SETF(F_V, 0);
+    // 8F1E  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 1; EXIT(0x8F23); }
+    EXIT(0x8F20);
+}
+
+static int block_8F20(espnes_context *ctx)
+{
+    BEGIN;
+    // 8F20  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x031C); NZ(a);
+    EXIT(0x8F23);
+}
+
+static int block_8F23(espnes_context *ctx)
+{
+    BEGIN;
+    // 8F23  INC
+    start = cycles; cycles += 5; executed++; t = RD(0x1B); t++; NZ(t); WR(0x1B, t);
+    // 8F25  LDA
+    start = cycles; cycles += 2; executed++; a = 0x1C; NZ(a);
+    // 8F27  STA
+    start = cycles; cycles += 3; executed++; WR(0xB5, a);
+    // 8F29  LDA
+    start = cycles; cycles += 2; executed++; a = 0xB2; NZ(a);
+    // 8F2B  STA
+    start = cycles; cycles += 3; executed++; WR(0xB6, a);
+    // 8F2D  ORA
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0xB5); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a |= RD(ea); NZ(a);
+    IO_EXIT(0x8F2F);
+    // 8F2F  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x06DE + x); cycles += PAGE_CROSSED(0x06DE, ea); a ^= RD(ea); NZ(a);
+    // 8F32  LDX
+    start = cycles; cycles += 2; executed++; x = 0x76; NZ(x);
+    // 8F34  LDA
+    start = cycles; cycles += 2; executed++; a = 0xFA; NZ(a);
+    // 8F36  STA
+    start = cycles; cycles += 3; executed++; WR(0x33, a);
+    // 8F38  LDA
+    start = cycles; cycles += 2; executed++; a = 0xDB; NZ(a);
+    // 8F3A  STA
+    start = cycles; cycles += 3; executed++; WR(0x34, a);
+    // 8F3C  CMP
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0xBD + x); CMP(a, RD(ea));
+    IO_EXIT(0x8F3E);
+    // 8F3E  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 1; EXIT(0x8F43); }
+    EXIT(0x8F40);
+}
+
+static int block_8F40(espnes_context *ctx)
+{
+    BEGIN;
+    // 8F40  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xFB78); NZ(a);
+    IO_EXIT(0x8F43);
+    EXIT(0x8F43);
+}
+
+static int block_8F43(espnes_context *ctx)
+{
+    BEGIN;
+    // 8F43  ROR
+    start = cycles; cycles += 6; executed++; t = RD(0x06C3); ROR(t); WR(0x06C3, t);
+    // 8F46  TXA
+    start = cycles; cycles += 2; executed++; a = x; NZ(a);
+    // 8F47  TAX
+    start = cycles; cycles += 2; executed++; x = a; NZ(x);
+    // 8F48  ASL
+    start = cycles; cycles += 6; executed++; t = RD(0x00AC); ASL(t); WR(0x00AC, t);
+    // 8F4B  ROR
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x003C + x); t = RD(ea); ROR(t); WR(ea, t);
+    // 8F4E  AND
+    start = cycles; cycles += 2; executed++; a &= 0x9A; NZ(a);
+    // 8F50  SBC
+    start = cycles; cycles += 2; executed++; SBC(0x19);
+    // 8F52  LDA
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x5E + x); a = RD(ea); NZ(a);
+    // 8F54  LDA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xB0F7 + x); cycles += PAGE_CROSSED(0xB0F7, ea); a = RD(ea); NZ(a);
+    IO_EXIT(0x8F57);
+    // 8F57  SED
+    start = cycles; cycles += 2; executed++; SETF(F_D, 1);
+    // 8F58  BEQ
+    start = cycles; cycles += 2; executed++; if (p & F_Z) { cycles += 1; EXIT(0x8F5D); }
+    EXIT(0x8F5A);
+}
+
+static int block_8F5A(espnes_context *ctx)
+{
+    BEGIN;
+    // 8F5A  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x9F55); NZ(a);
+    IO_EXIT(0x8F5D);
+    EXIT(0x8F5D);
+}
+
+static int block_8F5D(espnes_context *ctx)
+{
+    BEGIN;
+    // 8F5D  SED
+    start = cycles; cycles += 2; executed++; SETF(F_D, 1);
+    // 8F5E  STY
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x60 + x); WR(ea, y);
+    // 8F60  ORA
+    start = cycles; cycles += 3; executed++; a |= RD(0x80); NZ(a);
+    // 8F62  BVS
+    start = cycles; cycles += 2; executed++; if (p & F_V) { cycles += 1; EXIT(0x8F67); }
+    EXIT(0x8F64);
+}
+
+static int block_8F64(espnes_context *ctx)
+{
+    BEGIN;
+    // 8F64  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xCB9A); NZ(a);
+    IO_EXIT(0x8F67);
+    EXIT(0x8F67);
+}
+
+static int block_8F67(espnes_context *ctx)
+{
+    BEGIN;
+    // 8F67  ROR
+    start = cycles; cycles += 6; executed++; t = RD(0x01AA); ROR(t); WR(0x01AA, t);
+    // 8F6A  STA
+    start = cycles; cycles += 5; executed++; ea = (uint16_t)(0x0157 + x); WR(ea, a);
+    // 8F6D  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x08 + x); a ^= RD(ea); NZ(a);
+    // 8F6F  EOR
+    start = cycles; cycles += 3; executed++; a ^= RD(0x5E); NZ(a);
+    // 8F71  ROR
+    start = cycles; cycles += 2; executed++; ROR(a);
+    // 8F72  ORA
+    start = cycles; cycles += 4; executed++; a |= RD(0x06D8); NZ(a);
+    // 8F75  CMP
+    start = cycles; cycles += 3; executed++; CMP(a, RD(0xB7));
+    // 8F77  CLC
+    start = cycles; cycles += 2; executed++; SETF(F_C, 0);
+    // 8F78  BEQ
+    start = cycles; cycles += 2; executed++; if (p & F_Z) { cycles += 1; EXIT(0x8F7D); }
+    EXIT(0x8F7A);
+}
+
+static int block_8F7A(espnes_context *ctx)
+{
+    BEGIN;
+    // 8F7A  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x06E0); NZ(a);
+    EXIT(0x8F7D);
+}
+
+static int block_8F7D(espnes_context *ctx)
+{
+    BEGIN;
+    // 8F7D  LDA
+    start = cycles; cycles += 2; executed++; a = 0xEB; NZ(a);
+    // 8F7F  STA
+    start = cycles; cycles += 3; executed++; WR(0x80, a);
+    // 8F81  LDA
+    start = cycles; cycles += 2; executed++; a = 0x06; NZ(a);
+    // 8F83  STA
+    start = cycles; cycles += 3; executed++; WR(0x81, a);
+    // 8F85  ADC
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x80); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); ADC(RD(ea));
+    IO_EXIT(0x8F87);
+    // 8F87  SBC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xF5B4 + y); cycles += PAGE_CROSSED(0xF5B4, ea); SBC(RD(ea));
+    IO_EXIT(0x8F8A);
+    // 8F8A  AND
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x055E + y); cycles += PAGE_CROSSED(0x055E, ea); a &= RD(ea); NZ(a);
+    // 8F8D  DEC
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x50 + x); t = RD(ea); t--; NZ(t); WR(ea, t);
+    // 8F8F  BCC
+    start = cycles; cycles += 2; executed++; if (!(p & F_C)) { cycles += 1; EXIT(0x8F94); }
+    EXIT(0x8F91);
+}
+
+static int block_8F91(espnes_context *ctx)
+{
+    BEGIN;
+    // 8F91  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xC33E); NZ(a);
+    IO_EXIT(0x8F94);
+    EXIT(0x8F94);
+}
+
+static int block_8F94(espnes_context *ctx)
+{
+    BEGIN;
+    // 8F94  LSR
+    start = cycles; cycles += 6; executed++; t = RD(0x010F); LSR(t); WR(0x010F, t);
+    // 8F97  LDA
+    start = cycles; cycles += 2; executed++; a = 0x2E; NZ(a);
+    // 8F99  STA
+    start = cycles; cycles += 3; executed++; WR(0xA4, a);
+    // 8F9B  LDA
+    start = cycles; cycles += 2; executed++; a = 0xDD; NZ(a);
+    // 8F9D  STA
+    start = cycles; cycles += 3; executed++; WR(0xA5, a);
+    // 8F9F  LDA
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0xA4); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a = RD(ea); NZ(a);
+    IO_EXIT(0x8FA1);
+    // 8FA1  DEC
+    start = cycles; cycles += 6; executed++; t = RD(0x037A); t--; NZ(t); WR(0x037A, t);
+    // 8FA4  CPX
+    start = cycles; cycles += 4; executed++; CMP(x, RD(0x06EC));
+    // 8FA7  BPL
+    start = cycles; cycles += 2; executed++; if (!(p & F_N)) { cycles += 1; EXIT(0x8FAC); }
+    EXIT(0x8FA9);
+}
+
+static int block_8FA9(espnes_context *ctx)
+{
+    BEGIN;
+    // 8FA9  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xA5E7); NZ(a);
+    IO_EXIT(0x8FAC);
+    EXIT(0x8FAC);
+}
+
+static int block_8FAC(espnes_context *ctx)
+{
+    BEGIN;
+    // 8FAC  ADC
+    start = cycles; cycles += 4; executed++; ADC(RD(0x0183));
+    // 8FAF  EOR
+    start = cycles; cycles += 2; executed++; a ^= 0x18; NZ(a);
+    // 8FB1  ROR
+    start = cycles; cycles += 6; executed++; t = RD(0x024E); ROR(t); WR(0x024E, t);
+    // 8FB4  STY
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x0C + x); WR(ea, y);
+    // 8FB6  SBC
+    start = cycles; cycles += 2; executed++; SBC(0xC2);
+    // 8FB8  INY
+    start = cycles; cycles += 2; executed++; y++; NZ(y);
+    // 8FB9  BEQ
+    start = cycles; cycles += 2; executed++; if (p & F_Z) { cycles += 1; EXIT(0x8FBE); }
+    EXIT(0x8FBB);
+}
+
+static int block_8FBB(espnes_context *ctx)
+{
+    BEGIN;
+    // 8FBB  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xAB45); NZ(a);
+    IO_EXIT(0x8FBE);
+    EXIT(0x8FBE);
+}
+
+static int block_8FBE(espnes_context *ctx)
+{
+    BEGIN;
+    // 8FBE  INC
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x16 + x); t = RD(ea); t++; NZ(t); WR(ea, t);
+    // 8FC0  BPL
+    start = cycles; cycles += 2; executed++; if (!(p & F_N)) { cycles += 1; EXIT(0x8FC5); }
+    EXIT(0x8FC2);
+}
+
+static int block_8FC2(espnes_context *ctx)
+{
+    BEGIN;
+    // 8FC2  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x86FF); NZ(a);
+    IO_EXIT(0x8FC5);
+    EXIT(0x8FC5);
+}
+
+static int block_8FC5(espnes_context *ctx)
+{
+    BEGIN;
+    // 8FC5  ORA
+    start = cycles; cycles += 3; executed++; a |= RD(0xC9); NZ(a);
+    // 8FC7  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0342 + x); cycles += PAGE_CROSSED(0x0342, ea); ADC(RD(ea));
+    // 8FCA  STA
+    start = cycles; cycles += 5; executed++; ea = (uint16_t)(0x0519 + x); WR(ea, a);
+    // 8FCD  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 1; EXIT(0x8FD2); }
+    EXIT(0x8FCF);
+}
+
+static int block_8FCF(espnes_context *ctx)
+{
+    BEGIN;
+    // 8FCF  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x9EE7); NZ(a);
+    IO_EXIT(0x8FD2);
+    EXIT(0x8FD2);
+}
+
+static int block_8FD2(espnes_context *ctx)
+{
+    BEGIN;
+    // 8FD2  SBC
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x9B + x); SBC(RD(ea));
+    // 8FD4  AND
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xFA + x); a &= RD(ea); NZ(a);
+    // 8FD6  LDA
+    start = cycles; cycles += 2; executed++; a = 0xE4; NZ(a);
+    // 8FD8  STA
+    start = cycles; cycles += 3; executed++; WR(0x8E, a);
+    // 8FDA  LDA
+    start = cycles; cycles += 2; executed++; a = 0xFD; NZ(a);
+    // 8FDC  STA
+    start = cycles; cycles += 3; executed++; WR(0x8F, a);
+    // 8FDE  ORA
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x8E); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a |= RD(ea); NZ(a);
+    IO_EXIT(0x8FE0);
+    // 8FE0  BCC
+    start = cycles; cycles += 2; executed++; if (!(p & F_C)) { cycles += 1; EXIT(0x8FE5); }
+    EXIT(0x8FE2);
+}
+
+static int block_8FE2(espnes_context *ctx)
+{
+    BEGIN;
+    // 8FE2  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x00BA); NZ(a);
+    EXIT(0x8FE5);
+}
+
+static int block_8FE5(espnes_context *ctx)
+{
+    BEGIN;
+    // 8FE5  ADC
+    start = cycles; cycles += 3; executed++; ADC(RD(0xAC));
+    // 8FE7  STA
+    start = cycles; cycles += 4; executed++; WR(0x01CF, a);
+    // 8FEA  LDY
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xB5 + x); y = RD(ea); NZ(y);
+    // 8FEC  SBC
+    start = cycles; cycles += 2; executed++; SBC(0x2C);
+    // 8FEE  INX
+    start = cycles; cycles += 2; executed++; x++; NZ(x);
+    // 8FEF  TYA
+    start = cycles; cycles += 2; executed++; a = y; NZ(a);
+    // 8FF0  ASL
+    start = cycles; cycles += 2; executed++; ASL(a);
+    // 8FF1  LDY
+    start = cycles; cycles += 2; executed++; y = 0xE5; NZ(y);
+    // 8FF3  AND
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xC0 + x); a &= RD(ea); NZ(a);
+    // 8FF5  ORA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xD062 + x); cycles += PAGE_CROSSED(0xD062, ea); a |= RD(ea); NZ(a);
+    IO_EXIT(0x8FF8);
+    // 8FF8  BVC
+    start = cycles; cycles += 2; executed++; if (!(p & F_V)) { cycles += 1; EXIT(0x8FFD); }
+    EXIT(0x8FFA);
+}
+
+static int block_8FFA(espnes_context *ctx)
+{
+    BEGIN;
+    // 8FFA  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xBADF); NZ(a);
+    IO_EXIT(0x8FFD);
+    EXIT(0x8FFD);
+}
+
+static int block_8FFD(espnes_context *ctx)
+{
+    BEGIN;
+    // 8FFD  LDX
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0113 + y); cycles += PAGE_CROSSED(0x0113, ea); x = RD(ea); NZ(x);
+    // 9000  LDX
+    start = cycles; cycles += 2; executed++; x = 0x13; NZ(x);
+    // 9002  LDA
+    start = cycles; cycles += 2; executed++; a = 0xB0; NZ(a);
+    // 9004  STA
+    start = cycles; cycles += 3; executed++; WR(0x68, a);
+    // 9006  LDA
+    start = cycles; cycles += 2; executed++; a = 0xB2; NZ(a);
+    // 9008  STA
+    start = cycles; cycles += 3; executed++; WR(0x69, a);
+    // 900A  CMP
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x55 + x); CMP(a, RD(ea));
+    IO_EXIT(0x900C);
+    // 900C  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 1; EXIT(0x9011); }
+    EXIT(0x900E);
+}
+
+static int block_900E(espnes_context *ctx)
+{
+    BEGIN;
+    // 900E  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x052E); NZ(a);
+    EXIT(0x9011);
+}
+
+static int block_9011(espnes_context *ctx)
+{
+    BEGIN;
+    // 9011  ROR
+    start = cycles; cycles += 6; executed++; t = RD(0x0007); ROR(t); WR(0x0007, t);
+    // 9014  TXA
+    start = cycles; cycles += 2; executed++; a = x; NZ(a);
+    // 9015  BMI
+    start = cycles; cycles += 2; executed++; if (p & F_N) { cycles += 1; EXIT(0x901A); }
+    EXIT(0x9017);
+}
+
+static int block_9017(espnes_context *ctx)
+{
+    BEGIN;
+    // 9017  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xF5BF); NZ(a);
+    IO_EXIT(0x901A);
+    EXIT(0x901A);
+}
+
+static int block_901A(espnes_context *ctx)
+{
+    BEGIN;
+    // 901A  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0425 + x); cycles += PAGE_CROSSED(0x0425, ea); a ^= RD(ea); NZ(a);
+    // 901D  STX
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x2F + y); WR(ea, x);
+    // 901F  TXA
+    start = cycles; cycles += 2; executed++; a = x; NZ(a);
+    // 9020  ROL
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0xC0 + x); t = RD(ea); ROL(t); WR(ea, t);
+    // 9022  CMP
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x8F61 + x); cycles += PAGE_CROSSED(0x8F61, ea); CMP(a, RD(ea));
+    IO_EXIT(0x9025);
+    // 9025  SEC
+    start = cycles; cycles += 2; executed++; SETF(F_C, 1);
+    // 9026  SBC
+    start = cycles; cycles += 2; executed++; SBC(0x32);
+    // 9028  STA
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x38 + x); WR(ea, a);
+    // 902A  INC
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x04FC + x); t = RD(ea); t++; NZ(t); WR(ea, t);
+    // 902D  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x55 + x); a ^= RD(ea); NZ(a);
+    // 902F  BMI
+    start = cycles; cycles += 2; executed++; if (p & F_N) { cycles += 1; EXIT(0x9034); }
+    EXIT(0x9031);
+}
+
+static int block_9031(espnes_context *ctx)
+{
+    BEGIN;
+    // 9031  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x05E2); NZ(a);
+    EXIT(0x9034);
+}
+
+static int block_9034(espnes_context *ctx)
+{
+    BEGIN;
+    // 9034  ROR
+    start = cycles; cycles += 6; executed++; t = RD(0x0123); ROR(t); WR(0x0123, t);
+    // 9037  BMI
+    start = cycles; cycles += 2; executed++; if (p & F_N) { cycles += 1; EXIT(0x903C); }
+    EXIT(0x9039);
+}
+
+static int block_9039(espnes_context *ctx)
+{
+    BEGIN;
+    // 9039  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0589); NZ(a);
+    EXIT(0x903C);
+}
+
+static int block_903C(espnes_context *ctx)
+{
+    BEGIN;
+    // 903C  SBC
+    start = cycles; cycles += 4; executed++; SBC(RD(0xEED0));
+    IO_EXIT(0x903F);
+    // 903F  LDX
+    start = cycles; cycles += 2; executed++; x = 0x02; NZ(x);
+    // 9041  LDA
+    start = cycles; cycles += 2; executed++; a = 0x60; NZ(a);
+    // 9043  STA
+    start = cycles; cycles += 3; executed++; WR(0x07, a);
+    // 9045  LDA
+    start = cycles; cycles += 2; executed++; a = 0x04; NZ(a);
+    // 9047  STA
+    start = cycles; cycles += 3; executed++; WR(0x08, a);
+    // 9049  EOR
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x05 + x); a ^= RD(ea); NZ(a);
+    IO_EXIT(0x904B);
+    // 904B  TAX
+    start = cycles; cycles += 2; executed++; x = a; NZ(x);
+    // 904C  LDY
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xD6 + x); y = RD(ea); NZ(y);
+    // 904E  SBC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xD100 + x); cycles += PAGE_CROSSED(0xD100, ea); SBC(RD(ea));
+    IO_EXIT(0x9051);
+    // 9051  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xCE3B + y); cycles += PAGE_CROSSED(0xCE3B, ea); a ^= RD(ea); NZ(a);
+    IO_EXIT(0x9054);
+    // 9054  ORA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x06D1 + x); cycles += PAGE_CROSSED(0x06D1, ea); a |= RD(ea); NZ(a);
+    // 9057  INY
+    start = cycles; cycles += 2; executed++; y++; NZ(y);
+    // 9058  LDX
+    start = cycles; cycles += 3; executed++; x = RD(0x1F); NZ(x);
+    // 905A  LSR
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x7D + x); t = RD(ea); LSR(t); WR(ea, t);
+    // 905C  AND
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xFE85 + x); cycles += PAGE_CROSSED(0xFE85, ea); a &= RD(ea); NZ(a);
+    IO_EXIT(0x905F);
+    // 905F  BVC
+    start = cycles; cycles += 2; executed++; if (!(p & F_V)) { cycles += 1; EXIT(0x9064); }
+    EXIT(0x9061);
+}
+
+static int block_9061(espnes_context *ctx)
+{
+    BEGIN;
+    // 9061  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x9474); NZ(a);
+    IO_EXIT(0x9064);
+    EXIT(0x9064);
+}
+
+static int block_9064(espnes_context *ctx)
+{
+    BEGIN;
+    // 9064  LDA
+    start = cycles; cycles += 2; executed++; a = 0x23; NZ(a);
+    // 9066  STA
+    start = cycles; cycles += 3; executed++; WR(0x35, a);
+    // 9068  LDA
+    start = cycles; cycles += 2; executed++; a = 0x00; NZ(a);
+    // 906A  STA
+    start = cycles; cycles += 3; executed++; WR(0x36, a);
+    // 906C  ADC
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x35); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); ADC(RD(ea));
+    IO_EXIT(0x906E);
+    // 906E  CMP
+    start = cycles; cycles += 2; executed++; CMP(a, 0x34);
+    // 9070  ASL
+    start = cycles; cycles += 6; executed++; t = RD(0x0127); ASL(t); WR(0x0127, t);
+    // 9073  LDA
+    start = cycles; cycles += 2; executed++; a = 0x35; NZ(a);
+    // 9075  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x000A + y); cycles += PAGE_CROSSED(0x000A, ea); a ^= RD(ea); NZ(a);
+    // 9078  LDA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x8C77 + x); cycles += PAGE_CROSSED(0x8C77, ea); a = RD(ea); NZ(a);
+    IO_EXIT(0x907B);
+    // 907B  SBC
+    start = cycles; cycles += 4; executed++; SBC(RD(0x0610));
+    // 907E  ADC
+    start = cycles; cycles += 4; executed++; ADC(RD(0x0144));
+    // 9081  CPY
+    start = cycles; cycles += 2; executed++; CMP(y, 0xFD);
+    // 9083  BMI
+    start = cycles; cycles += 2; executed++; if (p & F_N) { cycles += 1; EXIT(0x9088); }
+    EXIT(0x9085);
+}
+
+static int block_9085(espnes_context *ctx)
+{
+    BEGIN;
+    // 9085  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0528); NZ(a);
+    EXIT(0x9088);
+}
+
+static int block_9088(espnes_context *ctx)
+{
+    BEGIN;
+    // 9088  PHP
+    start = cycles; cycles += 3; executed++; PUSH(p | F_B | F_U);
+    // 9089  LDX
+    start = cycles; cycles += 2; executed++; x = 0xD9; NZ(x);
+    // 908B  LDA
+    start = cycles; cycles += 2; executed++; a = 0x68; NZ(a);
+    // 908D  STA
+    start = cycles; cycles += 3; executed++; WR(0x77, a);
+    // 908F  LDA
+    start = cycles; cycles += 2; executed++; a = 0xC8; NZ(a);
+    // 9091  STA
+    start = cycles; cycles += 3; executed++; WR(0x78, a);
+    // 9093  CMP
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x9E + x); CMP(a, RD(ea));
+    IO_EXIT(0x9095);
+    // 9095  INY
+    start = cycles; cycles += 2; executed++; y++; NZ(y);
+    // 9096  ASL
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x02FB + x); t = RD(ea); ASL(t); WR(ea, t);
+    // 9099  ROL
+    start = cycles; cycles += 5; executed++; t = RD(0x7A); ROL(t); WR(0x7A, t);
+    // 909B  LDA
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x2D + x); a = RD(ea); NZ(a);
+    // 909D  INY
+    start = cycles; cycles += 2; executed++; y++; NZ(y);
+    // 909E  LDX
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x6A + y); x = RD(ea); NZ(x);
+    // 90A0  ASL
+    start = cycles; cycles += 5; executed++; t = RD(0x0B); ASL(t); WR(0x0B, t);
+    // 90A2  SBC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x065F + y); cycles += PAGE_CROSSED(0x065F, ea); SBC(RD(ea));
+    // 90A5  TXA
+    start = cycles; cycles += 2; executed++; a = x; NZ(a);
+    // 90A6  BEQ
+    start = cycles; cycles += 2; executed++; if (p & F_Z) { cycles += 1; EXIT(0x90AB); }
+    EXIT(0x90A8);
+}
+
+static int block_90A8(espnes_context *ctx)
+{
+    BEGIN;
+    // 90A8  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x01A9); NZ(a);
+    EXIT(0x90AB);
+}
+
+static int block_90AB(espnes_context *ctx)
+{
+    BEGIN;
+    // 90AB  SBC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xA6A9 + x); cycles += PAGE_CROSSED(0xA6A9, ea); SBC(RD(ea));
+    IO_EXIT(0x90AE);
+    // 90AE  SEC
+    start = cycles; cycles += 2; executed++; SETF(F_C, 1);
+    // 90AF  SBC
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xA4 + x); SBC(RD(ea));
+    // 90B1  LDY
+    start = cycles; cycles += 2; executed++; y = 0x41; NZ(y);
+    // 90B3  PHA
+    start = cycles; cycles += 3; executed++; PUSH(a);
+    // 90B4  BVC
+    start = cycles; cycles += 2; executed++; if (!(p & F_V)) { cycles += 1; EXIT(0x90B9); }
+    EXIT(0x90B6);
+}
+
+static int block_90B6(espnes_context *ctx)
+{
+    BEGIN;
+    // 90B6  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0564); NZ(a);
+    EXIT(0x90B9);
+}
+
+static int block_90B9(espnes_context *ctx)
+{
+    BEGIN;
+    // 90B9  LDA
+    start = cycles; cycles += 2; executed++; a = 0x97; NZ(a);
+    // 90BB  STA
+    start = cycles; cycles += 3; executed++; WR(0x37, a);
+    // 90BD  LDA
+    start = cycles; cycles += 2; executed++; a = 0x98; NZ(a);
+    // 90BF  STA
+    start = cycles; cycles += 3; executed++; WR(0x38, a);
+    // 90C1  SBC
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x37); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); SBC(RD(ea));
+    IO_EXIT(0x90C3);
+    // 90C3  BVS
+    start = cycles; cycles += 2; executed++; if (p & F_V) { cycles += 1; EXIT(0x90C8); }
+    EXIT(0x90C5);
+}
+
+static int block_90C5(espnes_context *ctx)
+{
+    BEGIN;
+    // 90C5  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x02FF); NZ(a);
+    EXIT(0x90C8);
+}
+
+static int block_90C8(espnes_context *ctx)
+{
+    BEGIN;
+    // 90C8  STX
+    start = cycles; cycles += 3; executed++; WR(0x47, x);
+    // 90CA  ORA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xC234 + x); cycles += PAGE_CROSSED(0xC234, ea); a |= RD(ea); NZ(a);
+    IO_EXIT(0x90CD);
+    // 90CD  SBC
+    start = cycles; cycles += 3; executed++; SBC(RD(0x3C));
+    // 90CF  ROL
+    start = cycles; cycles += 6; executed++; t = RD(0x051F); ROL(t); WR(0x051F, t);
+    // 90D2  DEC
+    start = cycles; cycles += 6; executed++; t = RD(0x00EB); t--; NZ(t); WR(0x00EB, t);
+    // 90D5  AND
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x91FF + y); cycles += PAGE_CROSSED(0x91FF, ea); a &= RD(ea); NZ(a);
+    IO_EXIT(0x90D8);
+    // 90D8  AND
+    start = cycles; cycles += 3; executed++; a &= RD(0xBD); NZ(a);
+    // 90DA  DEC
+    start = cycles; cycles += 6; executed++; t = RD(0x03B1); t--; NZ(t); WR(0x03B1, t);
+    // 90DD  STY
+    start = cycles; cycles += 4; executed++; WR(0x021E, y);
+    // 90E0  BCC
+    start = cycles; cycles += 2; executed++; if (!(p & F_C)) { cycles += 1; EXIT(0x90E5); }
+    EXIT(0x90E2);
+}
+
+static int block_90E2(espnes_context *ctx)
+{
+    BEGIN;
+    // 90E2  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x01D9); NZ(a);
+    EXIT(0x90E5);
+}
+
+static int block_90E5(espnes_context *ctx)
+{
+    BEGIN;
+    // 90E5  LDA
+    start = cycles; cycles += 2; executed++; a = 0x37; NZ(a);
+    // 90E7  STA
+    start = cycles; cycles += 3; executed++; WR(0x6B, a);
+    // 90E9  LDA
+    start = cycles; cycles += 2; executed++; a = 0xCA; NZ(a);
+    // 90EB  STA
+    start = cycles; cycles += 3; executed++; WR(0x6C, a);
+    // 90ED  EOR
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x6B); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a ^= RD(ea); NZ(a);
+    IO_EXIT(0x90EF);
+    // 90EF  LDY
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xD183 + x); cycles += PAGE_CROSSED(0xD183, ea); y = RD(ea); NZ(y);
+    IO_EXIT(0x90F2);
+    // 90F2  ASL
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x00D8 + x); t = RD(ea); ASL(t); WR(ea, t);
+    // 90F5  STX
+    start = cycles; cycles += 4; executed++; WR(0x0056, x);
+    // 90F8  EOR
+    start = cycles; cycles += 3; executed++; a ^= RD(0xB2); NZ(a);
+    // 90FA  ASL
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x05FB + x); t = RD(ea); ASL(t); WR(ea, t);
+    // 90FD  BEQ
+    start = cycles; cycles += 2; executed++; if (p & F_Z) { cycles += 2; EXIT(0x9102); }
+    EXIT(0x90FF);
+}
+
+static int block_90FF(espnes_context *ctx)
+{
+    BEGIN;
+    // 90FF  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xAB41); NZ(a);
+    IO_EXIT(0x9102);
+    EXIT(0x9102);
+}
+
+static int block_9102(espnes_context *ctx)
+{
+    BEGIN;
+    // 9102  AND
+    start = cycles; cycles += 2; executed++; a &= 0xED; NZ(a);
+    // 9104  PLA
+    start = cycles; cycles += 4; executed++; a = PULL(); NZ(a);
+    // 9105  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 1; EXIT(0x910A); }
+    EXIT(0x9107);
+}
+
+static int block_9107(espnes_context *ctx)
+{
+    BEGIN;
+    // 9107  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x054D); NZ(a);
+    EXIT(0x910A);
+}
+
+static int block_910A(espnes_context *ctx)
+{
+    BEGIN;
+    // 910A  LDX
+    start = cycles; cycles += 2; executed++; x = 0x50; NZ(x);
+    // 910C  INY
+    start = cycles; cycles += 2; executed++; y++; NZ(y);
+    // 910D  TAX
+    start = cycles; cycles += 2; executed++; x = a; NZ(x);
+    // 910E  ASL
+    start = cycles; cycles += 6; executed++; t = RD(0x03F6); ASL(t); WR(0x03F6, t);
+    // 9111  TSX
+    start = cycles; cycles += 2; executed++; x = sp; NZ(x);
+    // 9112  ADC
+    start = cycles; cycles += 3; executed++; ADC(RD(0x7A));
+    // 9114  LDX
+    start = cycles; cycles += 2; executed++; x = 0x97; NZ(x);
+    // 9116  LDA
+    start = cycles; cycles += 2; executed++; a = 0x4F; NZ(a);
+    // 9118  STA
+    start = cycles; cycles += 3; executed++; WR(0x75, a);
+    // 911A  LDA
+    start = cycles; cycles += 2; executed++; a = 0x93; NZ(a);
+    // 911C  STA
+    start = cycles; cycles += 3; executed++; WR(0x76, a);
+    // 911E  ORA
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0xDE + x); a |= RD(ea); NZ(a);
+    IO_EXIT(0x9120);
+    // 9120  STA
+    start = cycles; cycles += 4; executed++; WR(0x007C, a);
+    // 9123  LDA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x04ED + y); cycles += PAGE_CROSSED(0x04ED, ea); a = RD(ea); NZ(a);
+    // 9126  TYA
+    start = cycles; cycles += 2; executed++; a = y; NZ(a);
+    // 9127  PLA
+    start = cycles; cycles += 4; executed++; a = PULL(); NZ(a);
+    // 9128  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 1; EXIT(0x912D); }
+    EXIT(0x912A);
+}
+
+static int block_912A(espnes_context *ctx)
+{
+    BEGIN;
+    // 912A  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xD2AD); NZ(a);
+    IO_EXIT(0x912D);
+    EXIT(0x912D);
+}
+
+static int block_912D(espnes_context *ctx)
+{
+    BEGIN;
+    // 912D  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x24 + x); ADC(RD(ea));
+    // 912F  DEY
+    start = cycles; cycles += 2; executed++; y--; NZ(y);
+    // 9130  ASL
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x46 + x); t = RD(ea); ASL(t); WR(ea, t);
+    // 9132  SEI
+    start = cycles; cycles += 2; executed++; SETF(F_I, 1);
+    // 9133  DEC
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0xB9 + x); t = RD(ea); t--; NZ(t); WR(ea, t);
+    // 9135  BVC
+    start = cycles; cycles += 2; executed++; if (!(p & F_V)) { cycles += 1; EXIT(0x913A); }
+    EXIT(0x9137);
+}
+
+static int block_9137(espnes_context *ctx)
+{
+    BEGIN;
+    // 9137  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x03DD); NZ(a);
+    EXIT(0x913A);
+}
+
+static int block_913A(espnes_context *ctx)
+{
+    BEGIN;
+    // 913A  DEC
+    start = cycles; cycles += 6; executed++; t = RD(0x00BA); t--; NZ(t); WR(0x00BA, t);
+    // 913D  EOR
+    start = cycles; cycles += 3; executed++; a ^= RD(0x33); NZ(a);
+    // 913F  PLA
+    start = cycles; cycles += 4; executed++; a = PULL(); NZ(a);
+    // 9140  LDA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0494 + x); cycles += PAGE_CROSSED(0x0494, ea); a = RD(ea); NZ(a);
+    // 9143  LDA
+    start = cycles; cycles += 3; executed++; a = RD(0x17); NZ(a);
+    // 9145  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0179 + y); cycles += PAGE_CROSSED(0x0179, ea); a ^= RD(ea); NZ(a);
+    // 9148  LSR
+    start = cycles; cycles += 5; executed++; t = RD(0x2E); LSR(t); WR(0x2E, t);
+    // 914A  BEQ
+    start = cycles; cycles += 2; executed++; if (p & F_Z) { cycles += 1; EXIT(0x914F); }
+    EXIT(0x914C);
+}
+
+static int block_914C(espnes_context *ctx)
+{
+    BEGIN;
+    // 914C  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x01C3); NZ(a);
+    EXIT(0x914F);
+}
+
+static int block_914F(espnes_context *ctx)
+{
+    BEGIN;
+    // 914F  LDA
+    start = cycles; cycles += 2; executed++; a = 0x23; NZ(a);
+    // 9151  STA
+    start = cycles; cycles += 3; executed++; WR(0x28, a);
+    // 9153  LDA
+    start = cycles; cycles += 2; executed++; a = 0xD0; NZ(a);
+    // 9155  STA
+    start = cycles; cycles += 3; executed++; WR(0x29, a);
+    // 9157  AND
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x28); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a &= RD(ea); NZ(a);
+    IO_EXIT(0x9159);
+    // 9159  ADC
+    start = cycles; cycles += 4; executed++; ADC(RD(0xC335));
+    IO_EXIT(0x915C);
+    // 915C  STY
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x4F + x); WR(ea, y);
+    // 915E  LDX
+    start = cycles; cycles += 2; executed++; x = 0x72; NZ(x);
+    // 9160  LDA
+    start = cycles; cycles += 2; executed++; a = 0xFA; NZ(a);
+    // 9162  STA
+    start = cycles; cycles += 3; executed++; WR(0x0B, a);
+    // 9164  LDA
+    start = cycles; cycles += 2; executed++; a = 0xC5; NZ(a);
+    // 9166  STA
+    start = cycles; cycles += 3; executed++; WR(0x0C, a);
+    // 9168  AND
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x99 + x); a &= RD(ea); NZ(a);
+    IO_EXIT(0x916A);
+    // 916A  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xCAAD); NZ(a);
+    IO_EXIT(0x916D);
+    // 916D  LDY
+    start = cycles; cycles += 2; executed++; y = 0x8E; NZ(y);
+    // 916F  BIT
+    start = cycles; cycles += 4; executed++; BIT(RD(0xC597));
+    IO_EXIT(0x9172);
+    // 9172  SBC
+    start = cycles; cycles += 4; executed++; SBC(RD(0x913F));
+    IO_EXIT(0x9175);
+    // 9175  INC
+    start = cycles; cycles += 5; executed++; t = RD(0x6A); t++; NZ(t); WR(0x6A, t);
+    // 9177  EOR
+    start = cycles; cycles += 4; executed++; a ^= RD(0xDBA2); NZ(a);
+    IO_EXIT(0x917A);
+    // 917A  BCS
+    start = cycles; cycles += 2; executed++; if (p & F_C) { cycles += 1; EXIT(0x917F); }
+    EXIT(0x917C);
+}
+
+static int block_917C(espnes_context *ctx)
+{
+    BEGIN;
+    // 917C  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xAC62); NZ(a);
+    IO_EXIT(0x917F);
+    EXIT(0x917F);
+}
+
+static int block_917F(espnes_context *ctx)
+{
+    BEGIN;
+    // 917F  CPX
+    start = cycles; cycles += 4; executed++; CMP(x, RD(0x01A9));
+    // 9182  SBC
+    start = cycles; cycles += 3; executed++; SBC(RD(0xBE));
+    // 9184  DEX
+    start = cycles; cycles += 2; executed++; x--; NZ(x);
+    // 9185  ADC
+    start = cycles; cycles += 3; executed++; ADC(RD(0xB3));
+    // 9187  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 1; EXIT(0x918C); }
+    EXIT(0x9189);
+}
+
+static int block_9189(espnes_context *ctx)
+{
+    BEGIN;
+    // 9189  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xD6A6); NZ(a);
+    IO_EXIT(0x918C);
+    EXIT(0x918C);
+}
+
+static int block_918C(espnes_context *ctx)
+{
+    BEGIN;
+    // 918C  CPY
+    start = cycles; cycles += 3; executed++; CMP(y, RD(0xA8));
+    // 918E  TAX
+    start = cycles; cycles += 2; executed++; x = a; NZ(x);
+    // 918F  LDX
+    start = cycles; cycles += 2; executed++; x = 0x54; NZ(x);
+    // 9191  LDA
+    start = cycles; cycles += 2; executed++; a = 0xCF; NZ(a);
+    // 9193  STA
+    start = cycles; cycles += 3; executed++; WR(0xAE, a);
+    // 9195  LDA
+    start = cycles; cycles += 2; executed++; a = 0x03; NZ(a);
+    // 9197  STA
+    start = cycles; cycles += 3; executed++; WR(0xAF, a);
+    // 9199  CMP
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x5A + x); CMP(a, RD(ea));
+    IO_EXIT(0x919B);
+    // 919B  ASL
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x069D + x); t = RD(ea); ASL(t); WR(ea, t);
+    // 919E  CPY
+    start = cycles; cycles += 2; executed++; CMP(y, 0xB8);
+    // 91A0  CLV
+    start = cycles; cycles += 2; executed++; SETF(F_V, 0);
+    // 91A1  CMP
+    start = cycles; cycles += 3; executed++; CMP(a, RD(0x43));
+    // 91A3  TYA
+    start = cycles; cycles += 2; executed++; a = y; NZ(a);
+    // 91A4  ORA
+    start = cycles; cycles += 3; executed++; a |= RD(0x10); NZ(a);
+    // 91A6  ORA
+    start = cycles; cycles += 4; executed++; a |= RD(0x0443); NZ(a);
+    // 91A9  ADC
+    start = cycles; cycles += 4; executed++; ADC(RD(0xBA92));
+    IO_EXIT(0x91AC);
+    // 91AC  BCC
+    start = cycles; cycles += 2; executed++; if (!(p & F_C)) { cycles += 1; EXIT(0x91B1); }
+    EXIT(0x91AE);
+}
+
+static int block_91AE(espnes_context *ctx)
+{
+    BEGIN;
+    // 91AE  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x006E); NZ(a);
+    EXIT(0x91B1);
+}
+
+static int block_91B1(espnes_context *ctx)
+{
+    BEGIN;
+    // 91B1  TXS
+    start = cycles; cycles += 2; executed++; sp = x;
+    // 91B2  LDA
+    start = cycles; cycles += 2; executed++; a = 0x78; NZ(a);
+    // 91B4  STA
+    start = cycles; cycles += 3; executed++; WR(0xED, a);
+    // 91B6  LDA
+    start = cycles; cycles += 2; executed++; a = 0x03; NZ(a);
+    // 91B8  STA
+    start = cycles; cycles += 3; executed++; WR(0xEE, a);
+    // 91BA  ORA
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0xED); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a |= RD(ea); NZ(a);
+    IO_EXIT(0x91BC);
+    // 91BC  LDY
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x052C + x); cycles += PAGE_CROSSED(0x052C, ea); y = RD(ea); NZ(y);
+    // 91BF  BEQ
+    start = cycles; cycles += 2; executed++; if (p & F_Z) { cycles += 1; EXIT(0x91C4); }
+    EXIT(0x91C1);
+}
+
+static int block_91C1(espnes_context *ctx)
+{
+    BEGIN;
+    // 91C1  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x063E); NZ(a);
+    EXIT(0x91C4);
+}
+
+static int block_91C4(espnes_context *ctx)
+{
+    BEGIN;
+    // 91C4  ROL
+    start = cycles; cycles += 6; executed++; t = RD(0x0016); ROL(t); WR(0x0016, t);
+    // 91C7  STA
+    start = cycles; cycles += 5; executed++; ea = (uint16_t)(0x06DC + x); WR(ea, a);
+    // 91CA  SEC
+    start = cycles; cycles += 2; executed++; SETF(F_C, 1);
+    // 91CB  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xAF53 + y); cycles += PAGE_CROSSED(0xAF53, ea); ADC(RD(ea));
+    IO_EXIT(0x91CE);
+    // 91CE  LDA
+    start = cycles; cycles += 2; executed++; a = 0x15; NZ(a);
+    // 91D0  STA
+    start = cycles; cycles += 3; executed++; WR(0x01, a);
+    // 91D2  LDA
+    start = cycles; cycles += 2; executed++; a = 0x05; NZ(a);
+    // 91D4  STA
+    start = cycles; cycles += 3; executed++; WR(0x02, a);
+    // 91D6  AND
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x01); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a &= RD(ea); NZ(a);
+    IO_EXIT(0x91D8);
+    // 91D8  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x00E5 + y); cycles += PAGE_CROSSED(0x00E5, ea); a ^= RD(ea); NZ(a);
+    // 91DB  LDA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x8DCE + x); cycles += PAGE_CROSSED(0x8DCE, ea); a = RD(ea); NZ(a);
+    IO_EXIT(0x91DE);
+    // 91DE  LSR
+    start = cycles; cycles += 5; executed++; t = RD(0xB6); LSR(t); WR(0xB6, t);
+    // 91E0  TAX
+    start = cycles; cycles += 2; executed++; x = a; NZ(x);
+    // 91E1  CLD
+    start = cycles; cycles += 2; executed++; SETF(F_D, 0);
+    // 91E2  BCS
+    start = cycles; cycles += 2; executed++; if (p & F_C) { cycles += 1; EXIT(0x91E7); }
+    EXIT(0x91E4);
+}
+
+static int block_91E4(espnes_context *ctx)
+{
+    BEGIN;
+    // 91E4  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xE221); NZ(a);
+    IO_EXIT(0x91E7);
+    EXIT(0x91E7);
+}
+
+static int block_91E7(espnes_context *ctx)
+{
+    BEGIN;
+    // 91E7  SEC
+    start = cycles; cycles += 2; executed++; SETF(F_C, 1);
+    // 91E8  ROL
+    start = cycles; cycles += 2; executed++; ROL(a);
+    // 91E9  LDX
+    start = cycles; cycles += 3; executed++; x = RD(0x89); NZ(x);
+    // 91EB  ROL
+    start = cycles; cycles += 6; executed++; t = RD(0x00D5); ROL(t); WR(0x00D5, t);
+    // 91EE  AND
+    start = cycles; cycles += 4; executed++; a &= RD(0xDE3F); NZ(a);
+    IO_EXIT(0x91F1);
+    // 91F1  LDX
+    start = cycles; cycles += 2; executed++; x = 0x21; NZ(x);
+    // 91F3  LDA
+    start = cycles; cycles += 2; executed++; a = 0xCE; NZ(a);
+    // 91F5  STA
+    start = cycles; cycles += 3; executed++; WR(0xE3, a);
+    // 91F7  LDA
+    start = cycles; cycles += 2; executed++; a = 0x00; NZ(a);
+    // 91F9  STA
+    start = cycles; cycles += 3; executed++; WR(0xE4, a);
+    // 91FB  LDA
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0xC2 + x); a = RD(ea); NZ(a);
+    IO_EXIT(0x91FD);
+    // 91FD  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 2; EXIT(0x9202); }
+    EXIT(0x91FF);
+}
+
+static int block_91FF(espnes_context *ctx)
+{
+    BEGIN;
+    // 91FF  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xC1F8); NZ(a);
+    IO_EXIT(0x9202);
+    EXIT(0x9202);
+}
+
+static int block_9202(espnes_context *ctx)
+{
+    BEGIN;
+    // 9202  LDX
+    start = cycles; cycles += 2; executed++; x = 0x24; NZ(x);
+    // 9204  LDA
+    start = cycles; cycles += 2; executed++; a = 0x50; NZ(a);
+    // 9206  STA
+    start = cycles; cycles += 3; executed++; WR(0x96, a);
+    // 9208  LDA
+    start = cycles; cycles += 2; executed++; a = 0xB5; NZ(a);
+    // 920A  STA
+    start = cycles; cycles += 3; executed++; WR(0x97, a);
+    // 920C  ADC
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x72 + x); ADC(RD(ea));
+    IO_EXIT(0x920E);
+    // 920E  TAX
+    start = cycles; cycles += 2; executed++; x = a; NZ(x);
+    // 920F  BVC
+    start = cycles; cycles += 2; executed++; if (!(p & F_V)) { cycles += 1; EXIT(0x9214); }
+    EXIT(0x9211);
+}
+
+static int block_9211(espnes_context *ctx)
+{
+    BEGIN;
+    // 9211  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xE000); NZ(a);
+    IO_EXIT(0x9214);
+    EXIT(0x9214);
+}
+
+static int block_9214(espnes_context *ctx)
+{
+    BEGIN;
+    // 9214  ROR
+    start = cycles; cycles += 2; executed++; ROR(a);
+    // 9215  PHP
+    start = cycles; cycles += 3; executed++; PUSH(p | F_B | F_U);
+    // 9216  DEX
+    start = cycles; cycles += 2; executed++; x--; NZ(x);
+    // 9217  SBC
+    start = cycles; cycles += 4; executed++; SBC(RD(0xA1BD));
+    IO_EXIT(0x921A);
+    // 921A  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x8A6F); NZ(a);
+    IO_EXIT(0x921D);
+    // 921D  STA
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x5C + x); WR(ea, a);
+    // 921F  LSR
+    start = cycles; cycles += 2; executed++; LSR(a);
+    // 9220  ROR
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x0387 + x); t = RD(ea); ROR(t); WR(ea, t);
+    // 9223  INC
+    start = cycles; cycles += 5; executed++; t = RD(0x24); t++; NZ(t); WR(0x24, t);
+    // 9225  CPY
+    start = cycles; cycles += 4; executed++; CMP(y, RD(0x06D6));
+    // 9228  LDY
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xBF + x); y = RD(ea); NZ(y);
+    // 922A  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x01FB + x); cycles += PAGE_CROSSED(0x01FB, ea); a ^= RD(ea); NZ(a);
+    // 922D  BEQ
+    start = cycles; cycles += 2; executed++; if (p & F_Z) { cycles += 1; EXIT(0x9232); }
+    EXIT(0x922F);
+}
+
+static int block_922F(espnes_context *ctx)
+{
+    BEGIN;
+    // 922F  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xCA99); NZ(a);
+    IO_EXIT(0x9232);
+    EXIT(0x9232);
+}
+
+static int block_9232(espnes_context *ctx)
+{
+    BEGIN;
+    // 9232  ROR
+    start = cycles; cycles += 6; executed++; t = RD(0x00F9); ROR(t); WR(0x00F9, t);
+    // 9235  LDX
+    start = cycles; cycles += 2; executed++; x = 0x1E; NZ(x);
+    // 9237  LDA
+    start = cycles; cycles += 2; executed++; a = 0xDF; NZ(a);
+    // 9239  STA
+    start = cycles; cycles += 3; executed++; WR(0xAF, a);
+    // 923B  LDA
+    start = cycles; cycles += 2; executed++; a = 0xC4; NZ(a);
+    // 923D  STA
+    start = cycles; cycles += 3; executed++; WR(0xB0, a);
+    // 923F  SBC
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x91 + x); SBC(RD(ea));
+    IO_EXIT(0x9241);
+    // 9241  ASL
+    start = cycles; cycles += 5; executed++; t = RD(0x26); ASL(t); WR(0x26, t);
+    // 9243  STX
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x2A + y); WR(ea, x);
+    // 9245  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xBE33 + x); cycles += PAGE_CROSSED(0xBE33, ea); a ^= RD(ea); NZ(a);
+    IO_EXIT(0x9248);
+    // 9248  CMP
+    start = cycles; cycles += 2; executed++; CMP(a, 0x6D);
+    // 924A  BPL
+    start = cycles; cycles += 2; executed++; if (!(p & F_N)) { cycles += 1; EXIT(0x924F); }
+    EXIT(0x924C);
+}
+
+static int block_924C(espnes_context *ctx)
+{
+    BEGIN;
+    // 924C  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0263); NZ(a);
+    EXIT(0x924F);
+}
+
+static int block_924F(espnes_context *ctx)
+{
+    BEGIN;
+    // 924F  ORA
+    start = cycles; cycles += 2; executed++; a |= 0x71; NZ(a);
+    // 9251  TSX
+    start = cycles; cycles += 2; executed++; x = sp; NZ(x);
+    // 9252  ROR
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x6F + x); t = RD(ea); ROR(t); WR(ea, t);
+    // 9254  LSR
+    start = cycles; cycles += 6; executed++; t = RD(0x0591); LSR(t); WR(0x0591, t);
+    // 9257  SBC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x04BF + x); cycles += PAGE_CROSSED(0x04BF, ea); SBC(RD(ea));
+    // 925A  BIT
+    start = cycles; cycles += 3; executed++; BIT(RD(0x21));
+    // 925C  BCS
+    start = cycles; cycles += 2; executed++; if (p & F_C) { cycles += 1; EXIT(0x9261); }
+    EXIT(0x925E);
+}
+
+static int block_925E(espnes_context *ctx)
+{
+    BEGIN;
+    // 925E  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0359); NZ(a);
+    EXIT(0x9261);
+}
+
+static int block_9261(espnes_context *ctx)
+{
+    BEGIN;
+    // 9261  ROL
+    start = cycles; cycles += 5; executed++; t = RD(0xDA); ROL(t); WR(0xDA, t);
+    // 9263  BPL
+    start = cycles; cycles += 2; executed++; if (!(p & F_N)) { cycles += 1; EXIT(0x9268); }
+    EXIT(0x9265);
+}
+
+static int block_9265(espnes_context *ctx)
+{
+    BEGIN;
+    // 9265  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x04DC); NZ(a);
+    EXIT(0x9268);
+}
+
+static int block_9268(espnes_context *ctx)
+{
+    BEGIN;
+    // 9268  TSX
+    start = cycles; cycles += 2; executed++; x = sp; NZ(x);
+    // 9269  BCC
+    start = cycles; cycles += 2; executed++; if (!(p & F_C)) { cycles += 1; EXIT(0x926E); }
+    EXIT(0x926B);
+}
+
+static int block_926B(espnes_context *ctx)
+{
+    BEGIN;
+    // 926B  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0132); NZ(a);
+    EXIT(0x926E);
+}
+
+static int block_926E(espnes_context *ctx)
+{
+    BEGIN;
+    // 926E  SBC
+    start = cycles; cycles += 4; executed++; SBC(RD(0x03A8));
+    // 9271  AND
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x028A + y); cycles += PAGE_CROSSED(0x028A, ea); a &= RD(ea); NZ(a);
+    // 9274  LSR
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x02CE + x); t = RD(ea); LSR(t); WR(ea, t);
+    // 9277  LDX
+    start = cycles; cycles += 2; executed++; x = 0x86; NZ(x);
+    // 9279  LDA
+    start = cycles; cycles += 2; executed++; a = 0xEA; NZ(a);
+    // 927B  STA
+    start = cycles; cycles += 3; executed++; WR(0xD7, a);
+    // 927D  LDA
+    start = cycles; cycles += 2; executed++; a = 0x04; NZ(a);
+    // 927F  STA
+    start = cycles; cycles += 3; executed++; WR(0xD8, a);
+    // 9281  EOR
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x51 + x); a ^= RD(ea); NZ(a);
+    IO_EXIT(0x9283);
+    // 9283  CMP
+    start = cycles; cycles += 2; executed++; CMP(a, 0x54);
+    // 9285  ROL
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x00D1 + x); t = RD(ea); ROL(t); WR(ea, t);
+    // 9288  DEC
+    start = cycles; cycles += 6; executed++; t = RD(0x0325); t--; NZ(t); WR(0x0325, t);
+    // 928B  INC
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0xE2 + x); t = RD(ea); t++; NZ(t); WR(ea, t);
+    // 928D  LDA
+    start = cycles; cycles += 2; executed++; a = 0x0D; NZ(a);
+    // 928F  STA
+    start = cycles; cycles += 3; executed++; WR(0x79, a);
+    // 9291  LDA
+    start = cycles; cycles += 2; executed++; a = 0xA1; NZ(a);
+    // 9293  STA
+    start = cycles; cycles += 3; executed++; WR(0x7A, a);
+    // 9295  ORA
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x79); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a |= RD(ea); NZ(a);
+    IO_EXIT(0x9297);
+    // 9297  ASL
+    start = cycles; cycles += 2; executed++; ASL(a);
+    // 9298  BCC
+    start = cycles; cycles += 2; executed++; if (!(p & F_C)) { cycles += 1; EXIT(0x929D); }
+    EXIT(0x929A);
+}
+
+static int block_929A(espnes_context *ctx)
+{
+    BEGIN;
+    // 929A  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x05BE); NZ(a);
+    EXIT(0x929D);
+}
+
+static int block_929D(espnes_context *ctx)
+{
+    BEGIN;
+    // 929D  STA
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xC8 + x); WR(ea, a);
+    // 929F  BCC
+    start = cycles; cycles += 2; executed++; if (!(p & F_C)) { cycles += 1; EXIT(0x92A4); }
+    EXIT(0x92A1);
+}
+
+static int block_92A1(espnes_context *ctx)
+{
+    BEGIN;
+    // 92A1  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0269); NZ(a);
+    EXIT(0x92A4);
+}
+
+static int block_92A4(espnes_context *ctx)
+{
+    BEGIN;
+    // 92A4  DEC
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0xC9 + x); t = RD(ea); t--; NZ(t); WR(ea, t);
+    // 92A6  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x82 + x); a ^= RD(ea); NZ(a);
+    // 92A8  SEC
+    start = cycles; cycles += 2; executed++; SETF(F_C, 1);
+    // 92A9  DEC
+    start = cycles; cycles += 5; executed++; t = RD(0xB3); t--; NZ(t); WR(0xB3, t);
+    // 92AB  BMI
+    start = cycles; cycles += 2; executed++; if (p & F_N) { cycles += 1; EXIT(0x92B0); }
+    EXIT(0x92AD);
+}
+
+static int block_92AD(espnes_context *ctx)
+{
+    BEGIN;
+    // 92AD  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0674); NZ(a);
+    EXIT(0x92B0);
+}
+
+static int block_92B0(espnes_context *ctx)
+{
+    BEGIN;
+    // 92B0  LDA
+    start = cycles; cycles += 2; executed++; a = 0x46; NZ(a);
+    // 92B2  STA
+    start = cycles; cycles += 3; executed++; WR(0xB7, a);
+    // 92B4  LDA
+    start = cycles; cycles += 2; executed++; a = 0x01; NZ(a);
+    // 92B6  STA
+    start = cycles; cycles += 3; executed++; WR(0xB8, a);
+    // 92B8  SBC
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0xB7); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); SBC(RD(ea));
+    IO_EXIT(0x92BA);
+    // 92BA  SBC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xB206 + x); cycles += PAGE_CROSSED(0xB206, ea); SBC(RD(ea));
+    IO_EXIT(0x92BD);
+    // 92BD  BIT
+    start = cycles; cycles += 3; executed++; BIT(RD(0xAD));
+    // 92BF  LDY
+    start = cycles; cycles += 2; executed++; y = 0xD6; NZ(y);
+    // 92C1  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 1; EXIT(0x92C6); }
+    EXIT(0x92C3);
+}
+
+static int block_92C3(espnes_context *ctx)
+{
+    BEGIN;
+    // 92C3  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xCD5F); NZ(a);
+    IO_EXIT(0x92C6);
+    EXIT(0x92C6);
+}
+
+static int block_92C6(espnes_context *ctx)
+{
+    BEGIN;
+    // 92C6  DEC
+    start = cycles; cycles += 6; executed++; t = RD(0x0651); t--; NZ(t); WR(0x0651, t);
+    // 92C9  LDA
+    start = cycles; cycles += 2; executed++; a = 0x52; NZ(a);
+    // 92CB  STA
+    start = cycles; cycles += 3; executed++; WR(0x37, a);
+    // 92CD  LDA
+    start = cycles; cycles += 2; executed++; a = 0x06; NZ(a);
+    // 92CF  STA
+    start = cycles; cycles += 3; executed++; WR(0x38, a);
+    // 92D1  SBC
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x37); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); SBC(RD(ea));
+    IO_EXIT(0x92D3);
+    // 92D3  STX
+    start = cycles; cycles += 4; executed++; WR(0x056A, x);
+    // 92D6  LDA
+    start = cycles; cycles += 2; executed++; a = 0x09; NZ(a);
+    // 92D8  STA
+    start = cycles; cycles += 3; executed++; WR(0x7A, a);
+    // 92DA  LDA
+    start = cycles; cycles += 2; executed++; a = 0x03; NZ(a);
+    // 92DC  STA
+    start = cycles; cycles += 3; executed++; WR(0x7B, a);
+    // 92DE  CMP
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x7A); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); CMP(a, RD(ea));
+    IO_EXIT(0x92E0);
+    // 92E0  TXA
+    start = cycles; cycles += 2; executed++; a = x; NZ(a);
+    // 92E1  LDA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xC27B + x); cycles += PAGE_CROSSED(0xC27B, ea); a = RD(ea); NZ(a);
+    IO_EXIT(0x92E4);
+    // 92E4  DEY
+    start = cycles; cycles += 2; executed++; y--; NZ(y);
+    // 92E5  ROL
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x04BB + x); t = RD(ea); ROL(t); WR(ea, t);
+    // 92E8  BVS
+    start = cycles; cycles += 2; executed++; if (p & F_V) { cycles += 1; EXIT(0x92ED); }
+    EXIT(0x92EA);
+}
+
+static int block_92EA(espnes_context *ctx)
+{
+    BEGIN;
+    // 92EA  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xCF52); NZ(a);
+    IO_EXIT(0x92ED);
+    EXIT(0x92ED);
+}
+
+static int block_92ED(espnes_context *ctx)
+{
+    BEGIN;
+    // 92ED  STX
+    start = cycles; cycles += 4; executed++; WR(0x05AF, x);
+    // 92F0  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x023B + y); cycles += PAGE_CROSSED(0x023B, ea); a ^= RD(ea); NZ(a);
+    // 92F3  LDX
+    start = cycles; cycles += 2; executed++; x = 0xA6; NZ(x);
+    // 92F5  LDA
+    start = cycles; cycles += 2; executed++; a = 0xA5; NZ(a);
+    // 92F7  STA
+    start = cycles; cycles += 3; executed++; WR(0x65, a);
+    // 92F9  LDA
+    start = cycles; cycles += 2; executed++; a = 0xBB; NZ(a);
+    // 92FB  STA
+    start = cycles; cycles += 3; executed++; WR(0x66, a);
+    // 92FD  LDA
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0xBF + x); a = RD(ea); NZ(a);
+    IO_EXIT(0x92FF);
+    // 92FF  ROL
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x12 + x); t = RD(ea); ROL(t); WR(ea, t);
+    // 9301  CPX
+    start = cycles; cycles += 4; executed++; CMP(x, RD(0x01BD));
+    // 9304  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x06BF + x); cycles += PAGE_CROSSED(0x06BF, ea); a ^= RD(ea); NZ(a);
+    // 9307  CLV
+    start = cycles; cycles += 2; executed++; SETF(F_V, 0);
+    // 9308  ROL
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x3C + x); t = RD(ea); ROL(t); WR(ea, t);
+    // 930A  EOR
+    start = cycles; cycles += 3; executed++; a ^= RD(0x8C); NZ(a);
+    // 930C  TXS
+    start = cycles; cycles += 2; executed++; sp = x;
+    // 930D  CMP
+    start = cycles; cycles += 2; executed++; CMP(a, 0x92);
+    // 930F  BCS
+    start = cycles; cycles += 2; executed++; if (p & F_C) { cycles += 1; EXIT(0x9314); }
+    EXIT(0x9311);
+}
+
+static int block_9311(espnes_context *ctx)
+{
+    BEGIN;
+    // 9311  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xDB68); NZ(a);
+    IO_EXIT(0x9314);
+    EXIT(0x9314);
+}
+
+static int block_9314(espnes_context *ctx)
+{
+    BEGIN;
+    // 9314  LDA
+    start = cycles; cycles += 2; executed++; a = 0xDA; NZ(a);
+    // 9316  STA
+    start = cycles; cycles += 3; executed++; WR(0x07, a);
+    // 9318  LDA
+    start = cycles; cycles += 2; executed++; a = 0x98; NZ(a);
+    // 931A  STA
+    start = cycles; cycles += 3; executed++; WR(0x08, a);
+    // 931C  EOR
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x07); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a ^= RD(ea); NZ(a);
+    IO_EXIT(0x931E);
+    // 931E  LSR
+    start = cycles; cycles += 6; executed++; t = RD(0x051B); LSR(t); WR(0x051B, t);
+    // 9321  LDA
+    start = cycles; cycles += 2; executed++; a = 0xB8; NZ(a);
+    // 9323  STA
+    start = cycles; cycles += 3; executed++; WR(0x72, a);
+    // 9325  LDA
+    start = cycles; cycles += 2; executed++; a = 0xE9; NZ(a);
+    // 9327  STA
+    start = cycles; cycles += 3; executed++; WR(0x73, a);
+    // 9329  EOR
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x72); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a ^= RD(ea); NZ(a);
+    IO_EXIT(0x932B);
+    // 932B  LDX
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x7D + y); x = RD(ea); NZ(x);
+    // 932D  LDX
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x051E + y); cycles += PAGE_CROSSED(0x051E, ea); x = RD(ea); NZ(x);
+    // 9330  PLA
+    start = cycles; cycles += 4; executed++; a = PULL(); NZ(a);
+    // 9331  STY
+    start = cycles; cycles += 3; executed++; WR(0x92, y);
+    // 9333  ORA
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x98 + x); a |= RD(ea); NZ(a);
+    // 9335  ORA
+    start = cycles; cycles += 2; executed++; a |= 0x4E; NZ(a);
+    // 9337  BEQ
+    start = cycles; cycles += 2; executed++; if (p & F_Z) { cycles += 1; EXIT(0x933C); }
+    EXIT(0x9339);
+}
+
+static int block_9339(espnes_context *ctx)
+{
+    BEGIN;
+    // 9339  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x040F); NZ(a);
+    EXIT(0x933C);
+}
+
+static int block_933C(espnes_context *ctx)
+{
+    BEGIN;
+    // 933C  LDA
+    start = cycles; cycles += 3; executed++; a = RD(0x1A); NZ(a);
+    // 933E  INC
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x34 + x); t = RD(ea); t++; NZ(t); WR(ea, t);
+    // 9340  INX
+    start = cycles; cycles += 2; executed++; x++; NZ(x);
+    // 9341  BMI
+    start = cycles; cycles += 2; executed++; if (p & F_N) { cycles += 1; EXIT(0x9346); }
+    EXIT(0x9343);
+}
+
+static int block_9343(espnes_context *ctx)
+{
+    BEGIN;
+    // 9343  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0078); NZ(a);
+    EXIT(0x9346);
+}
+
+static int block_9346(espnes_context *ctx)
+{
+    BEGIN;
+    // 9346  ADC
+    start = cycles; cycles += 3; executed++; ADC(RD(0x87));
+    // 9348  LDA
+    start = cycles; cycles += 2; executed++; a = 0x87; NZ(a);
+    // 934A  STA
+    start = cycles; cycles += 3; executed++; WR(0x33, a);
+    // 934C  LDA
+    start = cycles; cycles += 2; executed++; a = 0xF4; NZ(a);
+    // 934E  STA
+    start = cycles; cycles += 3; executed++; WR(0x34, a);
+    // 9350  AND
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x33); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a &= RD(ea); NZ(a);
+    IO_EXIT(0x9352);
+    // 9352  ASL
+    start = cycles; cycles += 2; executed++; ASL(a);
+    // 9353  LDX
+    start = cycles; cycles += 2; executed++; x = 0x16; NZ(x);
+    // 9355  LDA
+    start = cycles; cycles += 2; executed++; a = 0x60; NZ(a);
+    // 9357  STA
+    start = cycles; cycles += 3; executed++; WR(0xEC, a);
+    // 9359  LDA
+    start = cycles; cycles += 2; executed++; a = 0x82; NZ(a);
+    // 935B  STA
+    start = cycles; cycles += 3; executed++; WR(0xED, a);
+    // 935D  EOR
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0xD6 + x); a ^= RD(ea); NZ(a);
+    IO_EXIT(0x935F);
+    // 935F  AND
+    start = cycles; cycles += 3; executed++; a &= RD(0x37); NZ(a);
+    // 9361  DEY
+    start = cycles; cycles += 2; executed++; y--; NZ(y);
+    // 9362  TAY
+    start = cycles; cycles += 2; executed++; y = a; NZ(y);
+    // 9363  EOR
+    start = cycles; cycles += 3; executed++; a ^= RD(0x63); NZ(a);
+    // 9365  TAY
+    start = cycles; cycles += 2; executed++; y = a; NZ(y);
+    // 9366  CPY
+    start = cycles; cycles += 3; executed++; CMP(y, RD(0x37));
+    // 9368  ROL
+    start = cycles; cycles += 2; executed++; ROL(a);
+    // 9369  BCS
+    start = cycles; cycles += 2; executed++; if (p & F_C) { cycles += 1; EXIT(0x936E); }
+    EXIT(0x936B);
+}
+
+static int block_936B(espnes_context *ctx)
+{
+    BEGIN;
+    // 936B  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0677); NZ(a);
+    EXIT(0x936E);
+}
+
+static int block_936E(espnes_context *ctx)
+{
+    BEGIN;
+    // 936E  STY
+    start = cycles; cycles += 4; executed++; WR(0x006F, y);
+    // 9371  LDA
+    start = cycles; cycles += 2; executed++; a = 0xC8; NZ(a);
+    // 9373  STA
+    start = cycles; cycles += 3; executed++; WR(0xFA, a);
+    // 9375  LDA
+    start = cycles; cycles += 2; executed++; a = 0xEF; NZ(a);
+    // 9377  STA
+    start = cycles; cycles += 3; executed++; WR(0xFB, a);
+    // 9379  LDA
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0xFA); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a = RD(ea); NZ(a);
+    IO_EXIT(0x937B);
+    // 937B  LDX
+    start = cycles; cycles += 4; executed++; x = RD(0x0009); NZ(x);
+    // 937E  ASL
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x29 + x); t = RD(ea); ASL(t); WR(ea, t);
+    // 9380  ROR
+    start = cycles; cycles += 6; executed++; t = RD(0x0258); ROR(t); WR(0x0258, t);
+    // 9383  STA
+    start = cycles; cycles += 3; executed++; WR(0x4F, a);
+    // 9385  BCS
+    start = cycles; cycles += 2; executed++; if (p & F_C) { cycles += 1; EXIT(0x938A); }
+    EXIT(0x9387);
+}
+
+static int block_9387(espnes_context *ctx)
+{
+    BEGIN;
+    // 9387  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0374); NZ(a);
+    EXIT(0x938A);
+}
+
+static int block_938A(espnes_context *ctx)
+{
+    BEGIN;
+    // 938A  SBC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xC460 + y); cycles += PAGE_CROSSED(0xC460, ea); SBC(RD(ea));
+    IO_EXIT(0x938D);
+    // 938D  CMP
+    start = cycles; cycles += 2; executed++; CMP(a, 0x1E);
+    // 938F  SEC
+    start = cycles; cycles += 2; executed++; SETF(F_C, 1);
+    // 9390  AND
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xED + x); a &= RD(ea); NZ(a);
+    // 9392  PHP
+    start = cycles; cycles += 3; executed++; PUSH(p | F_B | F_U);
+    // 9393  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 1; EXIT(0x9398); }
+    EXIT(0x9395);
+}
+
+static int block_9395(espnes_context *ctx)
+{
+    BEGIN;
+    // 9395  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0363); NZ(a);
+    EXIT(0x9398);
+}
+
+static int block_9398(espnes_context *ctx)
+{
+    BEGIN;
+    // 9398  ROR
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0xED + x); t = RD(ea); ROR(t); WR(ea, t);
+    // 939A  LDX
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xFB + y); x = RD(ea); NZ(x);
+    // 939C  AND
+    start = cycles; cycles += 2; executed++; a &= 0x9B; NZ(a);
+    // 939E  INC
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x0171 + x); t = RD(ea); t++; NZ(t); WR(ea, t);
+    // 93A1  LSR
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x17 + x); t = RD(ea); LSR(t); WR(ea, t);
+    // 93A3  BMI
+    start = cycles; cycles += 2; executed++; if (p & F_N) { cycles += 1; EXIT(0x93A8); }
+    EXIT(0x93A5);
+}
+
+static int block_93A5(espnes_context *ctx)
+{
+    BEGIN;
+    // 93A5  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0288); NZ(a);
+    EXIT(0x93A8);
+}
+
+static int block_93A8(espnes_context *ctx)
+{
+    BEGIN;
+    // 93A8  LDX
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0280 + y); cycles += PAGE_CROSSED(0x0280, ea); x = RD(ea); NZ(x);
+    // 93AB  CMP
+    start = cycles; cycles += 4; executed++; CMP(a, RD(0x91CA));
+    IO_EXIT(0x93AE);
+    // 93AE  ORA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xE5F8 + x); cycles += PAGE_CROSSED(0xE5F8, ea); a |= RD(ea); NZ(a);
+    IO_EXIT(0x93B1);
+    // 93B1  ADC
+    start = cycles; cycles += 2; executed++; ADC(0x1C);
+    // 93B3  BIT
+    start = cycles; cycles += 3; executed++; BIT(RD(0x5F));
+    // 93B5  AND
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xD522 + y); cycles += PAGE_CROSSED(0xD522, ea); a &= RD(ea); NZ(a);
+    IO_EXIT(0x93B8);
+    // 93B8  CMP
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xC6 + x); CMP(a, RD(ea));
+    // 93BA  BMI
+    start = cycles; cycles += 2; executed++; if (p & F_N) { cycles += 1; EXIT(0x93BF); }
+    EXIT(0x93BC);
+}
+
+static int block_93BC(espnes_context *ctx)
+{
+    BEGIN;
+    // 93BC  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x04A5); NZ(a);
+    EXIT(0x93BF);
+}
+
+static int block_93BF(espnes_context *ctx)
+{
+    BEGIN;
+    // 93BF  LDY
+    start = cycles; cycles += 2; executed++; y = 0xC2; NZ(y);
+    // 93C1  PHP
+    start = cycles; cycles += 3; executed++; PUSH(p | F_B | F_U);
+    // 93C2  DEY
+    start = cycles; cycles += 2; executed++; y--; NZ(y);
+    // 93C3  AND
+    start = cycles; cycles += 2; executed++; a &= 0xEE; NZ(a);
+    // 93C5  SEI
+    start = cycles; cycles += 2; executed++; SETF(F_I, 1);
+    // 93C6  CLV
+    start = cycles; cycles += 2; executed++; SETF(F_V, 0);
+    // 93C7  DEC
+    start = cycles; cycles += 6; executed++; t = RD(0x0086); t--; NZ(t); WR(0x0086, t);
+    // 93CA  BVC
+    start = cycles; cycles += 2; executed++; if (!(p & F_V)) { cycles += 1; EXIT(0x93CF); }
+    EXIT(0x93CC);
+}
+
+static int block_93CC(espnes_context *ctx)
+{
+    BEGIN;
+    // 93CC  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xA98E); NZ(a);
+    IO_EXIT(0x93CF);
+    EXIT(0x93CF);
+}
+
+static int block_93CF(espnes_context *ctx)
+{
+    BEGIN;
+    // 93CF  PHA
+    start = cycles; cycles += 3; executed++; PUSH(a);
+    // 93D0  STX
+    start = cycles; cycles += 4; executed++; WR(0x035E, x);
+    // 93D3  PHA
+    start = cycles; cycles += 3; executed++; PUSH(a);
+    // 93D4  ASL
+    start = cycles; cycles += 6; executed++; t = RD(0x02EF); ASL(t); WR(0x02EF, t);
+    // 93D7  CPY
+    start = cycles; cycles += 2; executed++; CMP(y, 0xE0);
+    // 93D9  LDA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xE187 + x); cycles += PAGE_CROSSED(0xE187, ea); a = RD(ea); NZ(a);
+    IO_EXIT(0x93DC);
+    // 93DC  ASL
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x0267 + x); t = RD(ea); ASL(t); WR(ea, t);
+    // 93DF  LDA
+    start = cycles; cycles += 2; executed++; a = 0xCD; NZ(a);
+    // 93E1  STA
+    start = cycles; cycles += 3; executed++; WR(0x9F, a);
+    // 93E3  LDA
+    start = cycles; cycles += 2; executed++; a = 0x83; NZ(a);
+    // 93E5  STA
+    start = cycles; cycles += 3; executed++; WR(0xA0, a);
+    // 93E7  AND
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x9F); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a &= RD(ea); NZ(a);
+    IO_EXIT(0x93E9);
+    // 93E9  ORA
+    start = cycles; cycles += 4; executed++; a |= RD(0x010E); NZ(a);
+    // 93EC  TYA
+    start = cycles; cycles += 2; executed++; a = y; NZ(a);
+    // 93ED  TAY
+    start = cycles; cycles += 2; executed++; y = a; NZ(y);
+    // 93EE  DEC
+    start = cycles; cycles += 5; executed++; t = RD(0xC2); t--; NZ(t); WR(0xC2, t);
+    // 93F0  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 1; EXIT(0x93F5); }
+    EXIT(0x93F2);
+}
+
+static int block_93F2(espnes_context *ctx)
+{
+    BEGIN;
+    // 93F2  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x01C6); NZ(a);
+    EXIT(0x93F5);
+}
+
+static int block_93F5(espnes_context *ctx)
+{
+    BEGIN;
+    // 93F5  CMP
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xF500 + y); cycles += PAGE_CROSSED(0xF500, ea); CMP(a, RD(ea));
+    IO_EXIT(0x93F8);
+    // 93F8  ORA
+    start = cycles; cycles += 2; executed++; a |= 0xB2; NZ(a);
+    // 93FA  DEX
+    start = cycles; cycles += 2; executed++; x--; NZ(x);
+    // 93FB  SEC
+    start = cycles; cycles += 2; executed++; SETF(F_C, 1);
+    // 93FC  STA
+    start = cycles; cycles += 5; executed++; ea = (uint16_t)(0x0297 + x); WR(ea, a);
+    // 93FF  DEC
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0xA0 + x); t = RD(ea); t--; NZ(t); WR(ea, t);
+    // 9401  INX
+    start = cycles; cycles += 2; executed++; x++; NZ(x);
+    // 9402  STY
+    start = cycles; cycles += 3; executed++; WR(0x51, y);
+    // 9404  LDA
+    start = cycles; cycles += 2; executed++; a = 0xD2; NZ(a);
+    // 9406  STA
+    start = cycles; cycles += 3; executed++; WR(0xC7, a);
+    // 9408  LDA
+    start = cycles; cycles += 2; executed++; a = 0x04; NZ(a);
+    // 940A  STA
+    start = cycles; cycles += 3; executed++; WR(0xC8, a);
+    // 940C  LDA
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0xC7); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a = RD(ea); NZ(a);
+    IO_EXIT(0x940E);
+    // 940E  CMP
+    start = cycles; cycles += 3; executed++; CMP(a, RD(0xC2));
+    // 9410  BVS
+    start = cycles; cycles += 2; executed++; if (p & F_V) { cycles += 1; EXIT(0x9415); }
+    EXIT(0x9412);
+}
+
+static int block_9412(espnes_context *ctx)
+{
+    BEGIN;
+    // 9412  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xC30E); NZ(a);
+    IO_EXIT(0x9415);
+    EXIT(0x9415);
+}
+
+static int block_9415(espnes_context *ctx)
+{
+    BEGIN;
+    // 9415  ROL
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x01C0 + x); t = RD(ea); ROL(t); WR(ea, t);
+    // 9418  LDX
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x05 + y); x = RD(ea); NZ(x);
+    // 941A  ADC
+    start = cycles; cycles += 2; executed++; ADC(0x83);
+    // 941C  LDA
+    start = cycles; cycles += 2; executed++; a = 0x62; NZ(a);
+    // 941E  STA
+    start = cycles; cycles += 3; executed++; WR(0xDB, a);
+    // 9420  LDA
+    start = cycles; cycles += 2; executed++; a = 0x03; NZ(a);
+    // 9422  STA
+    start = cycles; cycles += 3; executed++; WR(0xDC, a);
+    // 9424  LDA
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0xDB); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a = RD(ea); NZ(a);
+    IO_EXIT(0x9426);
+    // 9426  LSR
+    start = cycles; cycles += 2; executed++; LSR(a);
+    // 9427  LDX
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x8FB4 + y); cycles += PAGE_CROSSED(0x8FB4, ea); x = RD(ea); NZ(x);
+    IO_EXIT(0x942A);
+    // 942A  CMP
+    start = cycles; cycles += 3; executed++; CMP(a, RD(0x0A));
+    // 942C  EOR
+    start = cycles; cycles += 3; executed++; a ^= RD(0xDB); NZ(a);
+    // 942E  ROR
+    start = cycles; cycles += 6; executed++; t = RD(0x0458); ROR(t); WR(0x0458, t);
+    // 9431  BCC
+    start = cycles; cycles += 2; executed++; if (!(p & F_C)) { cycles += 1; EXIT(0x9436); }
+    EXIT(0x9433);
+}
+
+static int block_9433(espnes_context *ctx)
+{
+    BEGIN;
+    // 9433  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xF460); NZ(a);
+    IO_EXIT(0x9436);
+    EXIT(0x9436);
+}
+
+static int block_9436(espnes_context *ctx)
+{
+    BEGIN;
+    // 9436  DEC
+    start = cycles; cycles += 5; executed++; t = RD(0x07); t--; NZ(t); WR(0x07, t);
+    // 9438  ADC
+    start = cycles; cycles += 2; executed++; ADC(0x03);
+    // 943A  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xDC8F); NZ(a);
+    IO_EXIT(0x943D);
+    // 943D  LDX
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x03CE + y); cycles += PAGE_CROSSED(0x03CE, ea); x = RD(ea); NZ(x);
+    // 9440  ORA
+    start = cycles; cycles += 4; executed++; a |= RD(0xA2FE); NZ(a);
+    IO_EXIT(0x9443);
+    // 9443  BVC
+    start = cycles; cycles += 2; executed++; if (!(p & F_V)) { cycles += 1; EXIT(0x9448); }
+    EXIT(0x9445);
+}
+
+static int block_9445(espnes_context *ctx)
+{
+    BEGIN;
+    // 9445  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xB9B4); NZ(a);
+    IO_EXIT(0x9448);
+    EXIT(0x9448);
+}
+
+static int block_9448(espnes_context *ctx)
+{
+    BEGIN;
+    // 9448  CPY
+    start = cycles; cycles += 3; executed++; CMP(y, RD(0xA3));
+    // 944A  LSR
+    start = cycles; cycles += 5; executed++; t = RD(0x63); LSR(t); WR(0x63, t);
+    // 944C  PHP
+    start = cycles; cycles += 3; executed++; PUSH(p | F_B | F_U);
+    // 944D  INC
+    start = cycles; cycles += 5; executed++; t = RD(0x31); t++; NZ(t); WR(0x31, t);
+    // 944F  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x018F + x); cycles += PAGE_CROSSED(0x018F, ea); a ^= RD(ea); NZ(a);
+    // 9452  STX
+    start = cycles; cycles += 3; executed++; WR(0xE5, x);
+    // 9454  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x8030); NZ(a);
+    IO_EXIT(0x9457);
+    // 9457  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x11 + x); ADC(RD(ea));
+    // 9459  EOR
+    start = cycles; cycles += 2; executed++; a ^= 0xB6; NZ(a);
+    // 945B  CPY
+    start = cycles; cycles += 4; executed++; CMP(y, RD(0xC339));
+    IO_EXIT(0x945E);
+    // 945E  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 1; EXIT(0x9463); }
+    EXIT(0x9460);
+}
+
+static int block_9460(espnes_context *ctx)
+{
+    BEGIN;
+    // 9460  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x021B); NZ(a);
+    EXIT(0x9463);
+}
+
+static int block_9463(espnes_context *ctx)
+{
+    BEGIN;
+    // 9463  NOP
+    start = cycles; cycles += 2; executed++; 
+    // 9464  CPY
+    start = cycles; cycles += 4; executed++; CMP(y, RD(0xFAB0));
+    IO_EXIT(0x9467);
+    // 9467  CPY
+    start = cycles; cycles += 2; executed++; CMP(y, 0x65);
+    // 9469  ASL
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x26 + x); t = RD(ea); ASL(t); WR(ea, t);
+    // 946B  LDX
+    start = cycles; cycles += 2; executed++; x = 0xBD; NZ(x);
+    // 946D  LDA
+    start = cycles; cycles += 2; executed++; a = 0xFF; NZ(a);
+    // 946F  STA
+    start = cycles; cycles += 3; executed++; WR(0x41, a);
+    // 9471  LDA
+    start = cycles; cycles += 2; executed++; a = 0x01; NZ(a);
+    // 9473  STA
+    start = cycles; cycles += 3; executed++; WR(0x42, a);
+    // 9475  AND
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x84 + x); a &= RD(ea); NZ(a);
+    IO_EXIT(0x9477);
+    // 9477  BVS
+    start = cycles; cycles += 2; executed++; if (p & F_V) { cycles += 1; EXIT(0x947C); }
+    EXIT(0x9479);
+}
+
+static int block_9479(espnes_context *ctx)
+{
+    BEGIN;
+    // 9479  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xDAA5); NZ(a);
+    IO_EXIT(0x947C);
+    EXIT(0x947C);
+}
+
+static int block_947C(espnes_context *ctx)
+{
+    BEGIN;
+    // 947C  ADC
+    start = cycles; cycles += 4; executed++; ADC(RD(0x0689));
+    // 947F  LDX
+    start = cycles; cycles += 2; executed++; x = 0x2F; NZ(x);
+    // 9481  LDA
+    start = cycles; cycles += 2; executed++; a = 0x35; NZ(a);
+    // 9483  STA
+    start = cycles; cycles += 3; executed++; WR(0x7D, a);
+    // 9485  LDA
+    start = cycles; cycles += 2; executed++; a = 0x06; NZ(a);
+    // 9487  STA
+    start = cycles; cycles += 3; executed++; WR(0x7E, a);
+    // 9489  EOR
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x4E + x); a ^= RD(ea); NZ(a);
+    IO_EXIT(0x948B);
+    // 948B  DEC
+    start = cycles; cycles += 5; executed++; t = RD(0x6B); t--; NZ(t); WR(0x6B, t);
+    // 948D  ADC
+    start = cycles; cycles += 3; executed++; ADC(RD(0xDD));
+    // 948F  LDX
+    start = cycles; cycles += 2; executed++; x = 0x23; NZ(x);
+    // 9491  LDA
+    start = cycles; cycles += 2; executed++; a = 0x6E; NZ(a);
+    // 9493  STA
+    start = cycles; cycles += 3; executed++; WR(0xF3, a);
+    // 9495  LDA
+    start = cycles; cycles += 2; executed++; a = 0xAE; NZ(a);
+    // 9497  STA
+    start = cycles; cycles += 3; executed++; WR(0xF4, a);
+    // 9499  CMP
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0xD0 + x); CMP(a, RD(ea));
+    IO_EXIT(0x949B);
+    // 949B  LDX
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x01A3 + y); cycles += PAGE_CROSSED(0x01A3, ea); x = RD(ea); NZ(x);
+    // 949E  LSR
+    start = cycles; cycles += 6; executed++; t = RD(0x0459); LSR(t); WR(0x0459, t);
+    // 94A1  LDX
+    start = cycles; cycles += 2; executed++; x = 0xAF; NZ(x);
+    // 94A3  LDA
+    start = cycles; cycles += 2; executed++; a = 0xCE; NZ(a);
+    // 94A5  STA
+    start = cycles; cycles += 3; executed++; WR(0x8D, a);
+    // 94A7  LDA
+    start = cycles; cycles += 2; executed++; a = 0x00; NZ(a);
+    // 94A9  STA
+    start = cycles; cycles += 3; executed++; WR(0x8E, a);
+    // 94AB  CMP
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0xDE + x); CMP(a, RD(ea));
+    IO_EXIT(0x94AD);
+    // 94AD  LDX
+    start = cycles; cycles += 2; executed++; x = 0x1F; NZ(x);
+    // 94AF  LDA
+    start = cycles; cycles += 2; executed++; a = 0x03; NZ(a);
+    // 94B1  STA
+    start = cycles; cycles += 3; executed++; WR(0x07, a);
+    // 94B3  LDA
+    start = cycles; cycles += 2; executed++; a = 0x9D; NZ(a);
+    // 94B5  STA
+    start = cycles; cycles += 3; executed++; WR(0x08, a);
+    // 94B7  ADC
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0xE8 + x); ADC(RD(ea));
+    IO_EXIT(0x94B9);
+    // 94B9  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 1; EXIT(0x94BE); }
+    EXIT(0x94BB);
+}
+
+static int block_94BB(espnes_context *ctx)
+{
+    BEGIN;
+    // 94BB  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xE8ED); NZ(a);
+    IO_EXIT(0x94BE);
+    EXIT(0x94BE);
+}
+
+static int block_94BE(espnes_context *ctx)
+{
+    BEGIN;
+    // 94BE  STY
+    start = cycles; cycles += 3; executed++; WR(0x08, y);
+    // 94C0  LSR
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x06BF + x); t = RD(ea); LSR(t); WR(ea, t);
+    // 94C3  TSX
+    start = cycles; cycles += 2; executed++; x = sp; NZ(x);
+    // 94C4  CLV
+    start = cycles; cycles += 2; executed++; SETF(F_V, 0);
+    // 94C5  SBC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x01FB + y); cycles += PAGE_CROSSED(0x01FB, ea); SBC(RD(ea));
+    // 94C8  TAX
+    start = cycles; cycles += 2; executed++; x = a; NZ(x);
+    // 94C9  DEC
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0xB8 + x); t = RD(ea); t--; NZ(t); WR(ea, t);
+    // 94CB  ROR
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0xBC + x); t = RD(ea); ROR(t); WR(ea, t);
+    // 94CD  BVC
+    start = cycles; cycles += 2; executed++; if (!(p & F_V)) { cycles += 1; EXIT(0x94D2); }
+    EXIT(0x94CF);
+}
+
+static int block_94CF(espnes_context *ctx)
+{
+    BEGIN;
+    // 94CF  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xD83D); NZ(a);
+    IO_EXIT(0x94D2);
+    EXIT(0x94D2);
+}
+
+static int block_94D2(espnes_context *ctx)
+{
+    BEGIN;
+    // 94D2  PHA
+    start = cycles; cycles += 3; executed++; PUSH(a);
+    // 94D3  BEQ
+    start = cycles; cycles += 2; executed++; if (p & F_Z) { cycles += 1; EXIT(0x94D8); }
+    EXIT(0x94D5);
+}
+
+static int block_94D5(espnes_context *ctx)
+{
+    BEGIN;
+    // 94D5  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xB819); NZ(a);
+    IO_EXIT(0x94D8);
+    EXIT(0x94D8);
+}
+
+static int block_94D8(espnes_context *ctx)
+{
+    BEGIN;
+    // 94D8  LSR
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x3E + x); t = RD(ea); LSR(t); WR(ea, t);
+    // 94DA  LDX
+    start = cycles; cycles += 4; executed++; x = RD(0xE9F0); NZ(x);
+    IO_EXIT(0x94DD);
+    // 94DD  BEQ
+    start = cycles; cycles += 2; executed++; if (p & F_Z) { cycles += 1; EXIT(0x94E2); }
+    EXIT(0x94DF);
+}
+
+static int block_94DF(espnes_context *ctx)
+{
+    BEGIN;
+    // 94DF  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xB557); NZ(a);
+    IO_EXIT(0x94E2);
+    EXIT(0x94E2);
+}
+
+static int block_94E2(espnes_context *ctx)
+{
+    BEGIN;
+    // 94E2  CPY
+    start = cycles; cycles += 4; executed++; CMP(y, RD(0xDC87));
+    IO_EXIT(0x94E5);
+    // 94E5  CPX
+    start = cycles; cycles += 3; executed++; CMP(x, RD(0x46));
+    // 94E7  LSR
+    start = cycles; cycles += 5; executed++; t = RD(0x62); LSR(t); WR(0x62, t);
+    // 94E9  STX
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x15 + y); WR(ea, x);
+    // 94EB  AND
+    start = cycles; cycles += 3; executed++; a &= RD(0x55); NZ(a);
+    // 94ED  LDX
+    start = cycles; cycles += 2; executed++; x = 0xBE; NZ(x);
+    // 94EF  INC
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x0D + x); t = RD(ea); t++; NZ(t); WR(ea, t);
+    // 94F1  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 1; EXIT(0x94F6); }
+    EXIT(0x94F3);
+}
+
+static int block_94F3(espnes_context *ctx)
+{
+    BEGIN;
+    // 94F3  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xB9A0); NZ(a);
+    IO_EXIT(0x94F6);
+    EXIT(0x94F6);
+}
+
+static int block_94F6(espnes_context *ctx)
+{
+    BEGIN;
+    // 94F6  STA
+    start = cycles; cycles += 5; executed++; ea = (uint16_t)(0x0067 + x); WR(ea, a);
+    // 94F9  LDA
+    start = cycles; cycles += 2; executed++; a = 0x64; NZ(a);
+    // 94FB  STA
+    start = cycles; cycles += 3; executed++; WR(0x31, a);
+    // 94FD  LDA
+    start = cycles; cycles += 2; executed++; a = 0x01; NZ(a);
+    // 94FF  STA
+    start = cycles; cycles += 3; executed++; WR(0x32, a);
+    // 9501  CMP
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x31); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); CMP(a, RD(ea));
+    IO_EXIT(0x9503);
+    // 9503  STX
+    start = cycles; cycles += 4; executed++; WR(0x02F3, x);
+    // 9506  SED
+    start = cycles; cycles += 2; executed++; SETF(F_D, 1);
+    // 9507  LDX
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0455 + y); cycles += PAGE_CROSSED(0x0455, ea); x = RD(ea); NZ(x);
+    // 950A  LDX
+    start = cycles; cycles += 2; executed++; x = 0x17; NZ(x);
+    // 950C  LDA
+    start = cycles; cycles += 2; executed++; a = 0x10; NZ(a);
+    // 950E  STA
+    start = cycles; cycles += 3; executed++; WR(0x28, a);
+    // 9510  LDA
+    start = cycles; cycles += 2; executed++; a = 0xA8; NZ(a);
+    // 9512  STA
+    start = cycles; cycles += 3; executed++; WR(0x29, a);
+    // 9514  ORA
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x11 + x); a |= RD(ea); NZ(a);
+    IO_EXIT(0x9516);
+    // 9516  LDA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0525 + x); cycles += PAGE_CROSSED(0x0525, ea); a = RD(ea); NZ(a);
+    // 9519  ROL
+    start = cycles; cycles += 6; executed++; t = RD(0x0178); ROL(t); WR(0x0178, t);
+    // 951C  BCS
+    start = cycles; cycles += 2; executed++; if (p & F_C) { cycles += 1; EXIT(0x9521); }
+    EXIT(0x951E);
+}
+
+static int block_951E(espnes_context *ctx)
+{
+    BEGIN;
+    // 951E  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xBC3A); NZ(a);
+    IO_EXIT(0x9521);
+    EXIT(0x9521);
+}
+
+static int block_9521(espnes_context *ctx)
+{
+    BEGIN;
+    // 9521  NOP
+    start = cycles; cycles += 2; executed++; 
+    // 9522  LSR
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x0446 + x); t = RD(ea); LSR(t); WR(ea, t);
+    // 9525  LSR
+    start = cycles; cycles += 6; executed++; t = RD(0x0479); LSR(t); WR(0x0479, t);
+    // 9528  LDX
+    start = cycles; cycles += 2; executed++; x = 0xC3; NZ(x);
+    // 952A  LDA
+    start = cycles; cycles += 2; executed++; a = 0x11; NZ(a);
+    // 952C  STA
+    start = cycles; cycles += 3; executed++; WR(0x12, a);
+    // 952E  LDA
+    start = cycles; cycles += 2; executed++; a = 0x03; NZ(a);
+    // 9530  STA
+    start = cycles; cycles += 3; executed++; WR(0x13, a);
+    // 9532  SBC
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x4F + x); SBC(RD(ea));
+    IO_EXIT(0x9534);
+    // 9534  LDY
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xFAE7 + x); cycles += PAGE_CROSSED(0xFAE7, ea); y = RD(ea); NZ(y);
+    IO_EXIT(0x9537);
+    // 9537  LSR
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x046B + x); t = RD(ea); LSR(t); WR(ea, t);
+    // 953A  CMP
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xEC + x); CMP(a, RD(ea));
+    // 953C  LSR
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x04D2 + x); t = RD(ea); LSR(t); WR(ea, t);
+    // 953F  CMP
+    start = cycles; cycles += 2; executed++; CMP(a, 0x3F);
+    // 9541  LDA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xDD42 + x); cycles += PAGE_CROSSED(0xDD42, ea); a = RD(ea); NZ(a);
+    IO_EXIT(0x9544);
+    // 9544  LDX
+    start = cycles; cycles += 2; executed++; x = 0x97; NZ(x);
+    // 9546  LDA
+    start = cycles; cycles += 2; executed++; a = 0x03; NZ(a);
+    // 9548  STA
+    start = cycles; cycles += 3; executed++; WR(0x9E, a);
+    // 954A  LDA
+    start = cycles; cycles += 2; executed++; a = 0x05; NZ(a);
+    // 954C  STA
+    start = cycles; cycles += 3; executed++; WR(0x9F, a);
+    // 954E  CMP
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x07 + x); CMP(a, RD(ea));
+    IO_EXIT(0x9550);
+    // 9550  LDX
+    start = cycles; cycles += 2; executed++; x = 0xCD; NZ(x);
+    // 9552  LDA
+    start = cycles; cycles += 2; executed++; a = 0xA2; NZ(a);
+    // 9554  STA
+    start = cycles; cycles += 3; executed++; WR(0xBF, a);
+    // 9556  LDA
+    start = cycles; cycles += 2; executed++; a = 0x06; NZ(a);
+    // 9558  STA
+    start = cycles; cycles += 3; executed++; WR(0xC0, a);
+    // 955A  ORA
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0xF2 + x); a |= RD(ea); NZ(a);
+    IO_EXIT(0x955C);
+    // 955C  BVC
+    start = cycles; cycles += 2; executed++; if (!(p & F_V)) { cycles += 1; EXIT(0x9561); }
+    EXIT(0x955E);
+}
+
+static int block_955E(espnes_context *ctx)
+{
+    BEGIN;
+    // 955E  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x045B); NZ(a);
+    EXIT(0x9561);
+}
+
+static int block_9561(espnes_context *ctx)
+{
+    BEGIN;
+    // 9561  CMP
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0694 + x); cycles += PAGE_CROSSED(0x0694, ea); CMP(a, RD(ea));
+    // 9564  BMI
+    start = cycles; cycles += 2; executed++; if (p & F_N) { cycles += 1; EXIT(0x9569); }
+    EXIT(0x9566);
+}
+
+static int block_9566(espnes_context *ctx)
+{
+    BEGIN;
+    // 9566  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xC9CD); NZ(a);
+    IO_EXIT(0x9569);
+    EXIT(0x9569);
+}
+
+static int block_9569(espnes_context *ctx)
+{
+    BEGIN;
+    // 9569  STX
+    start = cycles; cycles += 4; executed++; WR(0x0131, x);
+    // 956C  LDA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0294 + x); cycles += PAGE_CROSSED(0x0294, ea); a = RD(ea); NZ(a);
+    // 956F  BPL
+    start = cycles; cycles += 2; executed++; if (!(p & F_N)) { cycles += 1; EXIT(0x9574); }
+    EXIT(0x9571);
+}
+
+static int block_9571(espnes_context *ctx)
+{
+    BEGIN;
+    // 9571  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x060D); NZ(a);
+    EXIT(0x9574);
+}
+
+static int block_9574(espnes_context *ctx)
+{
+    BEGIN;
+    // 9574  CMP
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x0A + x); CMP(a, RD(ea));
+    // 9576  SBC
+    start = cycles; cycles += 4; executed++; SBC(RD(0xB75C));
+    IO_EXIT(0x9579);
+    // 9579  ROL
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x0623 + x); t = RD(ea); ROL(t); WR(ea, t);
+    // 957C  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xFD78 + x); cycles += PAGE_CROSSED(0xFD78, ea); a ^= RD(ea); NZ(a);
+    IO_EXIT(0x957F);
+    // 957F  INX
+    start = cycles; cycles += 2; executed++; x++; NZ(x);
+    // 9580  ORA
+    start = cycles; cycles += 2; executed++; a |= 0x96; NZ(a);
+    // 9582  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x012D + x); cycles += PAGE_CROSSED(0x012D, ea); a ^= RD(ea); NZ(a);
+    // 9585  LDA
+    start = cycles; cycles += 2; executed++; a = 0x15; NZ(a);
+    // 9587  STA
+    start = cycles; cycles += 3; executed++; WR(0x01, a);
+    // 9589  LDA
+    start = cycles; cycles += 2; executed++; a = 0x01; NZ(a);
+    // 958B  STA
+    start = cycles; cycles += 3; executed++; WR(0x02, a);
+    // 958D  CMP
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x01); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); CMP(a, RD(ea));
+    IO_EXIT(0x958F);
+    // 958F  SEI
+    start = cycles; cycles += 2; executed++; SETF(F_I, 1);
+    // 9590  STY
+    start = cycles; cycles += 3; executed++; WR(0x0D, y);
+    // 9592  BPL
+    start = cycles; cycles += 2; executed++; if (!(p & F_N)) { cycles += 1; EXIT(0x9597); }
+    EXIT(0x9594);
+}
+
+static int block_9594(espnes_context *ctx)
+{
+    BEGIN;
+    // 9594  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xE125); NZ(a);
+    IO_EXIT(0x9597);
+    EXIT(0x9597);
+}
+
+static int block_9597(espnes_context *ctx)
+{
+    BEGIN;
+    // 9597  STA
+    start = cycles; cycles += 5; executed++; ea = (uint16_t)(0x0216 + x); WR(ea, a);
+    // 959A  LDA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xC607 + y); cycles += PAGE_CROSSED(0xC607, ea); a = RD(ea); NZ(a);
+    IO_EXIT(0x959D);
+    // 959D  AND
+    start = cycles; cycles += 3; executed++; a &= RD(0xCF); NZ(a);
+    // 959F  ROL
+    start = cycles; cycles += 2; executed++; ROL(a);
+    // 95A0  LDY
+    start = cycles; cycles += 2; executed++; y = 0x2B; NZ(y);
+    // 95A2  BCS
+    start = cycles; cycles += 2; executed++; if (p & F_C) { cycles += 1; EXIT(0x95A7); }
+    EXIT(0x95A4);
+}
+
+static int block_95A4(espnes_context *ctx)
+{
+    BEGIN;
+    // 95A4  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0337); NZ(a);
+    EXIT(0x95A7);
+}
+
+static int block_95A7(espnes_context *ctx)
+{
+    BEGIN;
+    // 95A7  CMP
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0080 + x); cycles += PAGE_CROSSED(0x0080, ea); CMP(a, RD(ea));
+    // 95AA  ORA
+    start = cycles; cycles += 3; executed++; a |= RD(0x49); NZ(a);
+    // 95AC  SBC
+    start = cycles; cycles += 4; executed++; SBC(RD(0xABEA));
+    IO_EXIT(0x95AF);
+    // 95AF  LDY
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x876F + x); cycles += PAGE_CROSSED(0x876F, ea); y = RD(ea); NZ(y);
+    IO_EXIT(0x95B2);
+    // 95B2  LDX
+    start = cycles; cycles += 2; executed++; x = 0x6D; NZ(x);
+    // 95B4  LDA
+    start = cycles; cycles += 2; executed++; a = 0x4A; NZ(a);
+    // 95B6  STA
+    start = cycles; cycles += 3; executed++; WR(0x45, a);
+    // 95B8  LDA
+    start = cycles; cycles += 2; executed++; a = 0xE2; NZ(a);
+    // 95BA  STA
+    start = cycles; cycles += 3; executed++; WR(0x46, a);
+    // 95BC  SBC
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0xD8 + x); SBC(RD(ea));
+    IO_EXIT(0x95BE);
+    // 95BE  LDA
+    start = cycles; cycles += 2; executed++; a = 0x42; NZ(a);
+    // 95C0  STA
+    start = cycles; cycles += 3; executed++; WR(0x53, a);
+    // 95C2  LDA
+    start = cycles; cycles += 2; executed++; a = 0xBE; NZ(a);
+    // 95C4  STA
+    start = cycles; cycles += 3; executed++; WR(0x54, a);
+    // 95C6  SBC
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x53); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); SBC(RD(ea));
+    IO_EXIT(0x95C8);
+    // 95C8  CPY
+    start = cycles; cycles += 2; executed++; CMP(y, 0x58);
+    // 95CA  BCC
+    start = cycles; cycles += 2; executed++; if (!(p & F_C)) { cycles += 1; EXIT(0x95CF); }
+    EXIT(0x95CC);
+}
+
+static int block_95CC(espnes_context *ctx)
+{
+    BEGIN;
+    // 95CC  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x01E6); NZ(a);
+    EXIT(0x95CF);
+}
+
+static int block_95CF(espnes_context *ctx)
+{
+    BEGIN;
+    // 95CF  DEC
+    start = cycles; cycles += 5; executed++; t = RD(0xFB); t--; NZ(t); WR(0xFB, t);
+    // 95D1  AND
+    start = cycles; cycles += 4; executed++; a &= RD(0xC7C1); NZ(a);
+    IO_EXIT(0x95D4);
+    // 95D4  CLD
+    start = cycles; cycles += 2; executed++; SETF(F_D, 0);
+    // 95D5  ASL
+    start = cycles; cycles += 6; executed++; t = RD(0x05B5); ASL(t); WR(0x05B5, t);
+    // 95D8  BVC
+    start = cycles; cycles += 2; executed++; if (!(p & F_V)) { cycles += 1; EXIT(0x95DD); }
+    EXIT(0x95DA);
+}
+
+static int block_95DA(espnes_context *ctx)
+{
+    BEGIN;
+    // 95DA  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xD59C); NZ(a);
+    IO_EXIT(0x95DD);
+    EXIT(0x95DD);
+}
+
+static int block_95DD(espnes_context *ctx)
+{
+    BEGIN;
+    // 95DD  CLV
+    start = cycles; cycles += 2; executed++; SETF(F_V, 0);
+    // 95DE  TAX
+    start = cycles; cycles += 2; executed++; x = a; NZ(x);
+    // 95DF  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 1; EXIT(0x95E4); }
+    EXIT(0x95E1);
+}
+
+static int block_95E1(espnes_context *ctx)
+{
+    BEGIN;
+    // 95E1  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xC8C5); NZ(a);
+    IO_EXIT(0x95E4);
+    EXIT(0x95E4);
+}
+
+static int block_95E4(espnes_context *ctx)
+{
+    BEGIN;
+    // 95E4  DEY
+    start = cycles; cycles += 2; executed++; y--; NZ(y);
+    // 95E5  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xFB63); NZ(a);
+    IO_EXIT(0x95E8);
+    // 95E8  LDA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x835F + x); cycles += PAGE_CROSSED(0x835F, ea); a = RD(ea); NZ(a);
+    IO_EXIT(0x95EB);
+    // 95EB  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xA6F1 + y); cycles += PAGE_CROSSED(0xA6F1, ea); ADC(RD(ea));
+    IO_EXIT(0x95EE);
+    // 95EE  LDY
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xE558 + x); cycles += PAGE_CROSSED(0xE558, ea); y = RD(ea); NZ(y);
+    IO_EXIT(0x95F1);
+    // 95F1  DEC
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0xC1 + x); t = RD(ea); t--; NZ(t); WR(ea, t);
+    // 95F3  SEC
+    start = cycles; cycles += 2; executed++; SETF(F_C, 1);
+    // 95F4  PLA
+    start = cycles; cycles += 4; executed++; a = PULL(); NZ(a);
+    // 95F5  SBC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xCE14 + y); cycles += PAGE_CROSSED(0xCE14, ea); SBC(RD(ea));
+    IO_EXIT(0x95F8);
+    // 95F8  CMP
+    start = cycles; cycles += 3; executed++; CMP(a, RD(0xE3));
+    // 95FA  STX
+    start = cycles; cycles += 4; executed++; WR(0x068D, x);
+    // 95FD  AND
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0474 + y); cycles += PAGE_CROSSED(0x0474, ea); a &= RD(ea); NZ(a);
+    // 9600  BEQ
+    start = cycles; cycles += 2; executed++; if (p & F_Z) { cycles += 1; EXIT(0x9605); }
+    EXIT(0x9602);
+}
+
+static int block_9602(espnes_context *ctx)
+{
+    BEGIN;
+    // 9602  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xE286); NZ(a);
+    IO_EXIT(0x9605);
+    EXIT(0x9605);
+}
+
+static int block_9605(espnes_context *ctx)
+{
+    BEGIN;
+    // 9605  DEC
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x0D + x); t = RD(ea); t--; NZ(t); WR(ea, t);
+    // 9607  SED
+    start = cycles; cycles += 2; executed++; SETF(F_D, 1);
+    // 9608  DEC
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x0502 + x); t = RD(ea); t--; NZ(t); WR(ea, t);
+    // 960B  ADC
+    start = cycles; cycles += 3; executed++; ADC(RD(0xFA));
+    // 960D  ROR
+    start = cycles; cycles += 5; executed++; t = RD(0x91); ROR(t); WR(0x91, t);
+    // 960F  TXS
+    start = cycles; cycles += 2; executed++; sp = x;
+    // 9610  LDY
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xFD9F + x); cycles += PAGE_CROSSED(0xFD9F, ea); y = RD(ea); NZ(y);
+    IO_EXIT(0x9613);
+    // 9613  CPY
+    start = cycles; cycles += 3; executed++; CMP(y, RD(0x17));
+    // 9615  BCS
+    start = cycles; cycles += 2; executed++; if (p & F_C) { cycles += 1; EXIT(0x961A); }
+    EXIT(0x9617);
+}
+
+static int block_9617(espnes_context *ctx)
+{
+    BEGIN;
+    // 9617  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x01D9); NZ(a);
+    EXIT(0x961A);
+}
+
+static int block_961A(espnes_context *ctx)
+{
+    BEGIN;
+    // 961A  AND
+    start = cycles; cycles += 4; executed++; a &= RD(0x806C); NZ(a);
+    IO_EXIT(0x961D);
+    // 961D  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xE9B7 + x); cycles += PAGE_CROSSED(0xE9B7, ea); ADC(RD(ea));
+    IO_EXIT(0x9620);
+    // 9620  ADC
+    start = cycles; cycles += 4; executed++; ADC(RD(0x028B));
+    // 9623  SED
+    start = cycles; cycles += 2; executed++; SETF(F_D, 1);
+    // 9624  STY
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x7B + x); WR(ea, y);
+    // 9626  AND
+    start = cycles; cycles += 3; executed++; a &= RD(0x81); NZ(a);
+    // 9628  BEQ
+    start = cycles; cycles += 2; executed++; if (p & F_Z) { cycles += 1; EXIT(0x962D); }
+    EXIT(0x962A);
+}
+
+static int block_962A(espnes_context *ctx)
+{
+    BEGIN;
+    // 962A  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0661); NZ(a);
+    EXIT(0x962D);
+}
+
+static int block_962D(espnes_context *ctx)
+{
+    BEGIN;
+    // 962D  TXA
+    start = cycles; cycles += 2; executed++; a = x; NZ(a);
+    // 962E  LDA
+    start = cycles; cycles += 2; executed++; a = 0x54; NZ(a);
+    // 9630  STA
+    start = cycles; cycles += 3; executed++; WR(0x4E, a);
+    // 9632  LDA
+    start = cycles; cycles += 2; executed++; a = 0xC1; NZ(a);
+    // 9634  STA
+    start = cycles; cycles += 3; executed++; WR(0x4F, a);
+    // 9636  LDA
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x4E); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a = RD(ea); NZ(a);
+    IO_EXIT(0x9638);
+    // 9638  CLC
+    start = cycles; cycles += 2; executed++; SETF(F_C, 0);
+    // 9639  PHP
+    start = cycles; cycles += 3; executed++; PUSH(p | F_B | F_U);
+    // 963A  BNE
+    start = cycles; cycles += 2; executed++; if (!(p & F_Z)) { cycles += 1; EXIT(0x963F); }
+    EXIT(0x963C);
+}
+
+static int block_963C(espnes_context *ctx)
+{
+    BEGIN;
+    // 963C  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0232); NZ(a);
+    EXIT(0x963F);
+}
+
+static int block_963F(espnes_context *ctx)
+{
+    BEGIN;
+    // 963F  ADC
+    start = cycles; cycles += 2; executed++; ADC(0x6F);
+    // 9641  DEC
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x67 + x); t = RD(ea); t--; NZ(t); WR(ea, t);
+    // 9643  LDA
+    start = cycles; cycles += 2; executed++; a = 0xDF; NZ(a);
+    // 9645  STA
+    start = cycles; cycles += 3; executed++; WR(0x01, a);
+    // 9647  LDA
+    start = cycles; cycles += 2; executed++; a = 0x05; NZ(a);
+    // 9649  STA
+    start = cycles; cycles += 3; executed++; WR(0x02, a);
+    // 964B  SBC
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x01); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); SBC(RD(ea));
+    IO_EXIT(0x964D);
+    // 964D  ORA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xA381 + x); cycles += PAGE_CROSSED(0xA381, ea); a |= RD(ea); NZ(a);
+    IO_EXIT(0x9650);
+    // 9650  LDY
+    start = cycles; cycles += 2; executed++; y = 0xF9; NZ(y);
+    // 9652  AND
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xB884 + x); cycles += PAGE_CROSSED(0xB884, ea); a &= RD(ea); NZ(a);
+    IO_EXIT(0x9655);
+    // 9655  AND
+    start = cycles; cycles += 3; executed++; a &= RD(0xA4); NZ(a);
+    // 9657  ASL
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x53 + x); t = RD(ea); ASL(t); WR(ea, t);
+    // 9659  ROL
+    start = cycles; cycles += 5; executed++; t = RD(0x88); ROL(t); WR(0x88, t);
+    // 965B  STY
+    start = cycles; cycles += 3; executed++; WR(0x5A, y);
+    // 965D  STA
+    start = cycles; cycles += 5; executed++; ea = (uint16_t)(0x0325 + y); WR(ea, a);
+    // 9660  BCS
+    start = cycles; cycles += 2; executed++; if (p & F_C) { cycles += 1; EXIT(0x9665); }
+    EXIT(0x9662);
+}
+
+static int block_9662(espnes_context *ctx)
+{
+    BEGIN;
+    // 9662  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xEEC6); NZ(a);
+    IO_EXIT(0x9665);
+    EXIT(0x9665);
+}
+
+static int block_9665(espnes_context *ctx)
+{
+    BEGIN;
+    // 9665  SBC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0248 + y); cycles += PAGE_CROSSED(0x0248, ea); SBC(RD(ea));
+    // 9668  CPX
+    start = cycles; cycles += 4; executed++; CMP(x, RD(0x03D1));
+    // 966B  ASL
+    start = cycles; cycles += 2; executed++; ASL(a);
+    // 966C  STA
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xA5 + x); WR(ea, a);
+    // 966E  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x00E0 + y); cycles += PAGE_CROSSED(0x00E0, ea); a ^= RD(ea); NZ(a);
+    // 9671  LDA
+    start = cycles; cycles += 2; executed++; a = 0x86; NZ(a);
+    // 9673  STA
+    start = cycles; cycles += 3; executed++; WR(0x25, a);
+    // 9675  LDA
+    start = cycles; cycles += 2; executed++; a = 0x00; NZ(a);
+    // 9677  STA
+    start = cycles; cycles += 3; executed++; WR(0x26, a);
+    // 9679  CMP
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x25); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); CMP(a, RD(ea));
+    IO_EXIT(0x967B);
+    // 967B  LDA
+    start = cycles; cycles += 3; executed++; a = RD(0x27); NZ(a);
+    // 967D  SBC
+    start = cycles; cycles += 4; executed++; SBC(RD(0x03C3));
+    // 9680  LSR
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0xC3 + x); t = RD(ea); LSR(t); WR(ea, t);
+    // 9682  EOR
+    start = cycles; cycles += 3; executed++; a ^= RD(0xA6); NZ(a);
+    // 9684  BPL
+    start = cycles; cycles += 2; executed++; if (!(p & F_N)) { cycles += 1; EXIT(0x9689); }
+    EXIT(0x9686);
+}
+
+static int block_9686(espnes_context *ctx)
+{
+    BEGIN;
+    // 9686  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x8D20); NZ(a);
+    IO_EXIT(0x9689);
+    EXIT(0x9689);
+}
+
+static int block_9689(espnes_context *ctx)
+{
+    BEGIN;
+    // 9689  LDA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x040F + x); cycles += PAGE_CROSSED(0x040F, ea); a = RD(ea); NZ(a);
+    // 968C  ROR
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0xD7 + x); t = RD(ea); ROR(t); WR(ea, t);
+    // 968E  LDX
+    start = cycles; cycles += 4; executed++; x = RD(0xCC75); NZ(x);
+    IO_EXIT(0x9691);
+    // 9691  LDX
+    start = cycles; cycles += 2; executed++; x = 0x82; NZ(x);
+    // 9693  LDA
+    start = cycles; cycles += 2; executed++; a = 0xF8; NZ(a);
+    // 9695  STA
+    start = cycles; cycles += 3; executed++; WR(0xEB, a);
+    // 9697  LDA
+    start = cycles; cycles += 2; executed++; a = 0xC0; NZ(a);
+    // 9699  STA
+    start = cycles; cycles += 3; executed++; WR(0xEC, a);
+    // 969B  ADC
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x69 + x); ADC(RD(ea));
+    IO_EXIT(0x969D);
+    // 969D  ADC
+    start = cycles; cycles += 3; executed++; ADC(RD(0x41));
+    // 969F  INC
+    start = cycles; cycles += 6; executed++; t = RD(0x0684); t++; NZ(t); WR(0x0684, t);
+    // 96A2  BMI
+    start = cycles; cycles += 2; executed++; if (p & F_N) { cycles += 1; EXIT(0x96A7); }
+    EXIT(0x96A4);
+}
+
+static int block_96A4(espnes_context *ctx)
+{
+    BEGIN;
+    // 96A4  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0283); NZ(a);
+    EXIT(0x96A7);
+}
+
+static int block_96A7(espnes_context *ctx)
+{
+    BEGIN;
+    // 96A7  SED
+    start = cycles; cycles += 2; executed++; SETF(F_D, 1);
+    // 96A8  INX
+    start = cycles; cycles += 2; executed++; x++; NZ(x);
+    // 96A9  TXS
+    start = cycles; cycles += 2; executed++; sp = x;
+    // 96AA  CPY
+    start = cycles; cycles += 4; executed++; CMP(y, RD(0x00D6));
+    // 96AD  CMP
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x02E6 + y); cycles += PAGE_CROSSED(0x02E6, ea); CMP(a, RD(ea));
+    // 96B0  CMP
+    start = cycles; cycles += 4; executed++; CMP(a, RD(0xA4BA));
+    IO_EXIT(0x96B3);
+    // 96B3  TYA
+    start = cycles; cycles += 2; executed++; a = y; NZ(a);
+    // 96B4  INC
+    start = cycles; cycles += 5; executed++; t = RD(0x0E); t++; NZ(t); WR(0x0E, t);
+    // 96B6  PHP
+    start = cycles; cycles += 3; executed++; PUSH(p | F_B | F_U);
+    // 96B7  LDA
+    start = cycles; cycles += 2; executed++; a = 0x4D; NZ(a);
+    // 96B9  STA
+    start = cycles; cycles += 3; executed++; WR(0x47, a);
+    // 96BB  LDA
+    start = cycles; cycles += 2; executed++; a = 0x06; NZ(a);
+    // 96BD  STA
+    start = cycles; cycles += 3; executed++; WR(0x48, a);
+    // 96BF  AND
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x47); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a &= RD(ea); NZ(a);
+    IO_EXIT(0x96C1);
+    // 96C1  BVS
+    start = cycles; cycles += 2; executed++; if (p & F_V) { cycles += 1; EXIT(0x96C6); }
+    EXIT(0x96C3);
+}
+
+static int block_96C3(espnes_context *ctx)
+{
+    BEGIN;
+    // 96C3  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x01FA); NZ(a);
+    EXIT(0x96C6);
+}
+
+static int block_96C6(espnes_context *ctx)
+{
+    BEGIN;
+    // 96C6  BIT
+    start = cycles; cycles += 3; executed++; BIT(RD(0x3E));
+    // 96C8  DEC
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x00A0 + x); t = RD(ea); t--; NZ(t); WR(ea, t);
+    // 96CB  STA
+    start = cycles; cycles += 4; executed++; WR(0x0118, a);
+    // 96CE  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x83 + x); ADC(RD(ea));
+    // 96D0  CMP
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xB740 + x); cycles += PAGE_CROSSED(0xB740, ea); CMP(a, RD(ea));
+    IO_EXIT(0x96D3);
+    // 96D3  LDX
+    start = cycles; cycles += 2; executed++; x = 0x80; NZ(x);
+    // 96D5  LDA
+    start = cycles; cycles += 2; executed++; a = 0x18; NZ(a);
+    // 96D7  STA
+    start = cycles; cycles += 3; executed++; WR(0xD6, a);
+    // 96D9  LDA
+    start = cycles; cycles += 2; executed++; a = 0x01; NZ(a);
+    // 96DB  STA
+    start = cycles; cycles += 3; executed++; WR(0xD7, a);
+    // 96DD  CMP
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x56 + x); CMP(a, RD(ea));
+    IO_EXIT(0x96DF);
+    // 96DF  CPY
+    start = cycles; cycles += 2; executed++; CMP(y, 0x2E);
+    // 96E1  ROR
+    start = cycles; cycles += 6; executed++; t = RD(0x0634); ROR(t); WR(0x0634, t);
+    // 96E4  LDA
+    start = cycles; cycles += 2; executed++; a = 0xE3; NZ(a);
+    // 96E6  STA
+    start = cycles; cycles += 3; executed++; WR(0x07, a);
+    // 96E8  LDA
+    start = cycles; cycles += 2; executed++; a = 0xFD; NZ(a);
+    // 96EA  STA
+    start = cycles; cycles += 3; executed++; WR(0x08, a);
+    // 96EC  EOR
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x07); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a ^= RD(ea); NZ(a);
+    IO_EXIT(0x96EE);
+    // 96EE  BVS
+    start = cycles; cycles += 2; executed++; if (p & F_V) { cycles += 1; EXIT(0x96F3); }
+    EXIT(0x96F0);
+}
+
+static int block_96F0(espnes_context *ctx)
+{
+    BEGIN;
+    // 96F0  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xC0A3); NZ(a);
+    IO_EXIT(0x96F3);
+    EXIT(0x96F3);
+}
+
+static int block_96F3(espnes_context *ctx)
+{
+    BEGIN;
+    // 96F3  CPX
+    start = cycles; cycles += 3; executed++; CMP(x, RD(0xFF));
+    // 96F5  INY
+    start = cycles; cycles += 2; executed++; y++; NZ(y);
+    // 96F6  ROL
+    start = cycles; cycles += 6; executed++; t = RD(0x036B); ROL(t); WR(0x036B, t);
+    // 96F9  LDX
+    start = cycles; cycles += 3; executed++; x = RD(0x6D); NZ(x);
+    // 96FB  ROL
+    start = cycles; cycles += 6; executed++; t = RD(0x0242); ROL(t); WR(0x0242, t);
+    // 96FE  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xF861 + x); cycles += PAGE_CROSSED(0xF861, ea); ADC(RD(ea));
+    IO_EXIT(0x9701);
+    // 9701  DEX
+    start = cycles; cycles += 2; executed++; x--; NZ(x);
+    // 9702  LDA
+    start = cycles; cycles += 2; executed++; a = 0xF1; NZ(a);
+    // 9704  CPY
+    start = cycles; cycles += 2; executed++; CMP(y, 0xC4);
+    // 9706  INC
+    start = cycles; cycles += 5; executed++; t = RD(0x84); t++; NZ(t); WR(0x84, t);
+    // 9708  LSR
+    start = cycles; cycles += 6; executed++; ea = (uint8_t)(0x6B + x); t = RD(ea); LSR(t); WR(ea, t);
+    // 970A  BVS
+    start = cycles; cycles += 2; executed++; if (p & F_V) { cycles += 1; EXIT(0x970F); }
+    EXIT(0x970C);
+}
+
+static int block_970C(espnes_context *ctx)
+{
+    BEGIN;
+    // 970C  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x04E1); NZ(a);
+    EXIT(0x970F);
+}
+
+static int block_970F(espnes_context *ctx)
+{
+    BEGIN;
+    // 970F  CPX
+    start = cycles; cycles += 2; executed++; CMP(x, 0x1F);
+    // 9711  CPY
+    start = cycles; cycles += 2; executed++; CMP(y, 0xB7);
+    // 9713  LDA
+    start = cycles; cycles += 2; executed++; a = 0xD7; NZ(a);
+    // 9715  STA
+    start = cycles; cycles += 3; executed++; WR(0x96, a);
+    // 9717  LDA
+    start = cycles; cycles += 2; executed++; a = 0xD9; NZ(a);
+    // 9719  STA
+    start = cycles; cycles += 3; executed++; WR(0x97, a);
+    // 971B  ORA
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x96); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a |= RD(ea); NZ(a);
+    IO_EXIT(0x971D);
+    // 971D  BEQ
+    start = cycles; cycles += 2; executed++; if (p & F_Z) { cycles += 1; EXIT(0x9722); }
+    EXIT(0x971F);
+}
+
+static int block_971F(espnes_context *ctx)
+{
+    BEGIN;
+    // 971F  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x04F3); NZ(a);
+    EXIT(0x9722);
+}
+
+static int block_9722(espnes_context *ctx)
+{
+    BEGIN;
+    // 9722  SBC
+    start = cycles; cycles += 3; executed++; SBC(RD(0xB9));
+    // 9724  SBC
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xAF + x); SBC(RD(ea));
+    // 9726  STA
+    start = cycles; cycles += 5; executed++; ea = (uint16_t)(0x067B + y); WR(ea, a);
+    // 9729  STX
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xCC + y); WR(ea, x);
+    // 972B  ORA
+    start = cycles; cycles += 4; executed++; a |= RD(0xF0E9); NZ(a);
+    IO_EXIT(0x972E);
+    // 972E  LDA
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0056 + x); cycles += PAGE_CROSSED(0x0056, ea); a = RD(ea); NZ(a);
+    // 9731  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x00B7 + y); cycles += PAGE_CROSSED(0x00B7, ea); a ^= RD(ea); NZ(a);
+    // 9734  BVC
+    start = cycles; cycles += 2; executed++; if (!(p & F_V)) { cycles += 1; EXIT(0x9739); }
+    EXIT(0x9736);
+}
+
+static int block_9736(espnes_context *ctx)
+{
+    BEGIN;
+    // 9736  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x04E5); NZ(a);
+    EXIT(0x9739);
+}
+
+static int block_9739(espnes_context *ctx)
+{
+    BEGIN;
+    // 9739  STX
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xFF + y); WR(ea, x);
+    // 973B  LDA
+    start = cycles; cycles += 2; executed++; a = 0x3A; NZ(a);
+    // 973D  STA
+    start = cycles; cycles += 3; executed++; WR(0x49, a);
+    // 973F  LDA
+    start = cycles; cycles += 2; executed++; a = 0xA0; NZ(a);
+    // 9741  STA
+    start = cycles; cycles += 3; executed++; WR(0x4A, a);
+    // 9743  ORA
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x49); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a |= RD(ea); NZ(a);
+    IO_EXIT(0x9745);
+    // 9745  EOR
+    start = cycles; cycles += 3; executed++; a ^= RD(0x6D); NZ(a);
+    // 9747  NOP
+    start = cycles; cycles += 2; executed++; 
+    // 9748  SBC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x05E8 + x); cycles += PAGE_CROSSED(0x05E8, ea); SBC(RD(ea));
+    // 974B  BCC
+    start = cycles; cycles += 2; executed++; if (!(p & F_C)) { cycles += 1; EXIT(0x9750); }
+    EXIT(0x974D);
+}
+
+static int block_974D(espnes_context *ctx)
+{
+    BEGIN;
+    // 974D  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xFA05); NZ(a);
+    IO_EXIT(0x9750);
+    EXIT(0x9750);
+}
+
+static int block_9750(espnes_context *ctx)
+{
+    BEGIN;
+    // 9750  CMP
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0280 + x); cycles += PAGE_CROSSED(0x0280, ea); CMP(a, RD(ea));
+    // 9753  CMP
+    start = cycles; cycles += 4; executed++; CMP(a, RD(0x8C1B));
+    IO_EXIT(0x9756);
+    // 9756  LSR
+    start = cycles; cycles += 2; executed++; LSR(a);
+    // 9757  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xCFF3 + y); cycles += PAGE_CROSSED(0xCFF3, ea); a ^= RD(ea); NZ(a);
+    IO_EXIT(0x975A);
+    // 975A  BVS
+    start = cycles; cycles += 2; executed++; if (p & F_V) { cycles += 1; EXIT(0x975F); }
+    EXIT(0x975C);
+}
+
+static int block_975C(espnes_context *ctx)
+{
+    BEGIN;
+    // 975C  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x985E); NZ(a);
+    IO_EXIT(0x975F);
+    EXIT(0x975F);
+}
+
+static int block_975F(espnes_context *ctx)
+{
+    BEGIN;
+    // 975F  EOR
+    start = cycles; cycles += 3; executed++; a ^= RD(0xC8); NZ(a);
+    // 9761  STA
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x4A + x); WR(ea, a);
+    // 9763  CMP
+    start = cycles; cycles += 4; executed++; CMP(a, RD(0x04DA));
+    // 9766  ADC
+    start = cycles; cycles += 3; executed++; ADC(RD(0xE2));
+    // 9768  LDA
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x7B + x); a = RD(ea); NZ(a);
+    // 976A  TYA
+    start = cycles; cycles += 2; executed++; a = y; NZ(a);
+    // 976B  AND
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xB9 + x); a &= RD(ea); NZ(a);
+    // 976D  BMI
+    start = cycles; cycles += 2; executed++; if (p & F_N) { cycles += 1; EXIT(0x9772); }
+    EXIT(0x976F);
+}
+
+static int block_976F(espnes_context *ctx)
+{
+    BEGIN;
+    // 976F  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x0187); NZ(a);
+    EXIT(0x9772);
+}
+
+static int block_9772(espnes_context *ctx)
+{
+    BEGIN;
+    // 9772  ADC
+    start = cycles; cycles += 2; executed++; ADC(0x76);
+    // 9774  INY
+    start = cycles; cycles += 2; executed++; y++; NZ(y);
+    // 9775  LDY
+    start = cycles; cycles += 3; executed++; y = RD(0x70); NZ(y);
+    // 9777  SEC
+    start = cycles; cycles += 2; executed++; SETF(F_C, 1);
+    // 9778  STA
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x91 + x); WR(ea, a);
+    // 977A  LDY
+    start = cycles; cycles += 4; executed++; y = RD(0xFCF8); NZ(y);
+    IO_EXIT(0x977D);
+    // 977D  CPX
+    start = cycles; cycles += 2; executed++; CMP(x, 0x47);
+    // 977F  DEC
+    start = cycles; cycles += 5; executed++; t = RD(0xD4); t--; NZ(t); WR(0xD4, t);
+    // 9781  SBC
+    start = cycles; cycles += 3; executed++; SBC(RD(0x9F));
+    // 9783  CLC
+    start = cycles; cycles += 2; executed++; SETF(F_C, 0);
+    // 9784  STA
+    start = cycles; cycles += 5; executed++; ea = (uint16_t)(0x0065 + y); WR(ea, a);
+    // 9787  ROL
+    start = cycles; cycles += 5; executed++; t = RD(0x9C); ROL(t); WR(0x9C, t);
+    // 9789  BCC
+    start = cycles; cycles += 2; executed++; if (!(p & F_C)) { cycles += 1; EXIT(0x978E); }
+    EXIT(0x978B);
+}
+
+static int block_978B(espnes_context *ctx)
+{
+    BEGIN;
+    // 978B  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x06D3); NZ(a);
+    EXIT(0x978E);
+}
+
+static int block_978E(espnes_context *ctx)
+{
+    BEGIN;
+    // 978E  ORA
+    start = cycles; cycles += 4; executed++; a |= RD(0xB5EA); NZ(a);
+    IO_EXIT(0x9791);
+    // 9791  SEI
+    start = cycles; cycles += 2; executed++; SETF(F_I, 1);
+    // 9792  LDA
+    start = cycles; cycles += 2; executed++; a = 0x04; NZ(a);
+    // 9794  STA
+    start = cycles; cycles += 3; executed++; WR(0x9B, a);
+    // 9796  LDA
+    start = cycles; cycles += 2; executed++; a = 0xCE; NZ(a);
+    // 9798  STA
+    start = cycles; cycles += 3; executed++; WR(0x9C, a);
+    // 979A  ADC
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x9B); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); ADC(RD(ea));
+    IO_EXIT(0x979C);
+    // 979C  SBC
+    start = cycles; cycles += 3; executed++; SBC(RD(0x5D));
+    // 979E  LDX
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xE752 + y); cycles += PAGE_CROSSED(0xE752, ea); x = RD(ea); NZ(x);
+    IO_EXIT(0x97A1);
+    // 97A1  STY
+    start = cycles; cycles += 4; executed++; WR(0x00B7, y);
+    // 97A4  INX
+    start = cycles; cycles += 2; executed++; x++; NZ(x);
+    // 97A5  LDY
+    start = cycles; cycles += 2; executed++; y = 0xC3; NZ(y);
+    // 97A7  TAX
+    start = cycles; cycles += 2; executed++; x = a; NZ(x);
+    // 97A8  DEC
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x06A8 + x); t = RD(ea); t--; NZ(t); WR(ea, t);
+    // 97AB  BVC
+    start = cycles; cycles += 2; executed++; if (!(p & F_V)) { cycles += 1; EXIT(0x97B0); }
+    EXIT(0x97AD);
+}
+
+static int block_97AD(espnes_context *ctx)
+{
+    BEGIN;
+    // 97AD  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x9B9F); NZ(a);
+    IO_EXIT(0x97B0);
+    EXIT(0x97B0);
+}
+
+static int block_97B0(espnes_context *ctx)
+{
+    BEGIN;
+    // 97B0  ROL
+    start = cycles; cycles += 5; executed++; t = RD(0x3F); ROL(t); WR(0x3F, t);
+    // 97B2  LDX
+    start = cycles; cycles += 2; executed++; x = 0x66; NZ(x);
+    // 97B4  LDA
+    start = cycles; cycles += 2; executed++; a = 0x73; NZ(a);
+    // 97B6  STA
+    start = cycles; cycles += 3; executed++; WR(0x8D, a);
+    // 97B8  LDA
+    start = cycles; cycles += 2; executed++; a = 0xAF; NZ(a);
+    // 97BA  STA
+    start = cycles; cycles += 3; executed++; WR(0x8E, a);
+    // 97BC  ORA
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0x27 + x); a |= RD(ea); NZ(a);
+    IO_EXIT(0x97BE);
+    // 97BE  ROL
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x0581 + x); t = RD(ea); ROL(t); WR(ea, t);
+    // 97C1  INC
+    start = cycles; cycles += 6; executed++; t = RD(0x0597); t++; NZ(t); WR(0x0597, t);
+    // 97C4  BCC
+    start = cycles; cycles += 2; executed++; if (!(p & F_C)) { cycles += 1; EXIT(0x97C9); }
+    EXIT(0x97C6);
+}
+
+static int block_97C6(espnes_context *ctx)
+{
+    BEGIN;
+    // 97C6  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xA10F); NZ(a);
+    IO_EXIT(0x97C9);
+    EXIT(0x97C9);
+}
+
+static int block_97C9(espnes_context *ctx)
+{
+    BEGIN;
+    // 97C9  TAX
+    start = cycles; cycles += 2; executed++; x = a; NZ(x);
+    // 97CA  DEY
+    start = cycles; cycles += 2; executed++; y--; NZ(y);
+    // 97CB  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x99C3 + y); cycles += PAGE_CROSSED(0x99C3, ea); a ^= RD(ea); NZ(a);
+    IO_EXIT(0x97CE);
+    // 97CE  AND
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x057E + y); cycles += PAGE_CROSSED(0x057E, ea); a &= RD(ea); NZ(a);
+    // 97D1  INY
+    start = cycles; cycles += 2; executed++; y++; NZ(y);
+    // 97D2  EOR
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x0426 + x); cycles += PAGE_CROSSED(0x0426, ea); a ^= RD(ea); NZ(a);
+    // 97D5  STY
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xF1 + x); WR(ea, y);
+    // 97D7  LDA
+    start = cycles; cycles += 2; executed++; a = 0xFF; NZ(a);
+    // 97D9  STA
+    start = cycles; cycles += 3; executed++; WR(0x03, a);
+    // 97DB  LDA
+    start = cycles; cycles += 2; executed++; a = 0x04; NZ(a);
+    // 97DD  STA
+    start = cycles; cycles += 3; executed++; WR(0x04, a);
+    // 97DF  ADC
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x03); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); ADC(RD(ea));
+    IO_EXIT(0x97E1);
+    // 97E1  INC
+    start = cycles; cycles += 6; executed++; t = RD(0x055F); t++; NZ(t); WR(0x055F, t);
+    // 97E4  LSR
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x01BE + x); t = RD(ea); LSR(t); WR(ea, t);
+    // 97E7  SED
+    start = cycles; cycles += 2; executed++; SETF(F_D, 1);
+    // 97E8  BCC
+    start = cycles; cycles += 2; executed++; if (!(p & F_C)) { cycles += 1; EXIT(0x97ED); }
+    EXIT(0x97EA);
+}
+
+static int block_97EA(espnes_context *ctx)
+{
+    BEGIN;
+    // 97EA  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xAFAC); NZ(a);
+    IO_EXIT(0x97ED);
+    EXIT(0x97ED);
+}
+
+static int block_97ED(espnes_context *ctx)
+{
+    BEGIN;
+    // 97ED  ASL
+    start = cycles; cycles += 6; executed++; t = RD(0x015F); ASL(t); WR(0x015F, t);
+    // 97F0  DEC
+    start = cycles; cycles += 6; executed++; t = RD(0x022B); t--; NZ(t); WR(0x022B, t);
+    // 97F3  LSR
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x0431 + x); t = RD(ea); LSR(t); WR(ea, t);
+    // 97F6  LSR
+    start = cycles; cycles += 6; executed++; t = RD(0x02B0); LSR(t); WR(0x02B0, t);
+    // 97F9  STA
+    start = cycles; cycles += 5; executed++; ea = (uint16_t)(0x06AB + y); WR(ea, a);
+    // 97FC  LDX
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x0A + y); x = RD(ea); NZ(x);
+    // 97FE  CMP
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0x9FB1 + x); cycles += PAGE_CROSSED(0x9FB1, ea); CMP(a, RD(ea));
+    IO_EXIT(0x9801);
+    // 9801  ORA
+    start = cycles; cycles += 3; executed++; a |= RD(0xE8); NZ(a);
+    // 9803  DEY
+    start = cycles; cycles += 2; executed++; y--; NZ(y);
+    // 9804  STA
+    start = cycles; cycles += 5; executed++; ea = (uint16_t)(0x01CF + y); WR(ea, a);
+    // 9807  EOR
+    start = cycles; cycles += 4; executed++; a ^= RD(0xE423); NZ(a);
+    IO_EXIT(0x980A);
+    // 980A  TSX
+    start = cycles; cycles += 2; executed++; x = sp; NZ(x);
+    // 980B  BPL
+    start = cycles; cycles += 2; executed++; if (!(p & F_N)) { cycles += 1; EXIT(0x9810); }
+    EXIT(0x980D);
+}
+
+static int block_980D(espnes_context *ctx)
+{
+    BEGIN;
+    // 980D  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x05BF); NZ(a);
+    EXIT(0x9810);
+}
+
+static int block_9810(espnes_context *ctx)
+{
+    BEGIN;
+    // 9810  SBC
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0xD6 + x); SBC(RD(ea));
+    // 9812  SBC
+    start = cycles; cycles += 2; executed++; SBC(0x34);
+    // 9814  BVC
+    start = cycles; cycles += 2; executed++; if (!(p & F_V)) { cycles += 1; EXIT(0x9819); }
+    EXIT(0x9816);
+}
+
+static int block_9816(espnes_context *ctx)
+{
+    BEGIN;
+    // 9816  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x04DA); NZ(a);
+    EXIT(0x9819);
+}
+
+static int block_9819(espnes_context *ctx)
+{
+    BEGIN;
+    // 9819  LDA
+    start = cycles; cycles += 2; executed++; a = 0x91; NZ(a);
+    // 981B  STA
+    start = cycles; cycles += 3; executed++; WR(0x48, a);
+    // 981D  LDA
+    start = cycles; cycles += 2; executed++; a = 0x02; NZ(a);
+    // 981F  STA
+    start = cycles; cycles += 3; executed++; WR(0x49, a);
+    // 9821  SBC
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x48); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); SBC(RD(ea));
+    IO_EXIT(0x9823);
+    // 9823  INC
+    start = cycles; cycles += 7; executed++; ea = (uint16_t)(0x008E + x); t = RD(ea); t++; NZ(t); WR(ea, t);
+    // 9826  AND
+    start = cycles; cycles += 4; executed++; a &= RD(0xA030); NZ(a);
+    IO_EXIT(0x9829);
+    // 9829  ADC
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xB68D + y); cycles += PAGE_CROSSED(0xB68D, ea); ADC(RD(ea));
+    IO_EXIT(0x982C);
+    // 982C  ROL
+    start = cycles; cycles += 2; executed++; ROL(a);
+    // 982D  AND
+    start = cycles; cycles += 4; executed++; ea = (uint16_t)(0xE837 + y); cycles += PAGE_CROSSED(0xE837, ea); a &= RD(ea); NZ(a);
+    IO_EXIT(0x9830);
+    // 9830  TAY
+    start = cycles; cycles += 2; executed++; y = a; NZ(y);
+    // 9831  STA
+    start = cycles; cycles += 3; executed++; WR(0x01, a);
+    // 9833  BPL
+    start = cycles; cycles += 2; executed++; if (!(p & F_N)) { cycles += 1; EXIT(0x9838); }
+    EXIT(0x9835);
+}
+
+static int block_9835(espnes_context *ctx)
+{
+    BEGIN;
+    // 9835  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x03A1); NZ(a);
+    EXIT(0x9838);
+}
+
+static int block_9838(espnes_context *ctx)
+{
+    BEGIN;
+    // 9838  TAY
+    start = cycles; cycles += 2; executed++; y = a; NZ(y);
+    // 9839  BPL
+    start = cycles; cycles += 2; executed++; if (!(p & F_N)) { cycles += 1; EXIT(0x983E); }
+    EXIT(0x983B);
+}
+
+static int block_983B(espnes_context *ctx)
+{
+    BEGIN;
+    // 983B  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x93EC); NZ(a);
+    IO_EXIT(0x983E);
+    EXIT(0x983E);
+}
+
+static int block_983E(espnes_context *ctx)
+{
+    BEGIN;
+    // 983E  LDX
+    start = cycles; cycles += 2; executed++; x = 0x0A; NZ(x);
+    // 9840  LDA
+    start = cycles; cycles += 2; executed++; a = 0xCB; NZ(a);
+    // 9842  STA
+    start = cycles; cycles += 3; executed++; WR(0x09, a);
+    // 9844  LDA
+    start = cycles; cycles += 2; executed++; a = 0x01; NZ(a);
+    // 9846  STA
+    start = cycles; cycles += 3; executed++; WR(0x0A, a);
+    // 9848  SBC
+    start = cycles; cycles += 6; executed++; ea = RD16_ZP(0xFF + x); SBC(RD(ea));
+    IO_EXIT(0x984A);
+    // 984A  TAY
+    start = cycles; cycles += 2; executed++; y = a; NZ(y);
+    // 984B  ASL
+    start = cycles; cycles += 5; executed++; t = RD(0x8F); ASL(t); WR(0x8F, t);
+    // 984D  LDA
+    start = cycles; cycles += 2; executed++; a = 0x67; NZ(a);
+    // 984F  STA
+    start = cycles; cycles += 3; executed++; WR(0x8C, a);
+    // 9851  LDA
+    start = cycles; cycles += 2; executed++; a = 0x06; NZ(a);
+    // 9853  STA
+    start = cycles; cycles += 3; executed++; WR(0x8D, a);
+    // 9855  EOR
+    start = cycles; cycles += 5; executed++; base = RD16_ZP(0x8C); ea = (uint16_t)(base + y); cycles += PAGE_CROSSED(base, ea); a ^= RD(ea); NZ(a);
+    IO_EXIT(0x9857);
+    // 9857  LSR
+    start = cycles; cycles += 2; executed++; LSR(a);
+    // 9858  DEC
+    start = cycles; cycles += 5; executed++; t = RD(0xD9); t--; NZ(t); WR(0xD9, t);
+    // 985A  DEX
+    start = cycles; cycles += 2; executed++; x--; NZ(x);
+    // 985B  LDA
+    start = cycles; cycles += 2; executed++; a = 0xB2; NZ(a);
+    // 985D  STA
+    start = cycles; cycles += 3; executed++; WR(0x79, a);
+    // 985F  BPL
+    start = cycles; cycles += 2; executed++; if (!(p & F_N)) { cycles += 1; EXIT(0x9864); }
+    EXIT(0x9861);
+}
+
+static int block_9861(espnes_context *ctx)
+{
+    BEGIN;
+    // 9861  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0x02D4); NZ(a);
+    EXIT(0x9864);
+}
+
+static int block_9864(espnes_context *ctx)
+{
+    BEGIN;
+    // 9864  STA
+    start = cycles; cycles += 4; executed++; ea = (uint8_t)(0x43 + x); WR(ea, a);
+    // 9866  BEQ
+    start = cycles; cycles += 2; executed++; if (p & F_Z) { cycles += 1; EXIT(0x986B); }
+    EXIT(0x9868);
+}
+
+static int block_9868(espnes_context *ctx)
+{
+    BEGIN;
+    // 9868  LDA
+    start = cycles; cycles += 4; executed++; a = RD(0xE1E6); NZ(a);
+    IO_EXIT(0x986B);
+    EXIT(0x986B);
+}
+
+static int block_986B(espnes_context *ctx)
+{
+    BEGIN;
+    // 986B  LDA
+    start = cycles; cycles += 2; executed++; a = 0x4C; NZ(a);
+    // 986D  STA
+    start = cycles; cycles += 4; executed++; WR(0x0200, a);
+    // 9870  LDA
+    start = cycles; cycles += 2; executed++; a = 0x00; NZ(a);
+    // 9872  STA
+    start = cycles; cycles += 4; executed++; WR(0x0201, a);
+    // 9875  LDA
+    start = cycles; cycles += 2; executed++; a = 0x02; NZ(a);
+    // 9877  STA
+    start = cycles; cycles += 4; executed++; WR(0x0202, a);
+    // 987A  JMP
+    start = cycles; cycles += 3; executed++; EXIT(0x0200);
+}
+
+static const espnes_block_entry blocks[] = {
+    { 0x8000, block_8000 },
+    { 0x8013, block_8013 },
+    { 0x8016, block_8016 },
+    { 0x801C, block_801C },
+    { 0x801F, block_801F },
+    { 0x8023, block_8023 },
+    { 0x8026, block_8026 },
+    { 0x8043, block_8043 },
+    { 0x8046, block_8046 },
+    { 0x805A, block_805A },
+    { 0x805D, block_805D },
+    { 0x8086, block_8086 },
+    { 0x8089, block_8089 },
+    { 0x80A1, block_80A1 },
+    { 0x80A4, block_80A4 },
+    { 0x80BF, block_80BF },
+    { 0x80C2, block_80C2 },
+    { 0x80DE, block_80DE },
+    { 0x80E1, block_80E1 },
+    { 0x8109, block_8109 },
+    { 0x810C, block_810C },
+    { 0x8129, block_8129 },
+    { 0x812C, block_812C },
+    { 0x8143, block_8143 },
+    { 0x8146, block_8146 },
+    { 0x8151, block_8151 },
+    { 0x8154, block_8154 },
+    { 0x8162, block_8162 },
+    { 0x8165, block_8165 },
+    { 0x816C, block_816C },
+    { 0x816F, block_816F },
+    { 0x8194, block_8194 },
+    { 0x8197, block_8197 },
+    { 0x819C, block_819C },
+    { 0x819F, block_819F },
+    { 0x81C0, block_81C0 },
+    { 0x81C3, block_81C3 },
+    { 0x81EF, block_81EF },
+    { 0x81F2, block_81F2 },
+    { 0x8201, block_8201 },
+    { 0x8204, block_8204 },
+    { 0x8217, block_8217 },
+    { 0x821A, block_821A },
+    { 0x8231, block_8231 },
+    { 0x8234, block_8234 },
+    { 0x823F, block_823F },
+    { 0x8242, block_8242 },
+    { 0x8250, block_8250 },
+    { 0x8253, block_8253 },
+    { 0x825B, block_825B },
+    { 0x825E, block_825E },
+    { 0x8278, block_8278 },
+    { 0x827B, block_827B },
+    { 0x828D, block_828D },
+    { 0x8290, block_8290 },
+    { 0x8299, block_8299 },
+    { 0x829C, block_829C },
+    { 0x82B2, block_82B2 },
+    { 0x82B5, block_82B5 },
+    { 0x82C3, block_82C3 },
+    { 0x82C6, block_82C6 },
+    { 0x82EA, block_82EA },
+    { 0x82ED, block_82ED },
+    { 0x8312, block_8312 },
+    { 0x8315, block_8315 },
+    { 0x831F, block_831F },
+    { 0x8322, block_8322 },
+    { 0x8338, block_8338 },
+    { 0x833B, block_833B },
+    { 0x8353, block_8353 },
+    { 0x8356, block_8356 },
+    { 0x835A, block_835A },
+    { 0x835D, block_835D },
+    { 0x8361, block_8361 },
+    { 0x8364, block_8364 },
+    { 0x837E, block_837E },
+    { 0x8381, block_8381 },
+    { 0x8395, block_8395 },
+    { 0x8398, block_8398 },
+    { 0x839E, block_839E },
+    { 0x83A1, block_83A1 },
+    { 0x83C1, block_83C1 },
+    { 0x83C4, block_83C4 },
+    { 0x83EC, block_83EC },
+    { 0x83EF, block_83EF },
+    { 0x8408, block_8408 },
+    { 0x840B, block_840B },
+    { 0x841C, block_841C },
+    { 0x841F, block_841F },
+    { 0x843D, block_843D },
+    { 0x8440, block_8440 },
+    { 0x8445, block_8445 },
+    { 0x8448, block_8448 },
+    { 0x8458, block_8458 },
+    { 0x845B, block_845B },
+    { 0x8483, block_8483 },
+    { 0x8486, block_8486 },
+    { 0x8496, block_8496 },
+    { 0x8499, block_8499 },
+    { 0x84AF, block_84AF },
+    { 0x84B2, block_84B2 },
+    { 0x84C1, block_84C1 },
+    { 0x84C4, block_84C4 },
+    { 0x84C9, block_84C9 },
+    { 0x84CC, block_84CC },
+    { 0x84E6, block_84E6 },
+    { 0x84E9, block_84E9 },
+    { 0x8508, block_8508 },
+    { 0x850B, block_850B },
+    { 0x8511, block_8511 },
+    { 0x8514, block_8514 },
+    { 0x851C, block_851C },
+    { 0x851F, block_851F },
+    { 0x8548, block_8548 },
+    { 0x854B, block_854B },
+    { 0x855E, block_855E },
+    { 0x8561, block_8561 },
+    { 0x8579, block_8579 },
+    { 0x857C, block_857C },
+    { 0x8591, block_8591 },
+    { 0x8594, block_8594 },
+    { 0x859F, block_859F },
+    { 0x85A2, block_85A2 },
+    { 0x85D1, block_85D1 },
+    { 0x85D4, block_85D4 },
+    { 0x85E9, block_85E9 },
+    { 0x85EC, block_85EC },
+    { 0x85FC, block_85FC },
+    { 0x85FF, block_85FF },
+    { 0x8608, block_8608 },
+    { 0x860B, block_860B },
+    { 0x860F, block_860F },
+    { 0x8612, block_8612 },
+    { 0x8618, block_8618 },
+    { 0x861B, block_861B },
+    { 0x8632, block_8632 },
+    { 0x8635, block_8635 },
+    { 0x865B, block_865B },
+    { 0x865E, block_865E },
+    { 0x8667, block_8667 },
+    { 0x866A, block_866A },
+    { 0x8680, block_8680 },
+    { 0x8683, block_8683 },
+    { 0x8688, block_8688 },
+    { 0x868B, block_868B },
+    { 0x86B8, block_86B8 },
+    { 0x86BB, block_86BB },
+    { 0x86C5, block_86C5 },
+    { 0x86C8, block_86C8 },
+    { 0x86E3, block_86E3 },
+    { 0x86E6, block_86E6 },
+    { 0x8709, block_8709 },
+    { 0x870C, block_870C },
+    { 0x8714, block_8714 },
+    { 0x8717, block_8717 },
+    { 0x8738, block_8738 },
+    { 0x873B, block_873B },
+    { 0x8743, block_8743 },
+    { 0x8746, block_8746 },
+    { 0x876F, block_876F },
+    { 0x8772, block_8772 },
+    { 0x8776, block_8776 },
+    { 0x8779, block_8779 },
+    { 0x8782, block_8782 },
+    { 0x8785, block_8785 },
+    { 0x8795, block_8795 },
+    { 0x8798, block_8798 },
+    { 0x879C, block_879C },
+    { 0x879F, block_879F },
+    { 0x87C4, block_87C4 },
+    { 0x87C7, block_87C7 },
+    { 0x87CE, block_87CE },
+    { 0x87D1, block_87D1 },
+    { 0x87EF, block_87EF },
+    { 0x87F2, block_87F2 },
+    { 0x87FA, block_87FA },
+    { 0x87FD, block_87FD },
+    { 0x8833, block_8833 },
+    { 0x8836, block_8836 },
+    { 0x883E, block_883E },
+    { 0x8841, block_8841 },
+    { 0x8869, block_8869 },
+    { 0x886C, block_886C },
+    { 0x888A, block_888A },
+    { 0x888D, block_888D },
+    { 0x889A, block_889A },
+    { 0x889D, block_889D },
+    { 0x88CB, block_88CB },
+    { 0x88CE, block_88CE },
+    { 0x88D5, block_88D5 },
+    { 0x88D8, block_88D8 },
+    { 0x890E, block_890E },
+    { 0x8911, block_8911 },
+    { 0x892A, block_892A },
+    { 0x892D, block_892D },
+    { 0x893C, block_893C },
+    { 0x893F, block_893F },
+    { 0x895B, block_895B },
+    { 0x895E, block_895E },
+    { 0x896A, block_896A },
+    { 0x896D, block_896D },
+    { 0x8999, block_8999 },
+    { 0x899C, block_899C },
+    { 0x89B1, block_89B1 },
+    { 0x89B4, block_89B4 },
+    { 0x89D3, block_89D3 },
+    { 0x89D6, block_89D6 },
+    { 0x89F7, block_89F7 },
+    { 0x89FA, block_89FA },
+    { 0x89FE, block_89FE },
+    { 0x8A01, block_8A01 },
+    { 0x8A36, block_8A36 },
+    { 0x8A39, block_8A39 },
+    { 0x8A4B, block_8A4B },
+    { 0x8A4E, block_8A4E },
+    { 0x8A7A, block_8A7A },
+    { 0x8A7D, block_8A7D },
+    { 0x8A9B, block_8A9B },
+    { 0x8A9E, block_8A9E },
+    { 0x8AB5, block_8AB5 },
+    { 0x8AB8, block_8AB8 },
+    { 0x8AD3, block_8AD3 },
+    { 0x8AD6, block_8AD6 },
+    { 0x8ADE, block_8ADE },
+    { 0x8AE1, block_8AE1 },
+    { 0x8B0E, block_8B0E },
+    { 0x8B11, block_8B11 },
+    { 0x8B2E, block_8B2E },
+    { 0x8B31, block_8B31 },
+    { 0x8B3F, block_8B3F },
+    { 0x8B42, block_8B42 },
+    { 0x8B5F, block_8B5F },
+    { 0x8B62, block_8B62 },
+    { 0x8B73, block_8B73 },
+    { 0x8B76, block_8B76 },
+    { 0x8B98, block_8B98 },
+    { 0x8B9B, block_8B9B },
+    { 0x8BAD, block_8BAD },
+    { 0x8BB0, block_8BB0 },
+    { 0x8BC4, block_8BC4 },
+    { 0x8BC7, block_8BC7 },
+    { 0x8BDA, block_8BDA },
+    { 0x8BDD, block_8BDD },
+    { 0x8BEB, block_8BEB },
+    { 0x8BEE, block_8BEE },
+    { 0x8BFE, block_8BFE },
+    { 0x8C01, block_8C01 },
+    { 0x8C15, block_8C15 },
+    { 0x8C18, block_8C18 },
+    { 0x8C21, block_8C21 },
+    { 0x8C24, block_8C24 },
+    { 0x8C2C, block_8C2C },
+    { 0x8C2F, block_8C2F },
+    { 0x8C3D, block_8C3D },
+    { 0x8C40, block_8C40 },
+    { 0x8C64, block_8C64 },
+    { 0x8C67, block_8C67 },
+    { 0x8C7F, block_8C7F },
+    { 0x8C82, block_8C82 },
+    { 0x8C92, block_8C92 },
+    { 0x8C95, block_8C95 },
+    { 0x8CA7, block_8CA7 },
+    { 0x8CAA, block_8CAA },
+    { 0x8CBC, block_8CBC },
+    { 0x8CBF, block_8CBF },
+    { 0x8CD4, block_8CD4 },
+    { 0x8CD7, block_8CD7 },
+    { 0x8CDA, block_8CDA },
+    { 0x8CDD, block_8CDD },
+    { 0x8CEB, block_8CEB },
+    { 0x8CEE, block_8CEE },
+    { 0x8D01, block_8D01 },
+    { 0x8D04, block_8D04 },
+    { 0x8D27, block_8D27 },
+    { 0x8D2A, block_8D2A },
+    { 0x8D30, block_8D30 },
+    { 0x8D33, block_8D33 },
+    { 0x8D3D, block_8D3D },
+    { 0x8D40, block_8D40 },
+    { 0x8D57, block_8D57 },
+    { 0x8D5A, block_8D5A },
+    { 0x8D73, block_8D73 },
+    { 0x8D76, block_8D76 },
+    { 0x8D8B, block_8D8B },
+    { 0x8D8E, block_8D8E },
+    { 0x8DA8, block_8DA8 },
+    { 0x8DAB, block_8DAB },
+    { 0x8DCA, block_8DCA },
+    { 0x8DCD, block_8DCD },
+    { 0x8DDB, block_8DDB },
+    { 0x8DDE, block_8DDE },
+    { 0x8DE8, block_8DE8 },
+    { 0x8DEB, block_8DEB },
+    { 0x8DEF, block_8DEF },
+    { 0x8DF2, block_8DF2 },
+    { 0x8E0F, block_8E0F },
+    { 0x8E12, block_8E12 },
+    { 0x8E2B, block_8E2B },
+    { 0x8E2E, block_8E2E },
+    { 0x8E3E, block_8E3E },
+    { 0x8E41, block_8E41 },
+    { 0x8E52, block_8E52 },
+    { 0x8E55, block_8E55 },
+    { 0x8E77, block_8E77 },
+    { 0x8E7A, block_8E7A },
+    { 0x8E7E, block_8E7E },
+    { 0x8E81, block_8E81 },
+    { 0x8EA9, block_8EA9 },
+    { 0x8EAC, block_8EAC },
+    { 0x8EB0, block_8EB0 },
+    { 0x8EB3, block_8EB3 },
+    { 0x8EC6, block_8EC6 },
+    { 0x8EC9, block_8EC9 },
+    { 0x8EE6, block_8EE6 },
+    { 0x8EE9, block_8EE9 },
+    { 0x8F01, block_8F01 },
+    { 0x8F04, block_8F04 },
+    { 0x8F20, block_8F20 },
+    { 0x8F23, block_8F23 },
+    { 0x8F40, block_8F40 },
+    { 0x8F43, block_8F43 },
+    { 0x8F5A, block_8F5A },
+    { 0x8F5D, block_8F5D },
+    { 0x8F64, block_8F64 },
+    { 0x8F67, block_8F67 },
+    { 0x8F7A, block_8F7A },
+    { 0x8F7D, block_8F7D },
+    { 0x8F91, block_8F91 },
+    { 0x8F94, block_8F94 },
+    { 0x8FA9, block_8FA9 },
+    { 0x8FAC, block_8FAC },
+    { 0x8FBB, block_8FBB },
+    { 0x8FBE, block_8FBE },
+    { 0x8FC2, block_8FC2 },
+    { 0x8FC5, block_8FC5 },
+    { 0x8FCF, block_8FCF },
+    { 0x8FD2, block_8FD2 },
+    { 0x8FE2, block_8FE2 },
+    { 0x8FE5, block_8FE5 },
+    { 0x8FFA, block_8FFA },
+    { 0x8FFD, block_8FFD },
+    { 0x900E, block_900E },
+    { 0x9011, block_9011 },
+    { 0x9017, block_9017 },
+    { 0x901A, block_901A },
+    { 0x9031, block_9031 },
+    { 0x9034, block_9034 },
+    { 0x9039, block_9039 },
+    { 0x903C, block_903C },
+    { 0x9061, block_9061 },
+    { 0x9064, block_9064 },
+    { 0x9085, block_9085 },
+    { 0x9088, block_9088 },
+    { 0x90A8, block_90A8 },
+    { 0x90AB, block_90AB },
+    { 0x90B6, block_90B6 },
+    { 0x90B9, block_90B9 },
+    { 0x90C5, block_90C5 },
+    { 0x90C8, block_90C8 },
+    { 0x90E2, block_90E2 },
+    { 0x90E5, block_90E5 },
+    { 0x90FF, block_90FF },
+    { 0x9102, block_9102 },
+    { 0x9107, block_9107 },
+    { 0x910A, block_910A },
+    { 0x912A, block_912A },
+    { 0x912D, block_912D },
+    { 0x9137, block_9137 },
+    { 0x913A, block_913A },
+    { 0x914C, block_914C },
+    { 0x914F, block_914F },
+    { 0x917C, block_917C },
+    { 0x917F, block_917F },
+    { 0x9189, block_9189 },
+    { 0x918C, block_918C },
+    { 0x91AE, block_91AE },
+    { 0x91B1, block_91B1 },
+    { 0x91C1, block_91C1 },
+    { 0x91C4, block_91C4 },
+    { 0x91E4, block_91E4 },
+    { 0x91E7, block_91E7 },
+    { 0x91FF, block_91FF },
+    { 0x9202, block_9202 },
+    { 0x9211, block_9211 },
+    { 0x9214, block_9214 },
+    { 0x922F, block_922F },
+    { 0x9232, block_9232 },
+    { 0x924C, block_924C },
+    { 0x924F, block_924F },
+    { 0x925E, block_925E },
+    { 0x9261, block_9261 },
+    { 0x9265, block_9265 },
+    { 0x9268, block_9268 },
+    { 0x926B, block_926B },
+    { 0x926E, block_926E },
+    { 0x929A, block_929A },
+    { 0x929D, block_929D },
+    { 0x92A1, block_92A1 },
+    { 0x92A4, block_92A4 },
+    { 0x92AD, block_92AD },
+    { 0x92B0, block_92B0 },
+    { 0x92C3, block_92C3 },
+    { 0x92C6, block_92C6 },
+    { 0x92EA, block_92EA },
+    { 0x92ED, block_92ED },
+    { 0x9311, block_9311 },
+    { 0x9314, block_9314 },
+    { 0x9339, block_9339 },
+    { 0x933C, block_933C },
+    { 0x9343, block_9343 },
+    { 0x9346, block_9346 },
+    { 0x936B, block_936B },
+    { 0x936E, block_936E },
+    { 0x9387, block_9387 },
+    { 0x938A, block_938A },
+    { 0x9395, block_9395 },
+    { 0x9398, block_9398 },
+    { 0x93A5, block_93A5 },
+    { 0x93A8, block_93A8 },
+    { 0x93BC, block_93BC },
+    { 0x93BF, block_93BF },
+    { 0x93CC, block_93CC },
+    { 0x93CF, block_93CF },
+    { 0x93F2, block_93F2 },
+    { 0x93F5, block_93F5 },
+    { 0x9412, block_9412 },
+    { 0x9415, block_9415 },
+    { 0x9433, block_9433 },
+    { 0x9436, block_9436 },
+    { 0x9445, block_9445 },
+    { 0x9448, block_9448 },
+    { 0x9460, block_9460 },
+    { 0x9463, block_9463 },
+    { 0x9479, block_9479 },
+    { 0x947C, block_947C },
+    { 0x94BB, block_94BB },
+    { 0x94BE, block_94BE },
+    { 0x94CF, block_94CF },
+    { 0x94D2, block_94D2 },
+    { 0x94D5, block_94D5 },
+    { 0x94D8, block_94D8 },
+    { 0x94DF, block_94DF },
+    { 0x94E2, block_94E2 },
+    { 0x94F3, block_94F3 },
+    { 0x94F6, block_94F6 },
+    { 0x951E, block_951E },
+    { 0x9521, block_9521 },
+    { 0x955E, block_955E },
+    { 0x9561, block_9561 },
+    { 0x9566, block_9566 },
+    { 0x9569, block_9569 },
+    { 0x9571, block_9571 },
+    { 0x9574, block_9574 },
+    { 0x9594, block_9594 },
+    { 0x9597, block_9597 },
+    { 0x95A4, block_95A4 },
+    { 0x95A7, block_95A7 },
+    { 0x95CC, block_95CC },
+    { 0x95CF, block_95CF },
+    { 0x95DA, block_95DA },
+    { 0x95DD, block_95DD },
+    { 0x95E1, block_95E1 },
+    { 0x95E4, block_95E4 },
+    { 0x9602, block_9602 },
+    { 0x9605, block_9605 },
+    { 0x9617, block_9617 },
+    { 0x961A, block_961A },
+    { 0x962A, block_962A },
+    { 0x962D, block_962D },
+    { 0x963C, block_963C },
+    { 0x963F, block_963F },
+    { 0x9662, block_9662 },
+    { 0x9665, block_9665 },
+    { 0x9686, block_9686 },
+    { 0x9689, block_9689 },
+    { 0x96A4, block_96A4 },
+    { 0x96A7, block_96A7 },
+    { 0x96C3, block_96C3 },
+    { 0x96C6, block_96C6 },
+    { 0x96F0, block_96F0 },
+    { 0x96F3, block_96F3 },
+    { 0x970C, block_970C },
+    { 0x970F, block_970F },
+    { 0x971F, block_971F },
+    { 0x9722, block_9722 },
+    { 0x9736, block_9736 },
+    { 0x9739, block_9739 },
+    { 0x974D, block_974D },
+    { 0x9750, block_9750 },
+    { 0x975C, block_975C },
+    { 0x975F, block_975F },
+    { 0x976F, block_976F },
+    { 0x9772, block_9772 },
+    { 0x978B, block_978B },
+    { 0x978E, block_978E },
+    { 0x97AD, block_97AD },
+    { 0x97B0, block_97B0 },
+    { 0x97C6, block_97C6 },
+    { 0x97C9, block_97C9 },
+    { 0x97EA, block_97EA },
+    { 0x97ED, block_97ED },
+    { 0x980D, block_980D },
+    { 0x9810, block_9810 },
+    { 0x9816, block_9816 },
+    { 0x9819, block_9819 },
+    { 0x9835, block_9835 },
+    { 0x9838, block_9838 },
+    { 0x983B, block_983B },
+    { 0x983E, block_983E },
+    { 0x9861, block_9861 },
+    { 0x9864, block_9864 },
+    { 0x9868, block_9868 },
+    { 0x986B, block_986B },
+};
+
+extern "C" ESPNES_EXPORT const espnes_module espnes_module_info = {
+    ESPNES_RECOMPILED_VERSION, 0x2BDF6EDDu, 513, blocks
+};
@@ -1,11 +1,461 @@
 #include "pch.h"
 #include "CppUnitTest.h"
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../espnes-cpp/include/breakpoint_condition.hpp"
 #include "../espnes-cpp/include/cpu_helpers.hpp"
+#include "../espnes-cpp/include/emulator.hpp"
+#include "../espnes-cpp/include/emulator_pool.hpp"
+#include "../espnes-cpp/include/mapper.hpp"
+#include "../espnes-cpp/include/rewind_buffer.hpp"
+#include "../espnes-cpp/include/rom_image.hpp"
+#include "../espnes-cpp/include/save_state.hpp"
+#include "../espnes-cpp/include/tile_decoder.hpp"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 
+// Blocks compiled from differential_rom(), see differential_rom.cpp
+extern "C" const espnes_module espnes_module_info;
+
 namespace nestests
 {
+	// Builds an iNES image with prg_banks 16KB PRG banks and chr_banks 8KB
+	// CHR banks. code goes at origin in the last 32KB, where the reset, NMI
+	// and IRQ vectors point, and the rest of PRG is NOP. CHR is blank.
+	static std::vector<uint8_t> build_rom(int mapper, int prg_banks, int chr_banks, const std::vector<uint8_t>& code, uint16_t origin)
+	{
+		size_t prg_size = prg_banks * 0x4000;
+		std::vector<uint8_t> rom(16 + prg_size + chr_banks * 0x2000, 0);
+		rom[0] = 'N';
+		rom[1] = 'E';
+		rom[2] = 'S';
+		rom[3] = 0x1A;
+		rom[4] = (uint8_t)prg_banks;
+		rom[5] = (uint8_t)chr_banks;
+		rom[6] = (uint8_t)((mapper & 0x0F) << 4);
+		rom[7] = (uint8_t)(mapper & 0xF0);
+
+		uint8_t* prg = &rom[16];
+		for (size_t i = 0; i < prg_size; i++)
+		{
+			prg[i] = 0xEA;
+		}
+
+		size_t start = prg_size - (0x10000 - origin);
+		for (size_t i = 0; i < code.size(); i++)
+		{
+			prg[start + i] = code[i];
+		}
+
+		for (int i = 0; i < 3; i++)
+		{
+			prg[prg_size - 6 + i * 2] = origin & 0xFF;
+			prg[prg_size - 5 + i * 2] = origin >> 8;
+		}
+
+		return rom;
+	}
+
+	static std::shared_ptr<RomImage> create_image(const std::vector<uint8_t>& rom)
+	{
+		std::string error;
+		std::shared_ptr<RomImage> image = RomImage::create(rom.data(), rom.size(), error);
+		Assert::IsNotNull(image.get());
+		return image;
+	}
+
+	// Addressing modes the program generator knows how to set up
+	enum TestMode
+	{
+		MODE_IMP, MODE_IMM, MODE_ZP, MODE_ZPX, MODE_ZPY, MODE_ABS, MODE_ABX, MODE_ABY, MODE_IZX, MODE_IZY
+	};
+
+	struct TestOpcode
+	{
+		uint8_t opcode;
+		TestMode mode;
+		bool writes;
+	};
+
+	// Every official opcode that doesn't transfer control, clear I or pull P
+	static const TestOpcode test_opcodes[] = {
+		{ 0x09, MODE_IMM }, { 0x05, MODE_ZP }, { 0x15, MODE_ZPX }, { 0x0D, MODE_ABS }, { 0x1D, MODE_ABX }, { 0x19, MODE_ABY }, { 0x01, MODE_IZX }, { 0x11, MODE_IZY },
+		{ 0x29, MODE_IMM }, { 0x25, MODE_ZP }, { 0x35, MODE_ZPX }, { 0x2D, MODE_ABS }, { 0x3D, MODE_ABX }, { 0x39, MODE_ABY }, { 0x21, MODE_IZX }, { 0x31, MODE_IZY },
+		{ 0x49, MODE_IMM }, { 0x45, MODE_ZP }, { 0x55, MODE_ZPX }, { 0x4D, MODE_ABS }, { 0x5D, MODE_ABX }, { 0x59, MODE_ABY }, { 0x41, MODE_IZX }, { 0x51, MODE_IZY },
+		{ 0x69, MODE_IMM }, { 0x65, MODE_ZP }, { 0x75, MODE_ZPX }, { 0x6D, MODE_ABS }, { 0x7D, MODE_ABX }, { 0x79, MODE_ABY }, { 0x61, MODE_IZX }, { 0x71, MODE_IZY },
+		{ 0xC9, MODE_IMM }, { 0xC5, MODE_ZP }, { 0xD5, MODE_ZPX }, { 0xCD, MODE_ABS }, { 0xDD, MODE_ABX }, { 0xD9, MODE_ABY }, { 0xC1, MODE_IZX }, { 0xD1, MODE_IZY },
+		{ 0xE9, MODE_IMM }, { 0xE5, MODE_ZP }, { 0xF5, MODE_ZPX }, { 0xED, MODE_ABS }, { 0xFD, MODE_ABX }, { 0xF9, MODE_ABY }, { 0xE1, MODE_IZX }, { 0xF1, MODE_IZY },
+		{ 0xA9, MODE_IMM }, { 0xA5, MODE_ZP }, { 0xB5, MODE_ZPX }, { 0xAD, MODE_ABS }, { 0xBD, MODE_ABX }, { 0xB9, MODE_ABY }, { 0xA1, MODE_IZX }, { 0xB1, MODE_IZY },
+		{ 0x85, MODE_ZP, true }, { 0x95, MODE_ZPX, true }, { 0x8D, MODE_ABS, true }, { 0x9D, MODE_ABX, true }, { 0x99, MODE_ABY, true },
+		{ 0xA2, MODE_IMM }, { 0xA6, MODE_ZP }, { 0xB6, MODE_ZPY }, { 0xAE, MODE_ABS }, { 0xBE, MODE_ABY },
+		{ 0xA0, MODE_IMM }, { 0xA4, MODE_ZP }, { 0xB4, MODE_ZPX }, { 0xAC, MODE_ABS }, { 0xBC, MODE_ABX },
+		{ 0x86, MODE_ZP, true }, { 0x96, MODE_ZPY, true }, { 0x8E, MODE_ABS, true },
+		{ 0x84, MODE_ZP, true }, { 0x94, MODE_ZPX, true }, { 0x8C, MODE_ABS, true },
+		{ 0xE0, MODE_IMM }, { 0xE4, MODE_ZP }, { 0xEC, MODE_ABS },
+		{ 0xC0, MODE_IMM }, { 0xC4, MODE_ZP }, { 0xCC, MODE_ABS },
+		{ 0x24, MODE_ZP }, { 0x2C, MODE_ABS },
+		{ 0x0A, MODE_IMP }, { 0x06, MODE_ZP, true }, { 0x16, MODE_ZPX, true }, { 0x0E, MODE_ABS, true }, { 0x1E, MODE_ABX, true },
+		{ 0x4A, MODE_IMP }, { 0x46, MODE_ZP, true }, { 0x56, MODE_ZPX, true }, { 0x4E, MODE_ABS, true }, { 0x5E, MODE_ABX, true },
+		{ 0x2A, MODE_IMP }, { 0x26, MODE_ZP, true }, { 0x36, MODE_ZPX, true }, { 0x2E, MODE_ABS, true }, { 0x3E, MODE_ABX, true },
+		{ 0x6A, MODE_IMP }, { 0x66, MODE_ZP, true }, { 0x76, MODE_ZPX, true }, { 0x6E, MODE_ABS, true }, { 0x7E, MODE_ABX, true },
+		{ 0xE6, MODE_ZP, true }, { 0xF6, MODE_ZPX, true }, { 0xEE, MODE_ABS, true }, { 0xFE, MODE_ABX, true },
+		{ 0xC6, MODE_ZP, true }, { 0xD6, MODE_ZPX, true }, { 0xCE, MODE_ABS, true }, { 0xDE, MODE_ABX, true },
+		{ 0xAA, MODE_IMP }, { 0xA8, MODE_IMP }, { 0x8A, MODE_IMP }, { 0x98, MODE_IMP }, { 0xBA, MODE_IMP }, { 0x9A, MODE_IMP },
+		{ 0xE8, MODE_IMP }, { 0xC8, MODE_IMP }, { 0xCA, MODE_IMP }, { 0x88, MODE_IMP },
+		{ 0x18, MODE_IMP }, { 0x38, MODE_IMP }, { 0xB8, MODE_IMP }, { 0xD8, MODE_IMP }, { 0xF8, MODE_IMP }, { 0x78, MODE_IMP },
+		{ 0xEA, MODE_IMP }, { 0x48, MODE_IMP }, { 0x68, MODE_IMP }, { 0x08, MODE_IMP }
+	};
+
+	static const uint8_t test_branches[] = { 0x10, 0x30, 0x50, 0x70, 0x90, 0xB0, 0xD0, 0xF0 };
+
+	// The generated program ends by jumping to a JMP-to-itself it wrote
+	// here, out of PRG-ROM and so out of the recompiled blocks
+	static const uint16_t DIFFERENTIAL_END = 0x0200;
+
+	// A fixed pseudo-random program of official opcodes, cut into blocks by
+	// branches that either skip the next instruction or fall into it.
+	// Memory accesses stay in RAM and PRG-ROM so both runs see the same
+	// values without any PPU or APU timing involved.
+	//
+	// differential_rom.cpp is this ROM recompiled. After changing anything
+	// here or in the recompiler, write the ROM out and compile it again:
+	//     set ESPNES_DIFFERENTIAL_ROM=differential_rom.nes
+	//     vstest.console nes_tests.dll /Tests:WriteDifferentialRom
+	//     espnes_recompiler differential_rom.nes
+	//     move differential_rom.nes.cpp nes_tests\differential_rom.cpp
+	static std::vector<uint8_t> differential_rom()
+	{
+		uint32_t seed = 0x2A6F13C5;
+		auto next = [&seed](uint32_t range)
+		{
+			seed ^= seed << 13;
+			seed ^= seed >> 17;
+			seed ^= seed << 5;
+			return seed % range;
+		};
+
+		// Any RAM or PRG-ROM address for reads, RAM for writes. Indexing
+		// adds up to $FF and wraps from the top of PRG-ROM into RAM.
+		auto address = [&next](bool writes)
+		{
+			return (uint16_t)(writes || next(2) == 0 ? next(0x700) : 0x8000 + next(0x8000));
+		};
+
+		std::vector<uint8_t> prg;
+		auto emit = [&prg](uint8_t opcode, int length, uint16_t operand)
+		{
+			prg.push_back(opcode);
+			if (length > 1)
+			{
+				prg.push_back(operand & 0xFF);
+			}
+			if (length > 2)
+			{
+				prg.push_back(operand >> 8);
+			}
+		};
+
+		// Start from known registers
+		emit(0xA9, 2, (uint16_t)next(0x100));
+		emit(0xA2, 2, (uint16_t)next(0x100));
+		emit(0xA0, 2, (uint16_t)next(0x100));
+
+		for (int block = 0; block < 256; block++)
+		{
+			int count = 1 + next(12);
+			for (int i = 0; i < count; i++)
+			{
+				const TestOpcode& op = test_opcodes[next(sizeof(test_opcodes) / sizeof(test_opcodes[0]))];
+				switch (op.mode)
+				{
+				case MODE_IMP:
+					emit(op.opcode, 1, 0);
+					break;
+				case MODE_IMM:
+				case MODE_ZP:
+				case MODE_ZPX:
+				case MODE_ZPY:
+					emit(op.opcode, 2, (uint16_t)next(0x100));
+					break;
+				case MODE_ABS:
+				case MODE_ABX:
+				case MODE_ABY:
+					emit(op.opcode, 3, address(op.writes));
+					break;
+				case MODE_IZX:
+				case MODE_IZY:
+				{
+					// Point the zero page vector somewhere safe to read
+					uint8_t zp = (uint8_t)next(0x100);
+					uint8_t index = (uint8_t)next(0x100);
+					uint8_t vector = op.mode == MODE_IZX ? (uint8_t)(zp + index) : zp;
+					uint16_t target = address(false);
+					if (op.mode == MODE_IZX)
+					{
+						emit(0xA2, 2, index);
+					}
+					emit(0xA9, 2, target & 0xFF);
+					emit(0x85, 2, vector);
+					emit(0xA9, 2, target >> 8);
+					emit(0x85, 2, (uint8_t)(vector + 1));
+					emit(op.opcode, 2, zp);
+					break;
+				}
+				}
+			}
+
+			// Either skip the load or run it
+			emit(test_branches[next(8)], 2, 3);
+			emit(0xAD, 3, address(false));
+		}
+
+		// JMP $0200 / $0200: JMP $0200
+		const uint8_t end[3] = { 0x4C, DIFFERENTIAL_END & 0xFF, DIFFERENTIAL_END >> 8 };
+		for (int i = 0; i < 3; i++)
+		{
+			emit(0xA9, 2, end[i]);
+			emit(0x8D, 3, (uint16_t)(DIFFERENTIAL_END + i));
+		}
+		emit(0x4C, 3, DIFFERENTIAL_END);
+
+		return build_rom(0, 2, 1, prg, 0x8000);
+	}
+
+	// Compiles source, failing the test if it doesn't, and evaluates it
+	// against variables
+	static bool evaluate_condition(const std::string& source, const int64_t* variables)
+	{
+		BreakpointCondition condition;
+		std::string error;
+		Assert::IsTrue(condition.compile(source, error));
+		Assert::IsTrue(error.empty());
+		return condition.evaluate(variables);
+	}
+
+	// The error compiling source gives, empty if it compiles
+	static std::string condition_error(const std::string& source)
+	{
+		BreakpointCondition condition;
+		std::string error;
+		bool compiled = condition.compile(source, error);
+		Assert::AreEqual(compiled, error.empty());
+		return error;
+	}
+
+	static std::unique_ptr<Mapper> create_mapper(const std::shared_ptr<RomImage>& image)
+	{
+		Mapper* mapper = Mapper::create(image->get_mapper_number(), image->get_prg(), image->get_prg_size(), image->get_chr(), image->get_chr_size(), false,
+			image->get_mirroring());
+		Assert::IsNotNull(mapper);
+		return std::unique_ptr<Mapper>(mapper);
+	}
+
+	// The 8KB PRG banks seen at $8000, $A000, $C000 and $E000
+	static void assert_prg_banks(Mapper* mapper, RomImage* image, int bank0, int bank1, int bank2, int bank3)
+	{
+		int banks[4] = { bank0, bank1, bank2, bank3 };
+		for (int i = 0; i < 4; i++)
+		{
+			Assert::IsTrue(mapper->get_prg_page((uint16_t)(0x8000 + i * 0x2000)) == image->get_prg() + banks[i] * 0x2000);
+		}
+	}
+
+	// The 1KB CHR banks seen in each of the eight windows
+	static void assert_chr_banks(Mapper* mapper, RomImage* image, const std::vector<int>& banks)
+	{
+		for (int i = 0; i < 8; i++)
+		{
+			Assert::IsTrue(mapper->get_chr_window(i) == image->get_chr() + banks[i] * 0x400);
+		}
+	}
+
+	// Loads an MMC1 register one bit at a time, LSB first
+	static int mmc1_write(Mapper* mapper, uint16_t address, uint8_t value)
+	{
+		int changed = 0;
+		for (int i = 0; i < 5; i++)
+		{
+			changed = mapper->write(address, (uint8_t)(value >> i));
+		}
+		return changed;
+	}
+
+	// Sets the MMC3 IRQ latch, reloads and enables the counter, writes mask
+	// to PPUMASK and idles with IRQs masked
+	static std::vector<uint8_t> mmc3_irq_program(uint8_t latch, uint8_t mask)
+	{
+		std::vector<uint8_t> code = {
+			0x78,
+			0xA9, latch,
+			0x8D, 0x00, 0xC0,
+			0x8D, 0x01, 0xC0,
+			0x8D, 0x01, 0xE0,
+			0xA9, mask,
+			0x8D, 0x01, 0x20
+		};
+
+		uint16_t loop = (uint16_t)(0xE000 + code.size());
+		code.push_back(0x4C);
+		code.push_back(loop & 0xFF);
+		code.push_back(loop >> 8);
+		return code;
+	}
+
+	// Turns on the background and changes the backdrop colour every vblank,
+	// so each frame differs from the last
+	static std::vector<uint8_t> palette_cycle_program()
+	{
+		return {
+			0xA9, 0x08,       // E000  LDA #$08
+			0x8D, 0x01, 0x20, // E002  STA $2001
+			0x2C, 0x02, 0x20, // E005  BIT $2002
+			0x10, 0xFB,       // E008  BPL $E005
+			0xA9, 0x3F,       // E00A  LDA #$3F
+			0x8D, 0x06, 0x20, // E00C  STA $2006
+			0xA9, 0x00,       // E00F  LDA #$00
+			0x8D, 0x06, 0x20, // E011  STA $2006
+			0xA5, 0x10,       // E014  LDA $10
+			0x8D, 0x07, 0x20, // E016  STA $2007
+			0xE6, 0x10,       // E019  INC $10
+			0xA9, 0x00,       // E01B  LDA #$00
+			0x8D, 0x06, 0x20, // E01D  STA $2006
+			0x8D, 0x06, 0x20, // E020  STA $2006
+			0x4C, 0x05, 0xE0  // E023  JMP $E005
+		};
+	}
+
+	// The next of a series of synthetic states: the last one with a run of
+	// length bytes at a position that moves each time changed
+	static std::vector<uint8_t> next_state(const std::vector<uint8_t>& state, int step, size_t length)
+	{
+		std::vector<uint8_t> next = state;
+		size_t start = (step * 37) % (state.size() - length + 1);
+		for (size_t i = start; i < start + length; i++)
+		{
+			next[i] ^= (uint8_t)(step * 2 + 1);
+		}
+		return next;
+	}
+
+	static const int FRAME_PIXELS = 256 * 240;
+
+	static std::vector<uint8_t> save_state(Emulator* emulator)
+	{
+		std::vector<uint8_t> state(emulator->get_state_size());
+		Assert::AreEqual(state.size(), emulator->save_state(state.data(), state.size()));
+		return state;
+	}
+
+	// Each vblank reads pad 0 into $10, pushes it and shows it as the
+	// backdrop colour, so RAM, the stack and the frame all follow the input
+	static std::vector<uint8_t> input_echo_program()
+	{
+		return {
+			0xA2, 0xFF,       // E000  LDX #$FF
+			0x9A,             // E002  TXS
+			0xA9, 0x08,       // E003  LDA #$08
+			0x8D, 0x01, 0x20, // E005  STA $2001
+			0x2C, 0x02, 0x20, // E008  BIT $2002
+			0x10, 0xFB,       // E00B  BPL $E008
+			0xA9, 0x01,       // E00D  LDA #$01
+			0x8D, 0x16, 0x40, // E00F  STA $4016
+			0xA9, 0x00,       // E012  LDA #$00
+			0x8D, 0x16, 0x40, // E014  STA $4016
+			0xA2, 0x08,       // E017  LDX #$08
+			0xAD, 0x16, 0x40, // E019  LDA $4016
+			0x4A,             // E01C  LSR A
+			0x26, 0x10,       // E01D  ROL $10
+			0xCA,             // E01F  DEX
+			0xD0, 0xF7,       // E020  BNE $E019
+			0xA5, 0x10,       // E022  LDA $10
+			0x48,             // E024  PHA
+			0xA9, 0x3F,       // E025  LDA #$3F
+			0x8D, 0x06, 0x20, // E027  STA $2006
+			0xA9, 0x00,       // E02A  LDA #$00
+			0x8D, 0x06, 0x20, // E02C  STA $2006
+			0xA5, 0x10,       // E02F  LDA $10
+			0x29, 0x3F,       // E031  AND #$3F
+			0x8D, 0x07, 0x20, // E033  STA $2007
+			0xA9, 0x00,       // E036  LDA #$00
+			0x8D, 0x06, 0x20, // E038  STA $2006
+			0x8D, 0x06, 0x20, // E03B  STA $2006
+			0x4C, 0x08, 0xE0  // E03E  JMP $E008
+		};
+	}
+
+	static Emulator* load_test_rom(const std::vector<uint8_t>& rom)
+	{
+		Emulator* emulator = new Emulator(true);
+		emulator->load_rom(create_image(rom));
+		emulator->set_PC_to_reset_vector();
+		return emulator;
+	}
+
+	// Writes bytes to PPU memory from address on, through PPUADDR and PPUDATA
+	static void write_vram(Emulator* emulator, uint16_t address, const std::vector<uint8_t>& bytes)
+	{
+		Memory* memory = emulator->get_memory();
+		memory->read(0x2002);
+		memory->write(0x2006, address >> 8);
+		memory->write(0x2006, address & 0xFF);
+		for (size_t i = 0; i < bytes.size(); i++)
+		{
+			memory->write(0x2007, bytes[i]);
+		}
+	}
+
+	// Fills OAM through OAMADDR and OAMDATA, sprites past the ones given
+	// hidden below the screen
+	static void write_oam(Emulator* emulator, const std::vector<uint8_t>& sprites)
+	{
+		Memory* memory = emulator->get_memory();
+		memory->write(0x2003, 0);
+		for (int i = 0; i < 0x100; i++)
+		{
+			memory->write(0x2004, i < (int)sprites.size() ? sprites[i] : 0xFF);
+		}
+	}
+
+	// PPUCTRL and the scroll, taken from the next frame on, then PPUMASK
+	static void set_scroll(Emulator* emulator, uint8_t control, uint8_t x, uint8_t y, uint8_t mask)
+	{
+		Memory* memory = emulator->get_memory();
+		memory->read(0x2002);
+		memory->write(0x2000, control);
+		memory->write(0x2005, x);
+		memory->write(0x2005, y);
+		memory->write(0x2001, mask);
+	}
+
+	// A backdrop and a colour for each pixel value of background palette 0
+	// and sprite palettes 0 and 1, all different
+	static void write_test_palette(Emulator* emulator)
+	{
+		write_vram(emulator, 0x3F00, { 0x0F, 0x01, 0x21, 0x31 });
+		write_vram(emulator, 0x3F10, { 0x0F, 0x16, 0x2A, 0x30, 0x0F, 0x12, 0x1A, 0x30 });
+	}
+
+	// Sets bytes of CHR-ROM in a ROM from build_rom()
+	static void set_chr(std::vector<uint8_t>& rom, uint16_t address, const std::vector<uint8_t>& bytes)
+	{
+		size_t chr = 16 + rom[4] * 0x4000;
+		for (size_t i = 0; i < bytes.size(); i++)
+		{
+			rom[chr + address + i] = bytes[i];
+		}
+	}
+
+	static uint8_t pixel(Emulator* emulator, int x, int y)
+	{
+		return emulator->get_frame_indices()[y * 256 + x];
+	}
+
+	static const std::vector<uint8_t> IDLE_PROGRAM = { 0x4C, 0x00, 0xE0 };
+
 	TEST_CLASS(nestests)
 	{
 	public:
@@ -32,4 +482,1007 @@ namespace nestests
 			Assert::AreEqual(3, result);
 		}
 	};
-}
+	TEST_CLASS(recompiler_tests)
+	{
+	public:
+
+		// The recompiled blocks against the interpreter, over the same
+		// program from the same state
+		TEST_METHOD(RecompiledMatchesInterpreter)
+		{
+			std::vector<uint8_t> rom = differential_rom();
+			std::unique_ptr<Emulator> interpreted(load_test_rom(rom));
+			std::unique_ptr<Emulator> recompiled(load_test_rom(rom));
+
+			RecompiledCode* code = recompiled->get_recompiled_code();
+			Assert::IsTrue(code->load(&espnes_module_info, recompiled->get_cartridge()->get_prg_crc()));
+			Assert::IsTrue(code->has_block(0x8000));
+			Assert::IsFalse(interpreted->get_recompiled_code()->has_block(0x8000));
+
+			Emulator* emulators[2] = { interpreted.get(), recompiled.get() };
+			for (Emulator* emulator : emulators)
+			{
+				CPU* cpu = emulator->get_CPU();
+				for (int blocks = 0; cpu->get_PC() != DIFFERENTIAL_END; blocks++)
+				{
+					Assert::IsTrue(blocks < 100000, L"Program did not reach its end");
+					cpu->run_block(1 << 20);
+				}
+			}
+
+			CPU* a = interpreted->get_CPU();
+			CPU* b = recompiled->get_CPU();
+			Assert::AreEqual(a->get_A(), b->get_A());
+			Assert::AreEqual(a->get_X(), b->get_X());
+			Assert::AreEqual(a->get_Y(), b->get_Y());
+			Assert::AreEqual(a->get_SP(), b->get_SP());
+			Assert::AreEqual(a->get_P(), b->get_P());
+			Assert::AreEqual(a->get_total_cycles(), b->get_total_cycles());
+			Assert::AreEqual(a->get_total_instructions(), b->get_total_instructions());
+
+			for (uint16_t address = 0; address < 0x800; address++)
+			{
+				Assert::AreEqual(interpreted->get_memory()->read(address, false), recompiled->get_memory()->read(address, false));
+			}
+		}
+
+		// Writes differential_rom() to the path in ESPNES_DIFFERENTIAL_ROM, for
+		// espnes_recompiler to rebuild differential_rom.cpp from. Does
+		// nothing when it isn't set.
+		TEST_METHOD(WriteDifferentialRom)
+		{
+			char* path = nullptr;
+			size_t length = 0;
+			if (_dupenv_s(&path, &length, "ESPNES_DIFFERENTIAL_ROM") != 0 || path == nullptr)
+			{
+				return;
+			}
+
+			std::vector<uint8_t> rom = differential_rom();
+			std::ofstream file(path, std::ios::binary);
+			free(path);
+			Assert::IsTrue(file.is_open());
+			file.write(reinterpret_cast<const char*>(rom.data()), rom.size());
+			Assert::IsTrue(file.good());
+		}
+	};
+	TEST_CLASS(breakpoint_condition_tests)
+	{
+	public:
+
+		TEST_METHOD(ConditionPrecedence)
+		{
+			int64_t variables[CONDITION_VARIABLE_COUNT] = {};
+			variables[CONDITION_A] = 5;
+
+			// Left-associative, (5 - 1) - 1
+			Assert::IsTrue(evaluate_condition("a - 1 - 1 == 3", variables));
+			Assert::IsFalse(evaluate_condition("a - 1 - 1 == 5", variables));
+
+			// == binds tighter than &, a & (2 == 2) is a & 1
+			Assert::IsTrue(evaluate_condition("a & 1 == 1", variables));
+			variables[CONDITION_A] = 2;
+			Assert::IsFalse(evaluate_condition("a & 1 == 1", variables));
+			Assert::IsFalse(evaluate_condition("a & 2 == 2", variables));
+			Assert::IsTrue(evaluate_condition("(a & 2) == 2", variables));
+
+			// ! binds tighter than ==, (!a) == 1 not !(a == 1)
+			Assert::IsTrue(evaluate_condition("!a == 0", variables));
+			Assert::IsFalse(evaluate_condition("!a == 1", variables));
+			variables[CONDITION_A] = 0;
+			Assert::IsFalse(evaluate_condition("!a == 0", variables));
+			Assert::IsTrue(evaluate_condition("!a == 1", variables));
+
+			// Relational over equality, && over ||, unary minus
+			Assert::IsTrue(evaluate_condition("1 < 2 == 1", variables));
+			Assert::IsTrue(evaluate_condition("1 || 0 && 0", variables));
+			Assert::IsTrue(evaluate_condition("-a - 1 == -1", variables));
+		}
+
+		TEST_METHOD(ConditionOperatorPrefixes)
+		{
+			int64_t variables[CONDITION_VARIABLE_COUNT] = {};
+			variables[CONDITION_A] = 2;
+			variables[CONDITION_X] = 4;
+
+			// | is bitwise, || logical
+			Assert::IsTrue(evaluate_condition("(a | x) == 6", variables));
+			Assert::IsTrue(evaluate_condition("(a || x) == 1", variables));
+			Assert::IsTrue(evaluate_condition("a||x", variables));
+			Assert::IsTrue(evaluate_condition("(a&x) == 0 && (a&&x) == 1", variables));
+
+			// ! is not, != compares
+			Assert::IsTrue(evaluate_condition("a != 3", variables));
+			Assert::IsFalse(evaluate_condition("a != 2", variables));
+			Assert::IsFalse(evaluate_condition("!a", variables));
+			Assert::IsTrue(evaluate_condition("a != !x", variables));
+			Assert::IsTrue(evaluate_condition("!!a", variables));
+		}
+
+		TEST_METHOD(ConditionNumbers)
+		{
+			int64_t variables[CONDITION_VARIABLE_COUNT] = {};
+			variables[CONDITION_PC] = 0xC000;
+			variables[CONDITION_SCANLINE] = 241;
+
+			Assert::IsTrue(evaluate_condition("$1F == 31", variables));
+			Assert::IsTrue(evaluate_condition("$ff == 255", variables));
+			Assert::IsTrue(evaluate_condition("0x1f == 31", variables));
+			Assert::IsTrue(evaluate_condition("0X1F == $1F", variables));
+			Assert::IsTrue(evaluate_condition("0 == 0", variables));
+			Assert::IsTrue(evaluate_condition("PC == $C000 && Scanline >= 241", variables));
+			Assert::IsFalse(evaluate_condition("pc == 49153", variables));
+
+			// Decimal numbers stop at the first hex letter
+			Assert::AreEqual(std::string("unexpected 'f' at column 3"), condition_error("12f"));
+
+			// Nothing to check always holds
+			Assert::IsTrue(evaluate_condition("  ", variables));
+		}
+
+		TEST_METHOD(ConditionStackDepth)
+		{
+			// 1 + (1 + (... 1)) needs one stack slot per operand
+			std::string nested = "1";
+			for (int i = 1; i < BreakpointCondition::MAX_STACK; i++)
+			{
+				nested = "1 + (" + nested + ")";
+			}
+
+			int64_t variables[CONDITION_VARIABLE_COUNT] = {};
+			Assert::IsTrue(evaluate_condition(nested + " == " + std::to_string(BreakpointCondition::MAX_STACK), variables));
+
+			std::string error = condition_error("1 + (" + nested + ")");
+			Assert::IsTrue(error.find("expression is nested too deeply") == 0);
+
+			// Flat expressions reuse the stack however long they get
+			std::string flat = "1";
+			for (int i = 1; i < 100; i++)
+			{
+				flat += " + 1";
+			}
+			Assert::IsTrue(evaluate_condition(flat + " == 100", variables));
+		}
+
+		TEST_METHOD(ConditionNestingLimit)
+		{
+			// Refused while parsing, long before the recursion gets deep
+			std::string parens(100000, '(');
+			Assert::IsTrue(condition_error(parens + "1").find("expression is nested too deeply") == 0);
+
+			std::string nots(100000, '!');
+			Assert::IsTrue(condition_error(nots + "a").find("expression is nested too deeply") == 0);
+
+			std::string negates(100000, '-');
+			Assert::IsTrue(condition_error(negates + "a").find("expression is nested too deeply") == 0);
+
+			// Up to the limit is fine
+			int64_t variables[CONDITION_VARIABLE_COUNT] = {};
+			variables[CONDITION_A] = 1;
+			Assert::IsFalse(evaluate_condition(std::string(BreakpointCondition::MAX_STACK - 1, '!') + "a", variables));
+		}
+
+		TEST_METHOD(ConditionErrors)
+		{
+			Assert::AreEqual(std::string("unexpected end of condition at column 6"), condition_error("a == "));
+			Assert::AreEqual(std::string("expected a number at column 7"), condition_error("a == $"));
+			Assert::AreEqual(std::string("expected a number at column 8"), condition_error("a == 0xg"));
+			Assert::AreEqual(std::string("unexpected '#' at column 3"), condition_error("a # 1"));
+			Assert::AreEqual(std::string("missing ')' at column 8"), condition_error("(a == 1"));
+			Assert::AreEqual(std::string("unexpected ')' at column 7"), condition_error("a == 1)"));
+			Assert::AreEqual(std::string("unknown variable 'foo' at column 4"), condition_error("foo == 1"));
+			Assert::AreEqual(std::string("unexpected '|' at column 5"), condition_error("a |||| x"));
+			Assert::AreEqual(std::string(""), condition_error("a == 1"));
+		}
+	};
+	TEST_CLASS(breakpoint_tests)
+	{
+	public:
+
+		TEST_METHOD(BreakpointsArmedPerInstruction)
+		{
+			// Memory watches are left to the bus
+			Breakpoints breakpoints;
+			std::string error;
+			Assert::IsTrue(breakpoints.add(BREAKPOINT_TYPE_READ, 0x10, "", error));
+			Assert::IsTrue(breakpoints.add(BREAKPOINT_TYPE_WRITE, 0x10, "", error));
+			Assert::IsTrue(breakpoints.is_armed());
+			Assert::IsFalse(breakpoints.is_armed_per_instruction());
+
+			Assert::IsTrue(breakpoints.add(BREAKPOINT_TYPE_SCANLINE, 100, "", error));
+			Assert::IsTrue(breakpoints.is_armed_per_instruction());
+		}
+
+		TEST_METHOD(BreakpointHitsStop)
+		{
+			std::vector<uint8_t> code = {
+				0xA5, 0x10,      // E000  LDA $10
+				0x4C, 0x00, 0xE0 // E002  JMP $E000
+			};
+
+			// A read hit and then an address hit in the same step both stop
+			std::unique_ptr<Emulator> emulator(load_test_rom(build_rom(0, 2, 1, code, 0xE000)));
+			emulator->add_breakpoint(BREAKPOINT_TYPE_READ, 0x10);
+			emulator->add_breakpoint(BREAKPOINT_TYPE_ADDRESS, 0xE002);
+			emulator->run_frames(1);
+			Assert::IsTrue(emulator->is_paused());
+			Assert::AreEqual((uint16_t)0xE002, emulator->get_PC());
+
+			// Read and write watches on one INC, run in blocks, stop right after it
+			code = {
+				0xE6, 0x10,      // E000  INC $10
+				0x4C, 0x00, 0xE0 // E002  JMP $E000
+			};
+			emulator.reset(load_test_rom(build_rom(0, 2, 1, code, 0xE000)));
+			emulator->add_breakpoint(BREAKPOINT_TYPE_READ, 0x10);
+			emulator->add_breakpoint(BREAKPOINT_TYPE_WRITE, 0x10);
+			emulator->run_frames(1);
+			Assert::IsTrue(emulator->is_paused());
+			Assert::AreEqual((uint8_t)1, emulator->get_ram()[0x10]);
+
+			// pause() is still the debugger's toggle
+			emulator->pause();
+			Assert::IsFalse(emulator->is_paused());
+		}
+	};
+	TEST_CLASS(mapper_tests)
+	{
+	public:
+
+		TEST_METHOD(MMC1ShiftRegister)
+		{
+			std::shared_ptr<RomImage> image = create_image(build_rom(1, 16, 16, {}, 0xE000));
+			std::unique_ptr<Mapper> mapper = create_mapper(image);
+
+			// Powers up with the last bank fixed at $C000
+			assert_prg_banks(mapper.get(), image.get(), 0, 1, 30, 31);
+
+			// Nothing changes until the fifth write
+			for (int i = 0; i < 4; i++)
+			{
+				Assert::AreEqual(0, mapper->write(0xE000, (uint8_t)(5 >> i)));
+				assert_prg_banks(mapper.get(), image.get(), 0, 1, 30, 31);
+			}
+			Assert::AreNotEqual(0, mapper->write(0xE000, 0) & MAPPER_PRG_CHANGED);
+			assert_prg_banks(mapper.get(), image.get(), 10, 11, 30, 31);
+
+			// Bit 7 drops the bits written so far
+			mapper->write(0xE000, 1);
+			mapper->write(0xE000, 1);
+			mapper->write(0xE000, 1);
+			mapper->write(0xE000, 0x80);
+			mmc1_write(mapper.get(), 0xE000, 2);
+			assert_prg_banks(mapper.get(), image.get(), 4, 5, 30, 31);
+
+			// and goes back to the last bank fixed at $C000
+			mmc1_write(mapper.get(), 0x8000, 0x08);
+			assert_prg_banks(mapper.get(), image.get(), 0, 1, 4, 5);
+			mapper->write(0x8000, 0x80);
+			assert_prg_banks(mapper.get(), image.get(), 4, 5, 30, 31);
+		}
+
+		TEST_METHOD(MMC1PrgModes)
+		{
+			std::shared_ptr<RomImage> image = create_image(build_rom(1, 16, 16, {}, 0xE000));
+			std::unique_ptr<Mapper> mapper = create_mapper(image);
+			mmc1_write(mapper.get(), 0xE000, 5);
+
+			// 32KB, the low bit of the bank ignored
+			mmc1_write(mapper.get(), 0x8000, 0x00);
+			assert_prg_banks(mapper.get(), image.get(), 8, 9, 10, 11);
+			mmc1_write(mapper.get(), 0x8000, 0x04);
+			assert_prg_banks(mapper.get(), image.get(), 8, 9, 10, 11);
+
+			// First bank fixed at $8000
+			mmc1_write(mapper.get(), 0x8000, 0x08);
+			assert_prg_banks(mapper.get(), image.get(), 0, 1, 10, 11);
+
+			// Last bank fixed at $C000
+			mmc1_write(mapper.get(), 0x8000, 0x0C);
+			assert_prg_banks(mapper.get(), image.get(), 10, 11, 30, 31);
+
+			// The low bits of control pick the mirroring
+			Assert::AreEqual((int)MIRRORING_SINGLE_LOWER, (int)mapper->get_mirroring());
+			mmc1_write(mapper.get(), 0x8000, 0x0D);
+			Assert::AreEqual((int)MIRRORING_SINGLE_UPPER, (int)mapper->get_mirroring());
+			mmc1_write(mapper.get(), 0x8000, 0x0E);
+			Assert::AreEqual((int)MIRRORING_VERTICAL, (int)mapper->get_mirroring());
+			mmc1_write(mapper.get(), 0x8000, 0x0F);
+			Assert::AreEqual((int)MIRRORING_HORIZONTAL, (int)mapper->get_mirroring());
+		}
+
+		TEST_METHOD(MMC1ChrModes)
+		{
+			std::shared_ptr<RomImage> image = create_image(build_rom(1, 16, 16, {}, 0xE000));
+			std::unique_ptr<Mapper> mapper = create_mapper(image);
+			mmc1_write(mapper.get(), 0xA000, 3);
+			mmc1_write(mapper.get(), 0xC000, 9);
+
+			// Two 4KB banks
+			mmc1_write(mapper.get(), 0x8000, 0x1C);
+			assert_chr_banks(mapper.get(), image.get(), { 12, 13, 14, 15, 36, 37, 38, 39 });
+
+			// One 8KB bank, the low bit of the first register ignored
+			mmc1_write(mapper.get(), 0x8000, 0x0C);
+			assert_chr_banks(mapper.get(), image.get(), { 8, 9, 10, 11, 12, 13, 14, 15 });
+		}
+
+		TEST_METHOD(UxROMBanks)
+		{
+			std::shared_ptr<RomImage> image = create_image(build_rom(2, 8, 1, {}, 0xE000));
+			std::unique_ptr<Mapper> mapper = create_mapper(image);
+			assert_prg_banks(mapper.get(), image.get(), 0, 1, 14, 15);
+
+			// Any address selects the bank at $8000, out of range banks wrap
+			Assert::AreEqual(MAPPER_PRG_CHANGED, mapper->write(0x8000, 3));
+			assert_prg_banks(mapper.get(), image.get(), 6, 7, 14, 15);
+			mapper->write(0xFFFF, 9);
+			assert_prg_banks(mapper.get(), image.get(), 2, 3, 14, 15);
+		}
+
+		TEST_METHOD(CNROMBanks)
+		{
+			std::shared_ptr<RomImage> image = create_image(build_rom(3, 2, 4, {}, 0xE000));
+			std::unique_ptr<Mapper> mapper = create_mapper(image);
+			assert_chr_banks(mapper.get(), image.get(), { 0, 1, 2, 3, 4, 5, 6, 7 });
+
+			// CHR switches in 8KB, PRG stays put
+			Assert::AreEqual(MAPPER_CHR_CHANGED, mapper->write(0xC123, 2));
+			assert_chr_banks(mapper.get(), image.get(), { 16, 17, 18, 19, 20, 21, 22, 23 });
+			assert_prg_banks(mapper.get(), image.get(), 0, 1, 2, 3);
+		}
+
+		TEST_METHOD(MMC3BankSelect)
+		{
+			std::shared_ptr<RomImage> image = create_image(build_rom(4, 16, 32, {}, 0xE000));
+			std::unique_ptr<Mapper> mapper = create_mapper(image);
+			assert_prg_banks(mapper.get(), image.get(), 0, 1, 30, 31);
+			assert_chr_banks(mapper.get(), image.get(), { 0, 1, 2, 3, 4, 5, 6, 7 });
+
+			// R6 and R7, through mirrors of the registers
+			mapper->write(0x8000, 6);
+			mapper->write(0x8001, 5);
+			mapper->write(0x9FFE, 7);
+			mapper->write(0x9FFF, 9);
+			assert_prg_banks(mapper.get(), image.get(), 5, 9, 30, 31);
+
+			// Bit 6 swaps R6 with the second-to-last bank
+			mapper->write(0x8000, 0x40);
+			assert_prg_banks(mapper.get(), image.get(), 30, 9, 5, 31);
+
+			// R0 and R1 are 2KB, ignoring their low bit
+			uint8_t chr[6] = { 0x11, 0x20, 0x40, 0x41, 0x42, 0x43 };
+			for (int i = 0; i < 6; i++)
+			{
+				mapper->write(0x8000, (uint8_t)i);
+				mapper->write(0x8001, chr[i]);
+			}
+			assert_chr_banks(mapper.get(), image.get(), { 0x10, 0x11, 0x20, 0x21, 0x40, 0x41, 0x42, 0x43 });
+
+			// Bit 7 swaps the halves
+			mapper->write(0x8000, 0x80);
+			assert_chr_banks(mapper.get(), image.get(), { 0x40, 0x41, 0x42, 0x43, 0x10, 0x11, 0x20, 0x21 });
+
+			Assert::AreEqual(MAPPER_MIRRORING_CHANGED, mapper->write(0xA000, 1));
+			Assert::AreEqual((int)MIRRORING_HORIZONTAL, (int)mapper->get_mirroring());
+			mapper->write(0xA000, 0);
+			Assert::AreEqual((int)MIRRORING_VERTICAL, (int)mapper->get_mirroring());
+		}
+
+		TEST_METHOD(MMC3IrqReload)
+		{
+			std::shared_ptr<RomImage> image = create_image(build_rom(4, 16, 32, {}, 0xE000));
+			std::unique_ptr<Mapper> mapper = create_mapper(image);
+			Assert::AreEqual(-1, mapper->get_scanlines_to_irq());
+
+			// The first clock loads the latch, the IRQ comes as it reaches 0
+			mapper->write(0xC000, 3);
+			mapper->write(0xC001, 0);
+			mapper->write(0xE001, 0);
+			Assert::AreEqual(4, mapper->get_scanlines_to_irq());
+			for (int i = 0; i < 3; i++)
+			{
+				mapper->clock_scanline();
+				Assert::IsFalse(mapper->get_irq());
+			}
+			mapper->clock_scanline();
+			Assert::IsTrue(mapper->get_irq());
+
+			// Disabling acknowledges
+			mapper->write(0xE000, 0);
+			Assert::IsFalse(mapper->get_irq());
+			Assert::AreEqual(-1, mapper->get_scanlines_to_irq());
+
+			// A reload mid-count starts over from the latch on the next clock
+			mapper->write(0xE001, 0);
+			mapper->clock_scanline();
+			mapper->clock_scanline();
+			Assert::AreEqual(2, mapper->get_scanlines_to_irq());
+			mapper->write(0xC001, 0);
+			Assert::AreEqual(4, mapper->get_scanlines_to_irq());
+			for (int i = 0; i < 4; i++)
+			{
+				Assert::IsFalse(mapper->get_irq());
+				mapper->clock_scanline();
+			}
+			Assert::IsTrue(mapper->get_irq());
+		}
+
+		// The PPU clocks the counter once per rendered line, as A12 rises
+		TEST_METHOD(MMC3A12Clocking)
+		{
+			// Rendering, 101 lines is well inside the first frame
+			std::unique_ptr<Emulator> emulator(load_test_rom(build_rom(4, 16, 32, mmc3_irq_program(100, 0x18), 0xE000)));
+			emulator->run_frames(1);
+			Assert::IsTrue(emulator->get_cartridge()->get_irq());
+
+			// 251 lines takes into the second
+			emulator.reset(load_test_rom(build_rom(4, 16, 32, mmc3_irq_program(250, 0x18), 0xE000)));
+			emulator->run_frames(1);
+			Assert::IsFalse(emulator->get_cartridge()->get_irq());
+			emulator->run_frames(1);
+			Assert::IsTrue(emulator->get_cartridge()->get_irq());
+
+			// A12 doesn't move with rendering off
+			emulator.reset(load_test_rom(build_rom(4, 16, 32, mmc3_irq_program(100, 0x00), 0xE000)));
+			emulator->run_frames(3);
+			Assert::IsFalse(emulator->get_cartridge()->get_irq());
+		}
+	};
+	TEST_CLASS(save_state_tests)
+	{
+	public:
+
+		TEST_METHOD(SaveStateRoundTrip)
+		{
+			std::vector<uint8_t> rom = build_rom(0, 2, 1, palette_cycle_program(), 0xE000);
+			std::unique_ptr<Emulator> original(load_test_rom(rom));
+			original->run_frames(10);
+			std::vector<uint8_t> state = save_state(original.get());
+
+			std::unique_ptr<Emulator> restored(load_test_rom(rom));
+			Assert::IsTrue(restored->load_state(state.data(), state.size()));
+
+			// The MachineState comes first and is copied as it is
+			std::vector<uint8_t> saved_again = save_state(restored.get());
+			Assert::AreEqual(0, memcmp(state.data() + sizeof(SaveStateHeader), saved_again.data() + sizeof(SaveStateHeader), sizeof(MachineState)));
+			Assert::IsTrue(state == saved_again);
+
+			// Both carry on the same way
+			for (int frame = 0; frame < 5; frame++)
+			{
+				std::vector<uint8_t> before(original->get_frame_indices(), original->get_frame_indices() + FRAME_PIXELS);
+				original->run_frames(1);
+				restored->run_frames(1);
+				Assert::AreEqual(0, memcmp(original->get_frame_indices(), restored->get_frame_indices(), FRAME_PIXELS));
+				Assert::AreNotEqual(0, memcmp(original->get_frame_indices(), before.data(), FRAME_PIXELS));
+			}
+			Assert::IsTrue(save_state(original.get()) == save_state(restored.get()));
+		}
+
+		TEST_METHOD(SaveStateRejectsMismatches)
+		{
+			std::vector<uint8_t> rom = build_rom(0, 2, 1, palette_cycle_program(), 0xE000);
+			std::unique_ptr<Emulator> emulator(load_test_rom(rom));
+			emulator->run_frames(3);
+			std::vector<uint8_t> state = save_state(emulator.get());
+			emulator->run_frames(1);
+			std::vector<uint8_t> current = save_state(emulator.get());
+
+			// Another version of the format
+			std::vector<uint8_t> version = state;
+			uint32_t other_version = SAVE_STATE_VERSION + 1;
+			memcpy(&version[offsetof(SaveStateHeader, version)], &other_version, sizeof(other_version));
+			Assert::IsFalse(emulator->load_state(version.data(), version.size()));
+
+			// Another ROM, one byte of PRG different
+			std::vector<uint8_t> other_rom = rom;
+			other_rom[16 + 0x1000] ^= 0xFF;
+			std::unique_ptr<Emulator> other(load_test_rom(other_rom));
+			other->run_frames(3);
+			std::vector<uint8_t> other_state = save_state(other.get());
+			Assert::IsFalse(emulator->load_state(other_state.data(), other_state.size()));
+
+			// Cut short
+			Assert::IsFalse(emulator->load_state(state.data(), state.size() - 1));
+
+			// Refused states leave the machine alone
+			Assert::IsTrue(save_state(emulator.get()) == current);
+			Assert::IsTrue(emulator->load_state(state.data(), state.size()));
+			Assert::IsTrue(save_state(emulator.get()) == state);
+		}
+	};
+	TEST_CLASS(rewind_buffer_tests)
+	{
+	public:
+
+		TEST_METHOD(RewindWrapsAndEvicts)
+		{
+			// Deltas of 42-61 bytes, so 256 bytes hold four or five and they
+			// wrap round the ring
+			RewindBuffer buffer;
+			buffer.allocate(256, 128);
+			std::vector<std::vector<uint8_t>> history(1, std::vector<uint8_t>(128, 0));
+			buffer.push(history[0].data());
+
+			for (int step = 1; step < 40; step++)
+			{
+				history.push_back(next_state(history.back(), step, 40 + step % 20));
+				buffer.push(history.back().data());
+				Assert::IsTrue(buffer.get_count() > 0);
+				Assert::IsTrue(buffer.get_count() < 6);
+				Assert::IsTrue(buffer.get_used() <= buffer.get_capacity());
+			}
+
+			// Step back one at a time through what was kept
+			int count = buffer.get_count();
+			size_t used = buffer.get_used();
+			for (int steps = 1; steps <= count; steps++)
+			{
+				const uint8_t* state = buffer.rewind(1);
+				Assert::AreEqual(0, memcmp(state, history[history.size() - 1 - steps].data(), 128));
+				Assert::AreEqual(count - steps, buffer.get_count());
+				Assert::IsTrue(buffer.get_used() < used);
+				used = buffer.get_used();
+			}
+			Assert::AreEqual((size_t)0, buffer.get_used());
+
+			// Nothing older is left, the oldest kept state stays
+			const uint8_t* oldest = buffer.rewind(1);
+			Assert::AreEqual(0, memcmp(oldest, history[history.size() - 1 - count].data(), 128));
+		}
+
+		TEST_METHOD(RewindThenPush)
+		{
+			RewindBuffer buffer;
+			buffer.allocate(256, 128);
+			std::vector<std::vector<uint8_t>> history(1, std::vector<uint8_t>(128, 0));
+			buffer.push(history[0].data());
+			for (int step = 1; step < 30; step++)
+			{
+				history.push_back(next_state(history.back(), step, 40 + step % 20));
+				buffer.push(history.back().data());
+			}
+
+			// Several steps at once, and history continues from there
+			int count = buffer.get_count();
+			const uint8_t* state = buffer.rewind(2);
+			Assert::AreEqual(count - 2, buffer.get_count());
+			history.resize(history.size() - 2);
+			Assert::AreEqual(0, memcmp(state, history.back().data(), 128));
+
+			for (int step = 100; step < 130; step++)
+			{
+				history.push_back(next_state(history.back(), step, 40 + step % 20));
+				buffer.push(history.back().data());
+				Assert::IsTrue(buffer.get_used() <= buffer.get_capacity());
+			}
+
+			count = buffer.get_count();
+			Assert::IsTrue(count > 2);
+			state = buffer.rewind(count - 1);
+			Assert::AreEqual(1, buffer.get_count());
+			Assert::AreEqual(0, memcmp(state, history[history.size() - count].data(), 128));
+			state = buffer.rewind(1);
+			Assert::AreEqual(0, buffer.get_count());
+			Assert::AreEqual((size_t)0, buffer.get_used());
+			Assert::AreEqual(0, memcmp(state, history[history.size() - 1 - count].data(), 128));
+		}
+
+		TEST_METHOD(RewindLimits)
+		{
+			// Small deltas run out of snapshot slots, one per 32 bytes,
+			// before they run out of ring
+			RewindBuffer buffer;
+			buffer.allocate(256, 128);
+			std::vector<uint8_t> state(128, 0);
+			buffer.push(state.data());
+			for (int step = 1; step < 100; step++)
+			{
+				state = next_state(state, step, 1);
+				buffer.push(state.data());
+			}
+			Assert::AreEqual(8, buffer.get_count());
+			Assert::AreEqual((size_t)(8 * 3), buffer.get_used());
+
+			// A delta bigger than the ring drops everything before it
+			std::vector<uint8_t> changed(128, 0);
+			for (size_t i = 0; i < changed.size(); i++)
+			{
+				changed[i] = (uint8_t)(state[i] ^ (0x55 + i));
+			}
+			buffer.allocate(64, 128);
+			buffer.push(state.data());
+			buffer.push(changed.data());
+			Assert::AreEqual(0, buffer.get_count());
+			Assert::AreEqual(0, memcmp(buffer.rewind(1), changed.data(), 128));
+
+			// Nothing to go back to
+			buffer.clear();
+			Assert::IsNull(buffer.rewind(1));
+		}
+	};
+	TEST_CLASS(emulator_pool_tests)
+	{
+	public:
+
+		TEST_METHOD(PoolMatchesSingleEmulators)
+		{
+			const int size = 7;
+			const int steps = 12;
+			std::vector<uint8_t> rom = build_rom(0, 2, 1, input_echo_program(), 0xE000);
+			std::shared_ptr<RomImage> image = create_image(rom);
+
+			// Fewer threads than instances, so slices get stolen from
+			EmulatorPool pool(size, 3, POOL_OBSERVE_FRAME | POOL_OBSERVE_RAM | POOL_OBSERVE_INDICES);
+			pool.load_rom(image);
+
+			uint32_t seed = 0x6C8E9CF5;
+			auto next_inputs = [&seed]()
+			{
+				std::vector<uint8_t> inputs(size * 2);
+				for (size_t i = 0; i < inputs.size(); i++)
+				{
+					seed = seed * 1103515245 + 12345;
+					inputs[i] = (uint8_t)(seed >> 16);
+				}
+				return inputs;
+			};
+
+			std::vector<std::vector<uint8_t>> history;
+			for (int step = 0; step < steps; step++)
+			{
+				history.push_back(next_inputs());
+			}
+
+			auto assert_matches = [&]()
+			{
+				for (int i = 0; i < size; i++)
+				{
+					std::unique_ptr<Emulator> single(load_test_rom(rom));
+					for (int step = 0; step < steps; step++)
+					{
+						single->set_buttons(0, history[step][i * 2]);
+						single->set_buttons(1, history[step][i * 2 + 1]);
+						single->run_frames(1);
+					}
+
+					const uint8_t* ram = pool.get_ram() + i * EmulatorPool::RAM_SIZE;
+					Assert::AreEqual(0, memcmp(single->get_ram(), ram, EmulatorPool::RAM_SIZE));
+					Assert::AreEqual(0, memcmp(single->get_frame_buffer(), pool.get_frames() + (size_t)i * EmulatorPool::FRAME_SIZE, EmulatorPool::FRAME_SIZE));
+					Assert::AreEqual(0, memcmp(single->get_frame_indices(), pool.get_frame_indices() + (size_t)i * EmulatorPool::INDEX_FRAME_SIZE,
+						EmulatorPool::INDEX_FRAME_SIZE));
+
+					// The stack is in the RAM slice, as the bus and its mirrors see it
+					Assert::AreEqual(single->get_memory()->read(0x01FF, false), ram[0x1FF]);
+					Assert::AreEqual(single->get_memory()->read(0x09FF, false), ram[0x1FF]);
+					Assert::AreEqual(ram[0x10], ram[0x100 + (uint8_t)(single->get_CPU()->get_SP() + 1)]);
+				}
+
+				// Different inputs made different machines
+				for (int i = 1; i < size; i++)
+				{
+					Assert::AreNotEqual(0, memcmp(pool.get_ram(), pool.get_ram() + i * EmulatorPool::RAM_SIZE, EmulatorPool::RAM_SIZE));
+				}
+			};
+
+			for (int step = 0; step < steps; step++)
+			{
+				pool.step(history[step].data());
+			}
+			assert_matches();
+
+			// reset() goes back to the machines load_rom() left, RAM and all
+			for (int step = 0; step < steps; step++)
+			{
+				pool.step(next_inputs().data(), 2);
+			}
+			pool.reset();
+			for (int step = 0; step < steps; step++)
+			{
+				pool.step(history[step].data());
+			}
+			assert_matches();
+		}
+	};
+	TEST_CLASS(tile_decoder_tests)
+	{
+	public:
+
+		// Every kernel the host can run against a plain loop, on random input
+		TEST_METHOD(KernelsMatchScalar)
+		{
+			uint32_t seed = 0x1B873593;
+			auto next = [&seed]()
+			{
+				seed ^= seed << 13;
+				seed ^= seed >> 17;
+				seed ^= seed << 5;
+				return seed;
+			};
+
+			// Not a multiple of 32, so wide kernels finish with their tail
+			const int color_count = 8 * 41;
+			const int index_count = 32 * 9;
+
+			std::vector<uint32_t> colors(64);
+			for (size_t i = 0; i < colors.size(); i++)
+			{
+				colors[i] = next();
+			}
+			std::vector<uint8_t> table(32);
+			for (size_t i = 0; i < table.size(); i++)
+			{
+				table[i] = (uint8_t)next();
+			}
+
+			std::vector<uint8_t> color_indices(color_count);
+			std::vector<uint32_t> expected_colors(color_count);
+			for (int i = 0; i < color_count; i++)
+			{
+				color_indices[i] = (uint8_t)(next() % 64);
+				expected_colors[i] = colors[color_indices[i]];
+			}
+			std::vector<uint8_t> table_indices(index_count);
+			std::vector<uint8_t> expected_bytes(index_count);
+			for (int i = 0; i < index_count; i++)
+			{
+				table_indices[i] = (uint8_t)(next() % 32);
+				expected_bytes[i] = table[table_indices[i]];
+			}
+
+			TileKernel selected = TileDecoder::get_kernel();
+			const TileKernel kernels[] = { TILE_KERNEL_SCALAR, TILE_KERNEL_AVX2 };
+			for (TileKernel kernel : kernels)
+			{
+				if (!TileDecoder::set_kernel(kernel))
+				{
+					Assert::AreNotEqual((int)TILE_KERNEL_SCALAR, (int)kernel);
+					continue;
+				}
+				Assert::AreEqual((int)kernel, (int)TileDecoder::get_kernel());
+
+				std::vector<uint32_t> pixels(color_count);
+				TileDecoder::lookup_colors(color_indices.data(), color_count, colors.data(), pixels.data());
+				Assert::IsTrue(pixels == expected_colors);
+
+				std::vector<uint8_t> bytes(index_count);
+				TileDecoder::lookup_indices(table_indices.data(), index_count, table.data(), bytes.data());
+				Assert::IsTrue(bytes == expected_bytes);
+			}
+			Assert::IsTrue(TileDecoder::set_kernel(selected));
+		}
+	};
+	TEST_CLASS(ppu_tests)
+	{
+	public:
+
+		TEST_METHOD(SpriteRendering)
+		{
+			// Tile 1 has only the left half of its top row, in colour 1.
+			// Tile 2 is solid colour 2.
+			std::vector<uint8_t> rom = build_rom(0, 2, 1, IDLE_PROGRAM, 0xE000);
+			set_chr(rom, 0x0010, { 0xF0 });
+			set_chr(rom, 0x0028, { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF });
+			std::unique_ptr<Emulator> emulator(load_test_rom(rom));
+
+			write_test_palette(emulator.get());
+
+			// Solid background under tiles 8 and 9 of row 4
+			write_vram(emulator.get(), 0x2088, { 0x02, 0x02 });
+
+			std::vector<uint8_t> sprites = {
+				9, 1, 0x00, 16,   // Plain
+				9, 1, 0x40, 32,   // Flipped horizontally
+				9, 1, 0x80, 48,   // Flipped vertically
+				31, 2, 0x20, 64,  // Behind the background
+				31, 2, 0x00, 72,  // In front of it
+				49, 2, 0x01, 100, // Overlapping, palette 1 first in OAM
+				49, 2, 0x00, 104,
+				139, 2, 0x00, 0   // In the left column
+			};
+
+			// Nine on lines 100-107
+			for (int i = 0; i < 9; i++)
+			{
+				std::vector<uint8_t> sprite = { 99, 2, 0x00, (uint8_t)(120 + i * 8) };
+				sprites.insert(sprites.end(), sprite.begin(), sprite.end());
+			}
+			write_oam(emulator.get(), sprites);
+			set_scroll(emulator.get(), 0x00, 0, 0, 0x1E);
+			emulator->run_frames(2);
+
+			// A sprite is drawn from the line after its Y
+			Assert::AreEqual((uint8_t)0x0F, pixel(emulator.get(), 16, 9));
+			Assert::AreEqual((uint8_t)0x16, pixel(emulator.get(), 16, 10));
+			Assert::AreEqual((uint8_t)0x16, pixel(emulator.get(), 19, 10));
+			Assert::AreEqual((uint8_t)0x0F, pixel(emulator.get(), 20, 10));
+			Assert::AreEqual((uint8_t)0x0F, pixel(emulator.get(), 16, 11));
+
+			Assert::AreEqual((uint8_t)0x0F, pixel(emulator.get(), 35, 10));
+			Assert::AreEqual((uint8_t)0x16, pixel(emulator.get(), 36, 10));
+			Assert::AreEqual((uint8_t)0x16, pixel(emulator.get(), 39, 10));
+
+			Assert::AreEqual((uint8_t)0x0F, pixel(emulator.get(), 48, 10));
+			Assert::AreEqual((uint8_t)0x16, pixel(emulator.get(), 48, 17));
+			Assert::AreEqual((uint8_t)0x0F, pixel(emulator.get(), 52, 17));
+
+			// Priority against the background, then between sprites
+			Assert::AreEqual((uint8_t)0x21, pixel(emulator.get(), 64, 32));
+			Assert::AreEqual((uint8_t)0x21, pixel(emulator.get(), 71, 39));
+			Assert::AreEqual((uint8_t)0x2A, pixel(emulator.get(), 72, 32));
+			Assert::AreEqual((uint8_t)0x1A, pixel(emulator.get(), 100, 50));
+			Assert::AreEqual((uint8_t)0x1A, pixel(emulator.get(), 107, 50));
+			Assert::AreEqual((uint8_t)0x2A, pixel(emulator.get(), 108, 50));
+
+			// Eight sprites on a line, and the overflow flag for the ninth
+			Assert::AreEqual((uint8_t)0x2A, pixel(emulator.get(), 120, 100));
+			Assert::AreEqual((uint8_t)0x2A, pixel(emulator.get(), 183, 107));
+			Assert::AreEqual((uint8_t)0x0F, pixel(emulator.get(), 184, 100));
+			Assert::AreNotEqual(0, emulator->get_memory()->read(0x2002, false) & 0x20);
+
+			Assert::AreEqual((uint8_t)0x2A, pixel(emulator.get(), 0, 140));
+			Assert::AreEqual((uint8_t)0x2A, pixel(emulator.get(), 7, 140));
+
+			// Without the ninth the flag stays clear, and with the left column
+			// clipped the sprite there goes
+			emulator->get_memory()->write(0x2003, 16 * 4);
+			emulator->get_memory()->write(0x2004, 0xFF);
+			emulator->get_memory()->write(0x2001, 0x1A);
+			emulator->run_frames(1);
+			Assert::AreEqual(0, emulator->get_memory()->read(0x2002, false) & 0x20);
+			Assert::AreEqual((uint8_t)0x2A, pixel(emulator.get(), 176, 100));
+			Assert::AreEqual((uint8_t)0x0F, pixel(emulator.get(), 0, 140));
+			Assert::AreEqual((uint8_t)0x0F, pixel(emulator.get(), 7, 140));
+		}
+
+		TEST_METHOD(TallSprites)
+		{
+			// Tile 3 picks tiles 2 and 3 of the $1000 table: the top row of the
+			// upper one in colour 1, the bottom row of the lower in colour 2
+			std::vector<uint8_t> rom = build_rom(0, 2, 1, IDLE_PROGRAM, 0xE000);
+			set_chr(rom, 0x1020, { 0xFF });
+			set_chr(rom, 0x103F, { 0xFF });
+			std::unique_ptr<Emulator> emulator(load_test_rom(rom));
+
+			write_test_palette(emulator.get());
+			write_oam(emulator.get(), {
+				59, 3, 0x00, 40,
+				59, 3, 0x80, 80
+			});
+			set_scroll(emulator.get(), 0x20, 0, 0, 0x1E);
+			emulator->run_frames(2);
+
+			Assert::AreEqual((uint8_t)0x16, pixel(emulator.get(), 40, 60));
+			Assert::AreEqual((uint8_t)0x0F, pixel(emulator.get(), 40, 61));
+			Assert::AreEqual((uint8_t)0x2A, pixel(emulator.get(), 47, 75));
+			Assert::AreEqual((uint8_t)0x0F, pixel(emulator.get(), 40, 76));
+
+			// Flipped vertically the halves swap as well as the rows
+			Assert::AreEqual((uint8_t)0x2A, pixel(emulator.get(), 80, 60));
+			Assert::AreEqual((uint8_t)0x16, pixel(emulator.get(), 80, 75));
+		}
+
+		// The flag goes up at dot X + 1 of line Y + 1, and code polling for it
+		// sees it then whether it runs in blocks that skip the idle loop or
+		// an instruction at a time
+		TEST_METHOD(Sprite0HitTiming)
+		{
+			std::vector<uint8_t> code = {
+				0x2C, 0x02, 0x20, // E000  BIT $2002
+				0x10, 0xFB,       // E003  BPL $E000
+				0xA9, 0x1E,       // E005  LDA #$1E
+				0x8D, 0x01, 0x20, // E007  STA $2001
+				0x2C, 0x02, 0x20, // E00A  BIT $2002
+				0x50, 0xFB,       // E00D  BVC $E00A
+				0xAD, 0x00, 0x03, // E00F  LDA $0300
+				0x4C, 0x12, 0xE0  // E012  JMP $E012
+			};
+			std::vector<uint8_t> rom = build_rom(0, 2, 1, code, 0xE000);
+			set_chr(rom, 0x0028, { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF });
+
+			int positions[2][2];
+			for (int stepped = 0; stepped < 2; stepped++)
+			{
+				std::unique_ptr<Emulator> emulator(load_test_rom(rom));
+				write_vram(emulator.get(), 0x2000, std::vector<uint8_t>(960, 0x02));
+				write_oam(emulator.get(), { 50, 2, 0x00, 100 });
+				set_scroll(emulator.get(), 0x00, 0, 0, 0x00);
+
+				// The read after the loop stops it. An address breakpoint that
+				// never hits makes it run an instruction at a time.
+				emulator->add_breakpoint(BREAKPOINT_TYPE_READ, 0x0300);
+				if (stepped)
+				{
+					emulator->add_breakpoint(BREAKPOINT_TYPE_ADDRESS, 0x0000);
+				}
+				emulator->run_frames(2);
+				Assert::IsTrue(emulator->is_paused());
+
+				PPU* ppu = emulator->get_PPU();
+				ppu->catch_up();
+				Assert::AreEqual(1, ppu->get_frame());
+				Assert::AreNotEqual(0, emulator->get_memory()->read(0x2002, false) & 0x40);
+				positions[stepped][0] = ppu->get_scanline();
+				positions[stepped][1] = ppu->get_cycle();
+			}
+
+			// Within one pass of the loop and the load after it
+			Assert::AreEqual(51, positions[0][0]);
+			Assert::IsTrue(positions[0][1] > 101);
+			Assert::IsTrue(positions[0][1] <= 101 + (4 + 3 + 2 + 4) * 3);
+			Assert::AreEqual(positions[0][0], positions[1][0]);
+			Assert::AreEqual(positions[0][1], positions[1][1]);
+		}
+
+		TEST_METHOD(BackgroundScroll)
+		{
+			std::vector<uint8_t> rom = build_rom(0, 2, 1, IDLE_PROGRAM, 0xE000);
+			set_chr(rom, 0x0028, { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF });
+
+			// Vertical mirroring, so $2400 is a nametable of its own
+			rom[6] |= 0x01;
+			std::unique_ptr<Emulator> emulator(load_test_rom(rom));
+
+			write_test_palette(emulator.get());
+			write_vram(emulator.get(), 0x2043, { 0x02 });
+			write_vram(emulator.get(), 0x2400, { 0x02 });
+
+			// Tile 3 of row 2 moved up and left by fine and coarse amounts
+			set_scroll(emulator.get(), 0x00, 5, 3, 0x0A);
+			emulator->run_frames(2);
+			Assert::AreEqual((uint8_t)0x21, pixel(emulator.get(), 19, 13));
+			Assert::AreEqual((uint8_t)0x21, pixel(emulator.get(), 26, 20));
+			Assert::AreEqual((uint8_t)0x0F, pixel(emulator.get(), 18, 13));
+			Assert::AreEqual((uint8_t)0x0F, pixel(emulator.get(), 27, 20));
+			Assert::AreEqual((uint8_t)0x0F, pixel(emulator.get(), 19, 12));
+			Assert::AreEqual((uint8_t)0x0F, pixel(emulator.get(), 19, 21));
+
+			// Scrolled across into the nametable to the right
+			set_scroll(emulator.get(), 0x00, 250, 0, 0x0A);
+			emulator->run_frames(1);
+			Assert::AreEqual((uint8_t)0x0F, pixel(emulator.get(), 5, 0));
+			Assert::AreEqual((uint8_t)0x21, pixel(emulator.get(), 6, 0));
+			Assert::AreEqual((uint8_t)0x21, pixel(emulator.get(), 13, 7));
+			Assert::AreEqual((uint8_t)0x0F, pixel(emulator.get(), 14, 0));
+
+			// Or started there through PPUCTRL
+			set_scroll(emulator.get(), 0x01, 0, 0, 0x0A);
+			emulator->run_frames(1);
+			Assert::AreEqual((uint8_t)0x21, pixel(emulator.get(), 0, 0));
+			Assert::AreEqual((uint8_t)0x0F, pixel(emulator.get(), 8, 0));
+		}
+
+		TEST_METHOD(TileCacheFollowsChr)
+		{
+			// CHR-RAM written through PPUDATA shows on the next frame
+			std::unique_ptr<Emulator> emulator(load_test_rom(build_rom(0, 2, 0, IDLE_PROGRAM, 0xE000)));
+			write_test_palette(emulator.get());
+			set_scroll(emulator.get(), 0x00, 0, 0, 0x0A);
+			emulator->run_frames(2);
+			Assert::AreEqual((uint8_t)0x0F, pixel(emulator.get(), 100, 100));
+
+			write_vram(emulator.get(), 0x0008, { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF });
+			set_scroll(emulator.get(), 0x00, 0, 0, 0x0A);
+			emulator->run_frames(1);
+			Assert::AreEqual((uint8_t)0x21, pixel(emulator.get(), 100, 100));
+
+			// A CNROM bank switch to tiles that differ, and back
+			std::vector<uint8_t> rom = build_rom(3, 2, 2, IDLE_PROGRAM, 0xE000);
+			set_chr(rom, 0x2008, { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF });
+			emulator.reset(load_test_rom(rom));
+			write_test_palette(emulator.get());
+			set_scroll(emulator.get(), 0x00, 0, 0, 0x0A);
+			emulator->run_frames(2);
+			Assert::AreEqual((uint8_t)0x0F, pixel(emulator.get(), 100, 100));
+
+			emulator->get_memory()->write(0x8000, 1);
+			emulator->run_frames(1);
+			Assert::AreEqual((uint8_t)0x21, pixel(emulator.get(), 100, 100));
+
+			emulator->get_memory()->write(0x8000, 0);
+			emulator->run_frames(1);
+			Assert::AreEqual((uint8_t)0x0F, pixel(emulator.get(), 100, 100));
+		}
+	};
+}
\ No newline at end of file